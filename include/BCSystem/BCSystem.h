@@ -272,7 +272,7 @@ private:
      * assemble local residual to the global RHS
      * @param t_dofs the number of dofs for current bc element
      * @param t_dofids the local dof ids
-     * @param I the node index, global one
+     * @param I the local node index
      * @param jxw the jacobian*weight value
      * @param t_dofhandler the dofhandler class
      * @param t_localR the local residual vector
@@ -287,8 +287,8 @@ private:
      * assemble local residual to the global RHS
      * @param t_dofs the number of dofs for current bc element
      * @param t_dofids the local dof ids
-     * @param I the node i-index, global one
-     * @param J the node j-index, global one
+     * @param I the local node i-index
+     * @param J the local node j-index
      * @param jxw the jacobian*weight value
      * @param t_dofhandler the dofhandler class
      * @param t_localK the local K matrix
@@ -319,6 +319,7 @@ private:
     int m_bcelmt_nodesnum;/**< the nodes number of the bc element */
     Nodes m_nodes;/**< for the nodal coordinates of current bc element (current configuration) */
     Nodes m_nodes0;/**< for the nodal coordinates of current bc element (reference configuration) */
+    vector<int> m_localnodeids;/**< the local node ids of current bc element, they index the nodal dofs map directly */
 
     LocalElmtInfo m_local_elmtinfo;/**< for the local element information */
     LocalElmtSolution m_local_elmtsoln;/**< for the local element solution */
@@ -19,13 +19,16 @@
 #include <iomanip>
 #include <string>
 #include <vector>
+#include <algorithm>
 
 /**
  * for AsFem's header files
  */
 #include "Utils/MessagePrinter.h"
 #include "Mesh/Mesh.h"
+#include "Mesh/ElmtConnectivity.h"
 #include "ElmtSystem/ElmtSystem.h"
+#include "DofHandler/DofRenumberType.h"
 
 using std::vector;
 using std::string;
@@ -53,7 +56,8 @@ public:
      */
     void init();
     /**
-     * create the bulk elements' dofs map
+     * create the bulk elements' dofs map, if the mesh is distributed, each processor only numbers the dofs of its own
+     * nodes, see createDistributedBulkDofsMap
      * @param t_mesh the mesh class
      * @param t_elmtSystem the element class
      */
@@ -63,6 +67,16 @@ public:
      * @param dofname string for the name of one single dof
      */
     void addDofName2List(const string &dofname);
+    /**
+     * set the renumbering method of the active dofs, it must be called before createBulkDofsMap
+     * @param t_type the node ordering method
+     */
+    void setDofsRenumberType(const DofRenumberType &t_type){m_renumber_type=t_type;}
+    /**
+     * set the flag for the field-blocked dofs ordering, if false, the dofs of one node are numbered together
+     * @param flag true if all the dofs of one field are numbered before the next field
+     */
+    void setFieldBlockedDofsFlag(const bool &flag){m_isfieldblocked=flag;}
 
     //***************************************************
     //*** general gettings
@@ -103,6 +117,47 @@ public:
     inline int getBulkElmtsNum()const{
         return m_bulkelmts;
     }
+    /**
+     * get the range of the dofs (start from 1) owned by current processor, all the active dofs are owned if the mesh
+     * is not distributed
+     * @param iStart the first owned dof id
+     * @param iEnd the last owned dof id, inclusive
+     */
+    inline void getOwnedDofsRange(int &iStart,int &iEnd)const{
+        iStart=m_owned_dofs_start+1;
+        iEnd=m_owned_dofs_end;
+    }
+    /**
+     * get the local size of the distributed vectors and matrices, i.e. the number of the owned dofs, PETSC_DECIDE is
+     * returned if the mesh is not distributed, then PETSc splits the rows
+     */
+    inline int getLocalDofsNum()const{
+        if(!m_isdistributed) return PETSC_DECIDE;
+        return m_owned_dofs_end-m_owned_dofs_start;
+    }
+    /**
+     * get the number of the nodes stored on current processor, it equals to the total one if the mesh is not distributed
+     */
+    inline int getLocalNodesNum()const{
+        if(!m_isdistributed) return m_nodes;
+        return static_cast<int>(m_node_local2global.size());
+    }
+    /**
+     * check whether the i-th node is stored on current processor, every node is stored if the mesh is not distributed
+     * @param i integer for the global node id, start from 1
+     */
+    inline bool isNodeStored(const int &i)const{
+        if(!m_isdistributed) return i>=1&&i<=m_nodes;
+        return std::binary_search(m_node_local2global.begin(),m_node_local2global.end(),i);
+    }
+    /**
+     * get the global id of the i-th local node
+     * @param i integer for the local node id, start from 1
+     */
+    inline int getIthLocalNodeGlobalID(const int &i)const{
+        if(!m_isdistributed) return i;
+        return m_node_local2global[i-1];
+    }
     /**
      * get the i-th dof id
      * @param i integer for the i-th dof
@@ -146,15 +201,20 @@ public:
      * @param j integer for j-th dof id
      */
     inline int getIthNodeJthDofID(const int &i,const int &j)const{
-        if(i<1||i>m_nodes){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of nodes' range(="+to_string(m_nodes)+")");
-            MessagePrinter::exitAsFem();
-        }
-        if(j<1||j>m_maxdofs_pernode){
-            MessagePrinter::printErrorTxt("j="+to_string(j)+" is out of nodes' max dof num(="+to_string(m_maxdofs_pernode)+")");
-            MessagePrinter::exitAsFem();
-        }
-        return m_nodal_dofids[i-1][j-1];
+        checkIthNodeJthDofIndex(i,j);
+        return m_nodal_dofids[(getNodeLocalID(i)-1)*m_maxdofs_pernode+j-1];
+    }
+    /**
+     * get the j-th dof id of the i-th local node, no global id lookup is needed.
+     * The range check is only done in the debug build (NDEBUG is not defined)
+     * @param i integer for the local node id, start from 1
+     * @param j integer for j-th dof id
+     */
+    inline int getIthLocalNodeJthDofID(const int &i,const int &j)const{
+#ifndef NDEBUG
+        checkIthLocalNodeJthDofIndex(i,j);
+#endif
+        return m_nodal_dofids[(i-1)*m_maxdofs_pernode+j-1];
     }
     /**
      * get i-th node's j-th dof id, start from 0
@@ -162,15 +222,8 @@ public:
      * @param j integer for j-th dof id
      */
     inline int getIthNodeJthDofID0(const int &i,const int &j)const{
-        if(i<1||i>m_nodes){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of nodes' range(="+to_string(m_nodes)+")");
-            MessagePrinter::exitAsFem();
-        }
-        if(j<1||j>m_maxdofs_pernode){
-            MessagePrinter::printErrorTxt("j="+to_string(j)+" is out of nodes' max dof num(="+to_string(m_maxdofs_pernode)+")");
-            MessagePrinter::exitAsFem();
-        }
-        return m_nodal_dofids[i-1][j-1]-1;
+        checkIthNodeJthDofIndex(i,j);
+        return m_nodal_dofids[(getNodeLocalID(i)-1)*m_maxdofs_pernode+j-1]-1;
     }
     /**
      * get i-th elmt's j-th dof id
@@ -178,15 +231,12 @@ public:
      * @param j integer for j-th dof id
      */
     inline int getIthBulkElmtJthDofID(const int &i,const int &j)const{
-        if(i<1||i>m_bulkelmts){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of elmts' range(="+to_string(m_bulkelmts)+")");
+        checkIthBulkElmtIndex(i);
+        if(j<1||j>m_elmt_dofids.getIthElmtNodesNum(i-1-m_elmt_offset)){
+            MessagePrinter::printErrorTxt("j="+to_string(j)+" is out of elmts' dof num(="+to_string(m_elmt_dofids.getIthElmtNodesNum(i-1-m_elmt_offset))+")");
             MessagePrinter::exitAsFem();
         }
-        if(j<1||j>static_cast<int>(m_elmt_dofids[i-1].size())){
-            MessagePrinter::printErrorTxt("j="+to_string(j)+" is out of elmts' dof num(="+to_string(m_elmt_dofids[i-1].size())+")");
-            MessagePrinter::exitAsFem();
-        }
-        return m_elmt_dofids[i-1][j-1];
+        return m_elmt_dofids[i-1-m_elmt_offset][j-1];
     }
     /**
      * get i-th elmt's j-th dof id
@@ -194,15 +244,12 @@ public:
      * @param j integer for j-th dof id
      */
     inline int getIthBulkElmtJthDofID0(const int &i,const int &j)const{
-        if(i<1||i>m_bulkelmts){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of elmts' range(="+to_string(m_bulkelmts)+")");
+        checkIthBulkElmtIndex(i);
+        if(j<1||j>m_elmt_dofids.getIthElmtNodesNum(i-1-m_elmt_offset)){
+            MessagePrinter::printErrorTxt("j="+to_string(j)+" is out of elmts' dof num(="+to_string(m_elmt_dofids.getIthElmtNodesNum(i-1-m_elmt_offset))+")");
             MessagePrinter::exitAsFem();
         }
-        if(j<1||j>static_cast<int>(m_elmt_dofids[i-1].size())){
-            MessagePrinter::printErrorTxt("j="+to_string(j)+" is out of elmts' dof num(="+to_string(m_elmt_dofids[i-1].size())+")");
-            MessagePrinter::exitAsFem();
-        }
-        return m_elmt_dofids[i-1][j-1]-1;
+        return m_elmt_dofids[i-1-m_elmt_offset][j-1]-1;
     }
     /**
      * get i-th elmt's dofs
@@ -210,13 +257,11 @@ public:
      * @param elmtdofs vector for current element's dof ids
      */
     inline void getIthBulkElmtDofIDs(const int &i,vector<int> &elmtdofs)const{
-        if(i<1||i>m_bulkelmts){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of elmts' range(="+to_string(m_bulkelmts)+")");
-            MessagePrinter::exitAsFem();
-        }
+        checkIthBulkElmtIndex(i);
+        ElmtConnSpan dofids=m_elmt_dofids[i-1-m_elmt_offset];
         bool AllDofsAreZero;AllDofsAreZero=true;
-        for(int j=0;j<static_cast<int>(m_elmt_dofids[i-1].size());j++){
-            elmtdofs[j]=m_elmt_dofids[i-1][j];
+        for(int j=0;j<dofids.size();j++){
+            elmtdofs[j]=dofids[j];
             if(elmtdofs[j]>0) AllDofsAreZero=false;
         }
         if(AllDofsAreZero){
@@ -230,13 +275,11 @@ public:
      * @param elmtdofs vector for current element's dof ids
      */
     inline void getIthBulkElmtDofIDs0(const int &i,vector<int> &elmtdofs)const{
-        if(i<1||i>m_bulkelmts){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of elmts' range(="+to_string(m_bulkelmts)+")");
-            MessagePrinter::exitAsFem();
-        }
+        checkIthBulkElmtIndex(i);
+        ElmtConnSpan dofids=m_elmt_dofids[i-1-m_elmt_offset];
         bool AllDofsAreZero;AllDofsAreZero=true;
-        for(int j=0;j<static_cast<int>(m_elmt_dofids[i-1].size());j++){
-            elmtdofs[j]=m_elmt_dofids[i-1][j]-1;
+        for(int j=0;j<dofids.size();j++){
+            elmtdofs[j]=dofids[j]-1;
             if(elmtdofs[j]>0) AllDofsAreZero=false;
         }
         if(AllDofsAreZero){
@@ -250,12 +293,10 @@ public:
      * @param elmtdofs integer pointer for current element's dof ids
      */
     inline void getIthBulkElmtDofIDs(const int &i,int *elmtdofs)const{
-        if(i<1||i>m_bulkelmts){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of elmts' range(="+to_string(m_bulkelmts)+")");
-            MessagePrinter::exitAsFem();
-        }
-        for(int j=0;j<static_cast<int>(m_elmt_dofids[i-1].size());j++){
-            elmtdofs[j]=m_elmt_dofids[i-1][j];
+        checkIthBulkElmtIndex(i);
+        ElmtConnSpan dofids=m_elmt_dofids[i-1-m_elmt_offset];
+        for(int j=0;j<dofids.size();j++){
+            elmtdofs[j]=dofids[j];
         }
     }
     /**
@@ -264,12 +305,10 @@ public:
      * @param elmtdofs integer pointer for current element's dof ids
      */
     inline void getIthBulkElmtDofIDs0(const int &i,int *elmtdofs)const{
-        if(i<1||i>m_bulkelmts){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of elmts' range(="+to_string(m_bulkelmts)+")");
-            MessagePrinter::exitAsFem();
-        }
-        for(int j=0;j<static_cast<int>(m_elmt_dofids[i-1].size());j++){
-            elmtdofs[j]=m_elmt_dofids[i-1][j]-1;
+        checkIthBulkElmtIndex(i);
+        ElmtConnSpan dofids=m_elmt_dofids[i-1-m_elmt_offset];
+        for(int j=0;j<dofids.size();j++){
+            elmtdofs[j]=dofids[j]-1;
         }
     }
     /**
@@ -277,11 +316,19 @@ public:
      * @param i integer for i-th elmt
      */
     inline int getIthBulkElmtDofsNum(const int &i)const{
-        if(i<1||i>m_bulkelmts){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of elmts' range(="+to_string(m_bulkelmts)+")");
-            MessagePrinter::exitAsFem();
-        }
-        return static_cast<int>(m_elmt_dofids[i-1].size());
+        checkIthBulkElmtIndex(i);
+        return m_elmt_dofids.getIthElmtNodesNum(i-1-m_elmt_offset);
+    }
+    /**
+     * get i-th elmt's dofs as a contiguous block (start from 1) without copy, the span is valid until the dofs map
+     * is recreated. The range check is only done in the debug build (NDEBUG is not defined)
+     * @param i integer for i-th elmt
+     */
+    inline ElmtConnSpan getIthBulkElmtDofIDsSpan(const int &i)const{
+#ifndef NDEBUG
+        checkIthBulkElmtIndex(i);
+#endif
+        return m_elmt_dofids[i-1-m_elmt_offset];
     }
     /**
      * check if the input dof name is a valid name
@@ -322,6 +369,81 @@ public:
      */
     void printBulkElementalDofsInfo(const bool &flag=false)const;
 
+protected:
+    /**
+     * get the local id of the i-th (global id) node, the nodal dofs map only has the local nodes of the distributed mesh
+     * @param i integer for the global node id
+     */
+    inline int getNodeLocalID(const int &i)const{
+        if(!m_isdistributed) return i;
+        auto it=std::lower_bound(m_node_local2global.begin(),m_node_local2global.end(),i);
+        if(it==m_node_local2global.end()||*it!=i){
+            MessagePrinter::printErrorTxt("node-"+to_string(i)+" is not stored on current processor, please check your distributed mesh");
+            MessagePrinter::exitAsFem();
+        }
+        return static_cast<int>(it-m_node_local2global.begin())+1;
+    }
+    /**
+     * check the node index and the dof index, the error message is only built on the error path
+     * @param i integer for i-th node
+     * @param j integer for j-th dof id
+     */
+    inline void checkIthNodeJthDofIndex(const int &i,const int &j)const{
+        if(i<1||i>m_nodes){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of nodes' range(="+to_string(m_nodes)+")");
+            MessagePrinter::exitAsFem();
+        }
+        if(j<1||j>m_maxdofs_pernode){
+            MessagePrinter::printErrorTxt("j="+to_string(j)+" is out of nodes' max dof num(="+to_string(m_maxdofs_pernode)+")");
+            MessagePrinter::exitAsFem();
+        }
+    }
+    /**
+     * check the local node index and the dof index, the local nodes are all the nodes if the mesh is not distributed
+     * @param i integer for i-th local node
+     * @param j integer for j-th dof id
+     */
+    inline void checkIthLocalNodeJthDofIndex(const int &i,const int &j)const{
+        if(i<1||i>getLocalNodesNum()){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of local nodes' range(="+to_string(getLocalNodesNum())+")");
+            MessagePrinter::exitAsFem();
+        }
+        if(j<1||j>m_maxdofs_pernode){
+            MessagePrinter::printErrorTxt("j="+to_string(j)+" is out of nodes' max dof num(="+to_string(m_maxdofs_pernode)+")");
+            MessagePrinter::exitAsFem();
+        }
+    }
+    /**
+     * check the bulk element index, for the distributed mesh, only the owned elements have the elemental dofs
+     * @param i integer for i-th elmt
+     */
+    inline void checkIthBulkElmtIndex(const int &i)const{
+        if(i<1||i>m_bulkelmts){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of elmts' range(="+to_string(m_bulkelmts)+")");
+            MessagePrinter::exitAsFem();
+        }
+        if(i-1<m_elmt_offset||i-1>=m_elmt_offset+m_elmt_dofids.size()){
+            MessagePrinter::printErrorTxt("the dofs of element-"+to_string(i)+" are not stored on current processor, please check your code");
+            MessagePrinter::exitAsFem();
+        }
+    }
+    /**
+     * create the dofs map for the distributed mesh. Each node is owned by the processor which owns its first (min id)
+     * bulk element, the owners collect the active dofs flags from the neighbors, number their own dofs contiguously
+     * with the offset from MPI_Exscan, then the numbers of the ghost nodes are exchanged with the neighbors (the
+     * owners of the halo elements)
+     * @param t_mesh the distributed mesh
+     * @param t_localflags the active flag of each dof of the local nodes, only the owned elements are considered
+     */
+    void createDistributedBulkDofsMap(const Mesh &t_mesh,vector<char> &t_localflags);
+    /**
+     * renumber the active dofs in the nodal dofs map, the nodes are ordered by the reverse Cuthill-McKee method,
+     * then the dofs are numbered node by node or field by field. The bandwidth and the envelope bound of nnz(L+U) are
+     * printed out before and after the renumbering
+     * @param t_mesh the mesh class
+     */
+    void renumberBulkDofs(const Mesh &t_mesh);
+
 
 protected:
     vector<string> m_dof_namelist;/**< vector for the name of dofs of each node */
@@ -333,9 +455,18 @@ protected:
     int m_maxdofs_perelmt;/**< for the maximum dofs of one single element */
     int m_total_dofs;/**< for the total dofs */
     int m_active_dofs;/**< for the active dofs */
-    vector<vector<int>> m_elmt_dofids;/**< this vector stores the dofs id of each element */
-    vector<vector<int>> m_nodal_dofids;/**< this vector stores the dof ids of each node */
+    ElmtConnectivity m_elmt_dofids;/**< the dof ids of each element in CSR format, only the active ones are kept */
+    vector<int> m_nodal_dofids;/**< the dof ids of the local nodes, the j-th dof of the i-th local node is at (i-1)*m_maxdofs_pernode+j-1 */
 
     int m_maxnnz;/**< for the maximum nonzeros */
 
+    DofRenumberType m_renumber_type=DofRenumberType::NONE;/**< the node ordering for the dofs renumbering */
+    bool m_isfieldblocked=false;/**< true if the dofs are numbered field by field */
+
+    int m_elmt_offset=0;/**< the global id-1 of the first element in m_elmt_dofids, non-zero for the distributed mesh */
+    int m_owned_dofs_start=0;/**< the dofs in (m_owned_dofs_start,m_owned_dofs_end] are owned by current processor */
+    int m_owned_dofs_end=0;/**< the last dof id owned by current processor */
+    bool m_isdistributed=false;/**< true if the dofs map is created for the distributed mesh */
+    vector<int> m_node_local2global;/**< the sorted global id of the local nodes, only for the distributed mesh */
+
 };
\ No newline at end of file
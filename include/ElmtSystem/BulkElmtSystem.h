@@ -123,16 +123,26 @@ public:
     inline vector<ElmtBlock> getBulkElmtBlockList()const{
         return m_elmtblock_list;
     }
+    /**
+     * check whether all the bulk element blocks are linear, then the jacobian is constant for the fixed dt
+     */
+    inline bool isLinearSystem()const{
+        if(m_elmtblock_num<1) return false;
+        for(const auto &it:m_elmtblock_list){
+            if(!it.m_islinear) return false;
+        }
+        return true;
+    }
     /**
      * get the sub element/modules size of i-th bulk element
      * @param i integer for the sub element index
      */
     inline int getIthBulkElmtSubElmtsNum(const int &i)const{
-        if(i<1||i>m_bulk_elmts){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range for your bulk elements("+to_string(m_bulk_elmts)+")");
+        if(i<=m_elmt_offset||i>m_elmt_offset+m_bulk_elmts){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is not a local bulk element("+to_string(m_elmt_offset+1)+"~"+to_string(m_elmt_offset+m_bulk_elmts)+")");
             MessagePrinter::exitAsFem();
         }
-        return static_cast<int>(m_elemental_elmtblock_id[i-1].size());
+        return static_cast<int>(m_elemental_elmtblock_id[i-1-m_elmt_offset].size());
     }
     /**
      * get the j-th sub element index id of i-th bulk element
@@ -140,15 +150,15 @@ public:
      * @param j integer for the sub element index
      */
     inline int getIthBulkElmtJthSubElmtID(const int &i,const int &j)const{
-        if(i<1||i>m_bulk_elmts){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range for your bulk elements("+to_string(m_bulk_elmts)+")");
+        if(i<=m_elmt_offset||i>m_elmt_offset+m_bulk_elmts){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is not a local bulk element("+to_string(m_elmt_offset+1)+"~"+to_string(m_elmt_offset+m_bulk_elmts)+")");
             MessagePrinter::exitAsFem();
         }
-        if(j<1||j>static_cast<int>(m_elemental_elmtblock_id[i-1].size())){
-            MessagePrinter::printErrorTxt("j="+to_string(j)+" is out of range for your sub element("+to_string(m_elemental_elmtblock_id[i-1].size())+")");
+        if(j<1||j>static_cast<int>(m_elemental_elmtblock_id[i-1-m_elmt_offset].size())){
+            MessagePrinter::printErrorTxt("j="+to_string(j)+" is out of range for your sub element("+to_string(m_elemental_elmtblock_id[i-1-m_elmt_offset].size())+")");
             MessagePrinter::exitAsFem();
         }
-        return m_elemental_elmtblock_id[i-1][j-1];
+        return m_elemental_elmtblock_id[i-1-m_elmt_offset][j-1];
     }
 
     //**************************************************************
@@ -171,7 +181,8 @@ protected:
     //****************************
     //*** for elemental info
     //****************************
-    int m_bulk_elmts;
-    vector<vector<int>> m_elemental_elmtblock_id;/**< this vector stores the elmt block id for each single element */
+    int m_bulk_elmts;/**< the number of local bulk elements */
+    int m_elmt_offset;/**< the global id of the first local bulk element minus 1 */
+    vector<vector<int>> m_elemental_elmtblock_id;/**< this vector stores the elmt block id for each local element */
 
 };
\ No newline at end of file
@@ -44,6 +44,8 @@ public:
         m_matetype=MateType::NULLMATE;
 
         m_json_params.clear();
+
+        m_islinear=false;
     }
     /**
      * reset the content of current element block
@@ -64,6 +66,8 @@ public:
         m_matetype=MateType::NULLMATE;
 
         m_json_params.clear();
+
+        m_islinear=false;
     }
     /**
      * print out the information of current element block
@@ -84,6 +88,10 @@ public:
 
         MessagePrinter::printNormalTxt("  material type name = "+m_mate_typename);
 
+        if(m_islinear){
+            MessagePrinter::printNormalTxt("  linear = true (jacobian is independent of the solution)");
+        }
+
         str="";
         for(const auto &it:m_domain_namelist) str+=it+" ";
         MessagePrinter::printNormalTxt("  domain = "+str);
@@ -134,4 +142,6 @@ public:
     MateType m_matetype;/**< the type of material used in current element */
     nlohmann::json m_json_params;/**< json class for material paramters of current element */
 
+    bool m_islinear;/**< true if the jacobian of current element block doesn't depend on the solution */
+
 };
\ No newline at end of file
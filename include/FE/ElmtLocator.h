@@ -0,0 +1,136 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: locate the physical points in the bulk elements, the
+//+++          candidates are found by a bounding volume hierarchy
+//+++          over the element boxes (or by the index arithmetic of
+//+++          the uniform grid generated by AsFem), then the local
+//+++          coordinates are computed by the inverse isoparametric
+//+++          mapping of the shape functions
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <vector>
+
+#include "Mesh/Mesh.h"
+#include "FE/ShapeFun.h"
+#include "MathUtils/Vector3d.h"
+
+using std::vector;
+
+/**
+ * the point-in-element search service over the bulk elements of the undeformed mesh. For the distributed mesh, only
+ * the owned elements of current processor are searched, so at most one processor finds a point which is shared by
+ * several elements. All the element ids are the global ones, start from 1.
+ */
+class ElmtLocator{
+public:
+    /**
+     * constructor
+     */
+    ElmtLocator();
+
+    /**
+     * build the search structure from the initial nodal coordinates, the uniform grid is used for the mesh generated
+     * by AsFem, otherwise the bounding volume hierarchy is built
+     * @param t_mesh the mesh class
+     */
+    void init(const Mesh &t_mesh);
+    /**
+     * check whether the search structure is built
+     */
+    inline bool isInit()const{return m_isinit;}
+
+    /**
+     * find the bulk element which contains the given point, false is returned if the point is outside
+     * @param t_mesh the mesh class, it must be the same one used in init()
+     * @param t_point the physical coordinates of the point
+     * @param elmtid the global id of the found element, 0 if not found
+     * @param xi the local coordinates of the point in the found element
+     */
+    bool findElmt(const Mesh &t_mesh,const Vector3d &t_point,int &elmtid,Vector3d &xi);
+    /**
+     * find the bulk elements of a batch of points, the number of the found points is returned
+     * @param t_mesh the mesh class, it must be the same one used in init()
+     * @param t_points the physical coordinates of the points
+     * @param elmtids the global id of the found element for each point, 0 if not found
+     * @param xis the local coordinates of each point
+     */
+    int findElmts(const Mesh &t_mesh,const vector<Vector3d> &t_points,vector<int> &elmtids,vector<Vector3d> &xis);
+    /**
+     * get the shape function values at the last found point, the i-th value is the one of the i-th node
+     * of the found element, start from 1
+     * @param i the local node index
+     */
+    inline double getIthShapeValue(const int &i)const{return m_shp.shape_value(i);}
+
+    /**
+     * print out the summary of the search structure
+     */
+    void printElmtLocatorInfo()const;
+    /**
+     * release the allocated memory
+     */
+    void releaseMemory();
+
+protected:
+    /**
+     * compute the local coordinates of the point by the Gauss-Newton iteration of the isoparametric mapping, true is
+     * returned if the point is inside the element (within the tolerance)
+     * @param t_mesh the mesh class
+     * @param e the global element id
+     * @param t_point the physical coordinates of the point
+     * @param xi the local coordinates of the point
+     */
+    bool isPointInElmt(const Mesh &t_mesh,const int &e,const Vector3d &t_point,Vector3d &xi);
+    /**
+     * find the candidate element of the uniform grid, 0 is returned if the point is outside the grid
+     * @param t_point the physical coordinates of the point
+     */
+    int getGridElmtID(const Vector3d &t_point)const;
+    /**
+     * build the bounding volume hierarchy over the element boxes
+     */
+    void buildBVH();
+
+protected:
+    bool m_isinit=false;/**< true if the search structure is built */
+    bool m_isgrid=false;/**< true if the uniform grid (of the generated mesh) is used */
+    bool m_issimplex=false;/**< true for the tri/tet elements, the reference domain is the unit simplex, otherwise it is [-1,1]^dim */
+    int m_dim=0;/**< the dimension of the bulk elements */
+    int m_nodesperelmt=0;/**< the number of nodes per bulk element */
+    int m_elmtstart=0;/**< the first searched element (global id-1) */
+    int m_elmtend=0;/**< the end of the searched elements, exclusive */
+
+    // for the uniform grid
+    int m_ngrid[3]={1,1,1};/**< the number of elements in each axis */
+    double m_gridmin[3]={0.0,0.0,0.0};/**< the lower bounds of the grid */
+    double m_gridsize[3]={1.0,1.0,1.0};/**< the element size in each axis */
+
+    // for the bounding volume hierarchy, the children of an inner node are stored next to each other
+    vector<double> m_elmtboxes;/**< the boxes (xmin,ymin,zmin,xmax,ymax,zmax) of the elements, in the order of m_elmtids */
+    vector<int> m_elmtids;/**< the global element ids, sorted by the tree leaves */
+    vector<double> m_treeboxes;/**< the boxes of the tree nodes */
+    vector<int> m_treechild;/**< the 1st child of the inner node, or -1 for the leaf */
+    vector<int> m_treefirst;/**< the first element (index in m_elmtids) of the tree node */
+    vector<int> m_treecount;/**< the number of elements of the tree node */
+    vector<int> m_stack;/**< the traversal stack */
+    int m_treedepth=0;/**< the depth of the tree */
+
+    ShapeFun m_shp;/**< the shape functions of the bulk element */
+    Nodes m_nodes;/**< the nodal coordinates of current element */
+
+    static const int m_leafsize=4;/**< the max number of elements in a leaf */
+    static const int m_maxiters=25;/**< the max iterations of the inverse mapping */
+    double m_tol=1.0e-8;/**< the tolerance of the local coordinates (the inside test) */
+
+};
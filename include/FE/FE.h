@@ -17,6 +17,7 @@
 
 #include "FE/QPoint.h"
 #include "FE/ShapeFun.h"
+#include "FE/ElmtLocator.h"
 
 #include "Mesh/Mesh.h"
 
@@ -68,6 +69,8 @@ public:
     QPoint m_surface_qpoints;/**< gauss integration points for the surface element */
     QPoint m_line_qpoints;/**< gauss integration points for the line element */
 
+    ElmtLocator m_elmtlocator;/**< the point locator of the bulk elements, it is only built by the one who needs it */
+
 private:
     int m_maxdim;/**< the max dimension of fe space */
     int m_mindim;/**< the min dimension of fe space */
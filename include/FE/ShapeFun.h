@@ -74,6 +74,10 @@ public:
      * must be set up correctly.
      */
     void init();
+    /**
+     * get the number of shape functions
+     */
+    inline int getShapeFunsNum()const{return m_funs;}
     /**
      * get the jacobian determite reference
      */
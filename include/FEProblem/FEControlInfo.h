@@ -35,6 +35,9 @@ public:
         IsProjection=false;
 
         m_timesteppingtype=TimeSteppingType::BACKWARDEULER;
+        dtold=1.0e-6;
+        bdforder=1;
+        for(int i=0;i<6;i++) bdfcoefs[i]=0.0;
     }
 
     void init(){
@@ -48,6 +51,9 @@ public:
         IsProjection=false;
 
         m_timesteppingtype=TimeSteppingType::BACKWARDEULER;
+        dtold=1.0e-6;
+        bdforder=1;
+        for(int i=0;i<6;i++) bdfcoefs[i]=0.0;
     }
 
     double ctan[3];
@@ -61,5 +67,8 @@ public:
 
     // for time stepping
     TimeSteppingType m_timesteppingtype=TimeSteppingType::BACKWARDEULER;
+    double dtold=1.0e-6;// the delta t of the last converged step, for the variable step BDF2
+    int bdforder=1;// the order of the variable order BDF in current step
+    double bdfcoefs[6];// du/dt=sum(bdfcoefs[j]*U_n+1-j), j=0 for the current solution
 
 };
\ No newline at end of file
@@ -69,10 +69,19 @@ public:
      * reset the maximum coefficient of K matrix
      */
     inline void resetMaxKMatrixCoeff(){m_max_k_coeff=-1.0e16;}
+    /**
+     * only assemble the diagonal block of the flagged nodal dofs into K, the other entries are skipped
+     * @param t_flags the flag of each nodal dof (index starts from 0), true if it belongs to the block
+     */
+    inline void setAssembledDofsFlag(const vector<bool> &t_flags){m_assembleddofs=t_flags;}
+    /**
+     * assemble all the entries into K again
+     */
+    inline void resetAssembledDofsFlag(){m_assembleddofs.clear();}
 
     /**
      * generate the system residual and jacobian based on different elements(PDEs/ODEs)
-     * @param t_calctype the calculation action type, i.e., form residual or form jacobian
+     * @param t_calctype the calculation action type, i.e., form residual or form jacobian, the HRZ lumped mass goes to RHS
      * @param t double value for the current time
      * @param dt double value for the current time increment
      * @param ctan the 3-d vector for the time derivative coefficients
@@ -111,14 +120,14 @@ private:
      * assemble local residual to global residual
      * @param t_dofs the dofs number of current sub element
      * @param t_dofsid the dofs id of current sub element, the local one, not the global ids!
-     * @param t_globalnodeid the global node index
+     * @param t_localnodeid the local node index, it equals the global one if the mesh is not distributed
      * @param t_dofhandler the dofHandler class
      * @param jxw the JxW for integration
      * @param t_subR the residual of current sub element
      * @param RHS the global residual
      */
     void assembleLocalResidual2GlobalR(const int &t_dofs,const vector<int> &t_dofsid,
-                                       const int &t_globalnodeid,
+                                       const int &t_localnodeid,
                                        const DofHandler &t_dofhandler,
                                        const double &jxw,
                                        const VectorXd &t_subR,
@@ -127,20 +136,31 @@ private:
      * assemble local residual to global residual
      * @param t_dofs the dofs number of current sub element
      * @param t_dofsid the dofs id of current sub element, the local one
-     * @param t_globalnodeidI the node index (I-index), global one
-     * @param t_globalnodeidJ the node index (J-index), global one
+     * @param t_localnodeidI the node index (I-index), local one
+     * @param t_localnodeidJ the node index (J-index), local one
      * @param jxw JxW for integration
      * @param t_dofhandler the dofHandler class
      * @param t_subK the jacobian of current sub element
      * @param AMATRIX the global K matrix
      */
     void assembleLocalJacobian2GlobalK(const int &t_dofs,const vector<int> &t_dofsid,
-                                       const int &t_globalnodeidI,const int &t_globalnodeidJ,
+                                       const int &t_localnodeidI,const int &t_localnodeidJ,
                                        const double &jxw,
                                        const DofHandler &t_dofhandler,
                                        const MatrixXd &t_subK,
                                        SparseMatrix &AMATRIX);
-
+    /**
+     * assemble the HRZ lumped mass of current element to the global vector, the diagonal of the element mass
+     * of each field component is scaled by the ratio of its total mass to the sum of its diagonal
+     * @param t_elmtid the id of current bulk element
+     * @param t_mesh the mesh class
+     * @param t_dofhandler the dofHandler class
+     * @param RHS the global lumped mass vector
+     */
+    void assembleLocalLumpedMass2GlobalR(const int &t_elmtid,
+                                         const Mesh &t_mesh,
+                                         const DofHandler &t_dofhandler,
+                                         Vector &RHS);
 
 private:
     int m_max_nodal_dofs;/**< the maximum dofs number of each node */
@@ -152,17 +172,19 @@ private:
     MatrixXd m_subK;/**< for the local 'element's matrix, used for one single element/model */
 
     vector<int> m_elmtconn;/**< for local element's connectivity */
-    vector<int> m_elmtdofsid;/**< for local elemental nodes' gloabl ids, start from 0 */
     int         m_subelmt_dofs;/**< for the dofs number of each sub element */
     vector<int> m_subelmtdofsid;/**< for local sub-elemental nodes' gloabl ids, start from 0 */
 
     double m_max_k_coeff;/**< the max(absolute) value of current K matrix */
+    vector<bool> m_assembleddofs;/**< the nodal dofs whose diagonal block is assembled, empty means all */
 
     vector<double> m_elmtU;/**< 'displacemen' of current element */
     vector<double> m_elmtUold;/**< previous 'displacemen' of current element */
     vector<double> m_elmtUolder;/**< pre-previous 'displacemen' of current element */
     vector<double> m_elmtV;/**< 'velocity' of current element */
     vector<double> m_elmtA;/**< 'acceleration' of current element */
+    vector<double> m_elmtdiagmass;/**< the diagonal of the mass of current element, for the HRZ lumping */
+    vector<double> m_elmttotalmass;/**< the total mass of each field component of current element, for the HRZ lumping */
 
     Nodes m_nodes;/**< for the nodal coordinates of current bulk element (current configuration) */
     Nodes m_nodes0;/**< for the nodal coordinates of current bulk element (reference configuration) */
@@ -20,6 +20,7 @@
 enum class FECalcType{
     COMPUTERESIDUAL,
     COMPUTEJACOBIAN,
+    COMPUTELUMPEDMASS,
     INITMATERIAL,
     UPDATEMATERIAL,
     UPDATEU
@@ -107,6 +107,14 @@ public:
      * check whether the read-only flag is true
      */
     bool isReadOnly()const{return m_readonly;}
+    /**
+     * check whether the '--restart' flag is given
+     */
+    bool hasRestartFile()const{return m_hasrestartfile;}
+    /**
+     * get the name of the checkpoint file for the restart
+     */
+    inline string getRestartFileName()const{return m_restartfile_name;}
 
 private:
     /**
@@ -204,6 +212,8 @@ private:
     bool m_hasinputfile;/**< boolean flag, if true then the input file is loaded */
     string m_inputfile_name;/**< string for the name of input file */
     string m_meshfile_name;/**< string for the name of mesh file(external mesh file)*/
+    bool m_hasrestartfile;/**< boolean flag, if true then the simulation continues from the checkpoint file */
+    string m_restartfile_name;/**< string for the name of the checkpoint file given by '--restart' */
     nlohmann::json m_json;/**< json file reader */
     
 };
\ No newline at end of file
@@ -13,8 +13,8 @@
 //+++          element. In this code, we can define:
 //+++           1) Sigma
 //+++           2) dSigma/du(=0)
-//+++           3) F
-//+++           4) dF/du(=0)
+//+++           3) F(=f+dfdt*t+dfdu*u)
+//+++           4) dF/du(=dfdu)
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #pragma once
@@ -19,6 +19,8 @@
 #include "MathUtils/Rank4Tensor.h"
 
 #include "nlohmann/json.hpp"
+#include "Utils/JsonUtils.h"
+#include "MateSystem/MaterialsContainer.h"
 
 /**
  * This abstract class defines the basic function for mechanics material properties
@@ -45,4 +47,19 @@ protected:
                                           const Rank2Tensor &strain,
                                           Rank2Tensor &stress,
                                           Rank4Tensor &jacobian)=0;
+    /**
+     * save the density and the dilatational wave speed(=sqrt(C1111/rho)), they are required by the dynamics: the
+     * inertia term of the mechanics element and the critical dt of the central difference. Nothing is saved if
+     * 'rho' is not given, then the analysis is quasi-static
+     * @param t_params the json parameters defined in the input file
+     * @param jacobian the jacobian tensor
+     * @param mate the material container
+     */
+    void computeDensityAndWaveSpeed(const nlohmann::json &t_params,
+                                    const Rank4Tensor &jacobian,
+                                    MaterialsContainer &mate)const{
+        if(!JsonUtils::hasValue(t_params,"rho")) return;
+        mate.ScalarMaterial("rho")=JsonUtils::getValue(t_params,"rho");
+        mate.ScalarMaterial("wave-speed")=sqrt(jacobian(1,1,1,1)/mate.ScalarMaterial("rho"));
+    }
 };
\ No newline at end of file
@@ -227,6 +227,13 @@ public:
     inline int getRank4MaterialsNum()const{
         return static_cast<int>(m_rank4_materials.size());
     }
+    /**
+     * check whether the scalar material is defined
+     * @param matename the string name of inquery material
+     */
+    inline bool hasScalarMaterial(const string &matename)const{
+        return m_scalar_materials.find(matename)!=m_scalar_materials.end();
+    }
     
 
 private:
@@ -46,20 +46,21 @@ public:
      * @param m integer for the 1st dimension
      * @param n integer for the 2nd dimension
      * @param maxrownnz integer for the maximum non-zero elements of each row
+     * @param mlocal integer for the local rows (and columns), PETSc splits the rows if it is PETSC_DECIDE
      */
-    inline void resize(const int &m,const int &n,const int &maxrownnz){
+    inline void resize(const int &m,const int &n,const int &maxrownnz,const int &mlocal=PETSC_DECIDE){
         if(m<0||n<0||m!=n){
             MessagePrinter::printErrorTxt("either you m<0 or n<0 or m!=n detected in resize function");
             MessagePrinter::exitAsFem();
         }
         if(m_allocated){
             MatDestroy(&m_matrix);
-            MatCreateAIJ(PETSC_COMM_WORLD,PETSC_DECIDE,PETSC_DECIDE,m,n,maxrownnz,NULL,maxrownnz,NULL,&m_matrix);
+            MatCreateAIJ(PETSC_COMM_WORLD,mlocal,mlocal,m,n,maxrownnz,NULL,maxrownnz,NULL,&m_matrix);
             m_m=m;m_n=n;
             m_allocated=true;
         }
         else{
-            MatCreateAIJ(PETSC_COMM_WORLD,PETSC_DECIDE,PETSC_DECIDE,m,n,maxrownnz,NULL,maxrownnz,NULL,&m_matrix);
+            MatCreateAIJ(PETSC_COMM_WORLD,mlocal,mlocal,m,n,maxrownnz,NULL,maxrownnz,NULL,&m_matrix);
             m_m=m;m_n=n;
             m_allocated=true;
         }
@@ -150,6 +151,7 @@ public:
      */
     inline void setToZero(){
         MatZeroEntries(m_matrix);
+        m_assemblycount+=1;
     }
     /**
      * set all elements to random value but keep the sparsity pattern
@@ -266,6 +268,7 @@ public:
     inline void assemble(){
         MatAssemblyBegin(m_matrix,MAT_FINAL_ASSEMBLY);
         MatAssemblyEnd(m_matrix,MAT_FINAL_ASSEMBLY);
+        m_assemblycount+=1;
     }
     //****************************************************************
     //*** general gettings
@@ -282,6 +285,11 @@ public:
         MatNorm(m_matrix,NORM_FROBENIUS,&norm);
         return norm;
     }
+    /**
+     * get the number of final assembly (or zeroing) of current matrix, any path that modifies the
+     * entries bumps it, so an unchanged count means the entries are unchanged
+     */
+    inline long getAssemblyCount()const{return m_assemblycount;}
     /**
      * get the reference of current matrix
      */
@@ -326,4 +334,5 @@ private:
     Mat m_matrix;/**< sparse matrix class */
     int m_m;/**< the size of 1st dim */
     int m_n;/**< the size of 2nd dim */
+    long m_assemblycount=0;/**< the number of final assembly, see getAssemblyCount */
 };
\ No newline at end of file
@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+#include <algorithm>
+
 #include "petsc.h"
 #include "Utils/MessagePrinter.h"
 
@@ -60,8 +64,9 @@ public:
      * resize the vector with given value
      * @param n integer for the size of current vector
      * @param val the given initial value
+     * @param nlocal integer for the local size, PETSc splits the vector if it is PETSC_DECIDE
      */
-    void resize(const int &n,const double &val);
+    void resize(const int &n,const double &val,const int &nlocal=PETSC_DECIDE);
     //********************************************************
     //*** operators
     //********************************************************
@@ -446,6 +451,22 @@ public:
      * set the size of current vector
      */
     inline void setSize(const int &n){m_size=n;}
+    /**
+     * swap the storage with another vector, only the petsc handles are exchanged, no value is copied
+     * @param a the vector to be swapped with
+     */
+    inline void swap(Vector &a){
+        std::swap(m_allocated,a.m_allocated);
+        std::swap(m_vector,a.m_vector);
+        std::swap(m_size,a.m_size);
+        std::swap(m_ghostallocated,a.m_ghostallocated);
+        std::swap(m_vector_ghost,a.m_vector_ghost);
+        std::swap(m_scatter,a.m_scatter);
+        std::swap(m_localghost,a.m_localghost);
+        m_ghostids.swap(a.m_ghostids);
+        std::swap(m_ghost_start,a.m_ghost_start);
+        std::swap(m_ghost_owned,a.m_ghost_owned);
+    }
     /**
      * set the current vector's elements to zero, but keep the storage
      */
@@ -585,6 +606,8 @@ public:
             VecDestroy(&m_vector_ghost);
             m_ghostallocated=false;
         }
+        m_localghost=false;
+        vector<int>().swap(m_ghostids);
     }
     /**
      * print the vector's elements
@@ -595,6 +618,13 @@ public:
     //********************************************************
     //*** for ghost access(for multi-core case)
     //********************************************************
+    /**
+     * set the entries which are needed by current processor but owned by the other ones, then the ghost copy only
+     * has the owned entries plus them instead of the whole vector. Without them, the whole vector is copied. The
+     * ids are dropped once the vector is resized
+     * @param t_ghostids the sorted global ids (start from 1) of the needed entries out of the owned range
+     */
+    void setGhostIDs(const vector<int> &t_ghostids);
     /**
      * make a ghost copy of current vector for the cross-core access, after use, one must
      * call destroyGhostCopy !!!
@@ -614,11 +644,26 @@ public:
             MessagePrinter::exitAsFem();
         }
         double val;int index[1];
-        index[0]=i-1;
+        index[0]=m_localghost?getGhostLocalIndex(i):i-1;
         VecGetValues(m_vector_ghost,1,index,&val);
         return val;
     }
 
+private:
+    /**
+     * get the position of the i-th element in the local ghost copy, the owned entries come first
+     * @param i integer for element index, start from 1
+     */
+    inline int getGhostLocalIndex(const int &i)const{
+        if(i-1>=m_ghost_start&&i-1<m_ghost_start+m_ghost_owned) return i-1-m_ghost_start;
+        auto it=std::lower_bound(m_ghostids.begin(),m_ghostids.end(),i);
+        if(it==m_ghostids.end()||*it!=i){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is not in the ghost copy of current processor");
+            MessagePrinter::exitAsFem();
+        }
+        return m_ghost_owned+static_cast<int>(it-m_ghostids.begin());
+    }
+
 
 private:
     bool m_allocated=false;/**< boolean flag for the status of allocation */
@@ -628,4 +673,8 @@ private:
     bool m_ghostallocated=false;/**< boolean flag for ghost processor allocation */
     Vec m_vector_ghost;/**< the ghost copy of m_vector, which should be destroy after use */
     VecScatter m_scatter;/**< scatter used for ghost copy */
+    bool m_localghost=false;/**< true if the ghost copy only has the owned entries plus the needed ghost ones */
+    vector<int> m_ghostids;/**< the sorted global ids (start from 1) of the needed entries out of the owned range */
+    int m_ghost_start=0;/**< the first owned entry (start from 0) of the local ghost copy */
+    int m_ghost_owned=0;/**< the number of owned entries of the local ghost copy */
 };
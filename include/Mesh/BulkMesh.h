@@ -25,6 +25,8 @@
  * for AsFem's headers
  */
 #include "Mesh/MeshData.h"
+#include "Mesh/ImplicitStructuredMesh.h"
+#include "Mesh/MeshReorderType.h"
 #include "Mesh/Nodes.h"
 
 
@@ -100,6 +102,21 @@ public:
      * @param type the mesh type of bulk mesh
      */
     void setMeshType(const MeshType &type){m_meshdata.m_bulkelmt_type=type;}
+    /**
+     * set the flag for the distributed mesh, the mesh is distributed by distributeBulkMesh()
+     * @param flag true if each processor should only keep its own partition
+     */
+    void setDistributedMeshFlag(const bool &flag){m_meshdata.m_distribute=flag;}
+    /**
+     * set the flag for the msh4 importer to build the distributed mesh directly, then distributeBulkMesh() does nothing
+     * @param flag true if the whole mesh is not required before it is distributed
+     */
+    void setDistributeOnImportFlag(const bool &flag){m_meshdata.m_distributeonimport=flag;}
+    /**
+     * set the flag for the implicit structured mesh, it must be set before the mesh generation
+     * @param flag true if only the grid sizes should be stored, the mesh is computed on the fly
+     */
+    void setImplicitMeshFlag(const bool &flag){m_meshdata.m_isimplicit=flag;}
 
     //*****************************************************
     //*** general gettings
@@ -115,6 +132,155 @@ public:
      * get the min dim of bulk mesh
      */
     inline int getBulkMeshMinDim()const{return m_meshdata.m_mindim;}
+    /**
+     * get the number of mesh in x-axis, only valid for the generated mesh
+     */
+    inline int getBulkMeshNx()const{return m_meshdata.m_nx;}
+    /**
+     * get the number of mesh in y-axis, only valid for the generated mesh
+     */
+    inline int getBulkMeshNy()const{return m_meshdata.m_ny;}
+    /**
+     * get the number of mesh in z-axis, only valid for the generated mesh
+     */
+    inline int getBulkMeshNz()const{return m_meshdata.m_nz;}
+    /**
+     * get the lower and upper bounds of the generated mesh, only valid for the generated mesh
+     * @param t_min the lower bounds (xmin,ymin,zmin)
+     * @param t_max the upper bounds (xmax,ymax,zmax)
+     */
+    inline void getBulkMeshBounds(double t_min[3],double t_max[3])const{
+        t_min[0]=m_meshdata.m_xmin;t_min[1]=m_meshdata.m_ymin;t_min[2]=m_meshdata.m_zmin;
+        t_max[0]=m_meshdata.m_xmax;t_max[1]=m_meshdata.m_ymax;t_max[2]=m_meshdata.m_zmax;
+    }
+    /**
+     * check whether the mesh is a tensor-product grid generated by AsFem
+     */
+    inline bool isStructuredMesh()const{return m_meshdata.m_isstructured;}
+    /**
+     * check whether the mesh is an implicit structured mesh, if true, there is no stored coordinates or connectivity
+     */
+    inline bool isImplicitMesh()const{return m_meshdata.m_isimplicit;}
+    //**************************************************
+    //*** for the distributed mesh
+    //**************************************************
+    /**
+     * check whether the distributed mesh is required by the input file
+     */
+    inline bool isDistributedMeshRequired()const{return m_meshdata.m_distribute;}
+    /**
+     * check whether the mesh is already distributed, if true, only the owned and the halo elements are stored
+     */
+    inline bool isDistributedMesh()const{return m_meshdata.m_isdistributed;}
+    /**
+     * get the number of the nodes stored on current processor
+     */
+    inline int getBulkMeshLocalNodesNum()const{
+        if(!m_meshdata.m_isdistributed) return m_meshdata.m_nodes;
+        return static_cast<int>(m_meshdata.m_node_local2global.size());
+    }
+    /**
+     * get the global id of the i-th local node
+     * @param i the local node index, start from 1
+     */
+    inline int getBulkMeshIthLocalNodeGlobalID(const int &i)const{
+        if(!m_meshdata.m_isdistributed) return i;
+        return m_meshdata.m_node_local2global[i-1];
+    }
+    /**
+     * get the local id (start from 1) of the global node id, the node must be stored on current processor
+     * @param i the global node id, start from 1
+     */
+    inline int getBulkMeshNodeLocalID(const int &i)const{
+        if(!m_meshdata.m_isdistributed) return i;
+        auto it=std::lower_bound(m_meshdata.m_node_local2global.begin(),m_meshdata.m_node_local2global.end(),i);
+        if(it==m_meshdata.m_node_local2global.end()||*it!=i){
+            MessagePrinter::printErrorTxt("node-"+to_string(i)+" is not stored on current processor, please check your distributed mesh");
+            MessagePrinter::exitAsFem();
+        }
+        return static_cast<int>(it-m_meshdata.m_node_local2global.begin())+1;
+    }
+    /**
+     * get the local id (start from 1) of the global bulk element id, the owned elements come first, then the halo ones
+     * @param i the global bulk element id, start from 1
+     */
+    inline int getBulkMeshBulkElmtLocalID(const int &i)const{
+        if(!m_meshdata.m_isdistributed) return i;
+        if(i-1>=m_meshdata.m_ownedbulkelmt_start&&i-1<m_meshdata.m_ownedbulkelmt_end){
+            return i-m_meshdata.m_ownedbulkelmt_start;
+        }
+        auto it=std::lower_bound(m_meshdata.m_halobulkelmt_local2global.begin(),m_meshdata.m_halobulkelmt_local2global.end(),i);
+        if(it==m_meshdata.m_halobulkelmt_local2global.end()||*it!=i){
+            MessagePrinter::printErrorTxt("bulk element-"+to_string(i)+" is not stored on current processor, please check your distributed mesh");
+            MessagePrinter::exitAsFem();
+        }
+        return m_meshdata.m_ownedbulkelmt_end-m_meshdata.m_ownedbulkelmt_start+static_cast<int>(it-m_meshdata.m_halobulkelmt_local2global.begin())+1;
+    }
+    /**
+     * get the range of the owned bulk elements (global id-1) on current processor, all the elements are owned if the mesh is not distributed
+     * @param eStart the first owned element
+     * @param eEnd the end of the owned elements, exclusive
+     */
+    inline void getBulkMeshOwnedBulkElmtsRange(int &eStart,int &eEnd)const{
+        if(!m_meshdata.m_isdistributed){
+            eStart=0;eEnd=m_meshdata.m_bulkelmts;
+            return;
+        }
+        eStart=m_meshdata.m_ownedbulkelmt_start;
+        eEnd=m_meshdata.m_ownedbulkelmt_end;
+    }
+    /**
+     * get the range (start from 0) of the bulk elements that a processor works on, the bulk elements are split into
+     * the contiguous blocks in their (space-filling curve) order, and the last rank takes the remainder. All the
+     * element loops, the partition of the distributed mesh and its importer must use this one
+     * @param nElmts the number of the bulk elements
+     * @param rank the rank of the processor
+     * @param size the number of the processors
+     * @param eStart the first element
+     * @param eEnd the end of the elements, exclusive
+     */
+    static inline void getBulkElmtsRange(const int &nElmts,const int &rank,const int &size,int &eStart,int &eEnd){
+        const int rankne=nElmts/size;
+        eStart=rank*rankne;
+        eEnd=(rank==size-1)?nElmts:(rank+1)*rankne;
+    }
+    /**
+     * get the processor which works on the e-th (start from 0) bulk element, it is the inverse of getBulkElmtsRange
+     * @param e the element index, start from 0
+     * @param nElmts the number of the bulk elements
+     * @param size the number of the processors
+     */
+    static inline int getBulkElmtOwnerRank(const int &e,const int &nElmts,const int &size){
+        const int rankne=nElmts/size;
+        if(rankne<1) return size-1;
+        return std::min(e/rankne,size-1);
+    }
+    /**
+     * get the range (start from 0) of the elements in a physical group that current rank works on. The elements of
+     * the replicated mesh are split evenly over the ranks, while the distributed mesh only stores the elements owned
+     * by current rank in its physical groups, then all of them are used
+     * @param nElmts the number of the elements in the physical group stored on current processor
+     * @param rank the rank of current processor
+     * @param size the number of the processors
+     * @param eStart the first element
+     * @param eEnd the end of the elements, exclusive
+     */
+    inline void getBulkMeshPhyGroupElmtsRange(const int &nElmts,const int &rank,const int &size,int &eStart,int &eEnd)const{
+        if(m_meshdata.m_isdistributed){
+            eStart=0;eEnd=nElmts;
+            return;
+        }
+        getBulkElmtsRange(nElmts,rank,size,eStart,eEnd);
+    }
+    /**
+     * get the number of the halo bulk elements on current processor
+     */
+    inline int getBulkMeshHaloBulkElmtsNum()const{return static_cast<int>(m_meshdata.m_halobulkelmt_local2global.size());}
+    /**
+     * get the global id of the i-th halo bulk element
+     * @param i the halo element index, start from 1
+     */
+    inline int getBulkMeshIthHaloBulkElmtGlobalID(const int &i)const{return m_meshdata.m_halobulkelmt_local2global[i-1];}
     //**************************************************
     //*** for elements number
     //**************************************************
@@ -139,27 +305,21 @@ public:
      * @param name string for the physical name 
      */
     inline int getBulkMeshElmtsNumViaPhyName(const string &name)const{
-        for(const auto &it:m_meshdata.m_phygroup_name2elmtconnvec){
-            if(it.first==name){
-                return static_cast<int>(it.second.size());
-            }
-        }
-        return 0;// if the name is not there, then return 0
+        const int h=getBulkMeshPhyGroupHandle(name);
+        if(h<1) return 0;// if the name is not there, then return 0
+        return getBulkMeshElmtsNumViaHandle(h);
     }
     /**
      * get the number of bulk elements via its physical name
      * @param name string for the physical name 
      */
     inline int getBulkMeshBulkElmtsNumViaPhyName(const string &name)const{
-        for(int i=0;i<m_meshdata.m_phygroups;i++){
-            if(m_meshdata.m_phygroup_phynamevec[i]==name && 
-               m_meshdata.m_phygroup_dimvec[i]==m_meshdata.m_maxdim){
-                return m_meshdata.m_phygroup_elmtnumvec[i];
-            }
+        const int h=getBulkMeshPhyGroupHandle(name);
+        if(h<1||m_meshdata.m_phygroup_handle2bulkgroupvec[h-1]<1){
+            MessagePrinter::printErrorTxt("can\'t find elements number for phyname="+name+" in your Mesh class");
+            MessagePrinter::exitAsFem();
         }
-        MessagePrinter::printErrorTxt("can\'t find elements number for phyname="+name+" in your Mesh class");
-        MessagePrinter::exitAsFem();
-        return 0;
+        return getBulkMeshBulkElmtsNumViaHandle(h);
     }
     /**
      * get i-th bulk elements global id via the physical group name
@@ -167,18 +327,12 @@ public:
      * @param i the local element index number, start from 1
      */
     inline int getBulkMeshIthBulkElmtIDViaPhyName(const string &name,const int &i)const{
-        for(const auto &it:m_meshdata.m_phygroup_name2bulkelmtidvec){
-            if(name==it.first){
-                if(i<1||i>static_cast<int>(it.second.size())){
-                    MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range in the bulk element set (phyname="+name+") in your Mesh class");
-                    MessagePrinter::exitAsFem();
-                }
-                return it.second[i-1];
-            }
+        const int h=getBulkMeshPhyGroupHandle(name);
+        if(h<1||m_meshdata.m_phygroup_handle2bulkgroupvec[h-1]<1){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range in the bulk element set (phyname="+name+") in your Mesh class");
+            MessagePrinter::exitAsFem();
         }
-        MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range in the bulk element set (phyname="+name+") in your Mesh class");
-        MessagePrinter::exitAsFem();
-        return -1;
+        return getBulkMeshIthBulkElmtIDViaHandle(h,i);
     }
     /**
      * get the vtk cell type of bulk elements
@@ -209,14 +363,123 @@ public:
      * @param name string for the physical name 
      */
     inline int getBulkMeshElmtDimViaPhyName(const string &name)const{
-        for(const auto &it:m_meshdata.m_phygroup_name2dimvec){
-            if(it.first==name){
-                return it.second;
+        const int h=getBulkMeshPhyGroupHandle(name);
+        if(h<1||m_meshdata.m_phygroup_handle2dimvec[h-1]<0){
+            MessagePrinter::printErrorTxt("can\'t find bulk element dim for phyname="+name+" in BulkMesh class");
+            MessagePrinter::exitAsFem();
+        }
+        return m_meshdata.m_phygroup_handle2dimvec[h-1];
+    }
+    //**************************************************
+    //*** for the physical group handles
+    //**************************************************
+    /**
+     * get the handle of the elemental physical group, the handle can be used by the '...ViaHandle' functions
+     * in the element loops, then the group name is only resolved once. 0 is returned if the name is not there
+     * @param name string for the physical name
+     */
+    inline int getBulkMeshPhyGroupHandle(const string &name)const{
+        auto it=m_meshdata.m_phygroup_name2handle.find(name);
+        if(it==m_meshdata.m_phygroup_name2handle.end()) return 0;
+        return it->second;
+    }
+    /**
+     * get the number of elements of the physical group
+     * @param h the group handle
+     */
+    inline int getBulkMeshElmtsNumViaHandle(const int &h)const{
+        if(m_meshdata.m_isimplicit) return m_meshdata.m_phygroup_elmtnumvec[h-1];
+        return static_cast<int>(m_meshdata.m_phygroup_name2elmtidvec[h-1].second.size());
+    }
+    /**
+     * get the elmt dim of the physical group
+     * @param h the group handle
+     */
+    inline int getBulkMeshElmtDimViaHandle(const int &h)const{
+        return m_meshdata.m_phygroup_handle2dimvec[h-1];
+    }
+    /**
+     * get the number of bulk elements of the physical group
+     * @param h the group handle, it must be a bulk element group
+     */
+    inline int getBulkMeshBulkElmtsNumViaHandle(const int &h)const{
+        if(m_meshdata.m_isimplicit) return m_meshdata.m_bulkelmts;
+        return static_cast<int>(m_meshdata.m_phygroup_name2bulkelmtidvec[m_meshdata.m_phygroup_handle2bulkgroupvec[h-1]-1].second.size());
+    }
+    /**
+     * get i-th bulk element global id of the physical group
+     * @param h the group handle, it must be a bulk element group
+     * @param i the local element index number, start from 1
+     */
+    inline int getBulkMeshIthBulkElmtIDViaHandle(const int &h,const int &i)const{
+        if(m_meshdata.m_isimplicit){
+            // the only bulk group is 'alldomain'
+            if(i<1||i>m_meshdata.m_bulkelmts){
+                MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range in the bulk element set (phyname="+m_meshdata.m_phygroup_name2elmtidvec[h-1].first+") in your Mesh class");
+                MessagePrinter::exitAsFem();
             }
+            return i;
         }
-        MessagePrinter::printErrorTxt("can\'t find bulk element dim for phyname="+name+" in BulkMesh class");
-        MessagePrinter::exitAsFem();
-        return 0;// if the name is not there, then return 0
+        const vector<int> &ids=m_meshdata.m_phygroup_name2bulkelmtidvec[m_meshdata.m_phygroup_handle2bulkgroupvec[h-1]-1].second;
+        if(i<1||i>static_cast<int>(ids.size())){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range in the bulk element set (phyname="+m_meshdata.m_phygroup_name2elmtidvec[h-1].first+") in your Mesh class");
+            MessagePrinter::exitAsFem();
+        }
+        return ids[i-1];
+    }
+    /**
+     * get the node ids of the i-th element of the physical group, the stored ones are valid until the mesh is modified
+     * @param h the group handle
+     * @param i i-th element in current physical group, start from 1
+     */
+    inline ElmtConnArray getBulkMeshIthElmtConnViaHandle(const int &h,const int &i)const{
+        if(m_meshdata.m_isimplicit){
+            if(i<1||i>m_meshdata.m_phygroup_elmtnumvec[h-1]){
+                MessagePrinter::printErrorTxt("i is out of range for your elements(phyname="+m_meshdata.m_phygroup_name2elmtidvec[h-1].first+")");
+                MessagePrinter::exitAsFem();
+            }
+            ElmtConnArray conn;
+            if(m_meshdata.m_phygroup_handle2dimvec[h-1]==m_meshdata.m_maxdim){
+                conn.setInlineSize(ImplicitStructuredMesh::getIthBulkElmtConn(m_meshdata,i,conn.getInlineArray()));
+                return conn;
+            }
+            // the boundary groups are the first ones, in the order of the sides
+            conn.setInlineSize(ImplicitStructuredMesh::getIthBCElmtConn(m_meshdata,h-1,i,conn.getInlineArray()));
+            return conn;
+        }
+        const vector<int> &ids=m_meshdata.m_phygroup_name2elmtidvec[h-1].second;
+        if(i<1||i>static_cast<int>(ids.size())){
+            MessagePrinter::printErrorTxt("i is out of range for your elements(phyname="+m_meshdata.m_phygroup_name2elmtidvec[h-1].first+")");
+            MessagePrinter::exitAsFem();
+        }
+        const int dim=m_meshdata.m_phygroup_handle2dimvec[h-1];
+        if(dim==m_meshdata.m_maxdim){
+            return m_meshdata.m_bulkelmt_connectivity[getBulkMeshBulkElmtLocalID(ids[i-1])-1];
+        }
+        return getBulkMeshElmtConnectivityViaDim(dim)[ids[i-1]-1];
+    }
+    /**
+     * get the init coordinates of i-th element of the physical group, the nodes class must initilized before use!
+     * @param h the group handle
+     * @param i integer for the index of i-th element in current physical group
+     * @param nodes nodes class stores their coordinates
+     */
+    inline void getBulkMeshIthElmtNodeCoords0ViaHandle(const int &h,const int &i,Nodes &nodes)const{
+        ElmtConnArray conn=getBulkMeshIthElmtConnViaHandle(h,i);
+        for(int j=1;j<=conn.size();j++){
+            nodes(j,1)=getBulkMeshIthNodeJthCoord0(conn[j-1],1);
+            nodes(j,2)=getBulkMeshIthNodeJthCoord0(conn[j-1],2);
+            nodes(j,3)=getBulkMeshIthNodeJthCoord0(conn[j-1],3);
+        }
+    }
+    /**
+     * get the handle of the nodal physical group, 0 is returned if the name is not there
+     * @param name string for the nodal physical name
+     */
+    inline int getBulkMeshNodeSetHandle(const string &name)const{
+        auto it=m_meshdata.m_nodephygroup_name2handle.find(name);
+        if(it==m_meshdata.m_nodephygroup_name2handle.end()) return 0;
+        return it->second;
     }
     //**************************************************
     //*** for mesh data
@@ -257,25 +520,15 @@ public:
             MessagePrinter::printErrorTxt("i is out of range for your bulk elements");
             MessagePrinter::exitAsFem();
         }
-        return static_cast<int>(m_meshdata.m_bulkelmt_connectivity[i-1].size());
+        if(m_meshdata.m_isimplicit) return m_meshdata.m_nodesperbulkelmt;
+        return m_meshdata.m_bulkelmt_connectivity.getIthElmtNodesNum(getBulkMeshBulkElmtLocalID(i)-1);
     }
     /**
      * get the nodes number of i-th element via its physical name
      * @param i i-th element
      */
     inline int getBulkMeshIthElmtNodesNumViaPhyName(const string &name,const int &i)const{
-        for(const auto &it:m_meshdata.m_phygroup_name2elmtconnvec){
-            if(it.first==name){
-                if(i<1||i>static_cast<int>(it.second.size())){
-                    MessagePrinter::printErrorTxt("i is out of range for your elements(phyname="+name+")");
-                    MessagePrinter::exitAsFem();
-                }
-                return static_cast<int>(it.second[i-1].size());
-            }
-        }
-        MessagePrinter::printErrorTxt("can\'t find nodes number for your elements (phyname="+name+")");
-        MessagePrinter::exitAsFem();
-        return 0;
+        return getBulkMeshIthElmtConnViaPhyName(name,i).size();
     }
     /**
      * get the nodes number of i-th element via its physical name
@@ -284,23 +537,39 @@ public:
      * @param j j-th node id
      */
     inline int getBulkMeshIthElmtJthNodeIDViaPhyName(const string &name,const int &i,const int &j)const{
-        for(const auto &it:m_meshdata.m_phygroup_name2elmtconnvec){
-            if(it.first==name){
-                if(i<1||i>static_cast<int>(it.second.size())){
-                    MessagePrinter::printErrorTxt("i is out of range for your elements(phyname="+name+")");
-                    MessagePrinter::exitAsFem();
-                }
-                if(j<1||j>static_cast<int>(it.second[i-1].size())){
-                    MessagePrinter::printErrorTxt("j is out of range for your elements(phyname="+name+")");
-                    MessagePrinter::exitAsFem();
-                }
-                
-                return it.second[i-1][j-1];
-            }
+        ElmtConnArray conn=getBulkMeshIthElmtConnViaPhyName(name,i);
+        if(j<1||j>conn.size()){
+            MessagePrinter::printErrorTxt("j is out of range for your elements(phyname="+name+")");
+            MessagePrinter::exitAsFem();
         }
-        MessagePrinter::printErrorTxt("can\'t find node id for your elements (phyname="+name+")");
+        return conn[j-1];
+    }
+    /**
+     * get the connectivity storage of the elements with the given dim, for the max dim it is the bulk one, it is
+     * empty for the implicit mesh
+     * @param dim the dim of the elements
+     */
+    inline const ElmtConnectivity& getBulkMeshElmtConnectivityViaDim(const int &dim)const{
+        if(dim==m_meshdata.m_maxdim) return m_meshdata.m_bulkelmt_connectivity;
+        if(dim==0) return m_meshdata.m_pointelmt_connectivity;
+        if(dim==1) return m_meshdata.m_lineelmt_connectivity;
+        if(dim==2) return m_meshdata.m_surfaceelmt_connectivity;
+        MessagePrinter::printErrorTxt("dim="+to_string(dim)+" is invalid for the element connectivity");
         MessagePrinter::exitAsFem();
-        return -1;
+        return m_meshdata.m_bulkelmt_connectivity;
+    }
+    /**
+     * get the node ids of the i-th element via its physical name, the stored ones are valid until the mesh is modified
+     * @param name physical name
+     * @param i i-th element in current physical group, start from 1
+     */
+    inline ElmtConnArray getBulkMeshIthElmtConnViaPhyName(const string &name,const int &i)const{
+        const int h=getBulkMeshPhyGroupHandle(name);
+        if(h<1){
+            MessagePrinter::printErrorTxt("can\'t find the element set for phyname="+name);
+            MessagePrinter::exitAsFem();
+        }
+        return getBulkMeshIthElmtConnViaHandle(h,i);
     }
     /**
      * get the j-th node id of i-th element
@@ -316,7 +585,30 @@ public:
             MessagePrinter::printErrorTxt("j is out of range for node index(j<1 or j>"+to_string(m_meshdata.m_nodesperbulkelmt)+")");
             MessagePrinter::exitAsFem();
         }
-        return m_meshdata.m_bulkelmt_connectivity[i-1][j-1];
+        return getIthBulkElmtConnArray(i)[j-1];
+    }
+    /**
+     * get the local id of the j-th node of i-th element, it indexes the local nodal arrays (i.e. the nodal dofs map) directly
+     * @param i i-th element, it must be stored on current processor
+     * @param j j-th node index
+     */
+    inline int getBulkMeshIthBulkElmtJthLocalNodeID(const int &i,const int &j)const{
+        if(j<1||j>m_meshdata.m_nodesperbulkelmt){
+            MessagePrinter::printErrorTxt("j is out of range for node index(j<1 or j>"+to_string(m_meshdata.m_nodesperbulkelmt)+")");
+            MessagePrinter::exitAsFem();
+        }
+        return getIthBulkElmtLocalConnArray(i)[j-1];
+    }
+    /**
+     * get the node ids of the i-th bulk element, the stored ones are valid until the mesh is modified
+     * @param i the element index, start from 1
+     */
+    inline ElmtConnArray getBulkMeshIthBulkElmtConn(const int &i)const{
+        if(i<1||i>m_meshdata.m_bulkelmts){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range for bulk element(n="+to_string(m_meshdata.m_bulkelmts)+")");
+            MessagePrinter::exitAsFem();
+        }
+        return getIthBulkElmtConnArray(i);
     }
     /**
      * get the i-th element's connectivity info, index start from 0
@@ -327,8 +619,9 @@ public:
             MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range for bulk element(n="+to_string(m_meshdata.m_bulkelmts)+")");
             MessagePrinter::exitAsFem();
         }
-        for(int j=1;j<=m_meshdata.m_nodesperbulkelmt;j++){
-            t_conn[j-1]=getBulkMeshIthBulkElmtJthNodeID(i,j)-1;
+        ElmtConnArray conn=getIthBulkElmtConnArray(i);
+        for(int j=1;j<=conn.size();j++){
+            t_conn[j-1]=conn[j-1]-1;
         }
     }
     /**
@@ -340,8 +633,9 @@ public:
             MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range for bulk element(n="+to_string(m_meshdata.m_bulkelmts)+")");
             MessagePrinter::exitAsFem();
         }
-        for(int j=1;j<=m_meshdata.m_nodesperbulkelmt;j++){
-            t_conn[j-1]=getBulkMeshIthBulkElmtJthNodeID(i,j);
+        ElmtConnArray conn=getIthBulkElmtConnArray(i);
+        for(int j=1;j<=conn.size();j++){
+            t_conn[j-1]=conn[j-1];
         }
     }
     /**
@@ -350,46 +644,55 @@ public:
      * @param i i-th node index
      */
     inline int getBulkMeshIthNodeIDViaNodeSetName(const string setname,const int &i)const{
-        for(const auto &it:m_meshdata.m_nodephygroup_name2nodeidvec){
-            if(it.first==setname){
-                if(i<1||i>static_cast<int>(it.second.size())){
-                    MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range("+to_string(static_cast<int>(it.second.size()))+") for a nodeset");
-                    MessagePrinter::exitAsFem();
-                }
-                return it.second[i-1];
+        const int h=getBulkMeshNodeSetHandle(setname);
+        if(h<1){
+            MessagePrinter::printErrorTxt("can\'t find node id for your node set (phyname="+setname+")");
+            MessagePrinter::exitAsFem();
+        }
+        if(m_meshdata.m_isimplicit){
+            const int n=ImplicitStructuredMesh::getNodeSetNodesNum(m_meshdata,h-1);
+            if(i<1||i>n){
+                MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range("+to_string(n)+") for a nodeset");
+                MessagePrinter::exitAsFem();
             }
+            return ImplicitStructuredMesh::getIthNodeSetNodeID(m_meshdata,h-1,i);
         }
-        MessagePrinter::printErrorTxt("can\'t find node id for your node set (phyname="+setname+")");
-        MessagePrinter::exitAsFem();
-        return 0;
+        const vector<int> &ids=m_meshdata.m_nodephygroup_name2nodeidvec[h-1].second;
+        if(i<1||i>static_cast<int>(ids.size())){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range("+to_string(static_cast<int>(ids.size()))+") for a nodeset");
+            MessagePrinter::exitAsFem();
+        }
+        return ids[i-1];
     }
     /**
-     * get the node id of the required (by name) nodeset
+     * get the node id of the required (by name) nodeset, for the implicit mesh the ids are computed into a new vector
      * @param setname the physical name of the nodeset
      */
     inline vector<int> getBulkMeshNodeIDsViaNodeSetName(const string setname)const{
-        for(const auto &it:m_meshdata.m_nodephygroup_name2nodeidvec){
-            if(it.first==setname){
-                return it.second;
-            }
+        const int h=getBulkMeshNodeSetHandle(setname);
+        if(h<1){
+            MessagePrinter::printErrorTxt("can\'t find node ids for your node set (phyname="+setname+")");
+            MessagePrinter::exitAsFem();
         }
-        MessagePrinter::printErrorTxt("can\'t find node ids for your node set (phyname="+setname+")");
-        MessagePrinter::exitAsFem();
-        return vector<int>(0);
+        if(m_meshdata.m_isimplicit){
+            vector<int> ids(ImplicitStructuredMesh::getNodeSetNodesNum(m_meshdata,h-1));
+            for(int i=0;i<static_cast<int>(ids.size());i++) ids[i]=ImplicitStructuredMesh::getIthNodeSetNodeID(m_meshdata,h-1,i+1);
+            return ids;
+        }
+        return m_meshdata.m_nodephygroup_name2nodeidvec[h-1].second;
     }
     /**
      * get the number of nodes via its nodal physical name
      * @param name string for the nodal physical name
      */
     inline int getBulkMeshNodesNumViaNodeSetName(const string &name)const{
-        for(const auto &it:m_meshdata.m_nodephygroup_name2nodeidvec){
-            if(it.first==name){
-                return static_cast<int>(it.second.size());
-            }
+        const int h=getBulkMeshNodeSetHandle(name);
+        if(h<1){
+            MessagePrinter::printErrorTxt("can\'t find node number for your node set (phyname="+name+")");
+            MessagePrinter::exitAsFem();
         }
-        MessagePrinter::printErrorTxt("can\'t find node number for your node set (phyname="+name+")");
-        MessagePrinter::exitAsFem();
-        return 0;
+        if(m_meshdata.m_isimplicit) return ImplicitStructuredMesh::getNodeSetNodesNum(m_meshdata,h-1);
+        return static_cast<int>(m_meshdata.m_nodephygroup_name2nodeidvec[h-1].second.size());
     }
     //**************************************************
     //*** for nodes coordinates
@@ -408,7 +711,8 @@ public:
             MessagePrinter::printErrorTxt("j is out of range for node coordinate(j<1 or j>3)");
             MessagePrinter::exitAsFem();
         }
-        return m_meshdata.m_nodecoords0[(i-1)*3+j-1];
+        if(m_meshdata.m_isimplicit) return ImplicitStructuredMesh::getIthNodeJthCoord(m_meshdata,i,j);
+        return m_meshdata.m_nodecoords0[(getBulkMeshNodeLocalID(i)-1)*3+j-1];
     }
     /**
      * get the i-th node's j-th coordinate, this is the currrent coordinate
@@ -424,7 +728,8 @@ public:
             MessagePrinter::printErrorTxt("j is out of range for node coordinate(j<1 or j>3)");
             MessagePrinter::exitAsFem();
         }
-        return m_meshdata.m_nodecoords[(i-1)*3+j-1];
+        if(m_meshdata.m_isimplicit) return ImplicitStructuredMesh::getIthNodeJthCoord(m_meshdata,i,j);
+        return m_meshdata.m_nodecoords[(getBulkMeshNodeLocalID(i)-1)*3+j-1];
     }
     /**
      * get the init coordinates of i-th bulk element, the nodes class must initilized before use!
@@ -437,11 +742,23 @@ public:
             MessagePrinter::exitAsFem();
         }
         int j,iInd;
-        for(j=1;j<=static_cast<int>(m_meshdata.m_bulkelmt_connectivity[i-1].size());j++){
-            iInd=m_meshdata.m_bulkelmt_connectivity[i-1][j-1];
-            nodes(j,1)=getBulkMeshIthNodeJthCoord0(iInd,1);
-            nodes(j,2)=getBulkMeshIthNodeJthCoord0(iInd,2);
-            nodes(j,3)=getBulkMeshIthNodeJthCoord0(iInd,3);
+        if(m_meshdata.m_isimplicit){
+            ElmtConnArray conn=getIthBulkElmtConnArray(i);
+            for(j=1;j<=conn.size();j++){
+                iInd=conn[j-1];
+                nodes(j,1)=getBulkMeshIthNodeJthCoord0(iInd,1);
+                nodes(j,2)=getBulkMeshIthNodeJthCoord0(iInd,2);
+                nodes(j,3)=getBulkMeshIthNodeJthCoord0(iInd,3);
+            }
+            return;
+        }
+        // the local node ids index the stored coordinates directly
+        ElmtConnArray conn=getIthBulkElmtLocalConnArray(i);
+        for(j=1;j<=conn.size();j++){
+            iInd=conn[j-1];
+            nodes(j,1)=m_meshdata.m_nodecoords0[(iInd-1)*3  ];
+            nodes(j,2)=m_meshdata.m_nodecoords0[(iInd-1)*3+1];
+            nodes(j,3)=m_meshdata.m_nodecoords0[(iInd-1)*3+2];
         }
     }
     /**
@@ -455,11 +772,23 @@ public:
             MessagePrinter::exitAsFem();
         }
         int j,iInd;
-        for(j=1;j<=static_cast<int>(m_meshdata.m_bulkelmt_connectivity[i-1].size());j++){
-            iInd=m_meshdata.m_bulkelmt_connectivity[i-1][j-1];
-            nodes(j,1)=getBulkMeshIthNodeJthCoord(iInd,1);
-            nodes(j,2)=getBulkMeshIthNodeJthCoord(iInd,2);
-            nodes(j,3)=getBulkMeshIthNodeJthCoord(iInd,3);
+        if(m_meshdata.m_isimplicit){
+            ElmtConnArray conn=getIthBulkElmtConnArray(i);
+            for(j=1;j<=conn.size();j++){
+                iInd=conn[j-1];
+                nodes(j,1)=getBulkMeshIthNodeJthCoord(iInd,1);
+                nodes(j,2)=getBulkMeshIthNodeJthCoord(iInd,2);
+                nodes(j,3)=getBulkMeshIthNodeJthCoord(iInd,3);
+            }
+            return;
+        }
+        // the local node ids index the stored coordinates directly
+        ElmtConnArray conn=getIthBulkElmtLocalConnArray(i);
+        for(j=1;j<=conn.size();j++){
+            iInd=conn[j-1];
+            nodes(j,1)=m_meshdata.m_nodecoords[(iInd-1)*3  ];
+            nodes(j,2)=m_meshdata.m_nodecoords[(iInd-1)*3+1];
+            nodes(j,3)=m_meshdata.m_nodecoords[(iInd-1)*3+2];
         }
     }
     /**
@@ -469,27 +798,13 @@ public:
      * @param nodes nodes class stores their coordinates
      */
     inline void getBulkMeshIthElmtNodeCoords0ViaPhyName(const string &name,const int &i,Nodes &nodes)const{
-        bool IsValidName=false;
         int j,iInd;
-        for(const auto &it:m_meshdata.m_phygroup_name2elmtconnvec){
-            if(it.first==name){
-                // now, we found the correct vector
-                if(i<1||i>static_cast<int>(it.second.size())){
-                    MessagePrinter::printErrorTxt("i is out of range for phyname="+name+" elements");
-                    MessagePrinter::exitAsFem();
-                }
-                for(j=1;j<=static_cast<int>(it.second[i-1].size());j++){
-                    iInd=it.second[i-1][j-1];
-                    nodes(j,1)=getBulkMeshIthNodeJthCoord0(iInd,1);
-                    nodes(j,2)=getBulkMeshIthNodeJthCoord0(iInd,2);
-                    nodes(j,3)=getBulkMeshIthNodeJthCoord0(iInd,3);
-                }
-                IsValidName=true;break;
-            }
-        }
-        if(!IsValidName){
-            MessagePrinter::printErrorTxt("can\'t find the element set for phyname="+name);
-            MessagePrinter::exitAsFem();
+        ElmtConnArray conn=getBulkMeshIthElmtConnViaPhyName(name,i);
+        for(j=1;j<=conn.size();j++){
+            iInd=conn[j-1];
+            nodes(j,1)=getBulkMeshIthNodeJthCoord0(iInd,1);
+            nodes(j,2)=getBulkMeshIthNodeJthCoord0(iInd,2);
+            nodes(j,3)=getBulkMeshIthNodeJthCoord0(iInd,3);
         }
     }
     /**
@@ -499,27 +814,13 @@ public:
      * @param nodes nodes class stores their coordinates
      */
     inline void getBulkMeshIthElmtNodeCoordsViaPhyName(const string &name,const int &i,Nodes &nodes)const{
-        bool IsValidName=false;
         int j,iInd;
-        for(const auto &it:m_meshdata.m_phygroup_name2elmtconnvec){
-            if(it.first==name){
-                // now, we found the correct vector
-                if(i<1||i>static_cast<int>(it.second.size())){
-                    MessagePrinter::printErrorTxt("i is out of range for phyname="+name+" elements");
-                    MessagePrinter::exitAsFem();
-                }
-                for(j=1;j<=static_cast<int>(it.second[i-1].size());j++){
-                    iInd=it.second[i-1][j-1];
-                    nodes(j,1)=getBulkMeshIthNodeJthCoord(iInd,1);
-                    nodes(j,2)=getBulkMeshIthNodeJthCoord(iInd,2);
-                    nodes(j,3)=getBulkMeshIthNodeJthCoord(iInd,3);
-                }
-                IsValidName=true;break;
-            }
-        }
-        if(!IsValidName){
-            MessagePrinter::printErrorTxt("can\'t find the element set for phyname="+name);
-            MessagePrinter::exitAsFem();
+        ElmtConnArray conn=getBulkMeshIthElmtConnViaPhyName(name,i);
+        for(j=1;j<=conn.size();j++){
+            iInd=conn[j-1];
+            nodes(j,1)=getBulkMeshIthNodeJthCoord(iInd,1);
+            nodes(j,2)=getBulkMeshIthNodeJthCoord(iInd,2);
+            nodes(j,3)=getBulkMeshIthNodeJthCoord(iInd,3);
         }
     }
     //**************************************************
@@ -575,32 +876,25 @@ public:
      * get nodes number of i-th nodal physical group
      * @param i integer for i-th physical group
      */
-    inline int getBulkMeshIthNodalPhyGroupNodesNum(const int &i)const{return static_cast<int>(m_meshdata.m_nodephygroup_name2nodeidvec[i-1].second.size());}
+    inline int getBulkMeshIthNodalPhyGroupNodesNum(const int &i)const{
+        if(m_meshdata.m_isimplicit) return ImplicitStructuredMesh::getNodeSetNodesNum(m_meshdata,i-1);
+        return static_cast<int>(m_meshdata.m_nodephygroup_name2nodeidvec[i-1].second.size());
+    }
     /**
      * check whether the given string name is a valid physical group name for boundary mesh
      * @param phyname the physical name of the boundary mesh
      */
     inline bool isBCElmtPhyNameValid(const string &phyname)const{
-        for(int i=0;i<m_meshdata.m_phygroups;i++){
-            if(m_meshdata.m_phygroup_dimvec[i]<m_meshdata.m_maxdim && 
-               m_meshdata.m_phygroup_phynamevec[i]==phyname){
-                return true;
-            }
-        }
-        return false;
+        const int h=getBulkMeshPhyGroupHandle(phyname);
+        return h>0&&m_meshdata.m_phygroup_handle2dimvec[h-1]>=0&&m_meshdata.m_phygroup_handle2dimvec[h-1]<m_meshdata.m_maxdim;
     }
     /**
      * check whether the given string name is a valid physical group name for bulk mesh
      * @param phyname the physical name of the bulk mesh
      */
     inline bool isBulkElmtPhyNameValid(const string &phyname)const{
-        for(int i=0;i<m_meshdata.m_phygroups;i++){
-            if(m_meshdata.m_phygroup_dimvec[i]==m_meshdata.m_maxdim && 
-               m_meshdata.m_phygroup_phynamevec[i]==phyname){
-                return true;
-            }
-        }
-        return false;
+        const int h=getBulkMeshPhyGroupHandle(phyname);
+        return h>0&&m_meshdata.m_phygroup_handle2dimvec[h-1]==m_meshdata.m_maxdim;
     }
    
 
@@ -622,11 +916,69 @@ public:
      */
     void saveBulkMesh2VTU(const string &inputfilename)const;
 
+    /**
+     * save the imported mesh to the binary cache file, i.e. 'xxx.msh' is cached in 'xxx.msh.cache', the size
+     * and the hash of the mesh file are stored as well, then the modified mesh file invalidates the cache
+     * @param meshfile the string name of the mesh file
+     */
+    void saveBulkMesh2Cache(const string &meshfile)const;
+    /**
+     * load the mesh from the binary cache file of the given mesh file, false is returned if the cache doesn't
+     * exist or it is out of date, then the mesh file should be imported as usual
+     * @param meshfile the string name of the mesh file
+     */
+    bool loadBulkMeshFromCache(const string &meshfile);
+    /**
+     * get the name of the binary cache file of the given mesh file
+     * @param meshfile the string name of the mesh file
+     */
+    static string getMeshCacheFileName(const string &meshfile);
+
+    /**
+     * create the hashed name to handle maps of the physical groups, it must be called once the mesh is ready
+     */
+    void createPhyGroupHandles();
+
+    /**
+     * distribute the mesh among the processors, each one only keeps its owned bulk elements, their nodes
+     * and one layer of halo elements, the physical groups are filtered to the local entities as well
+     */
+    void distributeBulkMesh();
+
+    /**
+     * reorder the imported mesh for the cache locality, the bulk elements are sorted along the space-filling curve
+     * of their centroids, and the nodes are renumbered by the first touch, the physical groups are updated as well
+     * @param type the space-filling curve, nothing is done for MeshReorderType::NONE
+     */
+    void reorderBulkMesh(const MeshReorderType &type);
+
     /**
      * release memory
      */
     void releaseMemory();
 
+private:
+    /**
+     * get the node ids of the i-th bulk element without the range check, for the implicit mesh they are computed
+     * @param i the global element id, start from 1
+     */
+    inline ElmtConnArray getIthBulkElmtConnArray(const int &i)const{
+        if(m_meshdata.m_isimplicit){
+            ElmtConnArray conn;
+            conn.setInlineSize(ImplicitStructuredMesh::getIthBulkElmtConn(m_meshdata,i,conn.getInlineArray()));
+            return conn;
+        }
+        return m_meshdata.m_bulkelmt_connectivity[getBulkMeshBulkElmtLocalID(i)-1];
+    }
+    /**
+     * get the local node ids (start from 1) of the i-th bulk element, they equal the global ones if the mesh is not distributed
+     * @param i the global element id, start from 1
+     */
+    inline ElmtConnArray getIthBulkElmtLocalConnArray(const int &i)const{
+        if(!m_meshdata.m_isdistributed) return getIthBulkElmtConnArray(i);
+        return m_meshdata.m_bulkelmt_localconnectivity[getBulkMeshBulkElmtLocalID(i)-1];
+    }
+
 protected:
     MeshData m_meshdata;/**< mesh data for nodal coordinates, elemental connecitivty, etc. */
     
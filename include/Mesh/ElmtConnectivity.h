@@ -0,0 +1,249 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the flat (CSR) storage of the element connectivity,
+//+++          the node ids of all the elements are stored in one
+//+++          contiguous array, and the offsets array tells where
+//+++          each element starts
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <vector>
+
+using std::vector;
+
+/**
+ * the read-only view of the node ids of one element, it is only valid as long as the storage is not modified
+ */
+class ElmtConnSpan{
+public:
+    /**
+     * constructor
+     * @param t_data the pointer to the 1st node id
+     * @param t_size the number of nodes
+     */
+    ElmtConnSpan(const int *t_data,const int &t_size):m_data(t_data),m_size(t_size){}
+
+    /**
+     * get the number of nodes
+     */
+    inline int size()const{return m_size;}
+    /**
+     * check whether the span is empty
+     */
+    inline bool empty()const{return m_size==0;}
+    /**
+     * get the i-th node id, start from 0
+     * @param i the local node index
+     */
+    inline const int& operator[](const int &i)const{return m_data[i];}
+    /**
+     * get the pointer to the 1st node id
+     */
+    inline const int* data()const{return m_data;}
+    /**
+     * the begin and end pointers, for the range based loop
+     */
+    inline const int* begin()const{return m_data;}
+    inline const int* end()const{return m_data+m_size;}
+    /**
+     * copy the node ids to a vector
+     */
+    inline vector<int> toVector()const{return vector<int>(m_data,m_data+m_size);}
+
+private:
+    const int *m_data;/**< the pointer to the 1st node id */
+    int m_size;/**< the number of nodes */
+};
+
+/**
+ * the node ids of one element returned by value, they either refer to the stored connectivity, or are kept in the
+ * inline array if they are computed on the fly (i.e. the implicit mesh), so each copy is valid on its own
+ */
+class ElmtConnArray{
+public:
+    static const int MaxInlineNodes=8;/**< the max number of the node ids kept in the inline array */
+    /**
+     * constructor, the node ids are filled into the inline array, see getInlineArray
+     */
+    ElmtConnArray():m_data(m_inline),m_size(0){}
+    /**
+     * constructor, the node ids refer to the stored connectivity
+     * @param t_conn the stored node ids
+     */
+    ElmtConnArray(const ElmtConnSpan &t_conn):m_data(t_conn.data()),m_size(t_conn.size()){}
+    ElmtConnArray(const ElmtConnArray &t_conn){copyFrom(t_conn);}
+    ElmtConnArray& operator=(const ElmtConnArray &t_conn){copyFrom(t_conn);return *this;}
+
+    /**
+     * get the inline array to be filled, there is room for MaxInlineNodes node ids
+     */
+    inline int* getInlineArray(){m_data=m_inline;return m_inline;}
+    /**
+     * set the number of the node ids filled into the inline array
+     * @param t_size the number of nodes
+     */
+    inline void setInlineSize(const int &t_size){m_size=t_size;}
+
+    /**
+     * get the number of nodes
+     */
+    inline int size()const{return m_size;}
+    /**
+     * check whether there is no node
+     */
+    inline bool empty()const{return m_size==0;}
+    /**
+     * get the i-th node id, start from 0
+     * @param i the local node index
+     */
+    inline const int& operator[](const int &i)const{return m_data[i];}
+    /**
+     * get the pointer to the 1st node id
+     */
+    inline const int* data()const{return m_data;}
+    /**
+     * the begin and end pointers, for the range based loop
+     */
+    inline const int* begin()const{return m_data;}
+    inline const int* end()const{return m_data+m_size;}
+    /**
+     * copy the node ids to a vector
+     */
+    inline vector<int> toVector()const{return vector<int>(m_data,m_data+m_size);}
+
+private:
+    /**
+     * copy another one, the inline node ids are copied, the stored ones are referred
+     * @param t_conn another one
+     */
+    inline void copyFrom(const ElmtConnArray &t_conn){
+        m_size=t_conn.m_size;
+        if(t_conn.m_data!=t_conn.m_inline){
+            m_data=t_conn.m_data;
+            return;
+        }
+        for(int i=0;i<m_size;i++) m_inline[i]=t_conn.m_inline[i];
+        m_data=m_inline;
+    }
+
+private:
+    const int *m_data;/**< the pointer to the 1st node id, either the stored one or m_inline */
+    int m_size;/**< the number of nodes */
+    int m_inline[MaxInlineNodes];/**< the node ids computed on the fly */
+};
+
+/**
+ * the connectivity of a set of elements in CSR format
+ */
+class ElmtConnectivity{
+public:
+    /**
+     * constructor
+     */
+    ElmtConnectivity(){
+        m_offsets.assign(1,0);m_nodeids.clear();
+    }
+
+    /**
+     * remove all the elements
+     */
+    inline void clear(){
+        m_offsets.assign(1,0);m_nodeids.clear();
+    }
+    /**
+     * release all the memory
+     */
+    inline void releaseMemory(){
+        vector<int>(1,0).swap(m_offsets);
+        vector<int>().swap(m_nodeids);
+    }
+    /**
+     * reserve the memory
+     * @param t_elmts the number of elements
+     * @param t_nodeids the number of total node ids
+     */
+    inline void reserve(const int &t_elmts,const int &t_nodeids){
+        m_offsets.reserve(t_elmts+1);m_nodeids.reserve(t_nodeids);
+    }
+    /**
+     * replace the storage by the given raw arrays
+     * @param t_elmts the number of elements
+     * @param t_offsets the offsets array, its size is t_elmts+1 and it starts from 0
+     * @param t_nodeids the node ids array, its size is t_offsets[t_elmts]
+     */
+    inline void assign(const int &t_elmts,const int *t_offsets,const int *t_nodeids){
+        m_offsets.assign(t_offsets,t_offsets+t_elmts+1);
+        m_nodeids.assign(t_nodeids,t_nodeids+t_offsets[t_elmts]);
+    }
+    /**
+     * swap the storage with another one
+     * @param t_conn another connectivity
+     */
+    inline void swap(ElmtConnectivity &t_conn){
+        m_offsets.swap(t_conn.m_offsets);m_nodeids.swap(t_conn.m_nodeids);
+    }
+
+    /**
+     * append one element at the end
+     * @param t_conn the node ids of the new element
+     */
+    inline void push_back(const vector<int> &t_conn){
+        m_nodeids.insert(m_nodeids.end(),t_conn.begin(),t_conn.end());
+        m_offsets.push_back(static_cast<int>(m_nodeids.size()));
+    }
+    /**
+     * append one element at the end
+     * @param t_conn the node ids of the new element
+     */
+    inline void push_back(const ElmtConnSpan &t_conn){
+        m_nodeids.insert(m_nodeids.end(),t_conn.begin(),t_conn.end());
+        m_offsets.push_back(static_cast<int>(m_nodeids.size()));
+    }
+
+    /**
+     * get the number of elements
+     */
+    inline int size()const{return static_cast<int>(m_offsets.size())-1;}
+    /**
+     * check whether there is no element
+     */
+    inline bool empty()const{return m_offsets.size()<2;}
+    /**
+     * get the number of nodes of the i-th element, start from 0
+     * @param i the element index
+     */
+    inline int getIthElmtNodesNum(const int &i)const{return m_offsets[i+1]-m_offsets[i];}
+    /**
+     * get the node ids of the i-th element, start from 0
+     * @param i the element index
+     */
+    inline ElmtConnSpan operator[](const int &i)const{
+        return ElmtConnSpan(m_nodeids.data()+m_offsets[i],m_offsets[i+1]-m_offsets[i]);
+    }
+    /**
+     * get the offsets array, its size is the number of elements+1
+     */
+    inline const vector<int>& getOffsetsRef()const{return m_offsets;}
+    /**
+     * get the node ids array of all the elements
+     */
+    inline const vector<int>& getNodeIDsRef()const{return m_nodeids;}
+    /**
+     * get the node ids array of all the elements, the node ids can be renumbered in place
+     */
+    inline vector<int>& getNodeIDsRef(){return m_nodeids;}
+
+private:
+    vector<int> m_offsets;/**< the offset of each element in m_nodeids, the last one is the size of m_nodeids */
+    vector<int> m_nodeids;/**< the node ids (start from 1) of all the elements */
+};
@@ -18,6 +18,7 @@
 
 #include "Mesh/MeshFileImporterBase.h"
 #include "Mesh/MshFileUtils.h"
+#include "Mesh/MshFileTokenizer.h"
 
 /**
  * This class implements the msh file (version-2) import function.
@@ -0,0 +1,165 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the index arithmetic of the implicit structured mesh,
+//+++          for the quad4/hex8 grid generated by AsFem, only nx,
+//+++          ny, nz and the bounds are stored, then the nodal
+//+++          coordinates, the element connectivity and the left/
+//+++          right/bottom/top/back/front sets are computed from the
+//+++          (i,j,k) indices. The numbering is exactly the same as
+//+++          the one of Lagrange2D/3DMeshGenerator
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include "Mesh/MeshData.h"
+
+/**
+ * the on-the-fly queries of the implicit structured mesh, all the ids start from 1. The boundary side index follows
+ * the order of the physical groups of the generator, i.e. 0->left, 1->right, 2->bottom, 3->top, 4->back, 5->front
+ */
+class ImplicitStructuredMesh{
+public:
+    /**
+     * get the global node id of the (i,j,k)-th grid point
+     * @param t_meshdata the mesh data with the grid sizes
+     * @param i the index in x-axis, start from 1
+     * @param j the index in y-axis, start from 1
+     * @param k the index in z-axis, start from 1, it is ignored in 2d case
+     */
+    static inline int getNodeID(const MeshData &t_meshdata,const int &i,const int &j,const int &k){
+        if(t_meshdata.m_maxdim==2) return (j-1)*(t_meshdata.m_nx+1)+i;
+        return (k-1)*(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1)+(j-1)*(t_meshdata.m_nx+1)+i;
+    }
+    /**
+     * get the j-th coordinate of the i-th node
+     * @param t_meshdata the mesh data with the grid sizes
+     * @param i the global node id
+     * @param j the coordinate component, 1->x, 2->y, 3->z
+     */
+    static inline double getIthNodeJthCoord(const MeshData &t_meshdata,const int &i,const int &j){
+        const int nxy=(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
+        const int r=(i-1)%nxy;
+        if(j==1){
+            const double dx=(t_meshdata.m_xmax-t_meshdata.m_xmin)/t_meshdata.m_nx;
+            return t_meshdata.m_xmin+(r%(t_meshdata.m_nx+1))*dx;
+        }
+        else if(j==2){
+            const double dy=(t_meshdata.m_ymax-t_meshdata.m_ymin)/t_meshdata.m_ny;
+            return t_meshdata.m_ymin+(r/(t_meshdata.m_nx+1))*dy;
+        }
+        if(t_meshdata.m_maxdim==2) return 0.0;
+        const double dz=(t_meshdata.m_zmax-t_meshdata.m_zmin)/t_meshdata.m_nz;
+        return t_meshdata.m_zmin+((i-1)/nxy)*dz;
+    }
+    /**
+     * get the node ids of the e-th bulk element, the number of nodes is returned
+     * @param t_meshdata the mesh data with the grid sizes
+     * @param e the global bulk element id
+     * @param t_conn the node ids, it must have the space for 8 ids
+     */
+    static inline int getIthBulkElmtConn(const MeshData &t_meshdata,const int &e,int *t_conn){
+        const int nx=t_meshdata.m_nx,ny=t_meshdata.m_ny;
+        const int i=(e-1)%nx+1;
+        const int j=((e-1)/nx)%ny+1;
+        t_conn[0]=(j-1)*(nx+1)+i;
+        if(t_meshdata.m_maxdim==3) t_conn[0]+=((e-1)/(nx*ny))*(nx+1)*(ny+1);
+        t_conn[1]=t_conn[0]+1;
+        t_conn[2]=t_conn[1]+nx+1;
+        t_conn[3]=t_conn[2]-1;
+        if(t_meshdata.m_maxdim==2) return 4;
+        for(int n=0;n<4;n++) t_conn[4+n]=t_conn[n]+(nx+1)*(ny+1);
+        return 8;
+    }
+    /**
+     * get the number of elements on the given boundary side
+     * @param t_meshdata the mesh data with the grid sizes
+     * @param t_side the boundary side index
+     */
+    static inline int getBCElmtsNum(const MeshData &t_meshdata,const int &t_side){
+        const int nx=t_meshdata.m_nx,ny=t_meshdata.m_ny,nz=t_meshdata.m_nz;
+        if(t_meshdata.m_maxdim==2) return t_side<2?ny:nx;
+        if(t_side<2) return ny*nz;
+        if(t_side<4) return nx*nz;
+        return nx*ny;
+    }
+    /**
+     * get the node ids of the i-th element on the given boundary side, the number of nodes is returned
+     * @param t_meshdata the mesh data with the grid sizes
+     * @param t_side the boundary side index
+     * @param i the element index on this side, start from 1
+     * @param t_conn the node ids, it must have the space for 8 ids
+     */
+    static inline int getIthBCElmtConn(const MeshData &t_meshdata,const int &t_side,const int &i,int *t_conn){
+        // the local nodes of the bulk element on each side, the same layout as the generators
+        static const int LineLocalIDs[4][2]={{3,0},{1,2},{0,1},{2,3}};
+        static const int SurfaceLocalIDs[6][4]={{0,4,7,3},{1,2,6,5},{0,1,5,4},{3,7,6,2},{0,3,2,1},{4,5,6,7}};
+        const int nx=t_meshdata.m_nx,ny=t_meshdata.m_ny,nz=t_meshdata.m_nz;
+        const int n=i-1;
+        int ii,jj,kk;
+        if(t_meshdata.m_maxdim==2){
+            if(t_side<2){
+                ii=(t_side==0)?1:nx;jj=n+1;
+            }
+            else{
+                ii=n+1;jj=(t_side==2)?1:ny;
+            }
+            int elconn[8];
+            getIthBulkElmtConn(t_meshdata,(jj-1)*nx+ii,elconn);
+            t_conn[0]=elconn[LineLocalIDs[t_side][0]];
+            t_conn[1]=elconn[LineLocalIDs[t_side][1]];
+            return 2;
+        }
+        if(t_side<2){
+            ii=(t_side==0)?1:nx;jj=n%ny+1;kk=n/ny+1;
+        }
+        else if(t_side<4){
+            ii=n%nx+1;jj=(t_side==2)?1:ny;kk=n/nx+1;
+        }
+        else{
+            ii=n%nx+1;jj=n/nx+1;kk=(t_side==4)?1:nz;
+        }
+        int elconn[8];
+        getIthBulkElmtConn(t_meshdata,(kk-1)*nx*ny+(jj-1)*nx+ii,elconn);
+        for(int m=0;m<4;m++) t_conn[m]=elconn[SurfaceLocalIDs[t_side][m]];
+        return 4;
+    }
+    /**
+     * get the number of nodes on the given boundary side
+     * @param t_meshdata the mesh data with the grid sizes
+     * @param t_side the boundary side index
+     */
+    static inline int getNodeSetNodesNum(const MeshData &t_meshdata,const int &t_side){
+        const int nx=t_meshdata.m_nx,ny=t_meshdata.m_ny,nz=t_meshdata.m_nz;
+        if(t_meshdata.m_maxdim==2) return t_side<2?ny+1:nx+1;
+        if(t_side<2) return (ny+1)*(nz+1);
+        if(t_side<4) return (nx+1)*(nz+1);
+        return (nx+1)*(ny+1);
+    }
+    /**
+     * get the i-th node id on the given boundary side, the ids are sorted, which is the same as the generated node set
+     * @param t_meshdata the mesh data with the grid sizes
+     * @param t_side the boundary side index
+     * @param i the node index on this side, start from 1
+     */
+    static inline int getIthNodeSetNodeID(const MeshData &t_meshdata,const int &t_side,const int &i){
+        const int nx=t_meshdata.m_nx,ny=t_meshdata.m_ny,nz=t_meshdata.m_nz;
+        const int n=i-1;
+        if(t_meshdata.m_maxdim==2){
+            if(t_side<2) return getNodeID(t_meshdata,(t_side==0)?1:nx+1,n+1,1);
+            return getNodeID(t_meshdata,n+1,(t_side==2)?1:ny+1,1);
+        }
+        if(t_side<2) return getNodeID(t_meshdata,(t_side==0)?1:nx+1,n%(ny+1)+1,n/(ny+1)+1);
+        if(t_side<4) return getNodeID(t_meshdata,n%(nx+1)+1,(t_side==2)?1:ny+1,n/(nx+1)+1);
+        return getNodeID(t_meshdata,n%(nx+1)+1,n/(nx+1)+1,(t_side==4)?1:nz+1);
+    }
+
+};
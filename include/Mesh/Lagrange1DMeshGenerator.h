@@ -38,6 +38,5 @@ public:
     virtual bool generateMesh(const MeshType &t_meshtype,MeshData &t_meshdata) override;
 private:
     bool m_mesh_generated=false;
-    vector<vector<int>> leftconn,rightconn;
     vector<int> leftnodes,rightnodes;
 };
\ No newline at end of file
@@ -18,12 +18,15 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <utility>
 
 #include "Mesh/MeshType.h"
+#include "Mesh/ElmtConnectivity.h"
 
 using std::vector;
 using std::map;
+using std::unordered_map;
 using std::pair;
 using std::string;
 
@@ -45,15 +48,17 @@ struct MeshData{
     double m_zmin;/**< z-min of the regular domain */
     double m_zmax;/**< z-max of the regular domain */
     int m_order;/**< order of the mesh */
+    bool m_isstructured=false;/**< true if the mesh is a tensor-product grid generated by AsFem */
+    bool m_isimplicit=false;/**< true if only the sizes of the generated grid are stored, the coordinates, connectivity and boundary sets are computed from the (i,j,k) indices */
     vector<double> m_nodecoords0;/**< vector for the coordinates of nodes, undeformed ! */
     vector<double> m_nodecoords;/**< vector for the coordinates of nodes, deformed one! */
-    vector<vector<int>> m_bulkelmt_connectivity;/**< stores the connectivity of bulk elements */
+    ElmtConnectivity    m_bulkelmt_connectivity;/**< stores the connectivity of bulk elements in CSR format */
     vector<double>      m_bulkelmt_volume;/**< stores the volume of each bulk element */
-    vector<vector<int>> m_pointelmt_connectivity;/**< stores the connectivity of line elements */
+    ElmtConnectivity    m_pointelmt_connectivity;/**< stores the connectivity of line elements */
     vector<double>      m_pointelmt_volume;/**< stores the volume of each line element */
-    vector<vector<int>> m_lineelmt_connectivity;/**< stores the connectivity of line elements */
+    ElmtConnectivity    m_lineelmt_connectivity;/**< stores the connectivity of line elements */
     vector<double>      m_lineelmt_volume;/**< stores the volume of each line element */
-    vector<vector<int>> m_surfaceelmt_connectivity;/**< stores the connectivity of line elements */
+    ElmtConnectivity    m_surfaceelmt_connectivity;/**< stores the connectivity of line elements */
     vector<double>      m_surfaceelmt_volume;/**< stores the volume of each surface element */
     // for the number of different nodes
     int m_nodes;/**< the total number of nodes */
@@ -73,11 +78,15 @@ struct MeshData{
     vector<int>                              m_phygroup_phyidvec;/**< the vector of physical id for each phy group */
     vector<int>                              m_phygroup_elmtnumvec;/**< the vector for the element number of each phy group */
     vector<int>                              m_phygroup_nodesnumperelmtvec;/**< the vector for the nodes number of the element in each phy group */
-    vector<pair<string,vector<vector<int>>>> m_phygroup_name2elmtconnvec;/**< vector for the name to element connectivity map */
+    vector<pair<string,vector<int>>>         m_phygroup_name2elmtidvec;/**< vector for the name to element ids map, the ids (start from 1) refer to the connectivity of the same dim, for the bulk groups they are the bulk element ids */
     vector<pair<string,vector<int>>>         m_phygroup_name2bulkelmtidvec;/** vector for the name to bulk element id map */
     vector<pair<string,int>>                 m_phygroup_name2dimvec;/**< vector for the name to elmt dim map */
     vector<pair<string,int>>                 m_phygroup_name2phyidvec;/**< vector for the name to phyid map */
     vector<pair<int,string>>                 m_phygroup_phyid2namevec;/**< vector for the phyid to name map */
+    // the group handles, they are created once the mesh is ready, then the hot loops don't need any string comparison
+    unordered_map<string,int>                m_phygroup_name2handle;/**< the name to group handle map, the handle (start from 1) is the index in m_phygroup_name2elmtidvec */
+    vector<int>                              m_phygroup_handle2dimvec;/**< the elmt dim of each group handle */
+    vector<int>                              m_phygroup_handle2bulkgroupvec;/**< the index (start from 1) in m_phygroup_name2bulkelmtidvec of each group handle, 0 for the lower dim groups */
 
     int m_nodal_phygroups;/**< number of nodal physical groups */
     vector<pair<string,vector<int>>> m_nodephygroup_name2nodeidvec;/**< vector for the name to node ids map */
@@ -85,6 +94,7 @@ struct MeshData{
     vector<pair<int,string>>         m_nodephygroup_phyid2namevec;/**< vector for the phyid to name map */
     vector<string>                   m_nodephygroup_phynamevec;/**< the vector stores the name of node phy group */
     vector<int>                      m_nodephygroup_phyidvec;/**< the vector of physical id for node phy group */
+    unordered_map<string,int>        m_nodephygroup_name2handle;/**< the name to nodal group handle map, the handle (start from 1) is the index in m_nodephygroup_name2nodeidvec */
 
     MeshType m_bulkelmt_type;/**< the meshtype of bulk element */
     MeshType m_lineelmt_type;/**< the meshtype of line element */
@@ -95,4 +105,14 @@ struct MeshData{
     int m_surfaceelmt_vtktype;/**< the vtk cell type of surface element */
     string m_bulkelmt_typename;/**< name of the bulk element type */
 
+    // for the distributed mesh, the counters above are always the global ones
+    bool m_distribute=false;/**< true if the mesh should be distributed among the processors after the setup */
+    bool m_distributeonimport=false;/**< true if the msh4 importer may build the distributed mesh directly, i.e. the whole mesh is not required by the cache, the reordering or the mesh output */
+    bool m_isdistributed=false;/**< true if each processor only stores its own partition plus one layer of halo elements */
+    int m_ownedbulkelmt_start=0;/**< the first owned bulk element (global id-1) of current processor */
+    int m_ownedbulkelmt_end=0;/**< the end of the owned bulk elements (global id-1, exclusive) of current processor */
+    vector<int> m_halobulkelmt_local2global;/**< the sorted global id of the halo bulk elements, they are stored after the owned ones */
+    vector<int> m_node_local2global;/**< the sorted global id of the local nodes */
+    ElmtConnectivity m_bulkelmt_localconnectivity;/**< the connectivity of the local bulk elements in the local node ids */
+
 };
@@ -50,5 +50,15 @@ protected:
      * @param t_meshdata the mesh data structure
      */
     virtual bool importMeshFile(const string &filename,MeshData &t_meshdata)=0;
+
+    /**
+     * get the ids of all the bulk elements, i.e., 1,2,...,n, it is the element ids of the "alldomain" group
+     * @param n the number of bulk elements
+     */
+    static vector<int> getBulkElmtIDs(const int &n){
+        vector<int> ids(n>0?n:0);
+        for(int e=0;e<n;e++) ids[e]=e+1;
+        return ids;
+    }
     
 };
@@ -41,4 +41,22 @@ public:
      */
     virtual bool generateMesh(const MeshType &t_meshtype,MeshData &t_meshdata)=0;
 
+protected:
+    /**
+     * move the boundary elements to the connectivity of the lower dim elements, the physical group only keeps their ids
+     * @param t_conns the connectivity of the boundary elements, it is released after this call
+     * @param t_elmtconn the connectivity storage of the lower dim elements
+     * @return the element ids (start from 1) in t_elmtconn
+     */
+    static vector<int> appendBCElmtConnectivity(vector<vector<int>> &t_conns,ElmtConnectivity &t_elmtconn){
+        vector<int> ids;
+        ids.reserve(t_conns.size());
+        for(const auto &conn:t_conns){
+            t_elmtconn.push_back(conn);
+            ids.push_back(t_elmtconn.size());
+        }
+        vector<vector<int>>().swap(t_conns);
+        return ids;
+    }
+
 };
\ No newline at end of file
@@ -0,0 +1,25 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the space-filling curves for the reordering of the
+//+++          imported mesh
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+/**
+ * the enum class for the element ordering of the imported mesh
+ */
+enum class MeshReorderType{
+    NONE,
+    HILBERT,
+    MORTON
+};
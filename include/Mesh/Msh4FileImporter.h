@@ -12,12 +12,29 @@
 //+++ Purpose: Implement the msh file (version-4) import function.
 //+++          This mesh file must be the *.msh in version-4.
 //+++          For version-2, please use Msh2FileImporter.
+//+++          The $Nodes and $Elements sections are parsed in
+//+++          parallel, all the ranks index the lines together,
+//+++          then each rank parses its own chunks.
+//+++          Both the ASCII and the binary (version>=4.1) files
+//+++          are supported. For the distributed mesh, the parsed
+//+++          records are routed to their owners directly
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #pragma once
 
 #include "Mesh/MeshFileImporterBase.h"
 #include "Mesh/MshFileUtils.h"
+#include "Mesh/MshFileTokenizer.h"
+
+/**
+ * the chunk of the data lines inside one entity block of the msh4 file, it is the unit of the parallel reading
+ */
+struct Msh4LinesChunk{
+    long long m_offset;/**< the 1st line, for $Nodes it is the 1st node tag line, it is the file offset for the binary file and the line index inside the section for the ASCII one */
+    long long m_offset2;/**< the 1st coordinates line in the same form as m_offset, only used by $Nodes */
+    int m_block;/**< the index of the entity block, start from 0 */
+    int m_lines;/**< the number of the lines (nodes or elements) in this chunk */
+};
 
 /**
  * This class implements the msh file (version-2) import function.
@@ -45,7 +62,65 @@ private:
      */
     int getPhysicalIDViaEntityTag(const int &entityDim,const int &entityTag)const;
 
+    /**
+     * scan the entity blocks of $Nodes or $Elements, the data lines are split into chunks on all the ranks, the tokenizer
+     * must be just after the section name. For the ASCII file, the lines are counted by all the ranks in parallel and
+     * a sparse index of the line offsets is kept, then only the block headers are read by the master rank. For the
+     * binary file, the offsets are computed from the block size without reading the lines
+     * @param in the tokenizer of the mesh file
+     * @param IsNodes true for $Nodes, false for $Elements
+     * @param summary the 4 numbers of the 1st line in current section
+     * @param blockinfo the 4 numbers of each entity block header
+     * @param chunks the chunks of the data lines
+     * @param endoffset the file offset after the end of current section
+     */
+    void scanEntityBlocks(MshFileTokenizer &in,const bool &IsNodes,int (&summary)[4],
+                          vector<int> &blockinfo,vector<Msh4LinesChunk> &chunks,
+                          long long &endoffset);
+    /**
+     * move the tokenizer to the line given by the chunk
+     * @param in the tokenizer of the mesh file
+     * @param pos the m_offset or m_offset2 of the chunk
+     */
+    void seekChunkLine(MshFileTokenizer &in,const long long &pos)const;
+    /**
+     * get the chunks parsed by current rank, the chunks are split by the number of lines
+     * @param chunks the chunks of the data lines
+     * @param cStart the first chunk of current rank
+     * @param cEnd the end of the chunks of current rank, exclusive
+     */
+    void getRankChunksRange(const vector<Msh4LinesChunk> &chunks,int &cStart,int &cEnd)const;
+    /**
+     * build the distributed mesh from the records parsed by current rank, the nodes are sent to their home ranks,
+     * the bulk elements to the owners of the same partition as BulkMesh::distributeBulkMesh and the lower dimension
+     * elements to the owner of the 1st bulk element containing them, then the whole mesh is never stored on any rank
+     * @param mshMaxDim the max dim of the elements
+     * @param nodesummary the 4 numbers of the 1st line in $Nodes
+     * @param nodetags the node tags parsed by current rank, they are released
+     * @param nodecoords the coordinates of the parsed nodes, they are released
+     * @param elmtsummary the 4 numbers of the 1st line in $Elements
+     * @param blockinfo the 4 numbers of each entity block header in $Elements
+     * @param elmts the element records (block, element tag, nodes, node tags) parsed by current rank, they are released
+     * @param mshPhyGroupDimVec the dim of the physical groups (the nodal ones are excluded)
+     * @param mshPhyGroupIDVec the id of the physical groups
+     * @param mshPhyGroupNameVec the name of the physical groups
+     * @param mshBulkPhyGroupNum the number of the physical groups of the bulk elements
+     * @param mshNodalPhyGroupIDVec the id of the nodal physical groups
+     * @param mshNodalPhyGroupNameVec the name of the nodal physical groups
+     * @param meshdata the mesh data structure
+     */
+    bool buildDistributedMesh(const int &mshMaxDim,const int (&nodesummary)[4],
+                              vector<int> &nodetags,vector<double> &nodecoords,
+                              const int (&elmtsummary)[4],const vector<int> &blockinfo,vector<int> &elmts,
+                              const vector<int> &mshPhyGroupDimVec,const vector<int> &mshPhyGroupIDVec,
+                              const vector<string> &mshPhyGroupNameVec,const int &mshBulkPhyGroupNum,
+                              const vector<int> &mshNodalPhyGroupIDVec,const vector<string> &mshNodalPhyGroupNameVec,
+                              MeshData &meshdata);
+
 private:
     vector<int> m_PointsEntityPhyIDs,m_CurvesEntityPhyIDS,m_SurfaceEntityPhyIDs,m_VolumesEntityPhyIDs;
+    bool m_IsBinary=false;/**< true for the binary msh4 file */
+    int m_DataSize=8;/**< the size of size_t in the binary msh4 file */
+    vector<long long> m_LineOffsets;/**< the offsets of every Msh4IndexLines-th line of current ASCII section */
 
 };
\ No newline at end of file
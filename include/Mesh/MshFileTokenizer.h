@@ -0,0 +1,205 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the tokenizer shared by the msh/gmsh importers, the
+//+++          whole file is mapped into memory, the numbers are
+//+++          parsed in place by std::from_chars, so there is no
+//+++          any string or stream allocation per line. The raw
+//+++          reading of the binary msh4 sections is also offered
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <charconv>
+#include <cstring>
+#include <cstdint>
+
+using std::string;
+using std::string_view;
+using std::vector;
+
+/**
+ * the tokenizer over the memory mapped mesh file
+ */
+class MshFileTokenizer{
+public:
+    /**
+     * constructor
+     */
+    MshFileTokenizer();
+    /**
+     * destructor, the file is unmapped
+     */
+    ~MshFileTokenizer();
+
+    MshFileTokenizer(const MshFileTokenizer&)=delete;
+    MshFileTokenizer& operator=(const MshFileTokenizer&)=delete;
+
+    /**
+     * map the file into memory, return false if it fails
+     * @param filename the mesh file name
+     */
+    bool open(const string &filename);
+    /**
+     * unmap the file
+     */
+    void close();
+
+    /**
+     * check whether the file is mapped
+     */
+    inline bool isOpen()const{return m_data!=nullptr;}
+    /**
+     * check whether the end of the file is reached
+     */
+    inline bool eof()const{return m_pos>=m_size;}
+    /**
+     * get the current offset in the file
+     */
+    inline size_t tell()const{return m_pos;}
+    /**
+     * move to the given offset
+     * @param pos the offset in the file
+     */
+    inline void seek(const size_t &pos){m_pos=pos<m_size?pos:m_size;}
+    /**
+     * get the size of the file
+     */
+    inline size_t size()const{return m_size;}
+
+    /**
+     * get the next line (without the '\n' and the '\r'), return false at the end of the file
+     * @param line the view of the line, it is valid until the file is closed
+     */
+    bool nextLine(string_view &line);
+    /**
+     * skip the rest of the current line
+     */
+    void skipLine();
+    /**
+     * skip the next n lines
+     * @param n the number of lines
+     */
+    void skipLines(const long long &n);
+
+    /**
+     * find the 1st offset of the string inside [first,last) of the file, last is returned if it is not there
+     * @param str the string to be found
+     * @param first the first offset
+     * @param last the end offset, exclusive
+     */
+    size_t find(const string_view &str,const size_t &first,const size_t &last)const;
+    /**
+     * count the lines which start inside [first,last) of the file, a line starts after each '\n'
+     * @param first the first offset, it must be larger than 0
+     * @param last the end offset, exclusive
+     */
+    long long countLineStarts(const size_t &first,const size_t &last)const;
+    /**
+     * get the offsets of the lines which start inside [first,last) and whose index is a multiple of the step,
+     * the index of the 1st line starting inside the range is given by firstline
+     * @param first the first offset, it must be larger than 0
+     * @param last the end offset, exclusive
+     * @param firstline the index of the 1st line inside the range
+     * @param step the step of the line index
+     * @param offsets the offsets are appended to it
+     */
+    void getLineStarts(const size_t &first,const size_t &last,const long long &firstline,const long long &step,
+                       vector<long long> &offsets)const;
+
+    /**
+     * read the next integer, the blanks and the line breaks before it are skipped, like the stream '>>'
+     * @param val the integer value
+     */
+    bool readInt(int &val);
+    /**
+     * read the next double, the blanks and the line breaks before it are skipped, like the stream '>>'
+     * @param val the double value
+     */
+    bool readDouble(double &val);
+    /**
+     * read all the integers of the rest of the current line, the parsing stops at the first invalid token,
+     * then the tokenizer moves to the next line. The number of the integers is returned
+     * @param vals the integers, the vector is reused, so its capacity is kept between the calls
+     */
+    int readLineInts(vector<int> &vals);
+    /**
+     * read all the numbers of the rest of the current line, see readLineInts
+     * @param vals the numbers, the vector is reused, so its capacity is kept between the calls
+     */
+    int readLineNums(vector<double> &vals);
+
+    /**
+     * copy the raw bytes at the current offset, return false if the file is too short
+     * @param vals the destination
+     * @param bytes the number of bytes
+     */
+    bool readBinary(void *vals,const size_t &bytes);
+    /**
+     * read one raw value at the current offset
+     * @param val the value
+     */
+    template<typename T>
+    inline bool readBinaryValue(T &val){return readBinary(&val,sizeof(T));}
+    /**
+     * read one size_t value of the binary msh4 file, whose size is given by the $MeshFormat
+     * @param datasize the size of size_t in the file, 4 or 8
+     * @param val the value
+     */
+    bool readBinarySize(const int &datasize,long long &val);
+
+    /**
+     * map the whole file into memory (read only), nullptr is returned if it fails
+     * @param filename the file name
+     * @param size the size of the file
+     */
+    static const unsigned char* mapFile(const string &filename,size_t &size);
+    /**
+     * unmap the file mapped by mapFile
+     * @param data the pointer returned by mapFile
+     * @param size the size of the file
+     */
+    static void unmapFile(const unsigned char *data,const size_t &size);
+
+private:
+    /**
+     * skip the blanks inside the current line
+     */
+    inline void skipBlanks(){
+        while(m_pos<m_size&&(m_data[m_pos]==' '||m_data[m_pos]=='\t'||m_data[m_pos]=='\r'||m_data[m_pos]==',')) m_pos++;
+    }
+    /**
+     * skip the blanks and the line breaks
+     */
+    inline void skipSpaces(){
+        while(m_pos<m_size&&(m_data[m_pos]==' '||m_data[m_pos]=='\t'||m_data[m_pos]=='\r'||m_data[m_pos]=='\n')) m_pos++;
+    }
+    /**
+     * parse one number at the current offset, the offset is only moved if it succeeds
+     */
+    template<typename T>
+    inline bool parseNumber(T &val){
+        const char *first=m_data+m_pos,*last=m_data+m_size;
+        if(first<last&&*first=='+') first++;// from_chars doesn't accept the leading '+'
+        auto result=std::from_chars(first,last,val);
+        if(result.ec!=std::errc()) return false;
+        m_pos=static_cast<size_t>(result.ptr-m_data);
+        return true;
+    }
+
+private:
+    const char *m_data;/**< the mapped file */
+    size_t m_size;/**< the size of the file */
+    size_t m_pos;/**< the current offset */
+};
@@ -0,0 +1,117 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the geometric multigrid preconditioner for the mesh
+//+++          generated by AsFem, the nodes of the tensor-product
+//+++          mesh are mapped to a structured lattice, then each
+//+++          coarse level halves the lattice in every direction.
+//+++          Only the prolongation operators are built here, the
+//+++          coarse operators are the galerkin ones (P^T*K*P)
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <vector>
+
+#include "petsc.h"
+
+#include "Utils/MessagePrinter.h"
+#include "Mesh/Mesh.h"
+#include "DofHandler/DofHandler.h"
+
+using std::vector;
+
+/**
+ * This class builds the grid hierarchy and the prolongation operators of PCMG for the structured mesh
+ */
+class GeometricMultigrid{
+public:
+    /**
+     * constructor
+     */
+    GeometricMultigrid();
+
+    /**
+     * create the coarse grids and the prolongation operators, the number of levels is reduced if the mesh can't be halved
+     * @param t_mesh the mesh class, it must be generated by AsFem
+     * @param t_dofhandler the dof class
+     * @param t_levels the number of levels, including the finest one
+     */
+    void createHierarchy(const Mesh &t_mesh,const DofHandler &t_dofhandler,const int &t_levels);
+
+    /**
+     * setup PCMG with the prolongation operators, the smoother of each level and the coarse solver
+     * @param t_pc the preconditioner of PETSc
+     */
+    void setupPC(PC &t_pc);
+
+    /**
+     * check whether the grid hierarchy is already created
+     */
+    inline bool isCreated()const{return m_created;}
+    /**
+     * get the number of levels
+     */
+    inline int getLevelsNum()const{return m_levels;}
+
+    /**
+     * release the allocated memory
+     */
+    void releaseMemory();
+
+private:
+    /**
+     * map each node of the generated mesh to the (i,j,k) index of the finest lattice
+     * @param t_mesh the mesh class
+     */
+    void createLatticeMap(const Mesh &t_mesh);
+    /**
+     * create the prolongation from level l-1 to level l, the active dofs of level l-1 are found here,
+     * so the levels must be created from the finest one to the coarsest one
+     * @param l integer for the fine level, start from 1 (the coarsest one is 0)
+     * @param t_dofhandler the dof class
+     */
+    void createProlongation(const int &l,const DofHandler &t_dofhandler);
+    /**
+     * get the prolongation stencil of one fine dof, return the number of the coarse dofs
+     * @param l integer for the fine level
+     * @param ijk the fine lattice index
+     * @param dof the dof index of the node, start from 0
+     * @param cols the (lattice point, dof) id of the coarse dofs, before the active numbering
+     * @param vals the weights
+     */
+    int getRowStencil(const int &l,const int (&ijk)[3],const int &dof,int (&cols)[8],double (&vals)[8])const;
+    /**
+     * get the 1d prolongation stencil of the i-th fine lattice point, return the number of the coarse points
+     * @param i integer for the fine lattice index, start from 0
+     * @param ids the coarse lattice index
+     * @param w the weights
+     */
+    inline int get1DStencil(const int &i,int (&ids)[2],double (&w)[2])const{
+        if(i%2==0){
+            ids[0]=i/2;w[0]=1.0;
+            return 1;
+        }
+        ids[0]=(i-1)/2;w[0]=0.5;
+        ids[1]=(i+1)/2;w[1]=0.5;
+        return 2;
+    }
+
+private:
+    bool m_created;/**< true if the hierarchy and the prolongation operators are created */
+    int m_levels;/**< the number of levels, including the finest one */
+    int m_dim;/**< the dimension of the mesh */
+    int m_dofspernode;/**< the max dofs per node */
+    vector<int> m_n[3];/**< the lattice intervals of each level in x, y and z direction, level 0 is the coarsest one */
+    vector<int> m_node2lattice;/**< the (i,j,k) lattice index of each node on the finest level */
+    vector<vector<int>> m_activeids;/**< the active (lattice point, dof) ids of each coarse level, they give the row/column order of P */
+    vector<Mat> m_prolongation;/**< the prolongation operators, the l-th one maps level l-1 to level l */
+};
@@ -19,6 +19,7 @@
 
 
 #include "NonlinearSolver/SNESSolver.h"
+#include "NonlinearSolver/StaggeredSolver.h"
 
 
 /**
@@ -36,8 +37,62 @@ public:
      * init the nonlinear solver
      */
     void init();
+    /**
+     * release the allocated memory of all the nonlinear solvers
+     */
+    void releaseMemory();
+
+    /**
+     * solve the nonlinear equation by the solver defined in [nlsolver] block, if success then return true
+     * @param t_mesh the mesh class
+     * @param t_dofhandler the dof class
+     * @param t_fe the fe class
+     * @param t_elmtsyste the element system class
+     * @param t_matesystem the material system class
+     * @param t_fesystem the fe system class
+     * @param t_bcsystem the boundary condition system
+     * @param t_solutionsystem the solution system class
+     * @param t_equationsystem the equation system class
+     * @param t_fectrlinfo the fe control info
+     */
+    virtual bool solve(Mesh &t_mesh,DofHandler &t_dofhandler,FE &t_fe,
+                       ElmtSystem &t_elmtsyste,MateSystem &t_matesystem,
+                       FESystem &t_fesystem,
+                       BCSystem &t_bcsystem,
+                       SolutionSystem &t_solutionsystem,
+                       EquationSystem &t_equationsystem,
+                       FEControlInfo &t_fectrlinfo) override;
+
+    /**
+     * get the iteration number of the active nonlinear solver
+     */
+    inline int getIterationNum()const{
+        if(m_nlsolverblock.m_nlsolvertype==NonlinearSolverType::STAGGERED) return m_staggeredsolver.getIterationNum();
+        return SNESSolver::getIterationNum();
+    }
+    /**
+     * get the initial norm of residual of the active nonlinear solver
+     */
+    inline double getInitResidualNorm()const{
+        if(m_nlsolverblock.m_nlsolvertype==NonlinearSolverType::STAGGERED) return m_staggeredsolver.getInitResidualNorm();
+        return SNESSolver::getInitResidualNorm();
+    }
+    /**
+     * get the residual norm of the active nonlinear solver
+     */
+    inline double getResidualNorm()const{
+        if(m_nlsolverblock.m_nlsolvertype==NonlinearSolverType::STAGGERED) return m_staggeredsolver.getResidualNorm();
+        return SNESSolver::getResidualNorm();
+    }
+    /**
+     * print out the information of the active nonlinear solver
+     */
+    void printSolverInfo()const;
 
 public:
     NonlinearSolverBlock m_nlsolverblock;/**< the nonlinear solver block defined in json file */
 
-};
\ No newline at end of file
+private:
+    StaggeredSolver m_staggeredsolver;/**< the staggered solver, it is only used by the 'staggered' type */
+
+};
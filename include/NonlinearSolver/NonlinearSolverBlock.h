@@ -17,6 +17,7 @@
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <vector>
 
 #include "NonlinearSolver/NonlinearSolverType.h"
 
@@ -39,6 +40,17 @@ public:
         m_pctypename="lu";
         m_linearsolvername="default(gmres)";
         m_checkjacobian=false;
+        m_useinexactnewton=false;
+        m_ksp_restart=30;
+        m_ksp_maxiters=10000;
+        m_stagger_dofnames.clear();
+        m_stagger_maxiters=100;
+        m_stagger_abstol=1.0e-6;
+        m_stagger_reltol=1.0e-5;
+        m_stagger_linear[0]=false;m_stagger_linear[1]=false;
+        m_mg_levels=3;
+        m_vi_dofnames.clear();
+        m_vi_upperbound=1.0e20;
     }
 
     string              m_nlsolvertypename;/**< the string name of nonlinear solver */
@@ -52,6 +64,21 @@ public:
     string m_pctypename;/**< the string name of preconditioner */
     bool m_checkjacobian=false;/**< if this is true, then SNES will compare your jacobian with the finite difference one */
 
+    bool m_useinexactnewton;/**< if true, the linear solver tolerance is set by the Eisenstat-Walker forcing term */
+    int m_ksp_restart;/**< the restart number of the Krylov subspace (memory budget of gmres/fgmres) */
+    int m_ksp_maxiters;/**< the maximum iterations of the linear solver in each newton iteration */
+
+    vector<string> m_stagger_dofnames;/**< the dof names of the 2nd subproblem (i.e. damage) in staggered solver, the rest dofs belong to the 1st one */
+    int m_stagger_maxiters;/**< the maximum staggering iterations */
+    double m_stagger_abstol;/**< the absolute tolerance of the coupled residual for staggering iterations */
+    double m_stagger_reltol;/**< the relative tolerance of the coupled residual for staggering iterations */
+    bool m_stagger_linear[2];/**< true if the 1st/2nd subproblem is linear while the other one is fixed */
+
+    int m_mg_levels;/**< the number of levels (including the finest one) of the geometric multigrid preconditioner */
+
+    vector<string> m_vi_dofnames;/**< the dof names (i.e. damage) bounded by their previous values (d>=d_old) in the variational inequality solver */
+    double m_vi_upperbound;/**< the upper bound of the vi dofs, 1.0e20 means no upper bound */
+
     /**
      * initialize the nlsolver block
      */
@@ -65,5 +92,16 @@ public:
         m_pctypename="lu";
         m_linearsolvername="default(gmres)";
         m_checkjacobian=false;
+        m_useinexactnewton=false;
+        m_ksp_restart=30;
+        m_ksp_maxiters=10000;
+        m_stagger_dofnames.clear();
+        m_stagger_maxiters=100;
+        m_stagger_abstol=1.0e-6;
+        m_stagger_reltol=1.0e-5;
+        m_stagger_linear[0]=false;m_stagger_linear[1]=false;
+        m_mg_levels=3;
+        m_vi_dofnames.clear();
+        m_vi_upperbound=1.0e20;
     }
 };
\ No newline at end of file
@@ -32,6 +32,8 @@ enum class NonlinearSolverType{
     BFGS,
     BROYDEN,
     BADBROYDEN,
+    STAGGERED,
+    VINEWTONRSLS,
     // for user-defined nonlinear solver
     USER1,
     USER2,
@@ -0,0 +1,84 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the p-multigrid preconditioner for the quadratic
+//+++          mesh, the coarse level is the linear (vertex) dofs
+//+++          of the same mesh, the prolongation comes from the
+//+++          linear shape functions evaluated on the nodes of
+//+++          the quadratic element
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <vector>
+
+#include "petsc.h"
+
+#include "Utils/MessagePrinter.h"
+#include "Mesh/Mesh.h"
+#include "DofHandler/DofHandler.h"
+#include "FE/ShapeFun.h"
+
+using std::vector;
+
+/**
+ * This class builds the linear coarse space and the prolongation operator of PCMG for the quadratic mesh
+ */
+class PMultigrid{
+public:
+    /**
+     * constructor
+     */
+    PMultigrid();
+
+    /**
+     * create the vertex (linear) dofs map and the prolongation operator
+     * @param t_mesh the mesh class, its bulk element must be a quadratic one
+     * @param t_dofhandler the dof class
+     */
+    void createHierarchy(const Mesh &t_mesh,const DofHandler &t_dofhandler);
+
+    /**
+     * setup the two-level PCMG with the prolongation operator, the fine level smoother and the coarse solver
+     * @param t_pc the preconditioner of PETSc
+     */
+    void setupPC(PC &t_pc);
+
+    /**
+     * check whether the coarse space is already created
+     */
+    inline bool isCreated()const{return m_created;}
+
+    /**
+     * release the allocated memory
+     */
+    void releaseMemory();
+
+private:
+    /**
+     * get the linear mesh type of the quadratic one, return false if the mesh type is not supported
+     * @param t_meshtype the quadratic mesh type
+     * @param t_lineartype the linear mesh type
+     */
+    bool getLinearMeshType(const MeshType &t_meshtype,MeshType &t_lineartype)const;
+    /**
+     * calculate the weights of the vertex nodes for each node of the reference quadratic element
+     * @param t_meshtype the quadratic mesh type
+     */
+    void calcReferenceWeights(const MeshType &t_meshtype);
+
+private:
+    bool m_created;/**< true if the coarse space and the prolongation operator are created */
+    int m_vertices;/**< the number of vertex nodes per element */
+    int m_nodesperelmt;/**< the number of nodes per quadratic element */
+    vector<vector<double>> m_weights;/**< the weights of the vertex nodes for the k-th node of the reference element */
+    Mat m_prolongation;/**< the prolongation operator from the linear dofs to the quadratic dofs */
+};
@@ -16,6 +16,21 @@
 
 #include "NonlinearSolver/NonlinearSolverBase.h"
 #include "NonlinearSolver/NonlinearSolverBlock.h"
+#include "NonlinearSolver/GeometricMultigrid.h"
+#include "NonlinearSolver/PMultigrid.h"
+
+/**
+ * The structure for the jacobian reuse, it lives in SNESSolver and survives between different solves
+ */
+typedef struct{
+    bool IsLinear;/**< true if all the element blocks are linear, then the assembly can be skipped */
+    bool HasJacobian;/**< true if a valid jacobian is already stored in the equation system */
+    double dt;/**< the dt of the stored jacobian */
+    double ctan[3];/**< the time derivative coefficients of the stored jacobian */
+    long assemblycount;/**< the assembly count of K right after the stored jacobian is assembled */
+    int assembled;/**< the number of jacobian assembly in current solve */
+    int factorized;/**< the number of numeric factorization (pc setup) in current solve */
+} JacobianCtx;
 
 /**
  * This is the struct that will be used to pass down/up the args we need to call SNES
@@ -31,6 +46,7 @@ typedef struct{
     FE *_fe;
     FESystem *_feSystem;
     FEControlInfo *_fectrlinfo;
+    JacobianCtx *_jacctx;
 } AppCtx;
 
 /**
@@ -41,6 +57,7 @@ typedef struct{
     double dunorm,dunorm0;
     double enorm,enorm0;
     int iters;
+    int lits;/**< the accumulated linear iterations up to the current newton iteration */
     bool IsDepDebug;
 } MonitorCtx;
 
@@ -84,6 +101,32 @@ extern PetscErrorCode computeJacobian(SNES snes,Vec U,Mat A,Mat B,void *ctx);
  */
 extern PetscErrorCode computeResidual(SNES snes,Vec U,Vec RHS,void *ctx);
 
+/**
+ * assemble the residual of the whole system (with boundary conditions) for the given solution
+ * @param user the application context
+ * @param U the solution vector
+ * @param RHS the residual vector
+ */
+extern void formSystemResidual(AppCtx *user,Vec U,Vec RHS);
+
+/**
+ * assemble the jacobian of the whole system (with boundary conditions) into the K matrix of the equation system
+ * @param user the application context
+ * @param U the solution vector
+ */
+extern void formSystemJacobian(AppCtx *user,Vec U);
+
+/**
+ * setup the linear solver and its preconditioner by their string names
+ * @param t_ksp the KSP linear solver from PETSc
+ * @param t_linearsolvername the string name of the linear solver
+ * @param t_pcname the string name of the preconditioner
+ * @param t_restart the restart number of gmres/fgmres
+ * @param t_maxiters the maximum iterations of the linear solver
+ */
+extern void setupLinearSolver(KSP &t_ksp,const string &t_linearsolvername,const string &t_pcname,
+                              const int &t_restart,const int &t_maxiters);
+
 /**
  * This class implement the SNES wrapper based on PETSc package for nonlinear problem
  */
@@ -127,10 +170,51 @@ public:
                        EquationSystem &t_equationsystem,
                        FEControlInfo &t_fectrlinfo) override;
     
+    /**
+     * assemble the residual of the current solution with the preset dirichlet bcs of t+dt and return its norm.
+     * The residual is kept, the next newton solve starts from it instead of assembling it again
+     * @param t_mesh the mesh class
+     * @param t_dofhandler the dof class
+     * @param t_fe the fe class
+     * @param t_elmtsyste the element system class
+     * @param t_matesystem the material system class
+     * @param t_fesystem the fe system class
+     * @param t_bcsystem the boundary condition system
+     * @param t_solutionsystem the solution system class
+     * @param t_equationsystem the equation system class
+     * @param t_fectrlinfo the fe control info
+     */
+    double computeGuessResidualNorm(Mesh &t_mesh,DofHandler &t_dofhandler,FE &t_fe,
+                                    ElmtSystem &t_elmtsyste,MateSystem &t_matesystem,
+                                    FESystem &t_fesystem,
+                                    BCSystem &t_bcsystem,
+                                    SolutionSystem &t_solutionsystem,
+                                    EquationSystem &t_equationsystem,
+                                    FEControlInfo &t_fectrlinfo);
+    /**
+     * keep the residual of the previous guess instead of the latest one, it must be called
+     * if the solution goes back to the previous guess
+     */
+    inline void usePreviousGuessResidual(){
+        Vec tmp=m_rguess;m_rguess=m_rguess_prev;m_rguess_prev=tmp;
+    }
+
     /**
      * get the linear solver name in current SNES solver
      */
     inline string getLinearSolverName()const{return m_linearsolvername;}
+    /**
+     * get the preconditioner name in current SNES solver
+     */
+    inline string getPCName()const{return m_pcname;}
+    /**
+     * get the restart number of gmres/fgmres
+     */
+    inline int getKSPRestart()const{return m_ksp_restart;}
+    /**
+     * get the maximum iterations of the linear solver
+     */
+    inline int getKSPMaxIters()const{return m_ksp_maxiters;}
 
     /**
      * get the nonlinear solver name
@@ -141,6 +225,10 @@ public:
      * get the iteration number
      */
     inline int getIterationNum()const{return m_iterations;}
+    /**
+     * get the total linear iterations of the last nonlinear solve
+     */
+    inline int getLinearIterationNum()const{return m_linear_iterations;}
 
     /**
      * get the initial norm of residual
@@ -156,10 +244,39 @@ public:
      */
     void printSolverInfo()const;
 
+private:
+    /**
+     * print out the linear iterations spent in the last nonlinear solve
+     */
+    void printLinearIterationsInfo()const;
+    /**
+     * setup the bounds of the vi solver, the vi dofs are bounded by their previous values, the others are free
+     * @param t_dofhandler the dof class
+     * @param t_solutionsystem the solution system class
+     */
+    void setVariableBounds(const DofHandler &t_dofhandler,SolutionSystem &t_solutionsystem);
+    /**
+     * get the min increment U-U_old of the vi dofs over all the ranks, it should never be negative
+     * @param t_solutionsystem the solution system class
+     */
+    double computeMinBoundedIncrement(SolutionSystem &t_solutionsystem)const;
+
 private:
     bool m_initialized;/**< boolean flag for the status of initializing */
     int m_maxiters;/**< the maximum iterations */
     int m_iterations;/**< the iteration number */
+    int m_linear_iterations;/**< the total linear iterations of the last nonlinear solve */
+
+    bool m_useinexactnewton;/**< if true, the Eisenstat-Walker forcing term is used for the linear solver */
+    int m_ksp_restart;/**< the restart number of gmres/fgmres */
+    int m_ksp_maxiters;/**< the maximum iterations of the linear solver */
+    int m_mg_levels;/**< the levels of the geometric multigrid preconditioner */
+
+    vector<string> m_vi_dofnames;/**< the dof names bounded by their previous values in the vi solver */
+    double m_vi_upperbound;/**< the upper bound of the vi dofs */
+    vector<int> m_vi_dofids;/**< the locally owned global dof ids (start from 0) of the vi dofs */
+    bool m_hasbounds;/**< true if the bound vectors of the vi solver are allocated */
+    double m_vi_minincrement;/**< the min increment of the vi dofs in the last solve */
 
     double m_s_tol;/**< the tolerance for delta U */
 
@@ -175,6 +292,9 @@ private:
     double m_rnorm0;/**< the initial norm of residual */
     double m_rnorm;/**< the intermediate or final norm of reisudal */
 
+    bool m_hasguessvecs;/**< true if the residual vectors of the initial guesses are allocated */
+    bool m_hasguessresidual;/**< true if the residual of the initial guess is already assembled for the next solve */
+
 private:
     string m_linearsolvername;/**< the string name of the linear solver in SNES*/
     string m_nlsolvername;/**< the nonlinear solver name in SNES */
@@ -187,8 +307,15 @@ private:
     PC   m_pc;/**< the preconditioner from PETSc */
     SNESLineSearch m_sneslinesearch;/**< for the line search ctx */
     SNESConvergedReason m_snesconvergereason;/**< for the converged reason ctx */
+    Vec m_xl;/**< the lower bound of the vi solver */
+    Vec m_xu;/**< the upper bound of the vi solver */
+    Vec m_rguess;/**< the residual of the latest initial guess */
+    Vec m_rguess_prev;/**< the residual of the previous initial guess */
 
     AppCtx m_appctx;
     MonitorCtx m_monctx;
+    JacobianCtx m_jacctx;
+    GeometricMultigrid m_gmg;/**< the grid hierarchy for the geometric multigrid preconditioner */
+    PMultigrid m_pmg;/**< the linear coarse space for the p-multigrid preconditioner */
 
 };
\ No newline at end of file
@@ -0,0 +1,140 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the staggered(alternate minimization) solver, the
+//+++          dofs are split into two subproblems, i.e. the
+//+++          displacement and the damage of phase-field fracture,
+//+++          each one is solved by newton method with its own
+//+++          sub-matrix and linear solver, while the other one
+//+++          is fixed
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include "NonlinearSolver/SNESSolver.h"
+
+/**
+ * This class implements the staggered solver for the coupled problem
+ */
+class StaggeredSolver:public NonlinearSolverBase{
+public:
+    StaggeredSolver();
+
+    /**
+     * setup the staggered solver from [nlsolver] block
+     * @param t_nlblock the nonlinear solver block
+     */
+    void setFromNonlinearSolverBlock(const NonlinearSolverBlock &t_nlblock);
+
+    /**
+     * initialize the linear solvers of the two subproblems
+     */
+    void initSolver();
+    /**
+     * release the allocated memory
+     */
+    void releaseMemory();
+
+    /**
+     * solve the nonlinear equation, if success then return true
+     * @param t_mesh the mesh class
+     * @param t_dofhandler the dof class
+     * @param t_fe the fe class
+     * @param t_elmtsyste the element system class
+     * @param t_matesystem the material system class
+     * @param t_fesystem the fe system class
+     * @param t_bcsystem the boundary condition system
+     * @param t_solutionsystem the solution system class
+     * @param t_equationsystem the equation system class
+     * @param t_fectrlinfo the fe control info
+     */
+    virtual bool solve(Mesh &t_mesh,DofHandler &t_dofhandler,FE &t_fe,
+                       ElmtSystem &t_elmtsyste,MateSystem &t_matesystem,
+                       FESystem &t_fesystem,
+                       BCSystem &t_bcsystem,
+                       SolutionSystem &t_solutionsystem,
+                       EquationSystem &t_equationsystem,
+                       FEControlInfo &t_fectrlinfo) override;
+
+    /**
+     * get the staggering iteration number
+     */
+    inline int getIterationNum()const{return m_iterations;}
+    /**
+     * get the initial norm of the coupled residual
+     */
+    inline double getInitResidualNorm()const{return m_rnorm0;}
+    /**
+     * get the final norm of the coupled residual
+     */
+    inline double getResidualNorm()const{return m_rnorm;}
+
+    /**
+     * print out the staggered solver information
+     */
+    void printSolverInfo()const;
+
+private:
+    /**
+     * create the index set of the two subproblems from the dofs map
+     * @param t_dofhandler the dof class
+     */
+    void createSubProblems(const DofHandler &t_dofhandler);
+    /**
+     * solve the i-th subproblem by newton method while the other one is fixed, return true if it converges
+     * @param i integer for the subproblem index, 0 for the 1st one, 1 for the 2nd one
+     * @param U the solution vector of the whole system
+     */
+    bool solveSubProblem(const int &i,Vec &U);
+    /**
+     * assemble the diagonal block of the i-th subproblem and extract it to the sub-matrix
+     * @param i integer for the subproblem index, 0 for the 1st one, 1 for the 2nd one
+     * @param U the solution vector of the whole system
+     */
+    void assembleSubJacobian(const int &i,Vec &U);
+
+private:
+    bool m_initialized;/**< boolean flag for the status of initializing */
+    bool m_subproblemcreated;/**< boolean flag for the status of the index set */
+    bool m_hassubmatrix[2];/**< true if the sub-matrix of each subproblem is already allocated */
+    bool m_islinear[2];/**< true if the subproblem is linear while the other one is fixed */
+
+    int m_maxiters;/**< the maximum newton iterations of each subproblem */
+    int m_stagger_maxiters;/**< the maximum staggering iterations */
+    int m_iterations;/**< the staggering iteration number */
+    int m_subiterations[2];/**< the accumulated newton iterations of each subproblem in current step */
+
+    double m_abstol_r;/**< the absolute tolerance for the residual of each subproblem */
+    double m_reltol_r;/**< the relative tolerance for the residual of each subproblem */
+    double m_stagger_abstol;/**< the absolute tolerance for the coupled residual */
+    double m_stagger_reltol;/**< the relative tolerance for the coupled residual */
+
+    double m_rnorm0;/**< the initial norm of the coupled residual */
+    double m_rnorm;/**< the final norm of the coupled residual */
+
+    string m_linearsolvername;/**< the string name of the linear solver */
+    string m_pcname;/**< the preconditioner name */
+    int m_ksp_restart;/**< the restart number of gmres/fgmres */
+    int m_ksp_maxiters;/**< the maximum iterations of the linear solver */
+    vector<string> m_stagger_dofnames;/**< the dof names of the 2nd subproblem */
+    vector<bool> m_issubdof[2];/**< the nodal dofs (index starts from 0) of each subproblem */
+
+private:
+    IS  m_is[2];/**< the index set (global dof ids) of each subproblem */
+    Mat m_subK[2];/**< the sub-matrix of each subproblem */
+    Vec m_dU[2];/**< the newton increment of each subproblem */
+    KSP m_ksp[2];/**< the linear solver of each subproblem */
+    Vec m_R;/**< the residual of the whole system */
+
+    AppCtx m_appctx;/**< the application context for the residual/jacobian assembly */
+    bool m_isdepdebug;/**< true if the iteration info should be printed */
+
+};
@@ -44,6 +44,10 @@ public:
      * @param t_format the file format type
      */
     void setFileFormat(const ResultFileFormat &t_format){m_fileformat=t_format;}
+    /**
+     * setup the checkpoint interval, 0 means no checkpoint file is written
+     */
+    void setCheckpointIntervalNum(const int &interval){m_checkpoint_intervals=interval;}
 
     /**
      * save result to different files according to the output format
@@ -72,6 +76,12 @@ public:
      * save the end info of pvd file
      */
     void savePVDEnd();
+    /**
+     * restore the pvd file for the restart, only the first n datasets are kept, the ones written
+     * after the checkpoint are removed
+     * @param n the number of the datasets when the checkpoint is written
+     */
+    void restorePVDFile(const int &n);
 
     //*****************************************************
     //*** general gettings
@@ -84,6 +94,20 @@ public:
      * get the output interval number
      */
     inline int getIntervalNum()const{return m_intervals;}
+    /**
+     * get the checkpoint interval number
+     */
+    inline int getCheckpointIntervalNum()const{return m_checkpoint_intervals;}
+    /**
+     * get the string name of the checkpoint file
+     */
+    inline string getCheckpointFileName()const{
+        return m_inputfile_name.substr(0,m_inputfile_name.size()-5)+".chk";// remove '.json'
+    }
+    /**
+     * get the number of the datasets in the pvd file
+     */
+    inline int getPVDDataSetsNum()const{return m_pvd_datasets;}
 
     /**
      * print out the output system info
@@ -98,6 +122,8 @@ private:
     ResultFileFormat m_fileformat;/**< for the result file format */
 
     int m_intervals;/**< the output interval number */
+    int m_checkpoint_intervals;/**< the checkpoint interval number, 0 for no checkpoint */
+    int m_pvd_datasets;/**< the number of the datasets in the pvd file */
 
 private:
     PetscMPIInt m_rank;/** for the processor id */
@@ -40,6 +40,36 @@ public:
                              SolutionSystem &t_solution,
                              ProjectionSystem &t_projection) override;
 
+private:
+    /**
+     * get the piece file name of the given rank for the distributed mesh, i.e. xxx.pvtu -> xxx-p0.vtu
+     * @param t_filename the string name of the pvtu file
+     * @param t_rank the processor id
+     */
+    string getPieceFileName(const string &t_filename,const int &t_rank)const;
+    /**
+     * write the local nodes and the owned elements to a single vtu file
+     * @param t_filename the string name of the vtu file
+     * @param t_mesh the mesh class
+     * @param t_dofHandler the dofhandler class
+     * @param t_solution the solution class
+     * @param t_projection the projection class
+     */
+    void savePieceFile(const string &t_filename,
+                       const Mesh &t_mesh,
+                       const DofHandler &t_dofHandler,
+                       SolutionSystem &t_solution,
+                       ProjectionSystem &t_projection);
+    /**
+     * write the pvtu file which collects the pieces of all the processors
+     * @param t_filename the string name of the pvtu file
+     * @param t_dofHandler the dofhandler class
+     * @param t_projection the projection class
+     */
+    void savePVTUFile(const string &t_filename,
+                      const DofHandler &t_dofHandler,
+                      ProjectionSystem &t_projection);
+
 private:
     PetscMPIInt m_rank;/**< the processor id */
 
@@ -0,0 +1,52 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: Get the dof value at an arbitrary physical point for
+//+++          pps, the point is located by the element locator of
+//+++          the FE space
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include "Mesh/Mesh.h"
+#include "DofHandler/DofHandler.h"
+#include "SolutionSystem/SolutionSystem.h"
+#include "FE/FE.h"
+
+#include "Utils/MessagePrinter.h"
+#include "Utils/JsonUtils.h"
+
+/**
+ * This class interpolates the dof value at the given point (of the undeformed mesh)
+ */
+class PointValuePostprocessor{
+protected:
+    /**
+     * compute the dof value at the point given by 'point' in the parameters
+     * @param dofid the local dof id, start from 1
+     * @param t_parameters the parameters from json
+     * @param t_mesh the mesh class
+     * @param t_dofhandler the dofHandler class
+     * @param t_fe the fe space, its element locator is built on the first call
+     * @param t_soln the solution class
+     */
+    double computePointValue(const int &dofid,
+                             const nlohmann::json &t_parameters,
+                             const Mesh &t_mesh,
+                             const DofHandler &t_dofhandler,
+                             FE &t_fe,
+                             SolutionSystem &t_soln);
+
+private:
+    Vector3d m_point;/**< the coordinates of the point */
+    double m_pps_value=0.0;/**< the postprocess result */
+
+};
@@ -40,6 +40,8 @@
 #include "Postprocess/NodalVectorMatePostprocessor.h"
 #include "Postprocess/NodalRank2MatePostprocessor.h"
 #include "Postprocess/NodalRank4MatePostprocessor.h"
+// for point value postprocessor
+#include "Postprocess/PointValuePostprocessor.h"
 
 // for side integral postprocessors
 #include "Postprocess/AreaPostprocessor.h"
@@ -68,6 +70,7 @@ class Postprocessor:public NodalValuePostprocessor,
                     public NodalVectorMatePostprocessor,
                     public NodalRank2MatePostprocessor,
                     public NodalRank4MatePostprocessor,
+                    public PointValuePostprocessor,
                     // for side integral pps
                     public AreaPostprocessor,
                     public SideIntegralValuePostprocessor,
@@ -166,6 +169,16 @@ public:
      * @param inputfilename the string name of the input file
      */
     void prepareCSVFileHeader();
+    /**
+     * restore the csv file for the restart, only the first n rows are kept, the ones written
+     * after the checkpoint are removed
+     * @param n the number of the rows when the checkpoint is written
+     */
+    void restoreCSVFile(const int &n);
+    /**
+     * get the number of the rows (without the header) in the csv file
+     */
+    inline int getCSVRowsNum()const{return m_csv_rows;}
 
     /**
      * get the active status of the postprocess system
@@ -294,6 +307,7 @@ private:
 private:
     string m_inputfilename;/** the string name of the input file*/
     string m_csv_filename;/**< the string name of the csv file */
+    int m_csv_rows;/**< the number of the rows (without the header) in the csv file */
     int m_output_interval;/**< the output interval */
     vector<string> m_pps_namelist;/**< the name vector for the final postprocessed variables */
     vector<double> m_pps_values;/**< the value vector for the final postprocessed variables */
@@ -305,6 +319,7 @@ private:
     LocalElmtInfo m_local_elmtinfo;/**< for the local element info data structure */
     LocalShapeFun m_local_shp;/**< for the local shape function */
     Nodes m_nodes0,m_nodes;/**< the nodal coordinates of current element */
+    vector<int> m_localnodeids;/**< the local node ids of current element, they index the nodal dofs map directly */
     Rank2Tensor m_xs;
     Vector3d m_normal;/**< the normal vector */
 
@@ -25,6 +25,10 @@ enum class PostprocessorType{
     NODALRANK2MATERIALVALUE,
     NODALRANK4MATERIALVALUE,
     //*********************************
+    // for point type pps
+    //*********************************
+    POINTVALUE,
+    //*********************************
     // for side type pps
     //*********************************
     AREA,
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <fstream>
+
 #include "MathUtils/Vector.h"
 #include "MateSystem/MaterialsName.h"
 #include "DofHandler/DofHandler.h"
@@ -39,9 +41,15 @@ public:
     void init(const DofHandler &t_dofhandler,const FE &t_fe);
 
     /**
-     * update solution vectors
+     * update solution vectors for the accepted step, the previous solutions are rotated by swapping
+     * the storage, then only the new initial guess (U=U_old) is copied
      */
     void updateSolution();
+    /**
+     * roll back the solution vectors of the rejected step, U, V and A go back to the last accepted step,
+     * the history and the materials are only changed by the accepted step, so they are kept
+     */
+    void rollbackSolution();
     /**
      * update materials vectors
      */
@@ -52,14 +60,85 @@ public:
      */
     void releaseMemory();
 
+    /**
+     * allocate the ring buffer of the previous solutions, it is shared by the multi-step method, the predictor and the error estimation
+     * @param n integer for the capacity of the buffer
+     */
+    void initHistory(const int &n);
+    /**
+     * push the converged solution into the history buffer, the oldest one is overwritten if the buffer is full
+     * @param u the converged solution vector
+     * @param t the time of the converged solution
+     */
+    void pushHistory(const Vector &u,const double &t);
+    /**
+     * clear the history buffer without releasing the memory
+     */
+    inline void clearHistory(){m_history_num=0;m_history_head=-1;}
+
+    /**
+     * write the solution vectors, the history buffer and the materials of the local qpoints to the binary
+     * stream, only the local part of each vector is written, so each rank has its own checkpoint file
+     * @param out the binary output stream
+     */
+    void writeCheckpoint(std::ofstream &out);
+    /**
+     * read the solution vectors, the history buffer and the materials from the binary stream, return
+     * false if the stored sizes don't match the current problem
+     * @param in the binary input stream
+     */
+    bool readCheckpoint(std::ifstream &in);
+    /**
+     * get the number of the stored previous solutions
+     */
+    inline int getHistoryNum()const{return m_history_num;}
+    /**
+     * get the capacity of the history buffer
+     */
+    inline int getHistorySize()const{return m_history_size;}
+    /**
+     * get the i-th previous solution, i=1 for the latest one
+     * @param i integer, start from 1
+     */
+    inline Vector& getIthHistory(const int &i){
+        if(i<1||i>m_history_num){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range("+to_string(m_history_num)+") for the solution history");
+            MessagePrinter::exitAsFem();
+        }
+        return m_u_history[(m_history_head-(i-1)+m_history_size)%m_history_size];
+    }
+    /**
+     * get the time of the i-th previous solution, i=1 for the latest one
+     * @param i integer, start from 1
+     */
+    inline double getIthHistoryTime(const int &i)const{
+        if(i<1||i>m_history_num){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range("+to_string(m_history_num)+") for the solution history");
+            MessagePrinter::exitAsFem();
+        }
+        return m_t_history[(m_history_head-(i-1)+m_history_size)%m_history_size];
+    }
+
     /**
      * get the number of qpoints of each bulk element
      */
     inline int getQPointsNum()const{return m_qpoints_num;}
     /**
-     * get the number of bulk elements
+     * get the number of local bulk elements, only the elements assembled by the current rank store their materials
      */
     inline int getBulkElmtsNum()const{return m_bulkelmts_num;}
+    /**
+     * get the global id of the first local bulk element minus 1
+     */
+    inline int getBulkElmtsOffset()const{return m_elmt_offset;}
+    /**
+     * get the position of i-th element's j-th qpoint in the local materials arrays
+     * @param i the global id of the local bulk element, start from 1
+     * @param j the qpoint id, start from 1
+     */
+    inline int getIthElmtJthQPointLocalID(const int &i,const int &j)const{
+        return (i-1-m_elmt_offset)*m_qpoints_num+j-1;
+    }
     /**
      * get the number of dofs
      */
@@ -68,57 +147,57 @@ public:
      * get i-th element's j-th point's scalar material
      */
     inline ScalarMateType getIthElmtJthScalarMaterial(const int &i,const int &j)const{
-        if(i<1||i>m_bulkelmts_num){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range for bulk elements number in scalar materials access");
+        if(i<=m_elmt_offset||i>m_elmt_offset+m_bulkelmts_num){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is not a local bulk element in scalar materials access");
             MessagePrinter::exitAsFem();
         }
         if(j<1||j>m_qpoints_num){
             MessagePrinter::printErrorTxt("j="+to_string(i)+" is out of range for bulk qpoints number in scalar material access");
             MessagePrinter::exitAsFem();
         }
-        return m_qpoints_scalarmaterials[(i-1)*m_qpoints_num+j-1];
+        return m_qpoints_scalarmaterials[getIthElmtJthQPointLocalID(i,j)];
     }
     /**
      * get i-th element's j-th point's vector material
      */
     inline VectorMateType getIthElmtJthVectorMaterial(const int &i,const int &j)const{
-        if(i<1||i>m_bulkelmts_num){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range for bulk elements number in vector materials access");
+        if(i<=m_elmt_offset||i>m_elmt_offset+m_bulkelmts_num){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is not a local bulk element in vector materials access");
             MessagePrinter::exitAsFem();
         }
         if(j<1||j>m_qpoints_num){
             MessagePrinter::printErrorTxt("j="+to_string(i)+" is out of range for bulk qpoints number in vector material access");
             MessagePrinter::exitAsFem();
         }
-        return m_qpoints_vectormaterials[(i-1)*m_qpoints_num+j-1];
+        return m_qpoints_vectormaterials[getIthElmtJthQPointLocalID(i,j)];
     }
     /**
      * get i-th element's j-th point's rank-2 material
      */
     inline Rank2MateType getIthElmtJthRank2Material(const int &i,const int &j)const{
-        if(i<1||i>m_bulkelmts_num){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range for bulk elements number in rank-2 materials access");
+        if(i<=m_elmt_offset||i>m_elmt_offset+m_bulkelmts_num){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is not a local bulk element in rank-2 materials access");
             MessagePrinter::exitAsFem();
         }
         if(j<1||j>m_qpoints_num){
             MessagePrinter::printErrorTxt("j="+to_string(i)+" is out of range for bulk qpoints number in rank-2 material access");
             MessagePrinter::exitAsFem();
         }
-        return m_qpoints_rank2materials[(i-1)*m_qpoints_num+j-1];
+        return m_qpoints_rank2materials[getIthElmtJthQPointLocalID(i,j)];
     }
     /**
      * get i-th element's j-th point's rank-4 material
      */
     inline Rank4MateType getIthElmtJthRank4Material(const int &i,const int &j)const{
-        if(i<1||i>m_bulkelmts_num){
-            MessagePrinter::printErrorTxt("i="+to_string(i)+" is out of range for bulk elements number in rank-4 materials access");
+        if(i<=m_elmt_offset||i>m_elmt_offset+m_bulkelmts_num){
+            MessagePrinter::printErrorTxt("i="+to_string(i)+" is not a local bulk element in rank-4 materials access");
             MessagePrinter::exitAsFem();
         }
         if(j<1||j>m_qpoints_num){
             MessagePrinter::printErrorTxt("j="+to_string(i)+" is out of range for bulk qpoints number in rank-4 material access");
             MessagePrinter::exitAsFem();
         }
-        return m_qpoints_rank4materials[(i-1)*m_qpoints_num+j-1];
+        return m_qpoints_rank4materials[getIthElmtJthQPointLocalID(i,j)];
     }
 
 
@@ -148,7 +227,13 @@ public:
 
 private:
     bool m_allocated;/**< boolean flag for the allocation status */
-    int m_bulkelmts_num;/**< the total number of bulk elements */
+    vector<Vector> m_u_history;/**< the ring buffer of the previous converged solutions */
+    vector<double> m_t_history;/**< the time of each previous solution in the ring buffer */
+    int m_history_size;/**< the capacity of the ring buffer */
+    int m_history_num;/**< the number of the stored previous solutions */
+    int m_history_head;/**< the position of the latest solution in the ring buffer */
+    int m_bulkelmts_num;/**< the number of local bulk elements */
+    int m_elmt_offset;/**< the global id of the first local bulk element minus 1 */
     int m_qpoints_num;/**< for the number of gauss points of each bulk element */
 
 
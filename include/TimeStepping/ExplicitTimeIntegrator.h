@@ -0,0 +1,178 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the time integrators without SNES, the residual of
+//+++          each element is R=M*V+G(U), then:
+//+++          1) SSP-RK3: V=-ML^{-1}*G(U), with the lumped mass
+//+++          2) IMEX-SBDF: the linearized G (the jacobian of the
+//+++             initial state) is implicit, the rest is explicit,
+//+++             the system matrix is assembled and factored once
+//+++          3) central difference: M*A+G(U)=0 for the dynamics,
+//+++             with the lumped mass and the half-step velocity
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <fstream>
+
+#include "petsc.h"
+
+#include "Utils/MessagePrinter.h"
+#include "NonlinearSolver/SNESSolver.h"
+#include "TimeStepping/TimeSteppingType.h"
+
+/**
+ * This class implements the explicit and the IMEX time integration, no nonlinear iteration is required
+ */
+class ExplicitTimeIntegrator{
+public:
+    /**
+     * constructor
+     */
+    ExplicitTimeIntegrator();
+
+    /**
+     * advance the solution from t to t+dt, U_old is the previous solution, the new one goes to U_current
+     * @param t_mesh the mesh class
+     * @param t_dofhandler the dof class
+     * @param t_fe the fe class
+     * @param t_elmtsystem the element system class
+     * @param t_matesystem the material system class
+     * @param t_fesystem the fe system class
+     * @param t_bcsystem the boundary condition system
+     * @param t_solutionsystem the solution system class
+     * @param t_equationsystem the equation system class
+     * @param t_fectrlinfo the fe control info
+     */
+    bool step(Mesh &t_mesh,DofHandler &t_dofhandler,FE &t_fe,
+              ElmtSystem &t_elmtsystem,MateSystem &t_matesystem,
+              FESystem &t_fesystem,
+              BCSystem &t_bcsystem,
+              SolutionSystem &t_solutionsystem,
+              EquationSystem &t_equationsystem,
+              FEControlInfo &t_fectrlinfo);
+
+    /**
+     * estimate the critical dt of the central difference method, i.e. min(h_e/c_e), where h_e is the
+     * min node distance of each element and c_e is the max 'wave-speed' of its qpoints
+     * @param t_mesh the mesh class
+     * @param t_solutionsystem the solution system class, the materials should be initialized
+     */
+    double estimateStableDt(const Mesh &t_mesh,const SolutionSystem &t_solutionsystem)const;
+    /**
+     * setup the lumping method of the mass matrix
+     * @param flag true for the HRZ lumping (the element diagonal scaled per field component), false for the row-sum lumping
+     */
+    inline void setHRZLumpingFlag(const bool &flag){m_hrzlumping=flag;}
+    /**
+     * setup the linear solver of the IMEX system, it follows the one of the nonlinear solver block
+     * @param t_linearsolvername the linear solver name
+     * @param t_pcname the preconditioner name
+     * @param t_restart the restart number of gmres/fgmres
+     * @param t_maxiters the maximum iterations of the linear solver
+     */
+    void setLinearSolverOptions(const string &t_linearsolvername,const string &t_pcname,
+                                const int &t_restart,const int &t_maxiters);
+
+    /**
+     * write the multi-step state, i.e. G of the previous IMEX step and the half-step velocity/acceleration
+     * of the central difference, to the checkpoint file
+     * @param out the binary output stream of the checkpoint file
+     */
+    void writeCheckpoint(std::ofstream &out);
+    /**
+     * read the multi-step state from the checkpoint file, return false if the local size doesn't match
+     * @param in the binary input stream of the checkpoint file
+     * @param t_solutionsystem the solution system class, the work vectors are allocated from it
+     */
+    bool readCheckpoint(std::ifstream &in,SolutionSystem &t_solutionsystem);
+
+    /**
+     * release the allocated memory
+     */
+    void releaseMemory();
+
+private:
+    /**
+     * allocate the work vectors, they have the same layout as the solution
+     * @param t_solutionsystem the solution system class
+     */
+    void allocateVectors(SolutionSystem &t_solutionsystem);
+    /**
+     * compute G(U)=R(U,V=0) at time t, the dirichlet rows are zero
+     * @param t the time
+     * @param U the solution vector
+     * @param G the output vector
+     */
+    void evaluateResidual(const double &t,Vector &U,Vec &G);
+    /**
+     * assemble K=ctan[0]*dG/dU+ctan[1]*M at the solution U, then copy it to A
+     * @param U the solution vector
+     * @param ctan the coefficients of the jacobian
+     * @param applybc true if the dirichlet penalty should be applied
+     * @param A the output matrix, it is allocated in the first call
+     */
+    void assembleMatrix(Vector &U,const double (&ctan)[3],const bool &applybc,Mat &A);
+    /**
+     * apply the dirichlet bc to U_current at time t
+     * @param t the time
+     */
+    void applyDirichletBC(const double &t);
+    /**
+     * assemble the lumped mass with the given coefficients (row-sum of the mass matrix, or HRZ element by element),
+     * then store its inverse
+     * @param ctan the coefficients of the jacobian, {0,1,0} for the velocity, {0,0,1} for the acceleration
+     */
+    void assembleLumpedMass(const double (&ctan)[3]);
+
+    /**
+     * do one step of the 3-stage strong-stability-preserving runge-kutta method
+     */
+    bool stepSSPRK3();
+    /**
+     * do one step of the IMEX-SBDF method with the given order
+     * @param order 1 or 2
+     */
+    bool stepIMEX(const int &order);
+    /**
+     * do one step of the central difference method for the dynamics
+     */
+    bool stepCentralDifference();
+
+private:
+    AppCtx m_appctx;/**< the application context for the assembly */
+    bool m_allocated;/**< true if the work vectors are allocated */
+    bool m_hasmass;/**< true if the (lumped) mass matrix is ready */
+    bool m_hasimexmatrix;/**< true if the IMEX system matrix is assembled and factored */
+    bool m_hasgold;/**< true if G of the previous step is stored for IMEX-SBDF2 */
+    bool m_hasacc;/**< true if the acceleration of the previous step is stored for the central difference */
+    bool m_hrzlumping;/**< true if the HRZ lumping is used, otherwise the row-sum lumping */
+
+    double m_imex_dt;/**< the dt of the factored IMEX matrix */
+    int m_imex_order;/**< the order of the factored IMEX matrix */
+    double m_cd_dtold;/**< the dt of the previous central difference step */
+
+    string m_linearsolvername;/**< the linear solver name of the IMEX system */
+    string m_pcname;/**< the preconditioner name of the IMEX system */
+    int m_ksp_restart;/**< the restart number of gmres/fgmres */
+    int m_ksp_maxiters;/**< the maximum iterations of the linear solver */
+
+    Mat m_M;/**< the consistent mass matrix, it is not assembled for the HRZ lumping */
+    Mat m_A;/**< the IMEX system matrix, i.e. c*M/dt+dG/dU(U0) */
+    KSP m_ksp;/**< the linear solver of the IMEX system */
+    Vec m_MLinv;/**< the inverse of the lumped mass */
+    Vec m_G;/**< the G vector of current stage */
+    Vec m_Gold;/**< the G vector of the previous step */
+    Vec m_dU;/**< the increment of the solution */
+    Vec m_work;/**< the work vector */
+    Vec m_vhalf;/**< the half-step velocity of the central difference */
+    Vec m_acc;/**< the acceleration of the central difference */
+};
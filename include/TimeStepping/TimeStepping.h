@@ -32,6 +32,7 @@
 
 #include "TimeStepping/TimeSteppingType.h"
 #include "TimeStepping/TimeSteppingData.h"
+#include "TimeStepping/ExplicitTimeIntegrator.h"
 
 
 /**
@@ -92,6 +93,51 @@ public:
      * @param flag true to enable the adaptive time stepping
      */
     void setAdaptiveFlag(const bool &flag){m_data.m_isadaptive=flag;}
+    /**
+     * setup the order of the extrapolation predictor
+     * @param order 0 for no predictor, 1 for linear, 2 for quadratic extrapolation
+     */
+    void setPredictorOrder(const int &order){m_data.m_predictor_order=order;}
+    /**
+     * setup the error control flag of the adaptive time stepping
+     * @param flag true to control dt by the local truncation error, false to control dt by the nonlinear iterations
+     */
+    void setErrorControlFlag(const bool &flag){m_data.m_errorcontrol=flag;}
+    /**
+     * setup the absolute tolerance of the local truncation error
+     * @param tol the tolerance value
+     */
+    void setErrorAbsTolerance(const double &tol){m_data.m_err_abstol=tol;}
+    /**
+     * setup the relative tolerance of the local truncation error
+     * @param tol the tolerance value
+     */
+    void setErrorRelTolerance(const double &tol){m_data.m_err_reltol=tol;}
+    /**
+     * setup the safety factor of the step size controller
+     * @param factor the safety factor, it should be in (0,1]
+     */
+    void setSafetyFactor(const double &factor){m_data.m_safety=factor;}
+    /**
+     * setup the maximum order of the variable order BDF
+     * @param order the maximum order, it should be in [1,5]
+     */
+    void setBDFMaxOrder(const int &order){m_data.m_bdf_maxorder=order;}
+    /**
+     * setup the ratio of dt to the critical dt of the central difference method
+     * @param cfl the ratio, it should be in (0,1]
+     */
+    void setCFLFactor(const double &cfl){m_data.m_cfl=cfl;}
+    /**
+     * setup the lumping method of the mass matrix
+     * @param flag true for the HRZ lumping (the element diagonal scaled per field component), false for the row-sum lumping
+     */
+    void setHRZLumpingFlag(const bool &flag){m_data.m_hrzlumping=flag;}
+    /**
+     * setup the checkpoint file, then the simulation continues from it instead of the initial conditions
+     * @param filename the string name of the checkpoint file
+     */
+    void setRestartFileName(const string &filename){m_restartfile_name=filename;}
 
     /**
      * apply the default time stepping settings
@@ -139,10 +185,55 @@ public:
      * get the adaptive status
      */
     inline bool isAdaptive()const{return m_data.m_isadaptive;}
+    /**
+     * get the order of the extrapolation predictor
+     */
+    inline int getPredictorOrder()const{return m_data.m_predictor_order;}
+    /**
+     * get the error control status of the adaptive time stepping
+     */
+    inline bool isErrorControl()const{return m_data.m_errorcontrol;}
+    /**
+     * get the absolute tolerance of the local truncation error
+     */
+    inline double getErrorAbsTolerance()const{return m_data.m_err_abstol;}
+    /**
+     * get the relative tolerance of the local truncation error
+     */
+    inline double getErrorRelTolerance()const{return m_data.m_err_reltol;}
+    /**
+     * get the safety factor of the step size controller
+     */
+    inline double getSafetyFactor()const{return m_data.m_safety;}
+    /**
+     * get the maximum order of the variable order BDF
+     */
+    inline int getBDFMaxOrder()const{return m_data.m_bdf_maxorder;}
+    /**
+     * get the ratio of dt to the critical dt of the central difference method
+     */
+    inline double getCFLFactor()const{return m_data.m_cfl;}
+    /**
+     * check whether the HRZ lumping is used for the mass matrix
+     */
+    inline bool isHRZLumping()const{return m_data.m_hrzlumping;}
+    /**
+     * check whether the simulation continues from a checkpoint file
+     */
+    inline bool hasRestartFile()const{return m_restartfile_name.size()>0;}
     /**
      * get the time integration method
      */
     inline TimeSteppingType getTimeSteppingType()const{return m_data.m_stepping_type;}
+    /**
+     * check whether the time stepping method bypasses the nonlinear solver
+     */
+    inline bool isExplicitMethod()const{
+        return m_data.m_stepping_type==TimeSteppingType::SSPRK3||
+               m_data.m_stepping_type==TimeSteppingType::IMEXSBDF1||
+               m_data.m_stepping_type==TimeSteppingType::IMEXSBDF2||
+               m_data.m_stepping_type==TimeSteppingType::CENTRALDIFFERENCE;
+    }
 
     /**
      * solve the transient equation
@@ -177,7 +268,149 @@ public:
 
 
 
+private:
+    /**
+     * extrapolate the previous converged solutions in the history buffer to t+dt as the initial guess
+     * of the nonlinear solver. The guess is rejected and the previous solution is used if it has a larger
+     * residual, nothing is done if there are not enough converged solutions for the extrapolation
+     * @param t_mesh the mesh class
+     * @param t_dofhandler the dof class
+     * @param t_fe the fe class
+     * @param t_elmtsystem the element system class
+     * @param t_matesystem the material system class
+     * @param t_fesystem the fe system class
+     * @param t_bcsystem the boundary condition system
+     * @param t_solutionsystem the solution system class
+     * @param t_equationsystem the equation system class
+     * @param t_fectrlinfo the fe control info
+     * @param t_nlsolver the nonlinear solver class, it assembles the residual of both guesses
+     */
+    void applyPredictor(Mesh &t_mesh,DofHandler &t_dofhandler,FE &t_fe,
+                        ElmtSystem &t_elmtsystem,MateSystem &t_matesystem,
+                        FESystem &t_fesystem,
+                        BCSystem &t_bcsystem,
+                        SolutionSystem &t_solutionsystem,
+                        EquationSystem &t_equationsystem,
+                        FEControlInfo &t_fectrlinfo,
+                        NonlinearSolver &t_nlsolver);
+    /**
+     * get the number of the converged solutions needed by the multi-step method, the predictor
+     * and the error estimation, they share the history buffer of the solution system
+     */
+    int getRequiredHistoryNum()const;
+
+    /**
+     * estimate the weighted rms norm of the local truncation error for current step, the error is the
+     * difference between the current solution and the extrapolation of the previous ones, scaled by
+     * the error constant of the time integration method. A value <=1 means the step can be accepted
+     * @param t_solutionsystem the solution system class
+     * @param t_fectrlinfo the fe control info
+     */
+    double estimateLocalError(SolutionSystem &t_solutionsystem,const FEControlInfo &t_fectrlinfo)const;
+    /**
+     * get the new dt from the PI step size controller
+     * @param dt the current delta t
+     * @param err the error norm of the current step
+     */
+    double computePIStepSize(const double &dt,const double &err)const;
+    /**
+     * get the weighted rms norm of the error vector, the weight of each component is atol+rtol*|U|
+     * @param E the error vector, it will be overwritten by the weighted one
+     * @param U the current solution
+     */
+    double computeWeightedRMSNorm(Vec &E,const Vec &U)const;
+
+    /**
+     * compute the coefficients of the variable order variable step BDF for current step
+     * @param t_solutionsystem the solution system class, which stores the solution history
+     * @param t_fectrlinfo the fe control info
+     */
+    void computeBDFCoefficients(SolutionSystem &t_solutionsystem,FEControlInfo &t_fectrlinfo)const;
+    /**
+     * estimate the weighted rms norm of the local truncation error of the q-th order BDF by the (q+1)-th
+     * divided difference of the current and the previous solutions, return -1 if there are not enough steps
+     * @param t_solutionsystem the solution system class
+     * @param t the time of the current solution
+     * @param q the order of the BDF
+     */
+    double estimateBDFError(SolutionSystem &t_solutionsystem,const double &t,const int &q)const;
+    /**
+     * select the BDF order of the next step among k-1, k and k+1, the one allows the largest dt is used
+     * @param t_solutionsystem the solution system class
+     * @param t the time of the current solution
+     */
+    void selectBDFOrder(SolutionSystem &t_solutionsystem,const double &t);
+
+    /**
+     * record the cost of the rejected step
+     * @param failed true if the solver failed, false if the step is rejected by the error control
+     * @param starttime the wall time when the step is started
+     * @param iters the nonlinear iterations spent on the rejected step
+     */
+    void recordRejectedStep(const bool &failed,const double &starttime,const int &iters);
+    /**
+     * print out the number and the cost of the rejected steps
+     * @param totaltime the wall time of the whole transient analysis
+     */
+    void printRejectedStepsInfo(const double &totaltime)const;
+
+    /**
+     * get the checkpoint file name of current rank, the rank id is appended for the parallel run
+     * @param filename the string name of the checkpoint file
+     */
+    string getRankCheckpointFileName(const string &filename)const;
+    /**
+     * write the full simulation state to the binary checkpoint file, each rank writes its own file
+     * @param filename the string name of the checkpoint file
+     * @param lastiters the nonlinear iterations of the last step
+     * @param t_solutionsystem the solution system class
+     * @param t_fectrlinfo the fe control info
+     * @param t_output the output system
+     * @param t_postprocess the postprocess system
+     */
+    void saveCheckpoint(const string &filename,const int &lastiters,
+                        SolutionSystem &t_solutionsystem,
+                        const FEControlInfo &t_fectrlinfo,
+                        const OutputSystem &t_output,
+                        const Postprocessor &t_postprocess);
+    /**
+     * read the checkpoint file of current rank, return false if it doesn't match current problem
+     * @param filename the string name of the checkpoint file
+     * @param lastiters the nonlinear iterations of the last step
+     * @param pvddatasets the number of the pvd datasets at the checkpoint
+     * @param csvrows the number of the csv rows at the checkpoint
+     * @param t_solutionsystem the solution system class
+     * @param t_fectrlinfo the fe control info
+     */
+    bool readRankCheckpoint(const string &filename,int &lastiters,int &pvddatasets,int &csvrows,
+                            SolutionSystem &t_solutionsystem,
+                            FEControlInfo &t_fectrlinfo);
+    /**
+     * read the full simulation state from the binary checkpoint file, the pvd and the csv files are
+     * truncated to the checkpoint, return false if the checkpoint of any rank doesn't match current problem
+     * @param filename the string name of the checkpoint file
+     * @param lastiters the nonlinear iterations of the last step
+     * @param t_solutionsystem the solution system class
+     * @param t_fectrlinfo the fe control info
+     * @param t_output the output system
+     * @param t_postprocess the postprocess system
+     */
+    bool loadCheckpoint(const string &filename,int &lastiters,
+                        SolutionSystem &t_solutionsystem,
+                        FEControlInfo &t_fectrlinfo,
+                        OutputSystem &t_output,
+                        Postprocessor &t_postprocess);
+
 private:
     TimeSteppingData m_data;/**< the time stepping data */
+    double m_err_old;/**< the error norm of the last accepted step, for the PI controller */
+    int m_bdf_order;/**< the current order of the variable order BDF */
+    int m_bdf_steps;/**< the number of the accepted steps with current BDF order */
+    ExplicitTimeIntegrator m_explicit;/**< the explicit/IMEX time integrator, which bypasses SNES */
+    string m_restartfile_name;/**< the checkpoint file to restart from, empty for the normal run */
+    int m_failed_steps;/**< the number of the steps rejected by the solver failure */
+    int m_errorrejected_steps;/**< the number of the steps rejected by the error control */
+    int m_rejected_iters;/**< the nonlinear iterations spent on the rejected steps */
+    double m_rejected_time;/**< the wall time spent on the rejected steps */
 
 };
\ No newline at end of file
@@ -28,6 +28,14 @@ struct TimeSteppingData{
     double m_growthfactor;/**< the growth factor for time adaptive */
     bool m_isadaptive;/**< boolean flag for adaptive */
     int m_optimize_iters=3;/**< optimize nonlinear iterations for time adaptive */
+    bool m_errorcontrol=false;/**< true if the adaptive dt is controlled by the local truncation error, otherwise by the nonlinear iterations */
+    double m_err_abstol=1.0e-4;/**< the absolute tolerance of the local truncation error */
+    double m_err_reltol=1.0e-3;/**< the relative tolerance of the local truncation error */
+    double m_safety=0.9;/**< the safety factor of the step size controller */
+    int m_bdf_maxorder=5;/**< the maximum order of the variable order BDF */
+    double m_cfl=0.9;/**< the ratio of dt to the critical dt of the central difference method */
+    bool m_hrzlumping=false;/**< true if the diagonal of each element mass is scaled to its total mass per field component (HRZ), otherwise the row-sum lumping is used */
+    int m_predictor_order=0;/**< the extrapolation order of the initial guess, 0->none, 1->linear, 2->quadratic */
 
     TimeSteppingType m_stepping_type;/**< the time stepping type */
 };
@@ -48,6 +48,7 @@ void computeTimeDerivatives(FEControlInfo &fectrlinfo,
         soln.m_a.setToZero();
     }
     else if(fectrlinfo.m_timesteppingtype==TimeSteppingType::CRANCKNICOLSON){
+        // the residual is evaluated at the mid-point, i.e. (Un+1-Un)/dt=f(0.5*(Un+1+Un))
         fectrlinfo.ctan[0]=0.5;
         fectrlinfo.ctan[1]=1.0/fectrlinfo.dt;
         fectrlinfo.ctan[2]=0.0;
@@ -56,17 +57,19 @@ void computeTimeDerivatives(FEControlInfo &fectrlinfo,
         soln.m_u_temp+=soln.m_u_old;
         soln.m_u_temp*=0.5;
 
-        soln.m_v=soln.m_u_temp;
+        soln.m_v=U;
         soln.m_v-=soln.m_u_old;
         soln.m_v*=1.0/fectrlinfo.dt;
 
         soln.m_a.setToZero();
     }
     else if(fectrlinfo.m_timesteppingtype==TimeSteppingType::BDF2){
-        // the expression for BDF2 is:
-        // [Un+2-(4/3)Un+1+(1/3)Un]/dt=(2/3)f(Un+2)
+        // the expression for BDF2 with variable step (w=dt/dt_old) is:
+        // [(1+2w)/(1+w)*Un+1-(1+w)*Un+w^2/(1+w)*Un-1]/dt=f(Un+1)
+        // which reduces to [(3/2)Un+1-2Un+(1/2)Un-1]/dt=f(Un+1) for the constant dt
 
-        if(fectrlinfo.CurrentStep<2){
+        soln.m_u_temp=U;
+        if(fectrlinfo.CurrentStep<1){
             // for the first step, it is backward euler
             fectrlinfo.ctan[0]=1.0;
             fectrlinfo.ctan[1]=1.0/fectrlinfo.dt;
@@ -77,14 +80,30 @@ void computeTimeDerivatives(FEControlInfo &fectrlinfo,
             soln.m_v*=fectrlinfo.ctan[1];
         }
         else{
-            fectrlinfo.ctan[0]=2.0/3.0;
-            fectrlinfo.ctan[1]=1.0/fectrlinfo.dt;
+            const double w=fectrlinfo.dt/fectrlinfo.dtold;
+            fectrlinfo.ctan[0]=1.0;
+            fectrlinfo.ctan[1]=(1.0+2.0*w)/((1.0+w)*fectrlinfo.dt);
             fectrlinfo.ctan[2]=0.0;
             // calculate the current velocity
             soln.m_v=U;
-            soln.m_v+=soln.m_u_old*(-4.0/3.0);
-            soln.m_v+=soln.m_u_older*(1.0/3.0);
-            soln.m_v*=fectrlinfo.ctan[1];
+            VecAXPBYPCZ(soln.m_v.getVectorRef(),-(1.0+w)/fectrlinfo.dt,w*w/((1.0+w)*fectrlinfo.dt),fectrlinfo.ctan[1],
+                        soln.m_u_old.getVectorRef(),soln.m_u_older.getVectorRef());
+        }
+        soln.m_a.setToZero();
+    }
+    else if(fectrlinfo.m_timesteppingtype==TimeSteppingType::BDF){
+        // the variable order variable step BDF, the coefficients come from the derivative of the
+        // lagrange polynomial through Un+1 and the previous solutions in the history buffer:
+        // du/dt=sum(bdfcoefs[j]*Un+1-j)=f(Un+1), j=0,1,...,bdforder
+        fectrlinfo.ctan[0]=1.0;
+        fectrlinfo.ctan[1]=fectrlinfo.bdfcoefs[0];
+        fectrlinfo.ctan[2]=0.0;
+
+        soln.m_u_temp=U;
+        soln.m_v=U;
+        VecScale(soln.m_v.getVectorRef(),fectrlinfo.bdfcoefs[0]);
+        for(int j=1;j<=fectrlinfo.bdforder;j++){
+            VecAXPY(soln.m_v.getVectorRef(),fectrlinfo.bdfcoefs[j],soln.getIthHistory(j).getVectorRef());
         }
         soln.m_a.setToZero();
     }
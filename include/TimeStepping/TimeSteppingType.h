@@ -18,5 +18,10 @@ enum class TimeSteppingType{
     STATIC,
     BACKWARDEULER,
     CRANCKNICOLSON,
-    BDF2
+    BDF2,
+    BDF,
+    SSPRK3,
+    IMEXSBDF1,
+    IMEXSBDF2,
+    CENTRALDIFFERENCE
 };
\ No newline at end of file
@@ -8,10 +8,43 @@
 """
 import os 
 from pathlib import Path
+import re
 import subprocess
 import sys
 import time
 
+def compareGoldCSV(csvfile,goldfile,rtol=1.0e-6,atol=1.0e-10):
+    # the csv file of the postprocess is compared with its reference output row by row
+    if not os.path.exists(csvfile):
+        return False
+    with open(csvfile) as f:
+        rows=[line.strip() for line in f if len(line.strip())>0]
+    with open(goldfile) as f:
+        goldrows=[line.strip() for line in f if len(line.strip())>0]
+    if len(rows)!=len(goldrows) or rows[0]!=goldrows[0]:
+        return False
+    for row,goldrow in zip(rows[1:],goldrows[1:]):
+        values=row.split(',');goldvalues=goldrow.split(',')
+        if len(values)!=len(goldvalues):
+            return False
+        for value,goldvalue in zip(values,goldvalues):
+            if abs(float(value)-float(goldvalue))>atol+rtol*abs(float(goldvalue)):
+                return False
+    return True
+
+def getNewtonIterations(stdout):
+    # the total newton iterations of the converged steps, both the normal and the 'dep' print are counted
+    return sum(int(it) for it in re.findall(r'(?:final iters|SNES solver: iters)=\s*(\d+)',stdout))
+
+def getFailedSteps(stdout):
+    # the steps thrown away by the failed nonlinear solver, from the rejected steps summary
+    return sum(int(it) for it in re.findall(r'solver failed=\s*(\d+)',stdout))
+
+def getMinBoundedIncrement(stdout):
+    # the min increment U-U_old of the bounded dofs of the vi solver in all the converged steps
+    values=[float(it) for it in re.findall(r'min\(U-U_old\) of the vi dofs=\s*(\S+)',stdout)]
+    return min(values) if len(values)>0 else None
+
 cpus=2
 if len(sys.argv)>=3:
     if '-n' in sys.argv[2-1]:
@@ -39,6 +72,8 @@ timestart=time.time()
 
 nFiles=0;nSucess=0
 FailedFileList=[]
+NewtonIters={}
+FailedSteps={}
 for subdir,dirs,files in os.walk(TestDir):
     print('***----------------------------------------------------------------------------***')
     print('***   start to run input files in %s'%(subdir))
@@ -54,7 +89,43 @@ for subdir,dirs,files in os.walk(TestDir):
                 args='mpirun -np %d '%(cpus)+AsFem+' -i '+file
                 result=subprocess.run(args,shell=True,capture_output=True)
             nFiles+=1
-            if ('AsFem exit due to some errors' in result.stdout.decode("utf-8")) or ('Error' in result.stdout.decode("utf-8")):
+            NewtonIters[subdir+'/'+file]=getNewtonIterations(result.stdout.decode("utf-8"))
+            FailedSteps[subdir+'/'+file]=getFailedSteps(result.stdout.decode("utf-8"))
+            # the input xxx-vi.json bounds its damage by the previous one, then d>=d_old in every step
+            IsBoundKept=True
+            if file.endswith('-vi.json'):
+                dumin=getMinBoundedIncrement(result.stdout.decode("utf-8"))
+                IsBoundKept=(dumin is not None) and (dumin>=-1.0e-12)
+            # the input xxx-restart.json is restarted from its last checkpoint (written before the end),
+            # then the restarted run must rewrite exactly the same csv file
+            IsRestartMatched=True
+            if file.endswith('-restart.json') and os.path.exists(file[:-5]+'.csv'):
+                with open(file[:-5]+'.csv') as f:
+                    csvstr=f.read()
+                subprocess.run(args+' --restart '+file[:-5]+'.chk',shell=True,capture_output=True)
+                with open(file[:-5]+'.csv') as f:
+                    IsRestartMatched=(f.read()==csvstr)
+            # the input with a reference output (xxx-gold.csv) must reproduce it
+            goldfile=file[:-5]+'-gold.csv'
+            IsGoldMatched=True
+            if os.path.exists(goldfile):
+                IsGoldMatched=compareGoldCSV(file[:-5]+'.csv',goldfile)
+            if not IsGoldMatched:
+                sys.stdout.write("\033[1;31m") # set to red color
+                print('***     %s fails, its csv file is different from %s !'%(file,goldfile))
+                sys.stdout.write("\033[0;0m")  # reset color
+                FailedFileList.append(file)
+            elif not IsBoundKept:
+                sys.stdout.write("\033[1;31m") # set to red color
+                print('***     %s fails, the bounded dofs drop below their previous values !'%(file))
+                sys.stdout.write("\033[0;0m")  # reset color
+                FailedFileList.append(file)
+            elif not IsRestartMatched:
+                sys.stdout.write("\033[1;31m") # set to red color
+                print('***     %s fails, the restarted run gives a different csv file !'%(file))
+                sys.stdout.write("\033[0;0m")  # reset color
+                FailedFileList.append(file)
+            elif ('AsFem exit due to some errors' in result.stdout.decode("utf-8")) or ('Error' in result.stdout.decode("utf-8")):
                 sys.stdout.write("\033[1;31m") # set to red color
                 print('***     %s fails !'%(file))
                 sys.stdout.write("\033[0;0m")  # reset color
@@ -78,6 +149,26 @@ for subdir,dirs,files in os.walk(TestDir):
                 FailedFileList.append(file)
                 sys.exit()
 
+# the input xxx-predictor.json must reproduce xxx.json with fewer newton iterations
+for file in NewtonIters:
+    if file.endswith('-predictor.json') and (file[:-15]+'.json') in NewtonIters and os.path.basename(file) not in FailedFileList:
+        if NewtonIters[file]>=NewtonIters[file[:-15]+'.json']:
+            sys.stdout.write("\033[1;31m") # set to red color
+            print('***     %s fails, %d newton iterations are not fewer than the %d without the predictor !'%(os.path.basename(file),NewtonIters[file],NewtonIters[file[:-15]+'.json']))
+            sys.stdout.write("\033[0;0m")  # reset color
+            FailedFileList.append(os.path.basename(file))
+            nSucess-=1
+
+# the input xxx-vi.json must fail fewer steps than the history field only xxx.json
+for file in FailedSteps:
+    if file.endswith('-vi.json') and (file[:-8]+'.json') in FailedSteps and os.path.basename(file) not in FailedFileList:
+        if FailedSteps[file]>=FailedSteps[file[:-8]+'.json']:
+            sys.stdout.write("\033[1;31m") # set to red color
+            print('***     %s fails, %d failed steps are not fewer than the %d without the vi solver !'%(os.path.basename(file),FailedSteps[file],FailedSteps[file[:-8]+'.json']))
+            sys.stdout.write("\033[0;0m")  # reset color
+            FailedFileList.append(os.path.basename(file))
+            nSucess-=1
+
 timeend=time.time()
 duration=timeend-timestart
 
@@ -20,7 +20,10 @@ for subdir,dirs,files in os.walk(currentdir):
         continue
     #>>> clean files
     for file in files:
-        if ('.csv' in file):
+        if ('-gold.csv' in file):
+            # the reference outputs of the tests
+            continue
+        elif ('.csv' in file):
             try:
                 csvfile+=1
                 removepath=subdir+'/'+file
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@Author: Yang Bai
+@Date: 2026.10.19
+@Function: time the msh4 parsers on the files of test_input/importmesh and on a
+           synthetic hex8 box (10M elements by default), the text file is parsed
+           by the old getline+splitStrNum loop and by the mmap tokenizer, the
+           binary copy by the tokenizer. The kernel is MshParseBenchmark.cpp,
+           it is compiled here, so PETSc is not needed.
+           usage: python3 MeshImportBenchmark.py [-n elements] [-r repeat] [-d workdir] [--keep]
+"""
+import argparse
+import os
+from pathlib import Path
+import array
+import struct
+import subprocess
+import sys
+
+def writeSyntheticMesh(filename,n,IsBinary):
+    # the unit box with n^3 hex8 elements, one volume entity with the physical group 'block'
+    nn=n+1
+    nodes=nn**3
+    elmts=n**3
+    with open(filename,'wb') as f:
+        f.write(b'$MeshFormat\n')
+        if IsBinary:
+            f.write(b'4.1 1 8\n')
+            f.write(struct.pack('=i',1))
+            f.write(b'\n')
+        else:
+            f.write(b'4.1 0 8\n')
+        f.write(b'$EndMeshFormat\n')
+        f.write(b'$PhysicalNames\n1\n3 1 "block"\n$EndPhysicalNames\n')
+        f.write(b'$Entities\n')
+        if IsBinary:
+            f.write(struct.pack('=4Q',0,0,0,1))
+            f.write(struct.pack('=i6dQiQ',1,0.0,0.0,0.0,1.0,1.0,1.0,1,1,0))
+            f.write(b'\n')
+        else:
+            f.write(b'0 0 0 1\n1 0 0 0 1 1 1 1 1 0\n')
+        f.write(b'$EndEntities\n')
+        # nodes, the tags and then the coordinates of the only block
+        f.write(b'$Nodes\n')
+        if IsBinary:
+            f.write(struct.pack('=4Q',1,nodes,1,nodes))
+            f.write(struct.pack('=3iQ',3,1,0,nodes))
+            f.write(array.array('Q',range(1,nodes+1)).tobytes())
+        else:
+            f.write(('1 %d 1 %d\n3 1 0 %d\n'%(nodes,nodes,nodes)).encode())
+            for start in range(1,nodes+1,1000000):
+                f.write(''.join('%d\n'%(i) for i in range(start,min(start+1000000,nodes+1))).encode())
+        h=1.0/n
+        for k in range(nn):
+            z=k*h
+            if IsBinary:
+                coords=array.array('d')
+                for j in range(nn):
+                    for i in range(nn):
+                        coords.extend((i*h,j*h,z))
+                f.write(coords.tobytes())
+            else:
+                f.write(''.join('%.17g %.17g %.17g\n'%(i*h,j*h,z) for j in range(nn) for i in range(nn)).encode())
+        if IsBinary:
+            f.write(b'\n')
+        f.write(b'$EndNodes\n')
+        # elements, in the gmsh hex8 order
+        f.write(b'$Elements\n')
+        if IsBinary:
+            f.write(struct.pack('=4Q',1,elmts,1,elmts))
+            f.write(struct.pack('=3iQ',3,1,5,elmts))
+        else:
+            f.write(('1 %d 1 %d\n3 1 5 %d\n'%(elmts,elmts,elmts)).encode())
+        e=1
+        for k in range(n):
+            conn=array.array('Q') if IsBinary else []
+            for j in range(n):
+                for i in range(n):
+                    n1=k*nn*nn+j*nn+i+1
+                    n4=n1+nn;n5=n1+nn*nn;n8=n4+nn*nn
+                    if IsBinary:
+                        conn.extend((e,n1,n1+1,n4+1,n4,n5,n5+1,n8+1,n8))
+                    else:
+                        conn.append('%d %d %d %d %d %d %d %d %d\n'%(e,n1,n1+1,n4+1,n4,n5,n5+1,n8+1,n8))
+                    e+=1
+            f.write(conn.tobytes() if IsBinary else ''.join(conn).encode())
+        if IsBinary:
+            f.write(b'\n')
+        f.write(b'$EndElements\n')
+
+def runKernel(kernel,parser,filename,repeat):
+    result=subprocess.run([kernel,parser,filename,str(repeat)],capture_output=True)
+    values=result.stdout.decode('utf-8').split()
+    if result.returncode!=0 or len(values)!=5:
+        print('*** %s fails on %s: %s'%(parser,filename,result.stdout.decode('utf-8')))
+        sys.exit(1)
+    return float(values[0]),int(values[2]),values[1:]
+
+parser=argparse.ArgumentParser(description='time the msh4 parsers of the mesh importer')
+parser.add_argument('-n',type=int,default=10000000,help='the elements number of the synthetic hex8 box')
+parser.add_argument('-r',type=int,default=3,help='the best of r runs is reported')
+parser.add_argument('-d',default='',help='the folder of the kernel and the synthetic meshes')
+parser.add_argument('--keep',action='store_true',help='keep the synthetic meshes')
+args=parser.parse_args()
+
+scriptdir=Path(__file__).parent.resolve()
+asfemdir=Path(scriptdir).parent
+workdir=args.d if len(args.d)>0 else os.getcwd()+'/meshbenchmark'
+os.makedirs(workdir,exist_ok=True)
+
+kernel=workdir+'/MshParseBenchmark'
+compiler=os.environ.get('CXX','g++')
+args_compile=[compiler,'-O2','-std=c++17','-I'+str(asfemdir)+'/include',
+              str(scriptdir)+'/MshParseBenchmark.cpp',
+              str(asfemdir)+'/src/Mesh/MshFileTokenizer.cpp',
+              str(asfemdir)+'/src/Utils/StringUtils.cpp','-o',kernel]
+print('*** compile the kernel: %s'%(' '.join(args_compile)))
+if subprocess.run(args_compile).returncode!=0:
+    sys.exit(1)
+
+# the text/binary pairs, the synthetic one is generated
+cases=[('cylinder-tet4',str(asfemdir)+'/test_input/importmesh/cylinder-tet4.msh',str(asfemdir)+'/test_input/importmesh/cylinder-tet4-bin.msh')]
+n=max(1,round(args.n**(1.0/3.0)))
+textfile=workdir+'/box-hex8-%d.msh'%(n**3);binaryfile=workdir+'/box-hex8-%d-bin.msh'%(n**3)
+for filename,IsBinary in [(textfile,False),(binaryfile,True)]:
+    if not os.path.exists(filename):
+        print('*** write the synthetic mesh %s'%(filename))
+        writeSyntheticMesh(filename,n,IsBinary)
+cases.append(('box-hex8-%d'%(n**3),textfile,binaryfile))
+
+print('*** %-20s %-8s %-8s %10s %10s %10s %12s'%('mesh','format','parser','size(MB)','time(s)','MB/s','Melmts/s'))
+for name,textfile,binaryfile in cases:
+    checksums=[]
+    for fmt,parsername,filename in [('text','getline',textfile),('text','mmap',textfile),('binary','mmap',binaryfile)]:
+        duration,elmts,checksum=runKernel(kernel,parsername,filename,args.r)
+        size=os.path.getsize(filename)/1.0e6
+        checksums.append(checksum)
+        print('*** %-20s %-8s %-8s %10.2f %10.4f %10.1f %12.3f'%(name,fmt,parsername,size,duration,size/duration,elmts/duration/1.0e6))
+    if checksums[0]!=checksums[1] or checksums[1]!=checksums[2]:
+        print('*** the parsers give different meshes for %s: %s'%(name,checksums))
+        sys.exit(1)
+
+if not args.keep:
+    os.remove(textfile);os.remove(binaryfile)
@@ -0,0 +1,239 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.19
+//+++ Purpose: the timing kernel of MeshImportBenchmark.py, the
+//+++          $Nodes and $Elements of one msh4 file are parsed by
+//+++          the old getline+splitStrNum loop and by the mmap
+//+++          tokenizer (text or binary) of the msh4 importer.
+//+++          It only needs the tokenizer and the string utils:
+//+++          g++ -O2 -std=c++17 -Iinclude MshParseBenchmark.cpp
+//+++              src/Mesh/MshFileTokenizer.cpp
+//+++              src/Utils/StringUtils.cpp
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include "Mesh/MshFileTokenizer.h"
+#include "Utils/StringUtils.h"
+
+/**
+ * the parsed nodes and elements, only their sums are compared between the parsers
+ */
+struct ParsedMesh{
+    long long nodes=0;
+    long long elements=0;
+    double coordsum=0.0;
+    long long connsum=0;
+};
+
+/**
+ * the nodes number of the gmsh element type, MshFileUtils is not used since it needs the message printer of AsFem
+ * @param elmttype the gmsh element type
+ */
+static int getElmtNodesNum(const int &elmttype){
+    switch(elmttype){
+        case 1: return 2;// edge2
+        case 2: return 3;// tri3
+        case 3: return 4;// quad4
+        case 4: return 4;// tet4
+        case 5: return 8;// hex8
+        case 8: return 3;// edge3
+        case 9: return 6;// tri6
+        case 10: return 9;// quad9
+        case 11: return 10;// tet10
+        case 12: return 27;// hex27
+        case 15: return 1;// point
+        case 16: return 8;// quad8
+        case 17: return 20;// hex20
+        default: return 0;
+    }
+}
+
+/**
+ * the old importer loop: getline and splitStrNum for each line
+ */
+static bool parseByGetline(const string &filename,ParsedMesh &mesh){
+    std::ifstream in(filename);
+    if(!in.is_open()) return false;
+    string str;
+    vector<double> numbers;
+    vector<int> nodeid;
+    while(getline(in,str)){
+        if(str.find("$Nodes")!=string::npos){
+            getline(in,str);
+            numbers=StringUtils::splitStrNum(str);
+            const int blocks=static_cast<int>(numbers[0]);
+            for(int b=0;b<blocks;b++){
+                getline(in,str);
+                numbers=StringUtils::splitStrNum(str);
+                const int n=static_cast<int>(numbers[3]);
+                nodeid.clear();
+                for(int i=0;i<n;i++){
+                    getline(in,str);
+                    numbers=StringUtils::splitStrNum(str);
+                    nodeid.push_back(static_cast<int>(numbers[0]));
+                }
+                for(int i=0;i<n;i++){
+                    getline(in,str);
+                    numbers=StringUtils::splitStrNum(str);
+                    mesh.coordsum+=numbers[0]+numbers[1]+numbers[2];
+                    mesh.nodes+=1;
+                }
+            }
+        }
+        else if(str.find("$Elements")!=string::npos){
+            getline(in,str);
+            numbers=StringUtils::splitStrNum(str);
+            const int blocks=static_cast<int>(numbers[0]);
+            for(int b=0;b<blocks;b++){
+                getline(in,str);
+                numbers=StringUtils::splitStrNum(str);
+                const int n=static_cast<int>(numbers[3]);
+                for(int i=0;i<n;i++){
+                    getline(in,str);
+                    numbers=StringUtils::splitStrNum(str);
+                    for(size_t j=1;j<numbers.size();j++) mesh.connsum+=static_cast<long long>(numbers[j]);
+                    mesh.elements+=1;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * the loop of the msh4 importer on the mapped file, for both the text and the binary format
+ */
+static bool parseByTokenizer(const string &filename,ParsedMesh &mesh){
+    MshFileTokenizer in;
+    if(!in.open(filename)) return false;
+    string_view line;
+    vector<int> ints;
+    vector<double> nums;
+    vector<long long> tags;
+    vector<double> coords;
+    long long counts[4],n,val;
+    int entity[3],format=0,datasize=8,one;
+    double version;
+    while(in.nextLine(line)){
+        if(line.find("$MeshFormat")!=string_view::npos){
+            in.readDouble(version);in.readInt(format);in.readInt(datasize);
+            in.skipLine();
+            if(format==1) in.readBinaryValue(one);
+        }
+        else if(line.find("$Nodes")!=string_view::npos){
+            if(format==1){
+                for(int i=0;i<4;i++) in.readBinarySize(datasize,counts[i]);
+            }
+            else{
+                in.readLineInts(ints);
+                counts[0]=ints[0];
+            }
+            for(long long b=0;b<counts[0];b++){
+                if(format==1){
+                    in.readBinary(entity,3*sizeof(int));
+                    in.readBinarySize(datasize,n);
+                }
+                else{
+                    in.readLineInts(ints);
+                    n=ints[3];
+                }
+                tags.resize(n);
+                for(long long i=0;i<n;i++){
+                    if(format==1){
+                        in.readBinarySize(datasize,tags[i]);
+                    }
+                    else{
+                        in.readLineInts(ints);
+                        tags[i]=ints[0];
+                    }
+                }
+                coords.resize(3*n);
+                if(format==1){
+                    in.readBinary(coords.data(),3*n*sizeof(double));
+                }
+                else{
+                    for(long long i=0;i<n;i++){
+                        in.readLineNums(nums);
+                        coords[3*i]=nums[0];coords[3*i+1]=nums[1];coords[3*i+2]=nums[2];
+                    }
+                }
+                for(long long i=0;i<n;i++) mesh.coordsum+=coords[3*i]+coords[3*i+1]+coords[3*i+2];
+                mesh.nodes+=n;
+            }
+        }
+        else if(line.find("$Elements")!=string_view::npos){
+            if(format==1){
+                for(int i=0;i<4;i++) in.readBinarySize(datasize,counts[i]);
+            }
+            else{
+                in.readLineInts(ints);
+                counts[0]=ints[0];
+            }
+            for(long long b=0;b<counts[0];b++){
+                int nodes=0;
+                if(format==1){
+                    in.readBinary(entity,3*sizeof(int));
+                    in.readBinarySize(datasize,n);
+                    nodes=getElmtNodesNum(entity[2]);
+                }
+                else{
+                    in.readLineInts(ints);
+                    n=ints[3];
+                }
+                for(long long i=0;i<n;i++){
+                    if(format==1){
+                        in.readBinarySize(datasize,val);// the element tag
+                        for(int j=0;j<nodes;j++){
+                            in.readBinarySize(datasize,val);
+                            mesh.connsum+=val;
+                        }
+                    }
+                    else{
+                        in.readLineInts(ints);
+                        for(size_t j=1;j<ints.size();j++) mesh.connsum+=ints[j];
+                    }
+                }
+                mesh.elements+=n;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc,char *argv[]){
+    if(argc<3){
+        std::cout<<"usage: "<<argv[0]<<" getline|mmap file.msh [repeat]"<<std::endl;
+        return 1;
+    }
+    const string mode=argv[1],filename=argv[2];
+    const int repeat=argc>3?std::atoi(argv[3]):1;
+    ParsedMesh mesh;
+    double best=1.0e30;
+    for(int r=0;r<(repeat>0?repeat:1);r++){
+        mesh=ParsedMesh();
+        auto start=std::chrono::steady_clock::now();
+        const bool IsSuccess=mode=="getline"?parseByGetline(filename,mesh):parseByTokenizer(filename,mesh);
+        const double duration=std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+        if(!IsSuccess){
+            std::cout<<"can't read "<<filename<<std::endl;
+            return 1;
+        }
+        if(duration<best) best=duration;
+    }
+    // one line for the driver script: seconds, nodes, elements and the checksums
+    std::printf("%.6f %lld %lld %.10e %lld\n",best,mesh.nodes,mesh.elements,mesh.coordsum,mesh.connsum);
+    return 0;
+}
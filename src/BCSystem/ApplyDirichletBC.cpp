@@ -29,8 +29,8 @@ void BCSystem::applyDirichletBC(const FECalcType &calctype,
     //************************************
     //*** get rid of unused warnings 
     //************************************
-    int i,j,k,e,iInd,nElmts;
-    int rankne,eStart,eEnd;
+    int i,j,jlocal,k,e,iInd,nElmts,phyhandle;
+    int eStart,eEnd;
     vector<int> globaldofids;
     globaldofids.resize(dofids.size(),0);
 
@@ -47,23 +47,24 @@ void BCSystem::applyDirichletBC(const FECalcType &calctype,
 
     for(const auto &name:bcnamelist){
         nElmts=mesh.getBulkMeshElmtsNumViaPhyName(name);
-        rankne=nElmts/m_size;
-        eStart=m_rank*rankne;
-        eEnd=(m_rank+1)*rankne;
-        if(m_rank==m_size-1) eEnd=nElmts;
+        phyhandle=mesh.getBulkMeshPhyGroupHandle(name);
+        mesh.getBulkMeshPhyGroupElmtsRange(nElmts,m_rank,m_size,eStart,eEnd);
         m_local_elmtinfo.m_dim=mesh.getBulkMeshElmtDimViaPhyName(name);
 
         for(e=eStart;e<eEnd;e++){
-            m_local_elmtinfo.m_nodesnum=mesh.getBulkMeshIthElmtNodesNumViaPhyName(name,e+1);
+            ElmtConnArray conn=mesh.getBulkMeshIthElmtConnViaHandle(phyhandle,e+1);
+            m_local_elmtinfo.m_nodesnum=conn.size();
             
             for(i=1;i<=m_local_elmtinfo.m_nodesnum;i++){
-                j=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,i);
+                j=conn[i-1];
+                // the dofs map is indexed by the local node id, it is only looked up once per node
+                jlocal=mesh.getBulkMeshNodeLocalID(j);
                 m_local_elmtinfo.m_gpCoords0(1)=mesh.getBulkMeshIthNodeJthCoord0(j,1);
                 m_local_elmtinfo.m_gpCoords0(2)=mesh.getBulkMeshIthNodeJthCoord0(j,2);
                 m_local_elmtinfo.m_gpCoords0(3)=mesh.getBulkMeshIthNodeJthCoord0(j,3);
 
                 for(k=1;k<=m_local_elmtinfo.m_dofsnum;k++){
-                    iInd=dofhandler.getIthNodeJthDofID(j,dofids[k-1]);
+                    iInd=dofhandler.getIthLocalNodeJthDofID(jlocal,dofids[k-1]);
                     globaldofids[k-1]=iInd;
 
                     m_local_elmtsoln.m_gpU[k]=Ucopy.getIthValueFromGhost(iInd);
@@ -30,7 +30,7 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
                                  Vector &RHS){
     // for other types of boundary conditions
     // for other type boundary conditions
-    int rankne,eStart,eEnd,nNodesPerBCElmt;
+    int eStart,eEnd,nElmts,nNodesPerBCElmt,phyhandle;
     int e,i,j,k,iInd,jInd,gpInd;
     double xi,eta,w,JxW,dist;
 
@@ -45,10 +45,9 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
     V.makeGhostCopy();    
 
     for(const auto &name:bcnamelist){
-        rankne=mesh.getBulkMeshElmtsNumViaPhyName(name)/m_size;
-        eStart=m_rank*rankne;
-        eEnd=(m_rank+1)*rankne;
-        if(m_rank==m_size-1) eEnd=mesh.getBulkMeshElmtsNumViaPhyName(name);
+        nElmts=mesh.getBulkMeshElmtsNumViaPhyName(name);
+        phyhandle=mesh.getBulkMeshPhyGroupHandle(name);
+        mesh.getBulkMeshPhyGroupElmtsRange(nElmts,m_rank,m_size,eStart,eEnd);
         m_local_elmtinfo.m_dim=mesh.getBulkMeshElmtDimViaPhyName(name);
         nNodesPerBCElmt=0;
 
@@ -58,16 +57,19 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
         }
 
         for(e=eStart;e<eEnd;e++){
-            nNodesPerBCElmt=mesh.getBulkMeshIthElmtNodesNumViaPhyName(name,e+1);      
+            ElmtConnArray conn=mesh.getBulkMeshIthElmtConnViaHandle(phyhandle,e+1);
+            nNodesPerBCElmt=conn.size();      
+            // the local node ids index the nodal dofs map directly, so the global id is only looked up once per node
+            for(i=1;i<=nNodesPerBCElmt;i++) m_localnodeids[i-1]=mesh.getBulkMeshNodeLocalID(conn[i-1]);
             if(m_local_elmtinfo.m_dim==0){
                  // for 'point' case
                 for(i=1;i<=nNodesPerBCElmt;i++){
-                    j=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,i);// global id
+                    j=conn[i-1];// global id
                     m_local_elmtinfo.m_gpCoords0(1)=mesh.getBulkMeshIthNodeJthCoord0(j,1);
                     m_local_elmtinfo.m_gpCoords0(2)=mesh.getBulkMeshIthNodeJthCoord0(j,2);
                     m_local_elmtinfo.m_gpCoords0(3)=mesh.getBulkMeshIthNodeJthCoord0(j,3);
                     for(k=0;k<m_local_elmtinfo.m_dofsnum;k++){
-                        iInd=dofhandler.getIthNodeJthDofID(j,k+1);
+                        iInd=dofhandler.getIthLocalNodeJthDofID(m_localnodeids[i-1],k+1);
                         // get the local solutions
                         m_local_elmtsoln.m_gpU[k+1]=U.getIthValueFromGhost(iInd);
                         m_local_elmtsoln.m_gpUold[k+1]=Uold.getIthValueFromGhost(iInd);
@@ -85,7 +87,7 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
                         m_local_shp.m_grad_test=0.0;
                         m_local_shp.m_trial=0.0;
                         m_local_shp.m_grad_trial=0.0;
-                        iInd=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,i);
+                        iInd=m_localnodeids[i-1];
                         runBCLibs(calctype,bctype,bcvalue,ctan,parameters,
                                   m_normal,
                                   m_local_elmtinfo,m_local_elmtsoln,m_local_shp,
@@ -98,11 +100,11 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
                     for(i=1;i<=nNodesPerBCElmt;i++){
                         m_local_shp.m_test=1.0;
                         m_local_shp.m_grad_test=0.0;
-                        iInd=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,i);
+                        iInd=m_localnodeids[i-1];
                         for(j=1;j<=nNodesPerBCElmt;j++){
                             m_local_shp.m_trial=0.0;
                             m_local_shp.m_grad_trial=0.0;
-                            jInd=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,j);
+                            jInd=m_localnodeids[j-1];
                             runBCLibs(calctype,bctype,bcvalue,ctan,parameters,
                                       m_normal,
                                       m_local_elmtinfo,m_local_elmtsoln,m_local_shp,
@@ -116,7 +118,7 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
             }// end-of-dim=0-case
             else if(m_local_elmtinfo.m_dim==1){
                 // for 'line' element case
-                mesh.getBulkMeshIthElmtNodeCoords0ViaPhyName(name,e+1,m_nodes0);
+                mesh.getBulkMeshIthElmtNodeCoords0ViaHandle(phyhandle,e+1,m_nodes0);
                 
                 // do the gauss point integration loop
                 for(gpInd=1;gpInd<=fe.m_line_qpoints.getQPointsNum();gpInd++){
@@ -155,9 +157,9 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
                     m_local_elmtinfo.m_gpCoords0=0.0;
                             
                     for(i=1;i<=nNodesPerBCElmt;i++){
-                        j=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,i);//global id
+                        j=conn[i-1];//global id
                         for(k=1;k<=m_local_elmtinfo.m_dofsnum;k++){
-                            iInd=dofhandler.getIthNodeJthDofID(j,dofids[k-1]);
+                            iInd=dofhandler.getIthLocalNodeJthDofID(m_localnodeids[i-1],dofids[k-1]);
 
                             m_local_elmtsoln.m_gpU[k]+=fe.m_line_shp.shape_value(i)*U.getIthValueFromGhost(iInd);
                             m_local_elmtsoln.m_gpUold[k]+=fe.m_line_shp.shape_value(i)*Uold.getIthValueFromGhost(iInd);
@@ -189,7 +191,7 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
                             m_local_shp.m_grad_test=fe.m_line_shp.shape_grad(i);
                             m_local_shp.m_trial=0.0;
                             m_local_shp.m_grad_trial=0.0;
-                            iInd=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,i);
+                            iInd=m_localnodeids[i-1];
                             runBCLibs(calctype,bctype,bcvalue,ctan,parameters,
                                       m_normal,
                                       m_local_elmtinfo,m_local_elmtsoln,m_local_shp,
@@ -202,11 +204,11 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
                         for(i=1;i<=nNodesPerBCElmt;i++){
                             m_local_shp.m_test=fe.m_line_shp.shape_value(i);
                             m_local_shp.m_grad_test=fe.m_line_shp.shape_grad(i);
-                            iInd=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,i);
+                            iInd=m_localnodeids[i-1];
                             for(j=1;j<=nNodesPerBCElmt;j++){
                                 m_local_shp.m_trial=fe.m_line_shp.shape_value(j);
                                 m_local_shp.m_grad_trial=fe.m_line_shp.shape_grad(j);
-                                jInd=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,j);
+                                jInd=m_localnodeids[j-1];
 
                                 runBCLibs(calctype,bctype,bcvalue,ctan,parameters,
                                           m_normal,
@@ -223,7 +225,7 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
             } // end-of-dim=1-case
             else if(m_local_elmtinfo.m_dim==2){
                 // for 'surf' element case
-                mesh.getBulkMeshIthElmtNodeCoords0ViaPhyName(name,e+1,m_nodes0);
+                mesh.getBulkMeshIthElmtNodeCoords0ViaHandle(phyhandle,e+1,m_nodes0);
 
                 for(gpInd=1;gpInd<=fe.m_surface_qpoints.getQPointsNum();gpInd++){
                     xi =fe.m_surface_qpoints.getIthPointJthCoord(gpInd,1);
@@ -268,9 +270,9 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
                     }
                     m_local_elmtinfo.m_gpCoords0=0.0;
                     for(i=1;i<=nNodesPerBCElmt;i++){
-                        j=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,i);//global id
+                        j=conn[i-1];//global id
                         for(k=1;k<=m_local_elmtinfo.m_dofsnum;k++){
-                            iInd=dofhandler.getIthNodeJthDofID(j,dofids[k-1]);
+                            iInd=dofhandler.getIthLocalNodeJthDofID(m_localnodeids[i-1],dofids[k-1]);
 
                             m_local_elmtsoln.m_gpU[k]+=fe.m_surface_shp.shape_value(i)*U.getIthValueFromGhost(iInd);
                             m_local_elmtsoln.m_gpUold[k]+=fe.m_surface_shp.shape_value(i)*Uold.getIthValueFromGhost(iInd);
@@ -302,7 +304,7 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
                             m_local_shp.m_grad_test=fe.m_surface_shp.shape_grad(i);
                             m_local_shp.m_trial=0.0;
                             m_local_shp.m_grad_trial=0.0;
-                            iInd=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,i);
+                            iInd=m_localnodeids[i-1];
                             runBCLibs(calctype,bctype,bcvalue,ctan,parameters,
                                       m_normal,
                                       m_local_elmtinfo,m_local_elmtsoln,m_local_shp,
@@ -316,11 +318,11 @@ void BCSystem::applyIntegratedBC(const FECalcType &calctype,
                         for(i=1;i<=nNodesPerBCElmt;i++){
                             m_local_shp.m_test=fe.m_surface_shp.shape_value(i);
                             m_local_shp.m_grad_test=fe.m_surface_shp.shape_grad(i);
-                            iInd=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,i);
+                            iInd=m_localnodeids[i-1];
                             for(j=1;j<=nNodesPerBCElmt;j++){
                                 m_local_shp.m_trial=fe.m_surface_shp.shape_value(j);
                                 m_local_shp.m_grad_trial=fe.m_surface_shp.shape_grad(j);
-                                jInd=mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,j);
+                                jInd=m_localnodeids[j-1];
 
                                 runBCLibs(calctype,bctype,bcvalue,ctan,parameters,
                                           m_normal,
@@ -29,6 +29,7 @@ void BCSystem::init(const int &dofs){
     m_localR.resize(dofs+1,0.0);
     m_nodes0.resize(27+1);
     m_nodes.resize(27+1);
+    m_localnodeids.resize(27,0);
 
     m_local_elmtsoln.m_gpU.resize(dofs+1,0.0);
     m_local_elmtsoln.m_gpUold.resize(dofs+1,0.0);
@@ -54,6 +55,7 @@ void BCSystem::releaseMemory(){
     m_localR.clean();
     m_nodes0.clear();
     m_nodes.clear();
+    m_localnodeids.clear();
 
     m_local_elmtsoln.m_gpU.clear();
     m_local_elmtsoln.m_gpUold.clear();
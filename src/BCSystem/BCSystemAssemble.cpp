@@ -21,7 +21,7 @@ void BCSystem::assembleLocalResidual2Global(const int &dofs,const vector<int> &d
                                             const VectorXd &localR,Vector &RHS){
     int iInd;
     for(int i=0;i<dofs;i++){
-        iInd=dofhandler.getIthNodeJthDofID(I,dofids[i]);
+        iInd=dofhandler.getIthLocalNodeJthDofID(I,dofids[i]);
         RHS.addValue(iInd,localR(i+1)*jxw);
     }
 }
@@ -34,9 +34,9 @@ void BCSystem::assembleLocalJacobian2Global(const int &dofs,const vector<int> &d
                                             SparseMatrix &AMATRIX){
     int iInd,jInd;
     for(int i=0;i<dofs;i++){
-        iInd=dofhandler.getIthNodeJthDofID(I,dofids[i]);
+        iInd=dofhandler.getIthLocalNodeJthDofID(I,dofids[i]);
         for(int j=0;j<dofs;j++){
-            jInd=dofhandler.getIthNodeJthDofID(J,dofids[j]);
+            jInd=dofhandler.getIthLocalNodeJthDofID(J,dofids[j]);
             AMATRIX.addValue(iInd,jInd,localK(i+1,j+1)*jxw);
         }
     }
@@ -38,8 +38,13 @@ void BulkDofHandler::releaseMemory(){
     m_maxdofs_perelmt=0;
     m_total_dofs=0;
     m_active_dofs=0;
-    m_elmt_dofids.clear();
-    m_nodal_dofids.clear();
+    m_elmt_dofids.releaseMemory();
+    vector<int>().swap(m_nodal_dofids);
+    m_elmt_offset=0;
+    m_owned_dofs_start=0;
+    m_owned_dofs_end=0;
+    m_isdistributed=false;
+    vector<int>().swap(m_node_local2global);
 }
 BulkDofHandler::~BulkDofHandler(){
     m_dof_namelist.clear();
@@ -93,8 +98,8 @@ void BulkDofHandler::printBulkElementalDofsInfo(const bool &flag)const{
                <<", active dofs="<<m_active_dofs
                <<", max dofs per node="<<m_maxdofs_pernode
                <<", max dofs per elmt="<<m_maxdofs_perelmt<<endl;
-            for(int e=1;e<=m_bulkelmts;e++){
-                str="*** "+to_string(e)+"-th element: ";
+            for(int e=1;e<=m_elmt_dofids.size();e++){
+                str="*** "+to_string(e+m_elmt_offset)+"-th element: ";
                 for(const auto &dofid:m_elmt_dofids[e-1]) str+=to_string(dofid)+" ";
                 out<<str<<endl;
             }
@@ -109,8 +114,8 @@ void BulkDofHandler::printBulkElementalDofsInfo(const bool &flag)const{
             <<", max dofs per node="<<m_maxdofs_pernode
             <<", max dofs per elmt="<<m_maxdofs_perelmt<<endl;
         string str;
-        for(int e=1;e<=m_bulkelmts;e++){
-            str="*** "+to_string(e)+"-th element: ";
+        for(int e=1;e<=m_elmt_dofids.size();e++){
+            str="*** "+to_string(e+m_elmt_offset)+"-th element: ";
             for(const auto &dofid:m_elmt_dofids[e-1]) str+=to_string(dofid)+" ";
             cout<<str<<endl;
         }
@@ -25,6 +25,13 @@ void BulkDofHandler::init(){
     m_active_dofs=0;
     m_elmt_dofids.clear();
     m_nodal_dofids.clear();
+    m_renumber_type=DofRenumberType::NONE;
+    m_isfieldblocked=false;
+    m_elmt_offset=0;
+    m_owned_dofs_start=0;
+    m_owned_dofs_end=0;
+    m_isdistributed=false;
+    m_node_local2global.clear();
 }
 
 void BulkDofHandler::addDofName2List(const string &dofname){
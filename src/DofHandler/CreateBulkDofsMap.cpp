@@ -21,27 +21,51 @@ void BulkDofHandler::createBulkDofsMap(const Mesh &t_mesh,const ElmtSystem &t_el
                                            // one defined in the input file
     m_maxdofs_perelmt=m_maxdofs_pernode*t_mesh.getBulkMeshNodesNumPerBulkElmt();
 
+    if(t_mesh.isDistributedMesh()){
+        // each processor only marks the dofs of its own elements (the bulk groups are already filtered),
+        // then the owners of the nodes number them, no global loop is done
+        vector<char> localflags(static_cast<size_t>(t_mesh.getBulkMeshLocalNodesNum())*m_maxdofs_pernode,0);
+        int elmtid,nElmts,phyhandle;
+        for(const auto &block:t_elmtSystem.getBulkElmtBlockList()){
+            for(const auto &name:block.m_domain_namelist){
+                nElmts=t_mesh.getBulkMeshBulkElmtsNumViaPhyName(name);
+                phyhandle=t_mesh.getBulkMeshPhyGroupHandle(name);
+                for(int e=1;e<=nElmts;e++){
+                    elmtid=t_mesh.getBulkMeshIthBulkElmtIDViaHandle(phyhandle,e);
+                    for(const auto &node:t_mesh.getBulkMeshIthBulkElmtConn(elmtid)){
+                        const size_t localid=t_mesh.getBulkMeshNodeLocalID(node)-1;
+                        for(const auto &dofid:block.m_dof_ids) localflags[localid*m_maxdofs_pernode+dofid-1]=1;
+                    }
+                }
+            }
+        }
+        createDistributedBulkDofsMap(t_mesh,localflags);
+        return;
+    }
+
     // allocate memory for nodal and elemental dofs map
-    m_nodal_dofids.resize(m_nodes,vector<int>(m_maxdofs_pernode,0));
-    m_elmt_dofids.resize(m_bulkelmts,vector<int>(m_maxdofs_perelmt,0));
+    m_nodal_dofids.assign(static_cast<size_t>(m_nodes)*m_maxdofs_pernode,0);
+    m_elmt_dofids.clear();
 
 
     m_active_dofs=0;
-    int dofid,elmtid,nodeid;
+    int dofid,elmtid,nodeid,nElmts,phyhandle;
     for(const auto &block:t_elmtSystem.getBulkElmtBlockList()){
         for(const auto &name:block.m_domain_namelist){
-            for(int e=1;e<=t_mesh.getBulkMeshBulkElmtsNumViaPhyName(name);e++){
-                elmtid=t_mesh.getBulkMeshIthBulkElmtIDViaPhyName(name,e);//global element id
+            nElmts=t_mesh.getBulkMeshBulkElmtsNumViaPhyName(name);
+            phyhandle=t_mesh.getBulkMeshPhyGroupHandle(name);
+            for(int e=1;e<=nElmts;e++){
+                elmtid=t_mesh.getBulkMeshIthBulkElmtIDViaHandle(phyhandle,e);//global element id
                 for(int i=1;i<=t_mesh.getBulkMeshIthBulkElmtNodesNum(elmtid);i++){
                     nodeid=t_mesh.getBulkMeshIthBulkElmtJthNodeID(elmtid,i);
                     for(int k=0;k<static_cast<int>(block.m_dof_ids.size());k++){
                         dofid=block.m_dof_ids[k];
-                        if(m_nodal_dofids[nodeid-1][dofid-1]==0){
+                        if(m_nodal_dofids[(nodeid-1)*m_maxdofs_pernode+dofid-1]==0){
                             // if current nodal dof flag is zero, then we assign a non-zero value to it
                             // otherwise, it is duplicated, then skip it.
                             // Be careful about the ordering, the node id is not 1 to 1 mapping to the dof id !!!
                             m_active_dofs+=1;
-                            m_nodal_dofids[nodeid-1][dofid-1]=m_active_dofs;
+                            m_nodal_dofids[(nodeid-1)*m_maxdofs_pernode+dofid-1]=m_active_dofs;
                         }
                     }
                 }
@@ -54,7 +78,7 @@ void BulkDofHandler::createBulkDofsMap(const Mesh &t_mesh,const ElmtSystem &t_el
     for(int i=0;i<m_nodes;i++){
         HasDofID=false;
         for(int j=0;j<m_maxdofs_pernode;j++){
-            if(m_nodal_dofids[i][j]){
+            if(m_nodal_dofids[i*m_maxdofs_pernode+j]){
                 HasDofID=true;break;
             }
         }
@@ -64,28 +88,36 @@ void BulkDofHandler::createBulkDofsMap(const Mesh &t_mesh,const ElmtSystem &t_el
         }
     }
 
+    if(m_renumber_type!=DofRenumberType::NONE||m_isfieldblocked){
+        renumberBulkDofs(t_mesh);
+    }
+
+    m_owned_dofs_start=0;
+    m_owned_dofs_end=m_active_dofs;
+
     // now we can create the elemental dofs map
     vector<int> row_maxnnz;/*< for the maximum nonzeros of each row */
     m_maxnnz=0;
     row_maxnnz.resize(m_active_dofs,0);
+    vector<int> elmtdofs;
+    elmtdofs.reserve(m_maxdofs_perelmt);
+    m_elmt_offset=0;
+    m_elmt_dofids.reserve(m_bulkelmts,m_bulkelmts*m_maxdofs_perelmt);
     for(int e=1;e<=m_bulkelmts;e++){
+        elmtdofs.clear();
         for(int j=1;j<=t_mesh.getBulkMeshIthBulkElmtNodesNum(e);j++){
             nodeid=t_mesh.getBulkMeshIthBulkElmtJthNodeID(e,j);
             for(int k=1;k<=m_maxdofs_pernode;k++){
-                dofid=m_nodal_dofids[nodeid-1][k-1];
-                m_elmt_dofids[e-1][(j-1)*m_maxdofs_pernode+k-1]=dofid;
+                dofid=m_nodal_dofids[(nodeid-1)*m_maxdofs_pernode+k-1];
                 if(dofid!=0){
+                    // only the nonzero part is kept
+                    elmtdofs.push_back(dofid);
                     row_maxnnz[dofid-1]+=m_maxdofs_perelmt;
                     if(row_maxnnz[dofid-1]>m_maxnnz) m_maxnnz=row_maxnnz[dofid-1];
                 }
             }
         }
-        // remove the zero elements, only keep the nonzero part
-        m_elmt_dofids[e-1].erase(
-            remove(m_elmt_dofids[e-1].begin(),m_elmt_dofids[e-1].end(),0),
-            m_elmt_dofids[e-1].end()
-        );
-        m_elmt_dofids[e-1].shrink_to_fit();
+        m_elmt_dofids.push_back(elmtdofs);
     }
     row_maxnnz.clear();
 
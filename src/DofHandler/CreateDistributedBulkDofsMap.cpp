@@ -0,0 +1,331 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: generate the dofs map for the distributed mesh, the
+//+++          node is owned by the processor which owns its first
+//+++          (min id) bulk element, which is the same rule as the
+//+++          nodal sets of the distributed mesh. Each processor
+//+++          only works on its owned and halo elements:
+//+++            1) the active dofs flags are sent to the owners
+//+++            2) the owners number their dofs, the offset comes
+//+++               from MPI_Exscan
+//+++            3) the owners send the numbers to the processors
+//+++               which own an element around the node
+//+++            4) the numbers of the halo elements' nodes are sent
+//+++               by the owners of the halo elements
+//+++          All the messages only go to the neighbors, i.e. the
+//+++          owners of the halo elements
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <climits>
+
+#include "DofHandler/BulkDofHandler.h"
+
+/**
+ * exchange the integer buffers with the neighbors, the neighborhood must be symmetric, i.e. each neighbor sends
+ * a buffer (may be empty) back
+ * @param neighbors the neighbor ranks
+ * @param sendbufs the buffer sent to each neighbor
+ * @param recvbufs the buffer received from each neighbor
+ */
+static void exchangeWithNeighbors(const vector<int> &neighbors,const vector<vector<int>> &sendbufs,vector<vector<int>> &recvbufs){
+    const int n=static_cast<int>(neighbors.size());
+    vector<int> sendsizes(n),recvsizes(n);
+    vector<MPI_Request> requests(2*n);
+    for(int i=0;i<n;i++){
+        sendsizes[i]=static_cast<int>(sendbufs[i].size());
+        MPI_Irecv(&recvsizes[i],1,MPI_INT,neighbors[i],0,PETSC_COMM_WORLD,&requests[i]);
+        MPI_Isend(&sendsizes[i],1,MPI_INT,neighbors[i],0,PETSC_COMM_WORLD,&requests[n+i]);
+    }
+    MPI_Waitall(2*n,requests.data(),MPI_STATUSES_IGNORE);
+    recvbufs.assign(n,vector<int>());
+    for(int i=0;i<n;i++){
+        recvbufs[i].resize(recvsizes[i]);
+        MPI_Irecv(recvbufs[i].data(),recvsizes[i],MPI_INT,neighbors[i],1,PETSC_COMM_WORLD,&requests[i]);
+        MPI_Isend(sendbufs[i].data(),sendsizes[i],MPI_INT,neighbors[i],1,PETSC_COMM_WORLD,&requests[n+i]);
+    }
+    MPI_Waitall(2*n,requests.data(),MPI_STATUSES_IGNORE);
+}
+
+void BulkDofHandler::createDistributedBulkDofsMap(const Mesh &t_mesh,vector<char> &t_localflags){
+    PetscMPIInt rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+
+    const int nDofs=m_maxdofs_pernode;
+    const int nLocalNodes=t_mesh.getBulkMeshLocalNodesNum();
+    // the same partition as the element loops
+    auto getElmtOwnerRank=[&](const int &e)->int{
+        return BulkMesh::getBulkElmtOwnerRank(e-1,m_bulkelmts,size);
+    };
+    int e,i,j,k;
+
+    //*****************************************************
+    //*** the stored elements with the local node ids
+    //*****************************************************
+    int eStart,eEnd;
+    t_mesh.getBulkMeshOwnedBulkElmtsRange(eStart,eEnd);
+    const int nOwnedElmts=eEnd-eStart;
+    vector<int> elmtids;// the global ids, the owned elements come first, then the halo ones
+    elmtids.reserve(nOwnedElmts+t_mesh.getBulkMeshHaloBulkElmtsNum());
+    for(e=eStart+1;e<=eEnd;e++) elmtids.push_back(e);
+    for(i=1;i<=t_mesh.getBulkMeshHaloBulkElmtsNum();i++) elmtids.push_back(t_mesh.getBulkMeshIthHaloBulkElmtGlobalID(i));
+    const int nElmts=static_cast<int>(elmtids.size());
+
+    ElmtConnectivity localconn;// the local node ids start from 0
+    vector<int> conn;
+    localconn.reserve(nElmts,nElmts*t_mesh.getBulkMeshNodesNumPerBulkElmt());
+    for(const auto &id:elmtids){
+        conn.clear();
+        for(const auto &node:t_mesh.getBulkMeshIthBulkElmtConn(id)) conn.push_back(t_mesh.getBulkMeshNodeLocalID(node)-1);
+        localconn.push_back(conn);
+    }
+
+    //*****************************************************
+    //*** the owner of each local node
+    //*****************************************************
+    // for the node of an owned element, all the elements around it are stored, so its first element is exact.
+    // for the node which only belongs to the halo elements, the result is not current rank, which is enough here
+    vector<int> nodeowner(nLocalNodes,INT_MAX);
+    for(k=0;k<nElmts;k++){
+        for(const auto &l:localconn[k]) nodeowner[l]=std::min(nodeowner[l],elmtids[k]);
+    }
+    for(i=0;i<nLocalNodes;i++){
+        if(nodeowner[i]==INT_MAX){
+            MessagePrinter::printErrorTxt("Node-"+to_string(t_mesh.getBulkMeshIthLocalNodeGlobalID(i+1))+" hasen\'t been assigned by the dof, please check your code");
+            MessagePrinter::exitAsFem();
+        }
+        nodeowner[i]=getElmtOwnerRank(nodeowner[i]);
+    }
+
+    // the neighbors are the owners of the halo elements, this relation is symmetric
+    vector<int> neighbors,rank2neighbor(size,-1);
+    for(k=nOwnedElmts;k<nElmts;k++){
+        const int owner=getElmtOwnerRank(elmtids[k]);
+        if(owner!=rank&&rank2neighbor[owner]<0){
+            rank2neighbor[owner]=0;
+            neighbors.push_back(owner);
+        }
+    }
+    std::sort(neighbors.begin(),neighbors.end());
+    for(i=0;i<static_cast<int>(neighbors.size());i++) rank2neighbor[neighbors[i]]=i;
+    const int nNeighbors=static_cast<int>(neighbors.size());
+    vector<vector<int>> sendbufs(nNeighbors),recvbufs;
+
+    //*****************************************************
+    //*** 1) send the active dofs flags to the owners
+    //*****************************************************
+    bool HasDofID;
+    for(i=0;i<nLocalNodes;i++){
+        if(nodeowner[i]==rank) continue;
+        HasDofID=false;
+        for(j=0;j<nDofs;j++){
+            if(t_localflags[i*nDofs+j]){
+                HasDofID=true;break;
+            }
+        }
+        if(!HasDofID) continue;
+        vector<int> &buff=sendbufs[rank2neighbor[nodeowner[i]]];
+        buff.push_back(t_mesh.getBulkMeshIthLocalNodeGlobalID(i+1));
+        for(j=0;j<nDofs;j++) buff.push_back(t_localflags[i*nDofs+j]);
+    }
+    exchangeWithNeighbors(neighbors,sendbufs,recvbufs);
+    for(const auto &buff:recvbufs){
+        for(size_t n=0;n<buff.size();n+=1+nDofs){
+            const int l=t_mesh.getBulkMeshNodeLocalID(buff[n])-1;
+            for(j=0;j<nDofs;j++){
+                if(buff[n+1+j]) t_localflags[l*nDofs+j]=1;
+            }
+        }
+    }
+
+    //*****************************************************
+    //*** 2) number the owned dofs
+    //*****************************************************
+    if(m_renumber_type!=DofRenumberType::NONE){
+        MessagePrinter::printWarningTxt("the dofs of the distributed mesh are numbered by their owners, the 'renumber' option is ignored");
+    }
+    vector<int> localdofids(static_cast<size_t>(nLocalNodes)*nDofs,0);
+    int nOwnedDofs=0;
+    for(i=0;i<nLocalNodes;i++){
+        if(nodeowner[i]!=rank) continue;
+        HasDofID=false;
+        for(j=0;j<nDofs;j++){
+            if(t_localflags[i*nDofs+j]){
+                HasDofID=true;break;
+            }
+        }
+        if(!HasDofID){
+            MessagePrinter::printErrorTxt("Node-"+to_string(t_mesh.getBulkMeshIthLocalNodeGlobalID(i+1))+" hasen\'t been assigned by the dof, please check your code");
+            MessagePrinter::exitAsFem();
+        }
+    }
+    if(m_isfieldblocked){
+        for(j=0;j<nDofs;j++){
+            for(i=0;i<nLocalNodes;i++){
+                if(nodeowner[i]==rank&&t_localflags[i*nDofs+j]) localdofids[i*nDofs+j]=++nOwnedDofs;
+            }
+        }
+    }
+    else{
+        for(i=0;i<nLocalNodes;i++){
+            if(nodeowner[i]!=rank) continue;
+            for(j=0;j<nDofs;j++){
+                if(t_localflags[i*nDofs+j]) localdofids[i*nDofs+j]=++nOwnedDofs;
+            }
+        }
+    }
+    int offset=0;
+    MPI_Exscan(&nOwnedDofs,&offset,1,MPI_INT,MPI_SUM,PETSC_COMM_WORLD);
+    if(rank==0) offset=0;// the result of MPI_Exscan is undefined on the first rank
+    for(i=0;i<nLocalNodes;i++){
+        if(nodeowner[i]!=rank) continue;
+        for(j=0;j<nDofs;j++){
+            if(localdofids[i*nDofs+j]) localdofids[i*nDofs+j]+=offset;
+        }
+    }
+    MPI_Allreduce(&nOwnedDofs,&m_active_dofs,1,MPI_INT,MPI_SUM,PETSC_COMM_WORLD);
+    m_owned_dofs_start=offset;
+    m_owned_dofs_end=offset+nOwnedDofs;
+
+    // pack the dof ids of the given local nodes
+    auto packNodalDofIDs=[&](const vector<int> &nodes,vector<int> &buff){
+        buff.clear();
+        buff.reserve(nodes.size()*(1+nDofs));
+        for(const auto &l:nodes){
+            buff.push_back(t_mesh.getBulkMeshIthLocalNodeGlobalID(l+1));
+            for(j=0;j<nDofs;j++) buff.push_back(localdofids[l*nDofs+j]);
+        }
+    };
+    auto unpackNodalDofIDs=[&](const vector<vector<int>> &buffs){
+        for(const auto &buff:buffs){
+            for(size_t n=0;n<buff.size();n+=1+nDofs){
+                const int l=t_mesh.getBulkMeshNodeLocalID(buff[n])-1;
+                for(j=0;j<nDofs;j++) localdofids[l*nDofs+j]=buff[n+1+j];
+            }
+        }
+    };
+
+    //*****************************************************
+    //*** 3) the owners send the numbers to the processors
+    //***    which own an element around the node
+    //*****************************************************
+    vector<vector<int>> sendnodes(nNeighbors);
+    for(k=nOwnedElmts;k<nElmts;k++){
+        const int nb=rank2neighbor[getElmtOwnerRank(elmtids[k])];
+        for(const auto &l:localconn[k]){
+            if(nodeowner[l]==rank) sendnodes[nb].push_back(l);
+        }
+    }
+    for(i=0;i<nNeighbors;i++){
+        std::sort(sendnodes[i].begin(),sendnodes[i].end());
+        sendnodes[i].erase(std::unique(sendnodes[i].begin(),sendnodes[i].end()),sendnodes[i].end());
+        packNodalDofIDs(sendnodes[i],sendbufs[i]);
+    }
+    exchangeWithNeighbors(neighbors,sendbufs,recvbufs);
+    unpackNodalDofIDs(recvbufs);
+
+    //*****************************************************
+    //*** 4) send the numbers of the owned elements' nodes
+    //***    to the neighbors which store them as the halo
+    //*****************************************************
+    // the owned element is a halo one of the neighbor if it shares a node with the neighbor's element
+    vector<int> nodeelmt_ptr(nLocalNodes+1,0),nodeelmt_ids;
+    for(k=0;k<nOwnedElmts;k++){
+        for(const auto &l:localconn[k]) nodeelmt_ptr[l+1]+=1;
+    }
+    for(i=0;i<nLocalNodes;i++) nodeelmt_ptr[i+1]+=nodeelmt_ptr[i];
+    nodeelmt_ids.resize(nodeelmt_ptr[nLocalNodes]);
+    vector<int> pos(nodeelmt_ptr.begin(),nodeelmt_ptr.end()-1);
+    for(k=0;k<nOwnedElmts;k++){
+        for(const auto &l:localconn[k]) nodeelmt_ids[pos[l]++]=k;
+    }
+    vector<int>().swap(pos);
+    for(i=0;i<nNeighbors;i++) sendnodes[i].clear();
+    for(k=nOwnedElmts;k<nElmts;k++){
+        const int nb=rank2neighbor[getElmtOwnerRank(elmtids[k])];
+        for(const auto &l:localconn[k]){
+            for(int n=nodeelmt_ptr[l];n<nodeelmt_ptr[l+1];n++){
+                for(const auto &node:localconn[nodeelmt_ids[n]]) sendnodes[nb].push_back(node);
+            }
+        }
+    }
+    for(i=0;i<nNeighbors;i++){
+        std::sort(sendnodes[i].begin(),sendnodes[i].end());
+        sendnodes[i].erase(std::unique(sendnodes[i].begin(),sendnodes[i].end()),sendnodes[i].end());
+        packNodalDofIDs(sendnodes[i],sendbufs[i]);
+    }
+    exchangeWithNeighbors(neighbors,sendbufs,recvbufs);
+    unpackNodalDofIDs(recvbufs);
+    vector<int>().swap(nodeelmt_ptr);
+    vector<int>().swap(nodeelmt_ids);
+
+    //*****************************************************
+    //*** the nodal and elemental dofs map
+    //*****************************************************
+    // the nodal map only has the local nodes, the global id is translated by m_node_local2global
+    m_node_local2global.resize(nLocalNodes);
+    for(i=0;i<nLocalNodes;i++){
+        m_node_local2global[i]=t_mesh.getBulkMeshIthLocalNodeGlobalID(i+1);
+        HasDofID=false;
+        for(j=0;j<nDofs;j++){
+            if(localdofids[i*nDofs+j]) HasDofID=true;
+        }
+        if(!HasDofID){
+            MessagePrinter::printErrorTxt("can\'t get the dofs of node-"+to_string(m_node_local2global[i])+" from its owner, please check your distributed mesh");
+            MessagePrinter::exitAsFem();
+        }
+    }
+    m_isdistributed=true;
+
+    // only the owned elements have the elemental dofs, the halo ones are used to count the nonzeros of the owned rows
+    vector<int> row_maxnnz(nOwnedDofs,0),elmtdofs;
+    int maxnnz=0,dofid;
+    elmtdofs.reserve(m_maxdofs_perelmt);
+    m_elmt_offset=eStart;
+    m_elmt_dofids.clear();
+    m_elmt_dofids.reserve(nOwnedElmts,nOwnedElmts*m_maxdofs_perelmt);
+    for(k=0;k<nElmts;k++){
+        elmtdofs.clear();
+        for(const auto &l:localconn[k]){
+            for(j=0;j<nDofs;j++){
+                dofid=localdofids[l*nDofs+j];
+                if(dofid==0) continue;
+                elmtdofs.push_back(dofid);
+                if(dofid>m_owned_dofs_start&&dofid<=m_owned_dofs_end){
+                    row_maxnnz[dofid-m_owned_dofs_start-1]+=m_maxdofs_perelmt;
+                    if(row_maxnnz[dofid-m_owned_dofs_start-1]>maxnnz) maxnnz=row_maxnnz[dofid-m_owned_dofs_start-1];
+                }
+            }
+        }
+        if(k<nOwnedElmts) m_elmt_dofids.push_back(elmtdofs);
+    }
+    MPI_Allreduce(&maxnnz,&m_maxnnz,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    m_nodal_dofids.swap(localdofids);
+
+    //*****************************************************
+    //*** print out the summary
+    //*****************************************************
+    int ghostnodes=0,maxowned,maxghost,maxneighbors;
+    for(i=0;i<nLocalNodes;i++){
+        if(nodeowner[i]!=rank) ghostnodes+=1;
+    }
+    MPI_Allreduce(&nOwnedDofs,&maxowned,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    MPI_Allreduce(&ghostnodes,&maxghost,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    MPI_Allreduce(&nNeighbors,&maxneighbors,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    char buff[70];
+    snprintf(buff,70,"  dofs are numbered by their owners on %6d processors",static_cast<int>(size));
+    MessagePrinter::printNormalTxt(string(buff));
+    snprintf(buff,70,"  max owned dofs=%10d, max ghost nodes=%10d",maxowned,maxghost);
+    MessagePrinter::printNormalTxt(string(buff));
+    snprintf(buff,70,"  max neighbors=%6d",maxneighbors);
+    MessagePrinter::printNormalTxt(string(buff));
+}
@@ -0,0 +1,212 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: renumber the active dofs for a smaller bandwidth, the
+//+++          nodes are ordered by the reverse Cuthill-McKee method
+//+++          on the node adjacency graph of the bulk elements, then
+//+++          the dofs are numbered node by node (interleaved) or
+//+++          field by field (blocked)
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "DofHandler/BulkDofHandler.h"
+
+/**
+ * get the bandwidth and the profile (the sum of the distance between the diagonal and the 1st nonzero of each row)
+ * of the matrix, the dofs of one element are fully coupled, so only the min and max dof id of each element are needed
+ * @param t_mesh the mesh class
+ * @param t_nodaldofids the nodal dofs map
+ * @param t_maxdofspernode the stride of the nodal dofs map
+ * @param t_activedofs the number of active dofs
+ * @param bandwidth the max distance between the diagonal and the nonzeros
+ * @param profile the profile of the lower part, n+2*profile is the nnz(L+U) of the envelope (skyline) LU, it is an upper
+ *                bound of the fill, the actual fill of a sparse LU with its own ordering (e.g. nd) is not computed here
+ */
+static void getDofsMatrixBandwidth(const Mesh &t_mesh,const vector<int> &t_nodaldofids,const int &t_maxdofspernode,
+                                   const int &t_activedofs,int &bandwidth,long long &profile){
+    vector<int> rowmin(t_activedofs);
+    for(int i=0;i<t_activedofs;i++) rowmin[i]=i+1;
+    bandwidth=0;
+    for(int e=1;e<=t_mesh.getBulkMeshBulkElmtsNum();e++){
+        ElmtConnArray elconn=t_mesh.getBulkMeshIthBulkElmtConn(e);
+        int dmin=t_activedofs+1,dmax=0;
+        for(const auto &node:elconn){
+            for(int j=0;j<t_maxdofspernode;j++){
+                const int dofid=t_nodaldofids[(node-1)*t_maxdofspernode+j];
+                if(dofid<1) continue;
+                dmin=std::min(dmin,dofid);dmax=std::max(dmax,dofid);
+            }
+        }
+        if(dmax<1) continue;
+        bandwidth=std::max(bandwidth,dmax-dmin);
+        for(const auto &node:elconn){
+            for(int j=0;j<t_maxdofspernode;j++){
+                const int dofid=t_nodaldofids[(node-1)*t_maxdofspernode+j];
+                if(dofid>0&&dmin<rowmin[dofid-1]) rowmin[dofid-1]=dmin;
+            }
+        }
+    }
+    profile=0;
+    for(int i=0;i<t_activedofs;i++) profile+=i+1-rowmin[i];
+}
+
+void BulkDofHandler::renumberBulkDofs(const Mesh &t_mesh){
+    int e,i,j,k;
+    int bandwidthold,bandwidthnew;
+    long long profileold,profilenew;
+    getDofsMatrixBandwidth(t_mesh,m_nodal_dofids,m_maxdofs_pernode,m_active_dofs,bandwidthold,profileold);
+
+    //*****************************************************
+    //*** the node ordering
+    //*****************************************************
+    vector<int> nodeorder(m_nodes);// the new position to the old node index (start from 0)
+    if(m_renumber_type==DofRenumberType::RCM){
+        // the node to element map and the node adjacency graph, both in CSR format
+        vector<int> nodeelmt_ptr(m_nodes+1,0),nodeelmt_ids;
+        for(e=1;e<=m_bulkelmts;e++){
+            for(const auto &node:t_mesh.getBulkMeshIthBulkElmtConn(e)) nodeelmt_ptr[node]+=1;
+        }
+        for(i=0;i<m_nodes;i++) nodeelmt_ptr[i+1]+=nodeelmt_ptr[i];
+        nodeelmt_ids.resize(nodeelmt_ptr[m_nodes]);
+        vector<int> pos(nodeelmt_ptr.begin(),nodeelmt_ptr.end()-1);
+        for(e=1;e<=m_bulkelmts;e++){
+            for(const auto &node:t_mesh.getBulkMeshIthBulkElmtConn(e)) nodeelmt_ids[pos[node-1]++]=e;
+        }
+        vector<int> adj_ptr(m_nodes+1,0),adj_ids,marker(m_nodes,-1);
+        for(i=0;i<m_nodes;i++){
+            marker[i]=i;
+            for(k=nodeelmt_ptr[i];k<nodeelmt_ptr[i+1];k++){
+                for(const auto &node:t_mesh.getBulkMeshIthBulkElmtConn(nodeelmt_ids[k])){
+                    if(marker[node-1]!=i){
+                        marker[node-1]=i;
+                        adj_ids.push_back(node-1);
+                    }
+                }
+            }
+            adj_ptr[i+1]=static_cast<int>(adj_ids.size());
+        }
+        vector<int>().swap(nodeelmt_ptr);
+        vector<int>().swap(nodeelmt_ids);
+        vector<int>().swap(pos);
+        auto degree=[&](const int &node)->int{return adj_ptr[node+1]-adj_ptr[node];};
+
+        // the level structure from the root, the last level is returned, and the number of levels as well
+        vector<int> level(m_nodes,-1),queue;
+        queue.reserve(m_nodes);
+        auto bfs=[&](const int &root,vector<int> &lastlevel)->int{
+            queue.clear();queue.push_back(root);
+            level[root]=0;
+            int maxlevel=0;
+            for(size_t q=0;q<queue.size();q++){
+                const int node=queue[q];
+                maxlevel=level[node];
+                for(int n=adj_ptr[node];n<adj_ptr[node+1];n++){
+                    if(level[adj_ids[n]]<0){
+                        level[adj_ids[n]]=level[node]+1;
+                        queue.push_back(adj_ids[n]);
+                    }
+                }
+            }
+            lastlevel.clear();
+            for(const auto &node:queue){
+                if(level[node]==maxlevel) lastlevel.push_back(node);
+            }
+            for(const auto &node:queue) level[node]=-1;
+            return maxlevel;
+        };
+
+        vector<char> IsNumbered(m_nodes,0);
+        vector<int> lastlevel,neighbors;
+        int count=0;
+        for(int seed=0;seed<m_nodes;seed++){
+            if(IsNumbered[seed]) continue;
+            // the pseudo-peripheral node of current component (George-Liu), start from the min degree node
+            int root=seed;
+            bfs(root,lastlevel);
+            for(const auto &node:queue){
+                if(degree(node)<degree(root)) root=node;
+            }
+            int ecc=bfs(root,lastlevel);
+            while(true){
+                int next=lastlevel[0];
+                for(const auto &node:lastlevel){
+                    if(degree(node)<degree(next)) next=node;
+                }
+                vector<int> nextlevel;
+                const int nextecc=bfs(next,nextlevel);
+                if(nextecc<=ecc) break;
+                root=next;ecc=nextecc;lastlevel.swap(nextlevel);
+            }
+            // Cuthill-McKee from the root, the neighbors are visited by the increasing degree
+            const int first=count;
+            nodeorder[count++]=root;IsNumbered[root]=1;
+            for(int q=first;q<count;q++){
+                const int node=nodeorder[q];
+                neighbors.clear();
+                for(int n=adj_ptr[node];n<adj_ptr[node+1];n++){
+                    if(!IsNumbered[adj_ids[n]]) neighbors.push_back(adj_ids[n]);
+                }
+                std::sort(neighbors.begin(),neighbors.end(),[&](const int &a,const int &b){
+                    return degree(a)<degree(b)||(degree(a)==degree(b)&&a<b);
+                });
+                for(const auto &nb:neighbors){
+                    IsNumbered[nb]=1;
+                    nodeorder[count++]=nb;
+                }
+            }
+        }
+        std::reverse(nodeorder.begin(),nodeorder.end());
+    }
+    else{
+        // keep the element traversal order of the original numbering, i.e. the order of the 1st dof of each node
+        vector<int> firstdof(m_nodes,0);
+        for(i=0;i<m_nodes;i++){
+            firstdof[i]=m_active_dofs+1;
+            for(j=0;j<m_maxdofs_pernode;j++){
+                if(m_nodal_dofids[i*m_maxdofs_pernode+j]>0) firstdof[i]=std::min(firstdof[i],m_nodal_dofids[i*m_maxdofs_pernode+j]);
+            }
+            nodeorder[i]=i;
+        }
+        std::sort(nodeorder.begin(),nodeorder.end(),[&](const int &a,const int &b){return firstdof[a]<firstdof[b];});
+    }
+
+    //*****************************************************
+    //*** renumber the active dofs
+    //*****************************************************
+    int dofid=0;
+    if(m_isfieldblocked){
+        for(j=0;j<m_maxdofs_pernode;j++){
+            for(const auto &node:nodeorder){
+                if(m_nodal_dofids[node*m_maxdofs_pernode+j]>0) m_nodal_dofids[node*m_maxdofs_pernode+j]=++dofid;
+            }
+        }
+    }
+    else{
+        for(const auto &node:nodeorder){
+            for(j=0;j<m_maxdofs_pernode;j++){
+                if(m_nodal_dofids[node*m_maxdofs_pernode+j]>0) m_nodal_dofids[node*m_maxdofs_pernode+j]=++dofid;
+            }
+        }
+    }
+
+    //*****************************************************
+    //*** print out the summary
+    //*****************************************************
+    getDofsMatrixBandwidth(t_mesh,m_nodal_dofids,m_maxdofs_pernode,m_active_dofs,bandwidthnew,profilenew);
+    char buff[70];
+    snprintf(buff,70,"  dofs are renumbered by %s nodes, %s ordering",
+             m_renumber_type==DofRenumberType::RCM?"RCM":"natural",m_isfieldblocked?"field-blocked":"interleaved");
+    MessagePrinter::printNormalTxt(string(buff));
+    snprintf(buff,70,"  bandwidth              : %14d -> %14d",bandwidthold,bandwidthnew);
+    MessagePrinter::printNormalTxt(string(buff));
+    // the envelope bound of the LU fill, not the fill of PETSc's factorization
+    snprintf(buff,70,"  envelope nnz(L+U) bound: %14lld -> %14lld",m_active_dofs+2*profileold,m_active_dofs+2*profilenew);
+    MessagePrinter::printNormalTxt(string(buff));
+}
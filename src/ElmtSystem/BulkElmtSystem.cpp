@@ -18,6 +18,7 @@ BulkElmtSystem::BulkElmtSystem(){
     m_elmtblock_num=0;
     m_elmtblock_list.clear();
     m_bulk_elmts=0;
+    m_elmt_offset=0;
     m_elemental_elmtblock_id.clear();
 }
 
@@ -60,4 +61,5 @@ void BulkElmtSystem::releaseMemory(){
     
     m_elemental_elmtblock_id.clear();
     m_bulk_elmts=0;
+    m_elmt_offset=0;
 }
\ No newline at end of file
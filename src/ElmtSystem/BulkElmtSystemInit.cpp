@@ -15,15 +15,25 @@
 #include "ElmtSystem/BulkElmtSystem.h"
 
 void BulkElmtSystem::init(const Mesh &t_mesh){
-    m_bulk_elmts=t_mesh.getBulkMeshBulkElmtsNum();
+    // only the elements assembled by the current rank are stored, the partition is the same one used
+    // by the FE system's element loop
+    int rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    int eEnd;
+    BulkMesh::getBulkElmtsRange(t_mesh.getBulkMeshBulkElmtsNum(),rank,size,m_elmt_offset,eEnd);
+    m_bulk_elmts=eEnd-m_elmt_offset;
     m_elemental_elmtblock_id.clear();
     m_elemental_elmtblock_id.resize(m_bulk_elmts);
-    int ee;
+    int ee,nElmts,phyhandle;
     for(int i=1;i<=m_elmtblock_num;i++){
         for(const auto &name:m_elmtblock_list[i-1].m_domain_namelist){
-            for(int e=1;e<=t_mesh.getBulkMeshElmtsNumViaPhyName(name);e++){
-                ee=t_mesh.getBulkMeshIthBulkElmtIDViaPhyName(name,e);// global element id
-                m_elemental_elmtblock_id[ee-1].push_back(i);// here each bulk element could be assigned by
+            nElmts=t_mesh.getBulkMeshElmtsNumViaPhyName(name);
+            phyhandle=t_mesh.getBulkMeshPhyGroupHandle(name);
+            for(int e=1;e<=nElmts;e++){
+                ee=t_mesh.getBulkMeshIthBulkElmtIDViaHandle(phyhandle,e);// global element id
+                if(ee<=m_elmt_offset||ee>m_elmt_offset+m_bulk_elmts) continue;
+                m_elemental_elmtblock_id[ee-1-m_elmt_offset].push_back(i);// here each bulk element could be assigned by
                                                             // multiple 'elmts' block from the input file
             }
         }
@@ -51,6 +51,13 @@ void MechanicsElement::computeResidual(const LocalElmtInfo &elmtinfo,
         }
     }
 
+    // the inertia term, only if the density is given
+    if(mate.hasScalarMaterial("rho")){
+        for(int i=1;i<=elmtinfo.m_dim;i++){
+            localR(i)+=mate.ScalarMaterial("rho")*soln.m_gpA[i]*shp.m_test;
+        }
+    }
+
 }
 //*****************************************************************************
 void MechanicsElement::computeJacobian(const LocalElmtInfo &elmtinfo,const double (&ctan)[3],
@@ -90,4 +97,11 @@ void MechanicsElement::computeJacobian(const LocalElmtInfo &elmtinfo,const doubl
         }
     }
 
+    // the mass matrix of the inertia term
+    if(mate.hasScalarMaterial("rho")){
+        for(int i=1;i<=elmtinfo.m_dim;i++){
+            localK(i,i)+=mate.ScalarMaterial("rho")*shp.m_trial*shp.m_test*ctan[2];
+        }
+    }
+
 }
\ No newline at end of file
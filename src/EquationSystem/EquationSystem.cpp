@@ -21,13 +21,13 @@ EquationSystem::EquationSystem(){
 
 void EquationSystem::init(const DofHandler &t_dofHandler){
     m_dofs=t_dofHandler.getActiveDofs();
-    m_rhs.resize(m_dofs,0.0);
-    m_amatrix.resize(m_dofs,m_dofs,t_dofHandler.getMaxNNZ());
+    // the owned dofs of the distributed mesh are the local rows, otherwise PETSc splits them
+    m_rhs.resize(m_dofs,0.0,t_dofHandler.getLocalDofsNum());
+    m_amatrix.resize(m_dofs,m_dofs,t_dofHandler.getMaxNNZ(),t_dofHandler.getLocalDofsNum());
     m_allocated=true;
 }
 
 void EquationSystem::createSparsityPattern(const DofHandler &t_dofHandler){
-    vector<int> eldofs;
     vector<double> elvals;
     int n;
 
@@ -35,28 +35,24 @@ void EquationSystem::createSparsityPattern(const DofHandler &t_dofHandler){
     MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
     MPI_Comm_size(PETSC_COMM_WORLD,&size);
 
-    eldofs.resize(t_dofHandler.getMaxDofsPerElmt()+1,0);
     elvals.resize(t_dofHandler.getMaxDofsPerElmt()+1,0.0);
 
-    int rankne=t_dofHandler.getBulkElmtsNum()/size;
-    int eStart=rank*rankne;
-    int eEnd=(rank+1)*rankne;
-    if(rank==size-1) eEnd=t_dofHandler.getBulkElmtsNum();
+    int eStart,eEnd;
+    BulkMesh::getBulkElmtsRange(t_dofHandler.getBulkElmtsNum(),rank,size,eStart,eEnd);
     int e;
     for(int ee=eStart;ee<eEnd;++ee){
         e=ee+1;
-        t_dofHandler.getIthBulkElmtDofIDs0(e,eldofs);// index start from 0
-        n=t_dofHandler.getIthBulkElmtDofsNum(e);
+        ElmtConnSpan elmtdofs=t_dofHandler.getIthBulkElmtDofIDsSpan(e);// index start from 1
+        n=elmtdofs.size();
         for(int i=0;i<n;i++){
             for(int j=0;j<n;j++){
-                m_amatrix.addValue(eldofs[i]+1,eldofs[j]+1,elvals[i]);
+                m_amatrix.addValue(elmtdofs[i],elmtdofs[j],elvals[i]);
             }
         }
     }
     m_amatrix.assemble();
     m_amatrix.disableReallocation();// the following operation can not modify the sparsity pattern anymore!!!
 
-    eldofs.clear();
     elvals.clear();
 }
 
@@ -0,0 +1,329 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: locate the physical points in the bulk elements, the
+//+++          candidates are found by a bounding volume hierarchy
+//+++          over the element boxes (or by the index arithmetic of
+//+++          the uniform grid generated by AsFem), then the local
+//+++          coordinates are computed by the inverse isoparametric
+//+++          mapping of the shape functions
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <numeric>
+
+#include "FE/ElmtLocator.h"
+
+ElmtLocator::ElmtLocator(){}
+
+void ElmtLocator::init(const Mesh &t_mesh){
+    releaseMemory();
+    const MeshType meshtype=t_mesh.getBulkMeshBulkElmtMeshType();
+    m_dim=t_mesh.getBulkMeshMaxDim();
+    m_nodesperelmt=t_mesh.getBulkMeshNodesNumPerBulkElmt();
+    m_issimplex=(meshtype==MeshType::TRI3||meshtype==MeshType::TRI6||
+                 meshtype==MeshType::TET4||meshtype==MeshType::TET10);
+    m_shp.setMeshType(meshtype);
+    m_shp.init();
+    m_nodes.resize(m_nodesperelmt);
+    t_mesh.getBulkMeshOwnedBulkElmtsRange(m_elmtstart,m_elmtend);
+
+    int e,k;
+    m_isgrid=t_mesh.isStructuredMesh();
+    if(m_isgrid){
+        // the generated mesh is a uniform tensor-product grid, the element is found by its (i,j,k) indices
+        double xmin[3],xmax[3];
+        const int n[3]={t_mesh.getBulkMeshNx(),t_mesh.getBulkMeshNy(),t_mesh.getBulkMeshNz()};
+        t_mesh.getBulkMeshBounds(xmin,xmax);
+        for(k=0;k<3;k++){
+            m_ngrid[k]=(k<m_dim)?n[k]:1;
+            m_gridmin[k]=xmin[k];
+            m_gridsize[k]=(k<m_dim)?(xmax[k]-xmin[k])/m_ngrid[k]:1.0;
+        }
+    }
+    else{
+        // the boxes of the elements, the higher order elements may be curved, then their boxes are enlarged
+        const int nElmts=m_elmtend-m_elmtstart;
+        const double pad=(t_mesh.getBulkMeshBulkElmtOrder()>1)?0.1:m_tol;
+        m_elmtids.resize(nElmts);
+        m_elmtboxes.resize(6*nElmts);
+        for(e=0;e<nElmts;e++){
+            m_elmtids[e]=m_elmtstart+e+1;
+            double *box=&m_elmtboxes[6*e];
+            for(k=0;k<3;k++){
+                box[k]=1.0e30;box[3+k]=-1.0e30;
+            }
+            for(const auto &node:t_mesh.getBulkMeshIthBulkElmtConn(m_elmtids[e])){
+                for(k=0;k<3;k++){
+                    const double x=t_mesh.getBulkMeshIthNodeJthCoord0(node,k+1);
+                    box[k]=std::min(box[k],x);box[3+k]=std::max(box[3+k],x);
+                }
+            }
+            const double h=std::max(box[3]-box[0],std::max(box[4]-box[1],box[5]-box[2]));
+            for(k=0;k<3;k++){
+                box[k]-=pad*h;box[3+k]+=pad*h;
+            }
+        }
+        buildBVH();
+    }
+    m_isinit=true;
+}
+
+void ElmtLocator::buildBVH(){
+    const int nElmts=static_cast<int>(m_elmtids.size());
+    if(nElmts<1) return;
+    int i,k;
+    vector<double> centers(3*nElmts);
+    for(i=0;i<nElmts;i++){
+        for(k=0;k<3;k++) centers[3*i+k]=0.5*(m_elmtboxes[6*i+k]+m_elmtboxes[6*i+3+k]);
+    }
+    // the elements are sorted by the tree leaves, perm is the new position to the old one
+    vector<int> perm(nElmts);
+    std::iota(perm.begin(),perm.end(),0);
+
+    auto addTreeNode=[&](const int &first,const int &count)->int{
+        m_treechild.push_back(-1);
+        m_treefirst.push_back(first);
+        m_treecount.push_back(count);
+        m_treeboxes.resize(m_treeboxes.size()+6);
+        return static_cast<int>(m_treechild.size())-1;
+    };
+    vector<int> todo,depth;
+    todo.push_back(addTreeNode(0,nElmts));depth.push_back(1);
+    m_treedepth=0;
+    while(!todo.empty()){
+        const int node=todo.back();todo.pop_back();
+        const int d=depth.back();depth.pop_back();
+        const int first=m_treefirst[node],count=m_treecount[node];
+        m_treedepth=std::max(m_treedepth,d);
+        // the box of the tree node is the union of its element boxes
+        double cmin[3],cmax[3];
+        for(k=0;k<3;k++){
+            m_treeboxes[6*node+k]=1.0e30;m_treeboxes[6*node+3+k]=-1.0e30;
+            cmin[k]=1.0e30;cmax[k]=-1.0e30;
+        }
+        for(i=first;i<first+count;i++){
+            for(k=0;k<3;k++){
+                m_treeboxes[6*node+k]=std::min(m_treeboxes[6*node+k],m_elmtboxes[6*perm[i]+k]);
+                m_treeboxes[6*node+3+k]=std::max(m_treeboxes[6*node+3+k],m_elmtboxes[6*perm[i]+3+k]);
+                cmin[k]=std::min(cmin[k],centers[3*perm[i]+k]);
+                cmax[k]=std::max(cmax[k],centers[3*perm[i]+k]);
+            }
+        }
+        if(count<=m_leafsize) continue;
+        // split at the median of the element centers along the longest axis
+        int axis=0;
+        for(k=1;k<3;k++){
+            if(cmax[k]-cmin[k]>cmax[axis]-cmin[axis]) axis=k;
+        }
+        const int mid=first+count/2;
+        std::nth_element(perm.begin()+first,perm.begin()+mid,perm.begin()+first+count,
+                         [&](const int &a,const int &b){return centers[3*a+axis]<centers[3*b+axis];});
+        const int left=addTreeNode(first,mid-first);
+        addTreeNode(mid,first+count-mid);
+        m_treechild[node]=left;
+        todo.push_back(left);depth.push_back(d+1);
+        todo.push_back(left+1);depth.push_back(d+1);
+    }
+
+    vector<int> ids(nElmts);
+    vector<double> boxes(6*nElmts);
+    for(i=0;i<nElmts;i++){
+        ids[i]=m_elmtids[perm[i]];
+        for(k=0;k<6;k++) boxes[6*i+k]=m_elmtboxes[6*perm[i]+k];
+    }
+    m_elmtids.swap(ids);
+    m_elmtboxes.swap(boxes);
+}
+
+int ElmtLocator::getGridElmtID(const Vector3d &t_point)const{
+    int ijk[3]={0,0,0};
+    for(int k=0;k<m_dim;k++){
+        const double s=(t_point(k+1)-m_gridmin[k])/m_gridsize[k];
+        if(s<-m_tol||s>m_ngrid[k]+m_tol) return 0;
+        ijk[k]=std::min(std::max(static_cast<int>(std::floor(s)),0),m_ngrid[k]-1);
+    }
+    return ijk[2]*m_ngrid[0]*m_ngrid[1]+ijk[1]*m_ngrid[0]+ijk[0]+1;
+}
+
+bool ElmtLocator::isPointInElmt(const Mesh &t_mesh,const int &e,const Vector3d &t_point,Vector3d &xi){
+    int i,j,k,iter;
+    t_mesh.getBulkMeshIthBulkElmtNodeCoords0(e,m_nodes);
+    double h=0.0;
+    for(k=1;k<=3;k++){
+        double xmin=m_nodes(1,k),xmax=m_nodes(1,k);
+        for(i=2;i<=m_nodesperelmt;i++){
+            xmin=std::min(xmin,m_nodes(i,k));xmax=std::max(xmax,m_nodes(i,k));
+        }
+        h=std::max(h,xmax-xmin);
+    }
+
+    // start from the center of the reference element
+    double x[3]={0.0,0.0,0.0};
+    if(m_issimplex){
+        for(j=0;j<m_dim;j++) x[j]=1.0/(m_dim+1);
+    }
+    double jac[3][3],r[3],a[3][3],b[3],dx[3];
+    auto calcResidual=[&](){
+        m_shp.calc(x[0],x[1],x[2],m_nodes,false);
+        for(k=0;k<3;k++){
+            r[k]=t_point(k+1);
+            for(j=0;j<m_dim;j++) jac[k][j]=0.0;
+        }
+        for(i=1;i<=m_nodesperelmt;i++){
+            const double N=m_shp.shape_value(i);
+            const Vector3d &dN=m_shp.shape_grad(i);
+            for(k=0;k<3;k++){
+                r[k]-=N*m_nodes(i,k+1);
+                for(j=0;j<m_dim;j++) jac[k][j]+=dN(j+1)*m_nodes(i,k+1);
+            }
+        }
+    };
+    for(iter=0;iter<m_maxiters;iter++){
+        calcResidual();
+        // Gauss-Newton, the normal equation works for the 1d/2d element embedded in 3d space as well
+        for(i=0;i<m_dim;i++){
+            b[i]=0.0;
+            for(k=0;k<3;k++) b[i]+=jac[k][i]*r[k];
+            for(j=0;j<m_dim;j++){
+                a[i][j]=0.0;
+                for(k=0;k<3;k++) a[i][j]+=jac[k][i]*jac[k][j];
+            }
+        }
+        if(m_dim==1){
+            if(a[0][0]<=0.0) return false;
+            dx[0]=b[0]/a[0][0];
+        }
+        else if(m_dim==2){
+            const double det=a[0][0]*a[1][1]-a[0][1]*a[1][0];
+            if(std::fabs(det)<1.0e-30) return false;
+            dx[0]=( a[1][1]*b[0]-a[0][1]*b[1])/det;
+            dx[1]=(-a[1][0]*b[0]+a[0][0]*b[1])/det;
+        }
+        else{
+            const double c00=a[1][1]*a[2][2]-a[1][2]*a[2][1];
+            const double c01=a[1][2]*a[2][0]-a[1][0]*a[2][2];
+            const double c02=a[1][0]*a[2][1]-a[1][1]*a[2][0];
+            const double det=a[0][0]*c00+a[0][1]*c01+a[0][2]*c02;
+            if(std::fabs(det)<1.0e-30) return false;
+            dx[0]=(c00*b[0]+(a[0][2]*a[2][1]-a[0][1]*a[2][2])*b[1]+(a[0][1]*a[1][2]-a[0][2]*a[1][1])*b[2])/det;
+            dx[1]=(c01*b[0]+(a[0][0]*a[2][2]-a[0][2]*a[2][0])*b[1]+(a[0][2]*a[1][0]-a[0][0]*a[1][2])*b[2])/det;
+            dx[2]=(c02*b[0]+(a[0][1]*a[2][0]-a[0][0]*a[2][1])*b[1]+(a[0][0]*a[1][1]-a[0][1]*a[1][0])*b[2])/det;
+        }
+        double dxmax=0.0,xmax=0.0;
+        for(j=0;j<m_dim;j++){
+            x[j]+=dx[j];
+            dxmax=std::max(dxmax,std::fabs(dx[j]));
+            xmax=std::max(xmax,std::fabs(x[j]));
+        }
+        if(xmax>10.0) return false;// far away from the element, the iteration is not trusted anymore
+        if(dxmax<1.0e-12) break;
+    }
+    // the residual of the converged local coordinates, the shape functions are kept for the interpolation
+    calcResidual();
+    if(std::sqrt(r[0]*r[0]+r[1]*r[1]+r[2]*r[2])>m_tol*(1.0+h)) return false;
+
+    for(j=0;j<3;j++) xi(j+1)=x[j];
+    if(m_issimplex){
+        double sum=0.0;
+        for(j=0;j<m_dim;j++){
+            if(x[j]<-m_tol) return false;
+            sum+=x[j];
+        }
+        return sum<=1.0+m_tol;
+    }
+    for(j=0;j<m_dim;j++){
+        if(std::fabs(x[j])>1.0+m_tol) return false;
+    }
+    return true;
+}
+
+bool ElmtLocator::findElmt(const Mesh &t_mesh,const Vector3d &t_point,int &elmtid,Vector3d &xi){
+    if(!m_isinit){
+        MessagePrinter::printErrorTxt("the element locator is not initialized, you must call init() before the search");
+        MessagePrinter::exitAsFem();
+    }
+    elmtid=0;
+    if(m_isgrid){
+        const int e=getGridElmtID(t_point);
+        if(e<=m_elmtstart||e>m_elmtend) return false;
+        if(!isPointInElmt(t_mesh,e,t_point,xi)) return false;
+        elmtid=e;
+        return true;
+    }
+    if(m_treechild.empty()) return false;
+
+    auto isInBox=[&](const double *box)->bool{
+        for(int k=0;k<3;k++){
+            if(t_point(k+1)<box[k]||t_point(k+1)>box[3+k]) return false;
+        }
+        return true;
+    };
+    m_stack.clear();
+    m_stack.push_back(0);
+    while(!m_stack.empty()){
+        const int node=m_stack.back();m_stack.pop_back();
+        if(!isInBox(&m_treeboxes[6*node])) continue;
+        if(m_treechild[node]<0){
+            for(int i=m_treefirst[node];i<m_treefirst[node]+m_treecount[node];i++){
+                if(!isInBox(&m_elmtboxes[6*i])) continue;
+                if(isPointInElmt(t_mesh,m_elmtids[i],t_point,xi)){
+                    elmtid=m_elmtids[i];
+                    return true;
+                }
+            }
+        }
+        else{
+            m_stack.push_back(m_treechild[node]+1);
+            m_stack.push_back(m_treechild[node]);
+        }
+    }
+    return false;
+}
+
+int ElmtLocator::findElmts(const Mesh &t_mesh,const vector<Vector3d> &t_points,vector<int> &elmtids,vector<Vector3d> &xis){
+    const int n=static_cast<int>(t_points.size());
+    int found=0;
+    elmtids.resize(n);
+    xis.resize(n);
+    for(int i=0;i<n;i++){
+        xis[i]=0.0;
+        if(findElmt(t_mesh,t_points[i],elmtids[i],xis[i])) found+=1;
+    }
+    return found;
+}
+
+void ElmtLocator::printElmtLocatorInfo()const{
+    char buff[70];
+    if(m_isgrid){
+        snprintf(buff,70,"  element locator: uniform grid, %d x %d x %d elmts",m_ngrid[0],m_ngrid[1],m_ngrid[2]);
+        MessagePrinter::printNormalTxt(string(buff));
+        return;
+    }
+    snprintf(buff,70,"  element locator: BVH over %d elmts",static_cast<int>(m_elmtids.size()));
+    MessagePrinter::printNormalTxt(string(buff));
+    snprintf(buff,70,"  tree nodes=%8d, depth=%4d, leaf size<=%2d",static_cast<int>(m_treechild.size()),m_treedepth,m_leafsize);
+    MessagePrinter::printNormalTxt(string(buff));
+}
+
+void ElmtLocator::releaseMemory(){
+    m_isinit=false;
+    m_isgrid=false;
+    m_elmtboxes.clear();
+    m_elmtids.clear();
+    m_treeboxes.clear();
+    m_treechild.clear();
+    m_treefirst.clear();
+    m_treecount.clear();
+    m_stack.clear();
+    m_treedepth=0;
+    m_shp.releaseMemory();
+    m_nodes.clear();
+}
@@ -168,4 +168,6 @@ void FE::releaseMemory(){
     m_bulk_qpoints.releaseMemory();
     m_line_qpoints.releaseMemory();
     m_surface_qpoints.releaseMemory();
+
+    m_elmtlocator.releaseMemory();
 }
\ No newline at end of file
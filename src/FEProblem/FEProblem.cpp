@@ -42,6 +42,18 @@ void FEProblem::initFEProblem(int args,char *argv[]){
 
     if(m_inputSystem.isReadOnly()) return;
 
+    //***************************************
+    // for the distributed mesh
+    //***************************************
+    if(m_mesh.isDistributedMeshRequired()){
+        // each rank only keeps its own partition, then the dofs are numbered by their owners
+        m_timer.startTimer();
+        MessagePrinter::printNormalTxt("Start to distribute the mesh ...");
+        m_mesh.distributeBulkMesh();
+        m_timer.endTimer();
+        m_timer.printElapseTime("Mesh is distributed",false);
+    }
+
     //***************************************
     // for dofs init
     //***************************************
@@ -153,6 +165,15 @@ void FEProblem::initFEProblem(int args,char *argv[]){
     m_fectrlinfo.IsDepDebug=m_jobblock.m_isdepdebug;
 
 
+    if(m_inputSystem.hasRestartFile()){
+        if(m_jobblock.m_jobtype==FEJobType::TRANSIENT){
+            m_timestepping.setRestartFileName(m_inputSystem.getRestartFileName());
+        }
+        else{
+            MessagePrinter::printWarningTxt("'--restart' is only used by the transient analysis, it will be ignored");
+        }
+    }
+
     //***************************************
     // for print out basic info
     //***************************************
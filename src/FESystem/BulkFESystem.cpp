@@ -34,16 +34,18 @@ BulkFESystem::BulkFESystem(){
     m_subK.clean();
 
     m_elmtconn.clear();
-    m_elmtdofsid.clear();
     m_subelmtdofsid.clear();
 
     m_max_k_coeff=-1.0e16;
+    m_assembleddofs.clear();
 
     m_elmtU.clear();
     m_elmtUold.clear();
     m_elmtUolder.clear();
     m_elmtV.clear();
     m_elmtA.clear();
+    m_elmtdiagmass.clear();
+    m_elmttotalmass.clear();
 
     m_local_elmtsoln.m_gpU.clear();
     m_local_elmtsoln.m_gpUold.clear();
@@ -85,16 +87,18 @@ void BulkFESystem::releaseMemory(){
     m_subK.clean();
 
     m_elmtconn.clear();
-    m_elmtdofsid.clear();
     m_subelmtdofsid.clear();
 
     m_max_k_coeff=-1.0e16;
+    m_assembleddofs.clear();
 
     m_elmtU.clear();
     m_elmtUold.clear();
     m_elmtUolder.clear();
     m_elmtV.clear();
     m_elmtA.clear();
+    m_elmtdiagmass.clear();
+    m_elmttotalmass.clear();
 
     m_local_elmtsoln.m_gpU.clear();
     m_local_elmtsoln.m_gpUold.clear();
@@ -19,30 +19,53 @@
 //*** for local to global assemble
 //********************************************************
 void BulkFESystem::assembleLocalResidual2GlobalR(const int &t_dofs,const vector<int> &t_dofsid,
-                                       const int &t_globalnodeid,
+                                       const int &t_localnodeid,
                                        const DofHandler &t_dofhandler,
                                        const double &jxw,
                                        const VectorXd &t_subR,
                                        Vector &RHS){
     int iInd;
     for(int i=0;i<t_dofs;i++){
-        iInd=t_dofhandler.getIthNodeJthDofID(t_globalnodeid,t_dofsid[i]);
+        iInd=t_dofhandler.getIthLocalNodeJthDofID(t_localnodeid,t_dofsid[i]);
         RHS.addValue(iInd,t_subR(i+1)*jxw);
     }
 }
 void BulkFESystem::assembleLocalJacobian2GlobalK(const int &t_dofs,const vector<int> &t_dofsid,
-                                       const int &t_globalnodeidI,const int &t_globalnodeidJ,
+                                       const int &t_localnodeidI,const int &t_localnodeidJ,
                                        const double &jxw,
                                        const DofHandler &t_dofhandler,
                                        const MatrixXd &t_subK,
                                        SparseMatrix &AMATRIX){
     int iInd,jInd;
+    bool HasFlag=!m_assembleddofs.empty();
     for(int i=0;i<t_dofs;i++){
-        iInd=t_dofhandler.getIthNodeJthDofID(t_globalnodeidI,t_dofsid[i]);
+        iInd=t_dofhandler.getIthLocalNodeJthDofID(t_localnodeidI,t_dofsid[i]);
         for(int j=0;j<t_dofs;j++){
-            jInd=t_dofhandler.getIthNodeJthDofID(t_globalnodeidJ,t_dofsid[j]);
-            AMATRIX.addValue(iInd,jInd,t_subK(i+1,j+1)*jxw*1.0);
+            // the max coefficient always covers the whole K, then the penalty of dirichlet bc does not depend on the block
             if(abs(t_subK(i+1,j+1))>m_max_k_coeff) m_max_k_coeff=abs(t_subK(i+1,j+1));
+            if(HasFlag&&(!m_assembleddofs[t_dofsid[i]-1]||!m_assembleddofs[t_dofsid[j]-1])) continue;
+            jInd=t_dofhandler.getIthLocalNodeJthDofID(t_localnodeidJ,t_dofsid[j]);
+            AMATRIX.addValue(iInd,jInd,t_subK(i+1,j+1)*jxw*1.0);
+        }
+    }
+}
+void BulkFESystem::assembleLocalLumpedMass2GlobalR(const int &t_elmtid,
+                                                   const Mesh &t_mesh,
+                                                   const DofHandler &t_dofhandler,
+                                                   Vector &RHS){
+    int iInd,localnodeid;
+    double diagsum;
+    for(int k=0;k<m_max_nodal_dofs;k++){
+        diagsum=0.0;
+        for(int i=0;i<m_bulkelmt_nodesnum;i++) diagsum+=m_elmtdiagmass[i*m_max_nodal_dofs+k];
+        if(diagsum<=0.0) continue;// the dof has no mass in this element
+        // the diagonal of each component is scaled by its own ratio, so the element keeps its total mass
+        const double ratio=m_elmttotalmass[k]/diagsum;
+        for(int i=1;i<=m_bulkelmt_nodesnum;i++){
+            localnodeid=t_mesh.getBulkMeshIthBulkElmtJthLocalNodeID(t_elmtid,i);
+            iInd=t_dofhandler.getIthLocalNodeJthDofID(localnodeid,k+1);
+            if(iInd<1) continue;// the inactive dof
+            RHS.addValue(iInd,m_elmtdiagmass[(i-1)*m_max_nodal_dofs+k]*ratio);
         }
     }
-}
\ No newline at end of file
+}
@@ -31,7 +31,6 @@ void BulkFESystem::init(const Mesh &t_mesh,const DofHandler &t_dofhandler){
     m_subK.resize(m_max_nodal_dofs+1,m_max_nodal_dofs+1,0.0);
 
     m_elmtconn.resize(m_bulkelmt_nodesnum,0);
-    m_elmtdofsid.resize(m_max_elmt_dofs+1,0);
     m_subelmtdofsid.resize(m_max_nodal_dofs+1,0);
 
     // for elemental solution
@@ -42,6 +41,9 @@ void BulkFESystem::init(const Mesh &t_mesh,const DofHandler &t_dofhandler){
     m_elmtV.resize(m_max_elmt_dofs,0.0);
     m_elmtA.resize(m_max_elmt_dofs,0.0);
 
+    m_elmtdiagmass.resize(m_bulkelmt_nodesnum*m_max_nodal_dofs,0.0);
+    m_elmttotalmass.resize(m_max_nodal_dofs,0.0);
+
     // for sub elemental solution
     m_local_elmtsoln.m_gpU.resize(m_max_nodal_dofs+1,0.0);
     m_local_elmtsoln.m_gpUold.resize(m_max_nodal_dofs+1,0.0);
@@ -20,7 +20,7 @@ void BulkFESystem::formBulkFE(const FECalcType &t_calctype,const double &t,const
                               ElmtSystem &t_elmtsystem,MateSystem &t_matesystem,
                               SolutionSystem &t_solutionsystem,
                               SparseMatrix &AMATRIX,Vector &RHS){
-    if(t_calctype==FECalcType::COMPUTERESIDUAL){
+    if(t_calctype==FECalcType::COMPUTERESIDUAL||t_calctype==FECalcType::COMPUTELUMPEDMASS){
         RHS.setToZero();
     }
     else if(t_calctype==FECalcType::COMPUTEJACOBIAN){
@@ -39,19 +39,17 @@ void BulkFESystem::formBulkFE(const FECalcType &t_calctype,const double &t,const
     MPI_Comm_rank(PETSC_COMM_WORLD,&m_rank);
     MPI_Comm_size(PETSC_COMM_WORLD,&m_size);
 
-    int rankne=t_mesh.getBulkMeshBulkElmtsNum()/m_size;
-    int eStart=m_rank*rankne;
-    int eEnd=(m_rank+1)*rankne;
-    if(m_rank==m_size-1) eEnd=t_mesh.getBulkMeshBulkElmtsNum();
+    int eStart,eEnd;
+    BulkMesh::getBulkElmtsRange(t_mesh.getBulkMeshBulkElmtsNum(),m_rank,m_size,eStart,eEnd);
 
-    int nDim,e,qpoints_num;
+    int nDim,e,qpoints_num,qpid;
     int ndofs_per_elmt;
     double xi,eta,zeta,w,J,JxW;
     nDim=t_mesh.getBulkMeshMaxDim();
 
     int subelmtid;
-    int globaldofid,globalnodeid;
-    int globalI,globalJ;
+    int globaldofid,localnodeid;
+    int localI,localJ;
 
     m_local_elmtinfo.m_dim=nDim;
     m_local_elmtinfo.m_nodesnum=t_mesh.getBulkMeshNodesNumPerBulkElmt();
@@ -67,17 +65,21 @@ void BulkFESystem::formBulkFE(const FECalcType &t_calctype,const double &t,const
 
         t_mesh.getBulkMeshIthBulkElmtConnectivity(e,m_elmtconn);// for current element's connectivity
 
-        t_dofhandler.getIthBulkElmtDofIDs(e,m_elmtdofsid);// the global dofs id, start from 1
-        ndofs_per_elmt=t_dofhandler.getIthBulkElmtDofsNum(e);
+        ElmtConnSpan elmtdofsid=t_dofhandler.getIthBulkElmtDofIDsSpan(e);// the global dofs id, start from 1
+        ndofs_per_elmt=elmtdofsid.size();
 
         // for the local solution
         for(int i=0;i<ndofs_per_elmt;i++){
-            m_elmtUolder[i]=t_solutionsystem.m_u_older.getIthValueFromGhost(m_elmtdofsid[i]);
-            m_elmtUold[i]=t_solutionsystem.m_u_old.getIthValueFromGhost(m_elmtdofsid[i]);
-            m_elmtU[i]=t_solutionsystem.m_u_temp.getIthValueFromGhost(m_elmtdofsid[i]);
+            m_elmtUolder[i]=t_solutionsystem.m_u_older.getIthValueFromGhost(elmtdofsid[i]);
+            m_elmtUold[i]=t_solutionsystem.m_u_old.getIthValueFromGhost(elmtdofsid[i]);
+            m_elmtU[i]=t_solutionsystem.m_u_temp.getIthValueFromGhost(elmtdofsid[i]);
 
-            m_elmtV[i]=t_solutionsystem.m_v.getIthValueFromGhost(m_elmtdofsid[i]);
-            m_elmtA[i]=t_solutionsystem.m_a.getIthValueFromGhost(m_elmtdofsid[i]);
+            m_elmtV[i]=t_solutionsystem.m_v.getIthValueFromGhost(elmtdofsid[i]);
+            m_elmtA[i]=t_solutionsystem.m_a.getIthValueFromGhost(elmtdofsid[i]);
+        }
+        if(t_calctype==FECalcType::COMPUTELUMPEDMASS){
+            for(auto &it:m_elmtdiagmass) it=0.0;
+            for(auto &it:m_elmttotalmass) it=0.0;
         }
 
         //***********************************************************
@@ -85,6 +87,7 @@ void BulkFESystem::formBulkFE(const FECalcType &t_calctype,const double &t,const
         //***********************************************************
         qpoints_num=t_fe.m_bulk_qpoints.getQPointsNum();
         for(int qpInd=1;qpInd<=qpoints_num;qpInd++){
+            qpid=t_solutionsystem.getIthElmtJthQPointLocalID(e,qpInd);// the position in the local materials arrays
             w =t_fe.m_bulk_qpoints.getIthPointJthCoord(qpInd,0);
             xi=t_fe.m_bulk_qpoints.getIthPointJthCoord(qpInd,1);
             if(nDim==1){
@@ -122,17 +125,17 @@ void BulkFESystem::formBulkFE(const FECalcType &t_calctype,const double &t,const
 
             if(t_calctype!=FECalcType::INITMATERIAL){
                 // get the old material properties on each qpoint
-                t_matesystem.m_materialcontainer_old.getScalarMaterialsRef()=t_solutionsystem.m_qpoints_scalarmaterials[(e-1)*qpoints_num+qpInd-1];
-                t_matesystem.m_materialcontainer_old.getVectorMaterialsRef()=t_solutionsystem.m_qpoints_vectormaterials[(e-1)*qpoints_num+qpInd-1];
-                t_matesystem.m_materialcontainer_old.getRank2MaterialsRef()=t_solutionsystem.m_qpoints_rank2materials[(e-1)*qpoints_num+qpInd-1];
-                t_matesystem.m_materialcontainer_old.getRank4MaterialsRef()=t_solutionsystem.m_qpoints_rank4materials[(e-1)*qpoints_num+qpInd-1];
+                t_matesystem.m_materialcontainer_old.getScalarMaterialsRef()=t_solutionsystem.m_qpoints_scalarmaterials[qpid];
+                t_matesystem.m_materialcontainer_old.getVectorMaterialsRef()=t_solutionsystem.m_qpoints_vectormaterials[qpid];
+                t_matesystem.m_materialcontainer_old.getRank2MaterialsRef()=t_solutionsystem.m_qpoints_rank2materials[qpid];
+                t_matesystem.m_materialcontainer_old.getRank4MaterialsRef()=t_solutionsystem.m_qpoints_rank4materials[qpid];
             }
 
             for(int subelmt=1;subelmt<=t_elmtsystem.getIthBulkElmtSubElmtsNum(e);subelmt++){
                 if(t_calctype==FECalcType::COMPUTERESIDUAL){
                     m_subR.setToZero();
                 }
-                else if(t_calctype==FECalcType::COMPUTEJACOBIAN){
+                else if(t_calctype==FECalcType::COMPUTEJACOBIAN||t_calctype==FECalcType::COMPUTELUMPEDMASS){
                     m_subK.setToZero();
                 }
 
@@ -161,8 +164,8 @@ void BulkFESystem::formBulkFE(const FECalcType &t_calctype,const double &t,const
 
                     m_local_elmtsoln.m_gpGradV[i+1]=0.0;
                     for(int j=1;j<=m_bulkelmt_nodesnum;j++){
-                        globalnodeid=t_mesh.getBulkMeshIthBulkElmtJthNodeID(e,j);
-                        globaldofid=t_dofhandler.getIthNodeJthDofID(globalnodeid,m_subelmtdofsid[i]);
+                        localnodeid=t_mesh.getBulkMeshIthBulkElmtJthLocalNodeID(e,j);// no global id search for the distributed mesh
+                        globaldofid=t_dofhandler.getIthLocalNodeJthDofID(localnodeid,m_subelmtdofsid[i]);
                         m_local_elmtsoln.m_gpUolder[i+1]+=t_fe.m_bulk_shp.shape_value(j)*t_solutionsystem.m_u_older.getIthValueFromGhost(globaldofid);
                         m_local_elmtsoln.m_gpUold[i+1]+=t_fe.m_bulk_shp.shape_value(j)*t_solutionsystem.m_u_old.getIthValueFromGhost(globaldofid);
                         m_local_elmtsoln.m_gpU[i+1]+=t_fe.m_bulk_shp.shape_value(j)*t_solutionsystem.m_u_temp.getIthValueFromGhost(globaldofid);
@@ -217,9 +220,9 @@ void BulkFESystem::formBulkFE(const FECalcType &t_calctype,const double &t,const
                                          m_local_elmtinfo,m_local_elmtsoln,m_local_shp,
                                          m_subK,m_subR);
 
-                        globalI=t_mesh.getBulkMeshIthBulkElmtJthNodeID(e,i);
+                        localI=t_mesh.getBulkMeshIthBulkElmtJthLocalNodeID(e,i);
                         
-                        assembleLocalResidual2GlobalR(m_subelmt_dofs,m_subelmtdofsid,globalI,t_dofhandler,JxW,m_subR,RHS);
+                        assembleLocalResidual2GlobalR(m_subelmt_dofs,m_subelmtdofsid,localI,t_dofhandler,JxW,m_subR,RHS);
                     
                     }
                 }
@@ -227,11 +230,11 @@ void BulkFESystem::formBulkFE(const FECalcType &t_calctype,const double &t,const
                     for(int i=1;i<=m_bulkelmt_nodesnum;i++){
                         m_local_shp.m_test=t_fe.m_bulk_shp.shape_value(i);
                         m_local_shp.m_grad_test=t_fe.m_bulk_shp.shape_grad(i);
-                        globalI=t_mesh.getBulkMeshIthBulkElmtJthNodeID(e,i);
+                        localI=t_mesh.getBulkMeshIthBulkElmtJthLocalNodeID(e,i);
                         for(int j=1;j<=m_bulkelmt_nodesnum;j++){
                             m_local_shp.m_trial=t_fe.m_bulk_shp.shape_value(j);
                             m_local_shp.m_grad_trial=t_fe.m_bulk_shp.shape_grad(j);
-                            globalJ=t_mesh.getBulkMeshIthBulkElmtJthNodeID(e,j);
+                            localJ=t_mesh.getBulkMeshIthBulkElmtJthLocalNodeID(e,j);
                             
                             t_elmtsystem.runBulkElmtLibs(t_calctype,ctan,subelmtid,
                                          t_matesystem.m_materialcontainer_old,
@@ -239,41 +242,69 @@ void BulkFESystem::formBulkFE(const FECalcType &t_calctype,const double &t,const
                                          m_local_elmtinfo,m_local_elmtsoln,m_local_shp,
                                          m_subK,m_subR);
 
-                            assembleLocalJacobian2GlobalK(m_subelmt_dofs,m_subelmtdofsid,globalI,globalJ,JxW,t_dofhandler,m_subK,AMATRIX);
+                            assembleLocalJacobian2GlobalK(m_subelmt_dofs,m_subelmtdofsid,localI,localJ,JxW,t_dofhandler,m_subK,AMATRIX);
                             
                         }
                     }
+                }
+                else if(t_calctype==FECalcType::COMPUTELUMPEDMASS){
+                    // the jacobian with ctan={0,1,0} or {0,0,1} is the mass, only its (k,k) entries are
+                    // kept, then the diagonal and the total mass of each field component are summed up
+                    for(int i=1;i<=m_bulkelmt_nodesnum;i++){
+                        m_local_shp.m_test=t_fe.m_bulk_shp.shape_value(i);
+                        m_local_shp.m_grad_test=t_fe.m_bulk_shp.shape_grad(i);
+                        for(int j=1;j<=m_bulkelmt_nodesnum;j++){
+                            m_local_shp.m_trial=t_fe.m_bulk_shp.shape_value(j);
+                            m_local_shp.m_grad_trial=t_fe.m_bulk_shp.shape_grad(j);
+
+                            t_elmtsystem.runBulkElmtLibs(FECalcType::COMPUTEJACOBIAN,ctan,subelmtid,
+                                         t_matesystem.m_materialcontainer_old,
+                                         t_matesystem.m_materialcontainer,
+                                         m_local_elmtinfo,m_local_elmtsoln,m_local_shp,
+                                         m_subK,m_subR);
+
+                            for(int k=0;k<m_subelmt_dofs;k++){
+                                m_elmttotalmass[m_subelmtdofsid[k]-1]+=m_subK(k+1,k+1)*JxW;
+                                if(i==j) m_elmtdiagmass[(i-1)*m_max_nodal_dofs+m_subelmtdofsid[k]-1]+=m_subK(k+1,k+1)*JxW;
+                            }
+                        }
+                    }
                 }// end-of-residual-jacobian-calc-in-subElement                          
 
             }// end-of-sub-element-loop
 
             if(t_calctype==FECalcType::INITMATERIAL){
                 // store the material properties on each qpoint
-                t_solutionsystem.m_qpoints_scalarmaterials[(e-1)*qpoints_num+qpInd-1]=t_matesystem.m_materialcontainer.getScalarMaterialsRef();
-                t_solutionsystem.m_qpoints_vectormaterials[(e-1)*qpoints_num+qpInd-1]=t_matesystem.m_materialcontainer.getVectorMaterialsRef();
-                t_solutionsystem.m_qpoints_rank2materials[(e-1)*qpoints_num+qpInd-1]=t_matesystem.m_materialcontainer.getRank2MaterialsRef();
-                t_solutionsystem.m_qpoints_rank4materials[(e-1)*qpoints_num+qpInd-1]=t_matesystem.m_materialcontainer.getRank4MaterialsRef();
+                t_solutionsystem.m_qpoints_scalarmaterials[qpid]=t_matesystem.m_materialcontainer.getScalarMaterialsRef();
+                t_solutionsystem.m_qpoints_vectormaterials[qpid]=t_matesystem.m_materialcontainer.getVectorMaterialsRef();
+                t_solutionsystem.m_qpoints_rank2materials[qpid]=t_matesystem.m_materialcontainer.getRank2MaterialsRef();
+                t_solutionsystem.m_qpoints_rank4materials[qpid]=t_matesystem.m_materialcontainer.getRank4MaterialsRef();
             }
             else if(t_calctype==FECalcType::UPDATEMATERIAL){
-                // store the material properties on each qpoint
-                t_solutionsystem.m_qpoints_scalarmaterials[(e-1)*qpoints_num+qpInd-1]=t_matesystem.m_materialcontainer.getScalarMaterialsRef();
-                t_solutionsystem.m_qpoints_vectormaterials[(e-1)*qpoints_num+qpInd-1]=t_matesystem.m_materialcontainer.getVectorMaterialsRef();
-                t_solutionsystem.m_qpoints_rank2materials[(e-1)*qpoints_num+qpInd-1]=t_matesystem.m_materialcontainer.getRank2MaterialsRef();
-                t_solutionsystem.m_qpoints_rank4materials[(e-1)*qpoints_num+qpInd-1]=t_matesystem.m_materialcontainer.getRank4MaterialsRef();
-
-                // update the old material
-                t_solutionsystem.m_qpoints_scalarmaterials_old[(e-1)*qpoints_num+qpInd-1]=t_solutionsystem.m_qpoints_scalarmaterials[(e-1)*qpoints_num+qpInd-1];
-                t_solutionsystem.m_qpoints_vectormaterials_old[(e-1)*qpoints_num+qpInd-1]=t_solutionsystem.m_qpoints_vectormaterials[(e-1)*qpoints_num+qpInd-1];
-                t_solutionsystem.m_qpoints_rank2materials_old[(e-1)*qpoints_num+qpInd-1]=t_solutionsystem.m_qpoints_rank2materials[(e-1)*qpoints_num+qpInd-1];
-                t_solutionsystem.m_qpoints_rank4materials_old[(e-1)*qpoints_num+qpInd-1]=t_solutionsystem.m_qpoints_rank4materials[(e-1)*qpoints_num+qpInd-1];
+                // the new materials are moved into the qpoint by swapping with the container, which is
+                // refilled by the next qpoint, then the old buffer gets a copy of them, so both hold the
+                // accepted step, the same as before, but only one map copy is done for each qpoint
+                t_solutionsystem.m_qpoints_scalarmaterials[qpid].swap(t_matesystem.m_materialcontainer.getScalarMaterialsRef());
+                t_solutionsystem.m_qpoints_vectormaterials[qpid].swap(t_matesystem.m_materialcontainer.getVectorMaterialsRef());
+                t_solutionsystem.m_qpoints_rank2materials[qpid].swap(t_matesystem.m_materialcontainer.getRank2MaterialsRef());
+                t_solutionsystem.m_qpoints_rank4materials[qpid].swap(t_matesystem.m_materialcontainer.getRank4MaterialsRef());
+
+                t_solutionsystem.m_qpoints_scalarmaterials_old[qpid]=t_solutionsystem.m_qpoints_scalarmaterials[qpid];
+                t_solutionsystem.m_qpoints_vectormaterials_old[qpid]=t_solutionsystem.m_qpoints_vectormaterials[qpid];
+                t_solutionsystem.m_qpoints_rank2materials_old[qpid]=t_solutionsystem.m_qpoints_rank2materials[qpid];
+                t_solutionsystem.m_qpoints_rank4materials_old[qpid]=t_solutionsystem.m_qpoints_rank4materials[qpid];
             }
 
         }// end-of-qpoints-loop
 
+        if(t_calctype==FECalcType::COMPUTELUMPEDMASS){
+            assembleLocalLumpedMass2GlobalR(e,t_mesh,t_dofhandler,RHS);
+        }
+
     }// end-of-element-loop
 
     // finish the final assemble
-    if(t_calctype==FECalcType::COMPUTERESIDUAL){
+    if(t_calctype==FECalcType::COMPUTERESIDUAL||t_calctype==FECalcType::COMPUTELUMPEDMASS){
         RHS.assemble();
     }
     else if(t_calctype==FECalcType::COMPUTEJACOBIAN){
@@ -16,8 +16,8 @@
 #include "ICSystem/ICSystem.h"
 
 void ICSystem::applyInitialConditions(const Mesh &t_mesh,const DofHandler &t_dofhandler,Vector &U0){
-    int e,i,j,k,iInd,dofs,dim;
-    int rankne,eStart,eEnd,nElmts,nNodesPerElmt;
+    int e,i,j,jlocal,k,iInd,dofs,dim;
+    int eStart,eEnd,nElmts,nNodesPerElmt,phyhandle;
     double icvalue;
     Vector3d nodecoords0;
 
@@ -39,22 +39,22 @@ void ICSystem::applyInitialConditions(const Mesh &t_mesh,const DofHandler &t_dof
         }
         for(const auto &name:it.m_domainNameList){
             nElmts=t_mesh.getBulkMeshElmtsNumViaPhyName(name);
-            rankne=nElmts/m_size;
-            eStart=m_rank*rankne;
-            eEnd=(m_rank+1)*rankne;
-            if(m_rank==m_size-1) eEnd=nElmts;
+            phyhandle=t_mesh.getBulkMeshPhyGroupHandle(name);
+            t_mesh.getBulkMeshPhyGroupElmtsRange(nElmts,m_rank,m_size,eStart,eEnd);
             dim=t_mesh.getBulkMeshElmtDimViaPhyName(name);
             for(e=eStart;e<eEnd;e++){
-                nNodesPerElmt=t_mesh.getBulkMeshIthElmtNodesNumViaPhyName(name,e+1);
+                ElmtConnArray conn=t_mesh.getBulkMeshIthElmtConnViaHandle(phyhandle,e+1);
+                nNodesPerElmt=conn.size();
                 for(i=1;i<=nNodesPerElmt;i++){
                     if(it.m_icType==ICType::RANDOMIC) PetscRandomGetValue(m_rnd,&icvalue);
-                    j=t_mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(name,e+1,i);// global id
+                    j=conn[i-1];// global id
+                    jlocal=t_mesh.getBulkMeshNodeLocalID(j);// the dofs map is indexed by the local id
                     nodecoords0(1)=t_mesh.getBulkMeshIthNodeJthCoord0(j,1);
                     nodecoords0(2)=t_mesh.getBulkMeshIthNodeJthCoord0(j,2);
                     nodecoords0(3)=t_mesh.getBulkMeshIthNodeJthCoord0(j,3);
                     runICLibs(it.m_icType,it.m_json_params,icvalue,dim,dofs,nodecoords0,m_localU);
                     for(k=1;k<=dofs;k++){
-                        iInd=t_dofhandler.getIthNodeJthDofID(j,it.m_dofIDs[k-1]);
+                        iInd=t_dofhandler.getIthLocalNodeJthDofID(jlocal,it.m_dofIDs[k-1]);
                         U0.insertValue(iInd,m_localU(k));
                     }
                 }
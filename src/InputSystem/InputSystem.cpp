@@ -19,6 +19,8 @@ InputSystem::InputSystem(){
     m_meshfile_name.clear();
     m_json.clear();
     m_readonly=false;
+    m_hasrestartfile=false;
+    m_restartfile_name.clear();
 }
 InputSystem::~InputSystem(){
     m_inputfile_name.clear();
@@ -27,6 +29,8 @@ InputSystem::~InputSystem(){
 }
 InputSystem::InputSystem(int args,char *argv[]){
     m_readonly=false;
+    m_hasrestartfile=false;
+    m_restartfile_name.clear();
     if(args==1){
         // ./asfem or asfem
         m_inputfile_name.clear();
@@ -74,12 +78,22 @@ InputSystem::InputSystem(int args,char *argv[]){
             if(string(argv[i]).find("--read-only")!=string::npos){
                 m_readonly=true;
             }
+            else if(string(argv[i])=="--restart"){
+                if(i+1>=args){
+                    MessagePrinter::printErrorTxt("no checkpoint file found after '--restart', please check your command line args");
+                    MessagePrinter::exitAsFem();
+                }
+                m_restartfile_name=argv[i+1];
+                m_hasrestartfile=true;
+            }
         }
     }
 }
 //*************************************************
 void InputSystem::init(int args,char *argv[]){
     m_readonly=false;
+    m_hasrestartfile=false;
+    m_restartfile_name.clear();
     if(args==1){
         // ./asfem or asfem
         m_inputfile_name.clear();
@@ -126,6 +140,14 @@ void InputSystem::init(int args,char *argv[]){
             if(string(argv[i]).find("--read-only")!=string::npos){
                 m_readonly=true;
             }
+            else if(string(argv[i])=="--restart"){
+                if(i+1>=args){
+                    MessagePrinter::printErrorTxt("no checkpoint file found after '--restart', please check your command line args");
+                    MessagePrinter::exitAsFem();
+                }
+                m_restartfile_name=argv[i+1];
+                m_hasrestartfile=true;
+            }
         }
     }
 }
\ No newline at end of file
@@ -40,5 +40,43 @@ bool InputSystem::readDofsBlock(nlohmann::json &t_json,DofHandler &t_dofhandler)
         MessagePrinter::printErrorTxt("can\'t find 'names' in your 'dofs' block, please check your input file");
         MessagePrinter::exitAsFem();
     }
+
+    // the optional renumbering of the active dofs
+    if(t_json.contains("renumber")){
+        if(!t_json.at("renumber").is_string()){
+            MessagePrinter::printErrorTxt("invalid 'renumber' in your 'dofs' block, it should be a string, i.e., \"none\" or \"rcm\", please check your input file");
+            MessagePrinter::exitAsFem();
+        }
+        string method=t_json.at("renumber");
+        method=StringUtils::strToLowerCase(method);
+        if(method=="none"){
+            t_dofhandler.setDofsRenumberType(DofRenumberType::NONE);
+        }
+        else if(method=="rcm"){
+            t_dofhandler.setDofsRenumberType(DofRenumberType::RCM);
+        }
+        else{
+            MessagePrinter::printErrorTxt("unsupported 'renumber' method ("+method+") in your 'dofs' block, only \"none\" and \"rcm\" are available, please check your input file");
+            MessagePrinter::exitAsFem();
+        }
+    }
+    if(t_json.contains("ordering")){
+        if(!t_json.at("ordering").is_string()){
+            MessagePrinter::printErrorTxt("invalid 'ordering' in your 'dofs' block, it should be a string, i.e., \"interleaved\" or \"blocked\", please check your input file");
+            MessagePrinter::exitAsFem();
+        }
+        string ordering=t_json.at("ordering");
+        ordering=StringUtils::strToLowerCase(ordering);
+        if(ordering=="interleaved"){
+            t_dofhandler.setFieldBlockedDofsFlag(false);
+        }
+        else if(ordering=="blocked"){
+            t_dofhandler.setFieldBlockedDofsFlag(true);
+        }
+        else{
+            MessagePrinter::printErrorTxt("unsupported 'ordering' ("+ordering+") in your 'dofs' block, only \"interleaved\" and \"blocked\" are available, please check your input file");
+            MessagePrinter::exitAsFem();
+        }
+    }
     return true;
 }
\ No newline at end of file
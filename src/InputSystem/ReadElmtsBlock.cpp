@@ -386,6 +386,17 @@ bool InputSystem::readElmtsBlock(nlohmann::json &t_json,const Mesh &t_mesh,const
             elmtBlock.m_matetype=MateType::NULLMATE;
         } //end-of-'material'-reading
 
+        if(ejson.contains("linear")){
+            if(!ejson.at("linear").is_boolean()){
+                MessagePrinter::printErrorTxt("linear in ["+elmtBlock.m_elmt_blockname+"] of your [elmts] subblock is not a valid boolean, please check your input file");
+                MessagePrinter::exitAsFem();
+            }
+            elmtBlock.m_islinear=ejson.at("linear");
+        }
+        else{
+            elmtBlock.m_islinear=false;
+        }//end-of-'linear'-reading
+
         if(!HasType || !HasDofs){
             MessagePrinter::printErrorTxt("information in ["+elmtBlock.m_elmt_blockname
                                          +"] of your [elmts] subblock is not complete, please check your input file");
@@ -97,6 +97,8 @@ bool InputSystem::readInputFile(Mesh &t_mesh,DofHandler &t_dofhandler,
         // read the mesh block
         if(readMeshBlock(m_json.at("mesh"),t_mesh)){
             HasMeshBlock=true;
+            // the physical groups are resolved by their handles in the following blocks and the analysis
+            t_mesh.createPhyGroupHandles();
         }
         else{
             MessagePrinter::printErrorTxt("something is incorrect in your 'mesh' block, please check your input file");
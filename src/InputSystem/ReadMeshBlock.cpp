@@ -16,12 +16,65 @@
 #include "Mesh/MeshGenerator.h"
 #include "Mesh/MeshFileImporter.h"
 
+/**
+ * read the 'savemesh' option of the imported mesh, it can be true/false (for the vtu file), or
+ * "vtu", "cache", "vtu+cache", where the binary cache makes the later runs skip the mesh file parsing
+ */
+static bool readSaveMeshOption(const nlohmann::json &t_json,bool &IsSaveMesh,bool &IsCacheMesh){
+    IsSaveMesh=false;IsCacheMesh=false;
+    if(!t_json.contains("savemesh")) return true;
+    if(t_json.at("savemesh").is_boolean()){
+        IsSaveMesh=static_cast<bool>(t_json.at("savemesh"));
+        return true;
+    }
+    if(t_json.at("savemesh").is_string()){
+        string option=t_json.at("savemesh");
+        if(option=="vtu"){
+            IsSaveMesh=true;return true;
+        }
+        else if(option=="cache"){
+            IsCacheMesh=true;return true;
+        }
+        else if(option=="vtu+cache"){
+            IsSaveMesh=true;IsCacheMesh=true;return true;
+        }
+    }
+    MessagePrinter::printErrorTxt("invalid value for savemesh in your mesh block, it should be true/false or \"vtu\", \"cache\", \"vtu+cache\"");
+    return false;
+}
+
+/**
+ * read the 'reorder' option of the imported mesh, it can be "none", "hilbert" or "morton", then the bulk elements
+ * are sorted along the space-filling curve and the nodes are renumbered for the cache locality. The distributed mesh
+ * is reordered along the Hilbert curve by default, since its partition is the contiguous blocks of the element order
+ * (see BulkMesh::getBulkElmtsRange), and the file order may give the scattered subdomains with the large halos
+ */
+static bool readReorderOption(const nlohmann::json &t_json,const bool &IsDistributed,MeshReorderType &reordertype){
+    reordertype=IsDistributed?MeshReorderType::HILBERT:MeshReorderType::NONE;
+    if(!t_json.contains("reorder")) return true;
+    if(t_json.at("reorder").is_string()){
+        string option=t_json.at("reorder");
+        if(option=="none"){
+            reordertype=MeshReorderType::NONE;return true;
+        }
+        else if(option=="hilbert"){
+            reordertype=MeshReorderType::HILBERT;return true;
+        }
+        else if(option=="morton"){
+            reordertype=MeshReorderType::MORTON;return true;
+        }
+    }
+    MessagePrinter::printErrorTxt("invalid value for reorder in your mesh block, it should be \"none\", \"hilbert\" or \"morton\"");
+    return false;
+}
+
 bool InputSystem::readMeshBlock(nlohmann::json &t_json,Mesh &t_mesh){
     // the json already read 'mesh' !!!
     MeshType meshtype;
     int dim,nx,ny,nz;
     double xmin,xmax,ymin,ymax,zmin,zmax;
-    bool HasNx,HasNy,HasNz,HasMeshType,IsSaveMesh;
+    bool HasNx,HasNy,HasNz,HasMeshType,IsSaveMesh,IsCacheMesh;
+    MeshReorderType reordertype;
     string meshfile;
 
     nx=2;ny=2;nz=2;
@@ -30,7 +83,14 @@ bool InputSystem::readMeshBlock(nlohmann::json &t_json,Mesh &t_mesh){
     dim=-1;
     meshtype=MeshType::NULLTYPE;
     HasNx=false;HasNy=false;HasNz=false;
-    HasMeshType=false;IsSaveMesh=false;
+    HasMeshType=false;IsSaveMesh=false;IsCacheMesh=false;
+    if(t_json.contains("distributed")){
+        if(!t_json.at("distributed").is_boolean()){
+            MessagePrinter::printErrorTxt("invalid boolean value for distributed in your mesh block, it should be true/false");
+            return false;
+        }
+        t_mesh.setDistributedMeshFlag(static_cast<bool>(t_json.at("distributed")));
+    }
     if(t_json.contains("type")){
         if(!t_json.at("type").is_string()){
             MessagePrinter::printErrorTxt("the type name of your mesh block is not a valid string");
@@ -39,6 +99,13 @@ bool InputSystem::readMeshBlock(nlohmann::json &t_json,Mesh &t_mesh){
         string meshtypename=t_json.at("type");
         if(meshtypename.find("asfem")!=string::npos){
             // for AsFem's built-in type
+            if(t_json.contains("implicit")){
+                if(!t_json.at("implicit").is_boolean()){
+                    MessagePrinter::printErrorTxt("invalid boolean value for implicit in your mesh block, it should be true/false");
+                    return false;
+                }
+                t_mesh.setImplicitMeshFlag(static_cast<bool>(t_json.at("implicit")));
+            }
             if(t_json.contains("dim")){
                 if(!t_json.at("dim").is_number_integer()){
                     MessagePrinter::printErrorTxt("the dim number in your mesh block is not a valid integer");
@@ -464,16 +531,28 @@ bool InputSystem::readMeshBlock(nlohmann::json &t_json,Mesh &t_mesh){
                 return false;
             }
 
-            if(t_json.contains("savemesh")){
-                if(!t_json.at("savemesh").is_boolean()){
-                    MessagePrinter::printErrorTxt("invalid boolean value for savemesh in your mesh block, it should be true/false");
-                    return false;
+            if(!readSaveMeshOption(t_json,IsSaveMesh,IsCacheMesh)){
+                return false;
+            }
+            if(!readReorderOption(t_json,t_mesh.isDistributedMeshRequired(),reordertype)){
+                return false;
+            }
+            if(IsCacheMesh&&t_mesh.loadBulkMeshFromCache(meshfile)){
+                t_mesh.reorderBulkMesh(reordertype);
+                if(IsSaveMesh){
+                    t_mesh.saveBulkMesh2VTU(m_inputfile_name);
+                    MessagePrinter::printNormalTxt("save mesh to "+m_inputfile_name.substr(0,m_inputfile_name.size()-5)+"-mesh.vtu");
                 }
-                IsSaveMesh=static_cast<bool>(t_json.at("savemesh"));
+                return true;
             }
             MeshFileImporter importer;
 
             if(importer.importMsh2Mesh(meshfile,t_mesh.getBulkMeshMeshDataRef())){
+                if(IsCacheMesh){
+                    t_mesh.saveBulkMesh2Cache(meshfile);
+                }
+                // the cache keeps the original order, then it doesn't depend on the reorder option
+                t_mesh.reorderBulkMesh(reordertype);
                 if(IsSaveMesh){
                     t_mesh.saveBulkMesh2VTU(m_inputfile_name);
                     MessagePrinter::printNormalTxt("save mesh to "+m_inputfile_name.substr(0,m_inputfile_name.size()-5)+"-mesh.vtu");
@@ -500,16 +579,32 @@ bool InputSystem::readMeshBlock(nlohmann::json &t_json,Mesh &t_mesh){
                 return false;
             }
 
-            if(t_json.contains("savemesh")){
-                if(!t_json.at("savemesh").is_boolean()){
-                    MessagePrinter::printErrorTxt("invalid boolean value for savemesh in your mesh block, it should be true/false");
-                    return false;
+            if(!readSaveMeshOption(t_json,IsSaveMesh,IsCacheMesh)){
+                return false;
+            }
+            if(!readReorderOption(t_json,t_mesh.isDistributedMeshRequired(),reordertype)){
+                return false;
+            }
+            if(IsCacheMesh&&t_mesh.loadBulkMeshFromCache(meshfile)){
+                t_mesh.reorderBulkMesh(reordertype);
+                if(IsSaveMesh){
+                    t_mesh.saveBulkMesh2VTU(m_inputfile_name);
+                    MessagePrinter::printNormalTxt("save mesh to "+m_inputfile_name.substr(0,m_inputfile_name.size()-5)+"-mesh.vtu");
                 }
-                IsSaveMesh=static_cast<bool>(t_json.at("savemesh"));
+                return true;
             }
+            // the whole mesh is only required by the cache, the reordering and the mesh output, otherwise
+            // each rank only keeps its own partition during the import, i.e. "reorder":"none" keeps the file order
+            t_mesh.setDistributeOnImportFlag(t_mesh.isDistributedMeshRequired()&&!IsCacheMesh&&!IsSaveMesh
+                                             &&reordertype==MeshReorderType::NONE);
             MeshFileImporter importer;
 
             if(importer.importMsh4Mesh(meshfile,t_mesh.getBulkMeshMeshDataRef())){
+                if(IsCacheMesh){
+                    t_mesh.saveBulkMesh2Cache(meshfile);
+                }
+                // the cache keeps the original order, then it doesn't depend on the reorder option
+                t_mesh.reorderBulkMesh(reordertype);
                 if(IsSaveMesh){
                     t_mesh.saveBulkMesh2VTU(m_inputfile_name);
                     MessagePrinter::printNormalTxt("save mesh to "+m_inputfile_name.substr(0,m_inputfile_name.size()-5)+"-mesh.vtu");
@@ -540,16 +635,28 @@ bool InputSystem::readMeshBlock(nlohmann::json &t_json,Mesh &t_mesh){
                 return false;
             }
 
-            if(t_json.contains("savemesh")){
-                if(!t_json.at("savemesh").is_boolean()){
-                    MessagePrinter::printErrorTxt("invalid boolean value for savemesh in your mesh block, it should be true/false");
-                    return false;
+            if(!readSaveMeshOption(t_json,IsSaveMesh,IsCacheMesh)){
+                return false;
+            }
+            if(!readReorderOption(t_json,t_mesh.isDistributedMeshRequired(),reordertype)){
+                return false;
+            }
+            if(IsCacheMesh&&t_mesh.loadBulkMeshFromCache(meshfile)){
+                t_mesh.reorderBulkMesh(reordertype);
+                if(IsSaveMesh){
+                    t_mesh.saveBulkMesh2VTU(m_inputfile_name);
+                    MessagePrinter::printNormalTxt("save mesh to "+m_inputfile_name.substr(0,m_inputfile_name.size()-5)+"-mesh.vtu");
                 }
-                IsSaveMesh=static_cast<bool>(t_json.at("savemesh"));
+                return true;
             }
             MeshFileImporter importer;
 
             if(importer.importGmsh2Mesh(meshfile,t_mesh.getBulkMeshMeshDataRef())){
+                if(IsCacheMesh){
+                    t_mesh.saveBulkMesh2Cache(meshfile);
+                }
+                // the cache keeps the original order, then it doesn't depend on the reorder option
+                t_mesh.reorderBulkMesh(reordertype);
                 if(IsSaveMesh){
                     t_mesh.saveBulkMesh2VTU(m_inputfile_name);
                     MessagePrinter::printNormalTxt("save mesh to "+m_inputfile_name.substr(0,m_inputfile_name.size()-5)+"-mesh.vtu");
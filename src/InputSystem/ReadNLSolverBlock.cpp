@@ -51,6 +51,14 @@ bool InputSystem::readNLSolverBlock(nlohmann::json &t_json,NonlinearSolver &t_nl
             t_nlsolver.m_nlsolverblock.m_nlsolvertypename="richardson";
             t_nlsolver.m_nlsolverblock.m_nlsolvertype=NonlinearSolverType::RICHARDSON;
         }
+        else if(solvertypename=="staggered"){
+            t_nlsolver.m_nlsolverblock.m_nlsolvertypename="staggered";
+            t_nlsolver.m_nlsolverblock.m_nlsolvertype=NonlinearSolverType::STAGGERED;
+        }
+        else if(solvertypename=="vi-newton"){
+            t_nlsolver.m_nlsolverblock.m_nlsolvertypename="vi newton with reduced space line search";
+            t_nlsolver.m_nlsolverblock.m_nlsolvertype=NonlinearSolverType::VINEWTONRSLS;
+        }
         else if(solvertypename.find("bfgs")!=string::npos){
             t_nlsolver.m_nlsolverblock.m_nlsolvertypename="BFGS";
             t_nlsolver.m_nlsolverblock.m_nlsolvertype=NonlinearSolverType::BFGS;
@@ -170,6 +178,187 @@ bool InputSystem::readNLSolverBlock(nlohmann::json &t_json,NonlinearSolver &t_nl
     else{
         t_nlsolver.m_nlsolverblock.m_pctypename="lu";
     }
+    //**********************************************
+    if(t_json.contains("inexact-newton")){
+        if(!t_json.at("inexact-newton").is_boolean()){
+            MessagePrinter::printErrorTxt("the inexact-newton in your nlsolver block is not a valid boolean,"
+                                          "please check your input file");
+            return false;
+        }
+        t_nlsolver.m_nlsolverblock.m_useinexactnewton=t_json.at("inexact-newton");
+    }
+    else{
+        t_nlsolver.m_nlsolverblock.m_useinexactnewton=false;
+    }
+    //**********************************************
+    if(t_json.contains("ksp-restart")){
+        if(!t_json.at("ksp-restart").is_number_integer()){
+            MessagePrinter::printErrorTxt("the ksp-restart in your nlsolver block is not a valid integer,"
+                                          "please check your input file");
+            return false;
+        }
+        t_nlsolver.m_nlsolverblock.m_ksp_restart=t_json.at("ksp-restart");
+        if(t_nlsolver.m_nlsolverblock.m_ksp_restart<1){
+            MessagePrinter::printErrorTxt("ksp-restart="+to_string(t_nlsolver.m_nlsolverblock.m_ksp_restart)+" is invalid, it must be larger than 0,"
+                                          "please check your input file");
+            return false;
+        }
+    }
+    else{
+        t_nlsolver.m_nlsolverblock.m_ksp_restart=30;
+    }
+    //**********************************************
+    if(t_json.contains("ksp-maxiters")){
+        if(!t_json.at("ksp-maxiters").is_number_integer()){
+            MessagePrinter::printErrorTxt("the ksp-maxiters in your nlsolver block is not a valid integer,"
+                                          "please check your input file");
+            return false;
+        }
+        t_nlsolver.m_nlsolverblock.m_ksp_maxiters=t_json.at("ksp-maxiters");
+        if(t_nlsolver.m_nlsolverblock.m_ksp_maxiters<1){
+            MessagePrinter::printErrorTxt("ksp-maxiters="+to_string(t_nlsolver.m_nlsolverblock.m_ksp_maxiters)+" is invalid, it must be larger than 0,"
+                                          "please check your input file");
+            return false;
+        }
+    }
+    else{
+        t_nlsolver.m_nlsolverblock.m_ksp_maxiters=10000;
+    }
+    //**********************************************
+    if(t_json.contains("stagger-dofs")){
+        if(!t_json.at("stagger-dofs").is_array()||t_json.at("stagger-dofs").size()<1){
+            MessagePrinter::printErrorTxt("the stagger-dofs in your nlsolver block is not a valid string array,"
+                                          "please check your input file");
+            return false;
+        }
+        t_nlsolver.m_nlsolverblock.m_stagger_dofnames.clear();
+        for(int i=0;i<static_cast<int>(t_json.at("stagger-dofs").size());i++){
+            if(!t_json.at("stagger-dofs").at(i).is_string()){
+                MessagePrinter::printErrorTxt("dof-"+to_string(i+1)+" of stagger-dofs in your nlsolver block is not a valid string,"
+                                              "please check your input file");
+                return false;
+            }
+            t_nlsolver.m_nlsolverblock.m_stagger_dofnames.push_back(t_json.at("stagger-dofs").at(i));
+        }
+    }
+    else{
+        t_nlsolver.m_nlsolverblock.m_stagger_dofnames.clear();
+        if(t_nlsolver.m_nlsolverblock.m_nlsolvertype==NonlinearSolverType::STAGGERED){
+            MessagePrinter::printErrorTxt("can\'t find 'stagger-dofs' in your nlsolver block, it is required by the staggered solver,"
+                                          "please check your input file");
+            return false;
+        }
+    }
+    //**********************************************
+    if(t_json.contains("stagger-maxiters")){
+        if(!t_json.at("stagger-maxiters").is_number_integer()){
+            MessagePrinter::printErrorTxt("the stagger-maxiters in your nlsolver block is not a valid integer,"
+                                          "please check your input file");
+            return false;
+        }
+        t_nlsolver.m_nlsolverblock.m_stagger_maxiters=t_json.at("stagger-maxiters");
+        if(t_nlsolver.m_nlsolverblock.m_stagger_maxiters<1){
+            MessagePrinter::printErrorTxt("stagger-maxiters="+to_string(t_nlsolver.m_nlsolverblock.m_stagger_maxiters)+" is invalid, it must be larger than 0,"
+                                          "please check your input file");
+            return false;
+        }
+    }
+    else{
+        t_nlsolver.m_nlsolverblock.m_stagger_maxiters=100;
+    }
+    //**********************************************
+    if(t_json.contains("stagger-abs-tolerance")){
+        if(!t_json.at("stagger-abs-tolerance").is_number_float()){
+            MessagePrinter::printErrorTxt("the stagger-abs-tolerance in your nlsolver block is not a valid float,"
+                                          "please check your input file");
+            return false;
+        }
+        t_nlsolver.m_nlsolverblock.m_stagger_abstol=t_json.at("stagger-abs-tolerance");
+    }
+    else{
+        t_nlsolver.m_nlsolverblock.m_stagger_abstol=1.0e-6;
+    }
+    //**********************************************
+    if(t_json.contains("stagger-rel-tolerance")){
+        if(!t_json.at("stagger-rel-tolerance").is_number_float()){
+            MessagePrinter::printErrorTxt("the stagger-rel-tolerance in your nlsolver block is not a valid float,"
+                                          "please check your input file");
+            return false;
+        }
+        t_nlsolver.m_nlsolverblock.m_stagger_reltol=t_json.at("stagger-rel-tolerance");
+    }
+    else{
+        t_nlsolver.m_nlsolverblock.m_stagger_reltol=1.0e-5;
+    }
+    //**********************************************
+    const string linearnames[2]={"stagger-linear-first","stagger-linear-second"};
+    for(int k=0;k<2;k++){
+        if(t_json.contains(linearnames[k])){
+            if(!t_json.at(linearnames[k]).is_boolean()){
+                MessagePrinter::printErrorTxt("the "+linearnames[k]+" in your nlsolver block is not a valid boolean,"
+                                              "please check your input file");
+                return false;
+            }
+            t_nlsolver.m_nlsolverblock.m_stagger_linear[k]=t_json.at(linearnames[k]);
+        }
+        else{
+            t_nlsolver.m_nlsolverblock.m_stagger_linear[k]=false;
+        }
+    }
+    //**********************************************
+    if(t_json.contains("mg-levels")){
+        if(!t_json.at("mg-levels").is_number_integer()){
+            MessagePrinter::printErrorTxt("the mg-levels in your nlsolver block is not a valid integer,"
+                                          "please check your input file");
+            return false;
+        }
+        t_nlsolver.m_nlsolverblock.m_mg_levels=t_json.at("mg-levels");
+        if(t_nlsolver.m_nlsolverblock.m_mg_levels<1){
+            MessagePrinter::printErrorTxt("mg-levels="+to_string(t_nlsolver.m_nlsolverblock.m_mg_levels)+" is invalid, it must be larger than 0,"
+                                          "please check your input file");
+            return false;
+        }
+    }
+    else{
+        t_nlsolver.m_nlsolverblock.m_mg_levels=3;
+    }
+    //**********************************************
+    if(t_json.contains("vi-dofs")){
+        if(!t_json.at("vi-dofs").is_array()||t_json.at("vi-dofs").size()<1){
+            MessagePrinter::printErrorTxt("the vi-dofs in your nlsolver block is not a valid string array,"
+                                          "please check your input file");
+            return false;
+        }
+        t_nlsolver.m_nlsolverblock.m_vi_dofnames.clear();
+        for(int i=0;i<static_cast<int>(t_json.at("vi-dofs").size());i++){
+            if(!t_json.at("vi-dofs").at(i).is_string()){
+                MessagePrinter::printErrorTxt("dof-"+to_string(i+1)+" of vi-dofs in your nlsolver block is not a valid string,"
+                                              "please check your input file");
+                return false;
+            }
+            t_nlsolver.m_nlsolverblock.m_vi_dofnames.push_back(t_json.at("vi-dofs").at(i));
+        }
+    }
+    else{
+        t_nlsolver.m_nlsolverblock.m_vi_dofnames.clear();
+        if(t_nlsolver.m_nlsolverblock.m_nlsolvertype==NonlinearSolverType::VINEWTONRSLS){
+            MessagePrinter::printErrorTxt("can\'t find 'vi-dofs' in your nlsolver block, it is required by the vi-newton solver,"
+                                          "please check your input file");
+            return false;
+        }
+    }
+    //**********************************************
+    if(t_json.contains("vi-upper-bound")){
+        if(!t_json.at("vi-upper-bound").is_number()){
+            MessagePrinter::printErrorTxt("the vi-upper-bound in your nlsolver block is not a valid float,"
+                                          "please check your input file");
+            return false;
+        }
+        t_nlsolver.m_nlsolverblock.m_vi_upperbound=t_json.at("vi-upper-bound");
+    }
+    else{
+        t_nlsolver.m_nlsolverblock.m_vi_upperbound=1.0e20;
+    }
 
 
 
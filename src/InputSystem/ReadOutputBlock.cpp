@@ -65,5 +65,21 @@ bool InputSystem::readOutputBlock(nlohmann::json &t_json,OutputSystem &t_output)
         t_output.setIntervalNum(1);
     }
 
+    if(t_json.contains("checkpoint-interval")){
+        if(!t_json.at("checkpoint-interval").is_number_integer()){
+            MessagePrinter::printErrorTxt("the checkpoint-interval value is not valid, please check your output block");
+            return false;
+        }
+        int step=t_json.at("checkpoint-interval");
+        if(step<0){
+            MessagePrinter::printErrorTxt("checkpoint-interval="+to_string(step)+" is invalid, please check your output block");
+            return false;
+        }
+        t_output.setCheckpointIntervalNum(step);
+    }
+    else{
+        t_output.setCheckpointIntervalNum(0);
+    }
+
     return HasType;
 }
\ No newline at end of file
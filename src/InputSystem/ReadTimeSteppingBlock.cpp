@@ -42,6 +42,26 @@ bool InputSystem::readTimeSteppingBlock(nlohmann::json &t_json,TimeStepping &t_t
                 solvertypename=="BDF2"){
             t_timestepping.setTimeSteppingMethod(TimeSteppingType::BDF2);
         }
+        else if(solvertypename=="bdf"||
+                solvertypename=="BDF"){
+            t_timestepping.setTimeSteppingMethod(TimeSteppingType::BDF);
+        }
+        else if(solvertypename=="ssp-rk3"||
+                solvertypename=="SSP-RK3"){
+            t_timestepping.setTimeSteppingMethod(TimeSteppingType::SSPRK3);
+        }
+        else if(solvertypename=="imex-sbdf1"||
+                solvertypename=="IMEX-SBDF1"){
+            t_timestepping.setTimeSteppingMethod(TimeSteppingType::IMEXSBDF1);
+        }
+        else if(solvertypename=="imex-sbdf2"||
+                solvertypename=="IMEX-SBDF2"){
+            t_timestepping.setTimeSteppingMethod(TimeSteppingType::IMEXSBDF2);
+        }
+        else if(solvertypename=="central-difference"||
+                solvertypename=="CENTRAL-DIFFERENCE"){
+            t_timestepping.setTimeSteppingMethod(TimeSteppingType::CENTRALDIFFERENCE);
+        }
         else{
             MessagePrinter::printErrorTxt("type="+solvertypename+" is invalid in [timestepping] block, please check your input file");
             MessagePrinter::exitAsFem();
@@ -54,6 +74,59 @@ bool InputSystem::readTimeSteppingBlock(nlohmann::json &t_json,TimeStepping &t_t
         HasType=true;
     }
 
+    if(t_json.contains("bdf-max-order")){
+        if(!t_json.at("bdf-max-order").is_number_integer()){
+            MessagePrinter::printErrorTxt("the bdf-max-order of your timestepping block is not a valid integer");
+            return false;
+        }
+        int order=t_json.at("bdf-max-order");
+        if(order<1||order>5){
+            MessagePrinter::printErrorTxt("the bdf-max-order of your timestepping block should be in [1,5]");
+            return false;
+        }
+        t_timestepping.setBDFMaxOrder(order);
+    }
+    else{
+        t_timestepping.setBDFMaxOrder(5);
+    }
+
+    if(t_json.contains("cfl")){
+        if(!t_json.at("cfl").is_number()){
+            MessagePrinter::printErrorTxt("the cfl of your timestepping block is not a valid float");
+            return false;
+        }
+        double cfl=t_json.at("cfl");
+        if(cfl<=0.0||cfl>1.0){
+            MessagePrinter::printErrorTxt("the cfl of your timestepping block should be in (0,1]");
+            return false;
+        }
+        t_timestepping.setCFLFactor(cfl);
+    }
+    else{
+        t_timestepping.setCFLFactor(0.9);
+    }
+
+    if(t_json.contains("mass-lumping")){
+        if(!t_json.at("mass-lumping").is_string()){
+            MessagePrinter::printErrorTxt("the mass-lumping of your timestepping block is not a valid string");
+            return false;
+        }
+        string lumpingname=t_json.at("mass-lumping");
+        if(lumpingname=="row-sum"){
+            t_timestepping.setHRZLumpingFlag(false);
+        }
+        else if(lumpingname=="hrz"||lumpingname=="HRZ"){
+            t_timestepping.setHRZLumpingFlag(true);
+        }
+        else{
+            MessagePrinter::printErrorTxt("mass-lumping="+lumpingname+" is invalid in [timestepping] block, only row-sum and hrz are supported");
+            return false;
+        }
+    }
+    else{
+        t_timestepping.setHRZLumpingFlag(false);
+    }
+
     if(t_json.contains("adaptive")){
         if(!t_json.at("adaptive").is_boolean()){
             MessagePrinter::printErrorTxt("the adaptive option of your timestepping block is not a valid boolean");
@@ -67,6 +140,75 @@ bool InputSystem::readTimeSteppingBlock(nlohmann::json &t_json,TimeStepping &t_t
         t_timestepping.setAdaptiveFlag(false);
     }
 
+    if(t_json.contains("adaptive-type")){
+        if(!t_json.at("adaptive-type").is_string()){
+            MessagePrinter::printErrorTxt("the adaptive-type of your timestepping block is not a valid string");
+            return false;
+        }
+        string adaptivetype=t_json.at("adaptive-type");
+        if(adaptivetype=="iteration"){
+            t_timestepping.setErrorControlFlag(false);
+        }
+        else if(adaptivetype=="error"){
+            t_timestepping.setErrorControlFlag(true);
+        }
+        else{
+            MessagePrinter::printErrorTxt("adaptive-type="+adaptivetype+" is invalid in [timestepping] block, only iteration and error are supported");
+            return false;
+        }
+    }
+    else{
+        t_timestepping.setErrorControlFlag(false);
+    }
+
+    if(t_json.contains("error-abs-tolerance")){
+        if(!t_json.at("error-abs-tolerance").is_number()){
+            MessagePrinter::printErrorTxt("the error-abs-tolerance of your timestepping block is not a valid float");
+            return false;
+        }
+        double tol=t_json.at("error-abs-tolerance");
+        if(tol<1.0e-16){
+            MessagePrinter::printErrorTxt("the error-abs-tolerance of your timestepping block is too small or negative");
+            return false;
+        }
+        t_timestepping.setErrorAbsTolerance(tol);
+    }
+    else{
+        t_timestepping.setErrorAbsTolerance(1.0e-4);
+    }
+
+    if(t_json.contains("error-rel-tolerance")){
+        if(!t_json.at("error-rel-tolerance").is_number()){
+            MessagePrinter::printErrorTxt("the error-rel-tolerance of your timestepping block is not a valid float");
+            return false;
+        }
+        double tol=t_json.at("error-rel-tolerance");
+        if(tol<0.0){
+            MessagePrinter::printErrorTxt("the error-rel-tolerance of your timestepping block can\'t be negative");
+            return false;
+        }
+        t_timestepping.setErrorRelTolerance(tol);
+    }
+    else{
+        t_timestepping.setErrorRelTolerance(1.0e-3);
+    }
+
+    if(t_json.contains("safety-factor")){
+        if(!t_json.at("safety-factor").is_number()){
+            MessagePrinter::printErrorTxt("the safety-factor of your timestepping block is not a valid float");
+            return false;
+        }
+        double factor=t_json.at("safety-factor");
+        if(factor<=0.0||factor>1.0){
+            MessagePrinter::printErrorTxt("the safety-factor of your timestepping block should be in (0,1]");
+            return false;
+        }
+        t_timestepping.setSafetyFactor(factor);
+    }
+    else{
+        t_timestepping.setSafetyFactor(0.9);
+    }
+
     if(t_json.contains("optimize-iters")){
         if(!t_json.at("optimize-iters").is_number()){
             MessagePrinter::printErrorTxt("the optimize iterations of your timestepping block is not a valid number");
@@ -86,6 +228,30 @@ bool InputSystem::readTimeSteppingBlock(nlohmann::json &t_json,TimeStepping &t_t
         }
     }
 
+    if(t_json.contains("predictor")){
+        if(!t_json.at("predictor").is_string()){
+            MessagePrinter::printErrorTxt("the predictor of your timestepping block is not a valid string");
+            return false;
+        }
+        string predictorname=t_json.at("predictor");
+        if(predictorname=="none"){
+            t_timestepping.setPredictorOrder(0);
+        }
+        else if(predictorname=="linear"){
+            t_timestepping.setPredictorOrder(1);
+        }
+        else if(predictorname=="quadratic"){
+            t_timestepping.setPredictorOrder(2);
+        }
+        else{
+            MessagePrinter::printErrorTxt("predictor="+predictorname+" is invalid in [timestepping] block, only none, linear and quadratic are supported");
+            return false;
+        }
+    }
+    else{
+        t_timestepping.setPredictorOrder(0);
+    }
+
     if(t_json.contains("dt0")){
         if(!t_json.at("dt0").is_number()){
             MessagePrinter::printErrorTxt("the dt0 in your timestepping block is not a valid float,"
@@ -13,8 +13,8 @@
 //+++          element. In this code, we can define:
 //+++           1) Sigma
 //+++           2) dSigma/du(=0)
-//+++           3) F
-//+++           4) dF/du(=0)
+//+++           3) F(=f+dfdt*t+dfdu*u)
+//+++           4) dF/du(=dfdu)
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "MateSystem/ConstPoissonMaterial.h"
@@ -49,6 +49,14 @@ void ConstPoissonMaterial::computeMaterialProperties(const nlohmann::json &input
     mate.ScalarMaterial("dsigmadu")=0.0;// dsigma/dphi
     mate.ScalarMaterial("f")=JsonUtils::getValue(inputparams,"f");// F
     mate.ScalarMaterial("dfdu")=0.0;// dF/dphi
+    // the optional linear dependence on time and phi, the transient tests use it for the known solutions
+    if(JsonUtils::hasValue(inputparams,"dfdt")){
+        mate.ScalarMaterial("f")+=JsonUtils::getValue(inputparams,"dfdt")*elmtinfo.m_t;
+    }
+    if(JsonUtils::hasValue(inputparams,"dfdu")){
+        mate.ScalarMaterial("dfdu")=JsonUtils::getValue(inputparams,"dfdu");
+        mate.ScalarMaterial("f")+=mate.ScalarMaterial("dfdu")*elmtsoln.m_gpU[1];
+    }
     mate.VectorMaterial("gradu")=elmtsoln.m_gpGradU[1];// the gradient of u
 
 }
\ No newline at end of file
@@ -57,6 +57,8 @@ void LinearElasticMaterial::computeMaterialProperties(const nlohmann::json &inpu
     mate.ScalarMaterial("vonMises-strain")=sqrt(1.5*m_devStrain.doubledot(m_devStrain));
     mate.ScalarMaterial("hydrostatic-stress")=m_stress.trace()/3.0;
 
+    computeDensityAndWaveSpeed(inputparams,m_jacobian,mate);
+
     mate.VectorMaterial("gradux")=elmtsoln.m_gpGradU[1];
     if(elmtinfo.m_dim>=2){
         mate.VectorMaterial("graduy")=elmtsoln.m_gpGradU[2];
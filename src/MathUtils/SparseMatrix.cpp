@@ -62,6 +62,7 @@ SparseMatrix& SparseMatrix::operator=(const double &a){
     MatCopy(temp,m_matrix,SAME_NONZERO_PATTERN);
     MatDestroy(&temp);
 
+    m_assemblycount+=1;
     return *this;
 }
 SparseMatrix& SparseMatrix::operator=(const SparseMatrix &a){
@@ -79,6 +80,7 @@ SparseMatrix& SparseMatrix::operator=(const SparseMatrix &a){
         }
         MatCopy(a.m_matrix,m_matrix,SAME_NONZERO_PATTERN);
     }
+    m_assemblycount+=1;
     return *this;
 }
 //*****************************
@@ -133,6 +135,7 @@ SparseMatrix& SparseMatrix::operator+=(const double &a){
     MatAssemblyEnd(temp,MAT_FINAL_ASSEMBLY);
     MatCopy(temp,m_matrix,SAME_NONZERO_PATTERN);
     MatDestroy(&temp);
+    m_assemblycount+=1;
     return *this;
 }
 SparseMatrix& SparseMatrix::operator+=(const SparseMatrix &a){
@@ -142,6 +145,7 @@ SparseMatrix& SparseMatrix::operator+=(const SparseMatrix &a){
     }
     //Computes Y = a*X + Y.
     MatAXPY(m_matrix,1.0,a.m_matrix,SAME_NONZERO_PATTERN);
+    m_assemblycount+=1;
     return *this;
 }
 //*****************************
@@ -206,6 +210,7 @@ SparseMatrix& SparseMatrix::operator-=(const double &a){
     MatAssemblyEnd(temp,MAT_FINAL_ASSEMBLY);
     MatCopy(temp,m_matrix,SAME_NONZERO_PATTERN);
     MatDestroy(&temp);
+    m_assemblycount+=1;
     return *this;
 }
 SparseMatrix& SparseMatrix::operator-=(const SparseMatrix &a){
@@ -215,6 +220,7 @@ SparseMatrix& SparseMatrix::operator-=(const SparseMatrix &a){
     }
     //Computes Y = a*X + Y.
     MatAXPY(m_matrix,-1.0,a.m_matrix,SAME_NONZERO_PATTERN);
+    m_assemblycount+=1;
     return *this;
 }
 //*****************************
@@ -231,6 +237,7 @@ SparseMatrix SparseMatrix::operator*(const double &a)const{
 }
 SparseMatrix& SparseMatrix::operator*=(const double &a){
     MatScale(m_matrix,a);
+    m_assemblycount+=1;
     return *this;
 }
 //*****************************
@@ -255,6 +262,7 @@ SparseMatrix& SparseMatrix::operator/=(const double &a){
         MessagePrinter::exitAsFem();
     }
     MatScale(m_matrix,1.0/a);
+    m_assemblycount+=1;
     return *this;
 }
 //**************************************************
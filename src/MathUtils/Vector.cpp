@@ -49,6 +49,8 @@ Vector::Vector(const Vector &a){
     m_size=a.getSize();
     m_allocated=true;
     m_ghostallocated=false;
+    m_localghost=a.m_localghost;
+    m_ghostids=a.m_ghostids;
 }
 //**************************************************
 void Vector::setup(){
@@ -62,6 +64,7 @@ void Vector::setup(){
     assemble();
     m_allocated=true;
     m_ghostallocated=false;
+    m_localghost=false;
 }
 void Vector::resize(const int &n){
     m_size=n;
@@ -74,19 +77,21 @@ void Vector::resize(const int &n){
     assemble();
     m_allocated=true;
     m_ghostallocated=false;
+    m_localghost=false;
 }
-void Vector::resize(const int &n,const double &val){
+void Vector::resize(const int &n,const double &val,const int &nlocal){
     m_size=n;
     if(m_allocated) VecDestroy(&m_vector);
     
     VecCreate(PETSC_COMM_WORLD,&m_vector);
-    VecSetSizes(m_vector,PETSC_DECIDE,m_size);
+    VecSetSizes(m_vector,nlocal,m_size);
     VecSetFromOptions(m_vector);
     VecSet(m_vector,val);
     assemble();
     m_allocated=true;
     
     m_ghostallocated=false;
+    m_localghost=false;
 }
 //**************************************************
 void Vector::makeGhostCopy(){
@@ -95,7 +100,25 @@ void Vector::makeGhostCopy(){
         VecScatterDestroy(&m_scatter);
         m_ghostallocated=false;
     }
-    if(m_size){
+    if(m_size&&m_localghost){
+        // only the owned entries and the needed ghost ones are copied, the owned ones come first
+        PetscInt iStart,iEnd;
+        VecGetOwnershipRange(m_vector,&iStart,&iEnd);
+        m_ghost_start=static_cast<int>(iStart);
+        m_ghost_owned=static_cast<int>(iEnd-iStart);
+        vector<PetscInt> ids(m_ghost_owned+m_ghostids.size());
+        for(int i=0;i<m_ghost_owned;i++) ids[i]=iStart+i;
+        for(int i=0;i<static_cast<int>(m_ghostids.size());i++) ids[m_ghost_owned+i]=m_ghostids[i]-1;
+        IS isfrom;
+        ISCreateGeneral(PETSC_COMM_SELF,static_cast<PetscInt>(ids.size()),ids.data(),PETSC_COPY_VALUES,&isfrom);
+        VecCreateSeq(PETSC_COMM_SELF,static_cast<PetscInt>(ids.size()),&m_vector_ghost);
+        VecScatterCreate(m_vector,isfrom,m_vector_ghost,NULL,&m_scatter);
+        ISDestroy(&isfrom);
+        VecScatterBegin(m_scatter,m_vector,m_vector_ghost,INSERT_VALUES,SCATTER_FORWARD);
+        VecScatterEnd(m_scatter,m_vector,m_vector_ghost,INSERT_VALUES,SCATTER_FORWARD);
+        m_ghostallocated=true;
+    }
+    else if(m_size){
         VecScatterCreateToAll(m_vector,&m_scatter,&m_vector_ghost);
         VecScatterBegin(m_scatter,m_vector,m_vector_ghost,INSERT_VALUES,SCATTER_FORWARD);
         VecScatterEnd(m_scatter,m_vector,m_vector_ghost,INSERT_VALUES,SCATTER_FORWARD);
@@ -105,6 +128,10 @@ void Vector::makeGhostCopy(){
         m_ghostallocated=false;
     }
 }
+void Vector::setGhostIDs(const vector<int> &t_ghostids){
+    m_ghostids=t_ghostids;
+    m_localghost=true;
+}
 void Vector::destroyGhostCopy(){
     if(m_ghostallocated){
         VecDestroy(&m_vector_ghost);
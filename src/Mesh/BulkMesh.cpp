@@ -23,6 +23,7 @@ void BulkMesh::releaseMemory(){
     m_meshdata.m_nodecoords0.clear();
     m_meshdata.m_nodecoords.clear();
     m_meshdata.m_bulkelmt_connectivity.clear();
+    m_meshdata.m_bulkelmt_localconnectivity.clear();
     m_meshdata.m_bulkelmt_volume.clear();
     m_meshdata.m_pointelmt_connectivity.clear();
     m_meshdata.m_pointelmt_volume.clear();
@@ -36,16 +37,52 @@ void BulkMesh::releaseMemory(){
     m_meshdata.m_phygroup_phyidvec.clear();
     m_meshdata.m_phygroup_elmtnumvec.clear();
     m_meshdata.m_phygroup_nodesnumperelmtvec.clear();
-    m_meshdata.m_phygroup_name2elmtconnvec.clear();
+    m_meshdata.m_phygroup_name2elmtidvec.clear();
     m_meshdata.m_phygroup_name2bulkelmtidvec.clear();
     m_meshdata.m_phygroup_name2dimvec.clear();
     m_meshdata.m_phygroup_name2phyidvec.clear();
     m_meshdata.m_phygroup_phyid2namevec.clear();
+    m_meshdata.m_phygroup_name2handle.clear();
+    m_meshdata.m_phygroup_handle2dimvec.clear();
+    m_meshdata.m_phygroup_handle2bulkgroupvec.clear();
 
     m_meshdata.m_nodephygroup_name2nodeidvec.clear();
     m_meshdata.m_nodephygroup_name2phyidvec.clear();
     m_meshdata.m_nodephygroup_phyid2namevec.clear();
     m_meshdata.m_nodephygroup_phynamevec.clear();
     m_meshdata.m_nodephygroup_phyidvec.clear();
+    m_meshdata.m_nodephygroup_name2handle.clear();
 
-}
\ No newline at end of file
+}
+
+void BulkMesh::createPhyGroupHandles(){
+    int i;
+    m_meshdata.m_phygroup_name2handle.clear();
+    m_meshdata.m_phygroup_name2handle.reserve(m_meshdata.m_phygroup_name2elmtidvec.size());
+    for(i=0;i<static_cast<int>(m_meshdata.m_phygroup_name2elmtidvec.size());i++){
+        // the 1st one wins for the duplicated names, which is the same as the linear search
+        m_meshdata.m_phygroup_name2handle.emplace(m_meshdata.m_phygroup_name2elmtidvec[i].first,i+1);
+    }
+
+    m_meshdata.m_phygroup_handle2dimvec.assign(m_meshdata.m_phygroup_name2elmtidvec.size(),-1);
+    for(const auto &it:m_meshdata.m_phygroup_name2dimvec){
+        auto hit=m_meshdata.m_phygroup_name2handle.find(it.first);
+        if(hit==m_meshdata.m_phygroup_name2handle.end()) continue;
+        if(m_meshdata.m_phygroup_handle2dimvec[hit->second-1]<0){
+            m_meshdata.m_phygroup_handle2dimvec[hit->second-1]=it.second;
+        }
+    }
+
+    m_meshdata.m_phygroup_handle2bulkgroupvec.assign(m_meshdata.m_phygroup_name2elmtidvec.size(),0);
+    for(i=static_cast<int>(m_meshdata.m_phygroup_name2bulkelmtidvec.size())-1;i>=0;i--){
+        auto hit=m_meshdata.m_phygroup_name2handle.find(m_meshdata.m_phygroup_name2bulkelmtidvec[i].first);
+        if(hit==m_meshdata.m_phygroup_name2handle.end()) continue;
+        m_meshdata.m_phygroup_handle2bulkgroupvec[hit->second-1]=i+1;
+    }
+
+    m_meshdata.m_nodephygroup_name2handle.clear();
+    m_meshdata.m_nodephygroup_name2handle.reserve(m_meshdata.m_nodephygroup_name2nodeidvec.size());
+    for(i=0;i<static_cast<int>(m_meshdata.m_nodephygroup_name2nodeidvec.size());i++){
+        m_meshdata.m_nodephygroup_name2handle.emplace(m_meshdata.m_nodephygroup_name2nodeidvec[i].first,i+1);
+    }
+}
@@ -0,0 +1,265 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: distribute the bulk mesh among the processors, each
+//+++          one keeps the same contiguous block of bulk elements
+//+++          as the one used by the element loops, the nodes of
+//+++          them and one layer of halo elements. The lower dim
+//+++          elements and the nodal sets are kept by the owner of
+//+++          their first (min id) bulk element, then each of them
+//+++          is visited by exactly one processor
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "Mesh/BulkMesh.h"
+
+void BulkMesh::distributeBulkMesh(){
+    if(m_meshdata.m_isdistributed) return;
+    if(m_meshdata.m_isimplicit){
+        // there is nothing stored to be distributed, each processor computes the elements it needs on the fly
+        MessagePrinter::printWarningTxt("the implicit mesh is not distributed, the 'distributed' option is ignored");
+        return;
+    }
+
+    PetscMPIInt rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+
+    const int nElmts=m_meshdata.m_bulkelmts;
+    const int nNodes=m_meshdata.m_nodes;
+    // the bulk elements are already sorted along the space-filling curve (see InputSystem::readMeshBlock), then
+    // the contiguous blocks are compact subdomains
+    int eStart,eEnd;
+    getBulkElmtsRange(nElmts,rank,size,eStart,eEnd);
+
+    int e,i,k;
+
+    //*****************************************************
+    //*** the owned, halo elements and their nodes
+    //*****************************************************
+    // the nodes of the owned elements are flagged first, then each element outside the owned block which
+    // touches them is a halo one, so the node to element map of the whole mesh is not needed
+    vector<char> IsLocalNode(nNodes,0);
+    for(e=eStart;e<eEnd;e++){
+        for(const auto &node:m_meshdata.m_bulkelmt_connectivity[e]) IsLocalNode[node-1]=1;
+    }
+    vector<int> halo;// it is sorted by construction
+    for(e=0;e<nElmts;e++){
+        if(e>=eStart&&e<eEnd) continue;
+        for(const auto &node:m_meshdata.m_bulkelmt_connectivity[e]){
+            if(IsLocalNode[node-1]){
+                halo.push_back(e);break;
+            }
+        }
+    }
+    for(const auto &he:halo){
+        for(const auto &node:m_meshdata.m_bulkelmt_connectivity[he]) IsLocalNode[node-1]=1;
+    }
+
+    //*****************************************************
+    //*** the node to bulk element map of the boundary nodes
+    //*****************************************************
+    // the owner of a lower dimension element or a node of the nodal sets is decided by the bulk elements
+    // of its first node, so the map (in CSR format) is only built for these nodes
+    vector<char> IsBCNode(nNodes,0);
+    for(const auto *conns:{&m_meshdata.m_pointelmt_connectivity,&m_meshdata.m_lineelmt_connectivity,&m_meshdata.m_surfaceelmt_connectivity}){
+        for(k=0;k<conns->size();k++){
+            if(!(*conns)[k].empty()) IsBCNode[(*conns)[k][0]-1]=1;
+        }
+    }
+    for(const auto &group:m_meshdata.m_nodephygroup_name2nodeidvec){
+        for(const auto &id:group.second) IsBCNode[id-1]=1;
+    }
+    vector<int> bcnodes;
+    for(i=0;i<nNodes;i++){
+        if(IsBCNode[i]) bcnodes.push_back(i+1);
+    }
+    auto getBCNodeIndex=[&](const int &node)->int{
+        return static_cast<int>(std::lower_bound(bcnodes.begin(),bcnodes.end(),node)-bcnodes.begin());
+    };
+    vector<int> nodeelmt_ptr(bcnodes.size()+1,0),nodeelmt_ids;
+    for(e=0;e<nElmts;e++){
+        for(const auto &node:m_meshdata.m_bulkelmt_connectivity[e]){
+            if(IsBCNode[node-1]) nodeelmt_ptr[getBCNodeIndex(node)+1]+=1;
+        }
+    }
+    for(i=0;i<static_cast<int>(bcnodes.size());i++) nodeelmt_ptr[i+1]+=nodeelmt_ptr[i];
+    nodeelmt_ids.resize(nodeelmt_ptr.back());
+    vector<int> pos(nodeelmt_ptr.begin(),nodeelmt_ptr.end()-1);
+    for(e=0;e<nElmts;e++){
+        for(const auto &node:m_meshdata.m_bulkelmt_connectivity[e]){
+            if(IsBCNode[node-1]) nodeelmt_ids[pos[getBCNodeIndex(node)]++]=e;
+        }
+    }
+    vector<int>().swap(pos);
+    vector<char>().swap(IsBCNode);
+
+    // the 1st bulk element (start from 0) which contains all the given nodes, -1 if there is no such element
+    auto getFirstBulkElmt=[&](const ElmtConnSpan &conn)->int{
+        if(conn.empty()) return -1;
+        const int b=getBCNodeIndex(conn[0]);
+        for(int ii=nodeelmt_ptr[b];ii<nodeelmt_ptr[b+1];ii++){
+            ElmtConnSpan elconn=m_meshdata.m_bulkelmt_connectivity[nodeelmt_ids[ii]];
+            bool IsContained=true;
+            for(const auto &n:conn){
+                if(std::find(elconn.begin(),elconn.end(),n)==elconn.end()){
+                    IsContained=false;break;
+                }
+            }
+            if(IsContained) return nodeelmt_ids[ii];
+        }
+        return nodeelmt_ptr[b]<nodeelmt_ptr[b+1]?nodeelmt_ids[nodeelmt_ptr[b]]:-1;
+    };
+    auto getElmtOwnerRank=[&](const ElmtConnSpan &conn)->int{
+        const int ee=getFirstBulkElmt(conn);
+        if(ee<0) return 0;
+        return getBulkElmtOwnerRank(ee,nElmts,size);
+    };
+
+    //*****************************************************
+    //*** filter the lower dimension elements
+    //*****************************************************
+    // old2new[dim] maps the element id (start from 1) of the lower dimension elements to the local one, 0 if not owned
+    vector<int> old2new[3];
+    auto filterLowerDimElmts=[&](ElmtConnectivity &conns,vector<int> &ids){
+        ElmtConnectivity localconn;
+        ids.assign(conns.size(),0);
+        for(k=0;k<conns.size();k++){
+            if(getElmtOwnerRank(conns[k])!=rank) continue;
+            for(const auto &node:conns[k]) IsLocalNode[node-1]=1;
+            localconn.push_back(conns[k]);
+            ids[k]=localconn.size();
+        }
+        conns.swap(localconn);
+    };
+    filterLowerDimElmts(m_meshdata.m_pointelmt_connectivity,old2new[0]);
+    filterLowerDimElmts(m_meshdata.m_lineelmt_connectivity,old2new[1]);
+    filterLowerDimElmts(m_meshdata.m_surfaceelmt_connectivity,old2new[2]);
+    // the volume of the lower dimension elements is not used by the analysis
+    vector<double>().swap(m_meshdata.m_pointelmt_volume);
+    vector<double>().swap(m_meshdata.m_lineelmt_volume);
+    vector<double>().swap(m_meshdata.m_surfaceelmt_volume);
+
+    //*****************************************************
+    //*** filter the elemental physical groups
+    //*****************************************************
+    for(auto &group:m_meshdata.m_phygroup_name2elmtidvec){
+        // the bulk groups keep the global bulk element id, the other ones are renumbered
+        const int dim=getBulkMeshElmtDimViaPhyName(group.first);
+        vector<int> localids;
+        for(const auto &id:group.second){
+            if(dim==m_meshdata.m_maxdim){
+                if(id-1>=eStart&&id-1<eEnd) localids.push_back(id);
+            }
+            else if(old2new[dim][id-1]>0){
+                localids.push_back(old2new[dim][id-1]);
+            }
+        }
+        group.second.swap(localids);
+        for(i=0;i<m_meshdata.m_phygroups;i++){
+            if(m_meshdata.m_phygroup_phynamevec[i]==group.first){
+                m_meshdata.m_phygroup_elmtnumvec[i]=static_cast<int>(group.second.size());
+            }
+        }
+    }
+    for(auto &group:m_meshdata.m_phygroup_name2bulkelmtidvec){
+        vector<int> localids;
+        for(const auto &id:group.second){
+            if(id-1>=eStart&&id-1<eEnd) localids.push_back(id);
+        }
+        group.second.swap(localids);
+    }
+    for(k=0;k<3;k++) vector<int>().swap(old2new[k]);
+
+    //*****************************************************
+    //*** filter the nodal physical groups
+    //*****************************************************
+    for(auto &group:m_meshdata.m_nodephygroup_name2nodeidvec){
+        vector<int> localids;
+        for(const auto &id:group.second){
+            const int b=getBCNodeIndex(id);
+            const int owner=(nodeelmt_ptr[b]<nodeelmt_ptr[b+1])?getBulkElmtOwnerRank(nodeelmt_ids[nodeelmt_ptr[b]],nElmts,size):0;
+            if(owner!=rank) continue;
+            IsLocalNode[id-1]=1;
+            localids.push_back(id);
+        }
+        group.second.swap(localids);
+    }
+    vector<int>().swap(nodeelmt_ptr);
+    vector<int>().swap(nodeelmt_ids);
+    vector<int>().swap(bcnodes);
+
+    //*****************************************************
+    //*** compact the nodes and the bulk elements
+    //*****************************************************
+    vector<int> node_local2global;
+    for(i=0;i<nNodes;i++){
+        if(IsLocalNode[i]) node_local2global.push_back(i+1);
+    }
+    vector<char>().swap(IsLocalNode);
+
+    vector<double> coords0(3*node_local2global.size(),0.0),coords(3*node_local2global.size(),0.0);
+    for(i=0;i<static_cast<int>(node_local2global.size());i++){
+        for(k=0;k<3;k++){
+            coords0[3*i+k]=m_meshdata.m_nodecoords0[3*(node_local2global[i]-1)+k];
+            coords[3*i+k]=m_meshdata.m_nodecoords[3*(node_local2global[i]-1)+k];
+        }
+    }
+    m_meshdata.m_nodecoords0.swap(coords0);
+    m_meshdata.m_nodecoords.swap(coords);
+    vector<double>().swap(coords0);
+    vector<double>().swap(coords);
+
+    // the owned elements come first, then the halo ones
+    ElmtConnectivity elconn;
+    elconn.reserve(eEnd-eStart+static_cast<int>(halo.size()),(eEnd-eStart+static_cast<int>(halo.size()))*m_meshdata.m_nodesperbulkelmt);
+    for(e=eStart;e<eEnd;e++) elconn.push_back(m_meshdata.m_bulkelmt_connectivity[e]);
+    for(const auto &he:halo) elconn.push_back(m_meshdata.m_bulkelmt_connectivity[he]);
+    m_meshdata.m_bulkelmt_connectivity.swap(elconn);
+    elconn.releaseMemory();
+    // the same elements in the local node ids, then the nodal arrays are indexed without any search
+    vector<int> lconn;
+    m_meshdata.m_bulkelmt_localconnectivity.clear();
+    m_meshdata.m_bulkelmt_localconnectivity.reserve(m_meshdata.m_bulkelmt_connectivity.size(),m_meshdata.m_bulkelmt_connectivity.size()*m_meshdata.m_nodesperbulkelmt);
+    for(e=0;e<m_meshdata.m_bulkelmt_connectivity.size();e++){
+        lconn.clear();
+        for(const auto &node:m_meshdata.m_bulkelmt_connectivity[e]){
+            lconn.push_back(static_cast<int>(std::lower_bound(node_local2global.begin(),node_local2global.end(),node)-node_local2global.begin())+1);
+        }
+        m_meshdata.m_bulkelmt_localconnectivity.push_back(lconn);
+    }
+    if(static_cast<int>(m_meshdata.m_bulkelmt_volume.size())==nElmts){
+        vector<double> volume;
+        volume.reserve(m_meshdata.m_bulkelmt_connectivity.size());
+        for(e=eStart;e<eEnd;e++) volume.push_back(m_meshdata.m_bulkelmt_volume[e]);
+        for(const auto &he:halo) volume.push_back(m_meshdata.m_bulkelmt_volume[he]);
+        m_meshdata.m_bulkelmt_volume.swap(volume);
+    }
+
+    m_meshdata.m_ownedbulkelmt_start=eStart;
+    m_meshdata.m_ownedbulkelmt_end=eEnd;
+    for(auto &he:halo) he+=1;// to the global id
+    m_meshdata.m_halobulkelmt_local2global.swap(halo);
+    m_meshdata.m_node_local2global.swap(node_local2global);
+    m_meshdata.m_isdistributed=true;
+
+    //*****************************************************
+    //*** print out the summary
+    //*****************************************************
+    int localnodes=getBulkMeshLocalNodesNum(),halonum=getBulkMeshHaloBulkElmtsNum();
+    int maxnodes,maxhalo;
+    MPI_Allreduce(&localnodes,&maxnodes,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    MPI_Allreduce(&halonum,&maxhalo,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    char buff[70];
+    snprintf(buff,70,"  mesh is distributed among %6d processors",static_cast<int>(size));
+    MessagePrinter::printNormalTxt(string(buff));
+    snprintf(buff,70,"  max local nodes=%10d, max halo elmts=%10d",maxnodes,maxhalo);
+    MessagePrinter::printNormalTxt(string(buff));
+}
@@ -17,28 +17,26 @@
 #include "Mesh/Gmsh2FileImporter.h"
 
 int Gmsh2FileImporter::getMaxMeshDim(const string &filename)const{
-    ifstream in;
-    string str;
+    MshFileTokenizer in;
+    string_view line;
     int maxdim;
-    in.open(filename.c_str(),ios::in);
-    if(!in.is_open()){
+    if(!in.open(filename)){
         MessagePrinter::printErrorTxt("can\'t read the .gmsh2 file("+filename+"),please make sure file name is correct"
                                       " or you have the access permission");
         return false;
     }
     maxdim=-1;
-    while(!in.eof()){
-        getline(in,str);
-        if(str.find("$Elements")!=string::npos){
-            int nelmts;
-            int elmtid,phyid,geoid,ntags,elmttype,dim,nodes;
-            in>>nelmts;
+    while(in.nextLine(line)){
+        if(line.find("$Elements")!=string_view::npos){
+            int nelmts=0;
+            int elmtid,elmttype,dim;
+            in.readInt(nelmts);
             maxdim=-1;
             for(int e=0;e<nelmts;e++){
-                in>>elmtid>>elmttype>>ntags>>phyid>>geoid;
+                // only the element type is needed, the rest of the line is skipped
+                if(!in.readInt(elmtid)||!in.readInt(elmttype)) break;
+                in.skipLine();
                 dim=MshFileUtils::getElmtDimFromElmtType(elmttype);
-                nodes=MshFileUtils::getElmtNodesNumFromElmtType(elmttype);
-                for(int i=0;i<nodes;i++) in>>geoid;
                 if(dim>maxdim) maxdim=dim;
             }
             break;
@@ -53,17 +51,16 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
 
     vector<int> ElmtPhyIDVec;
     vector<int> ElmtDimVec;
-    vector<vector<int>> ElmtConn;
+    vector<int> ElmtLocalID;// the element id in the connectivity of the same dim
     map<int,int> PhyID2DimMap;
 
-    ifstream in;
-    in.open(filename.c_str(),ios::in);
-    if(!in.is_open()){
+    MshFileTokenizer in;
+    if(!in.open(filename)){
         MessagePrinter::printErrorTxt("can\'t read the .gmsh2 file("+filename+"),please make sure file name is correct"
                                       " or you have the access permission");
         return false;
     }
-    string str;
+    string_view line;
     double version;
     int format,size;
 
@@ -79,27 +76,31 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
     meshdata.m_surfaceelmts=0;
     meshdata.m_bulkelmts=0;
 
-    while(!in.eof()){
-        getline(in,str);
+    while(in.nextLine(line)){
 
-        if(str.find("$MeshFormat")!=string::npos){
+        if(line.find("$MeshFormat")!=string_view::npos){
             // read the version, format, size
-            in>>version>>format>>size;
+            version=0.0;format=0;size=0;
+            in.readDouble(version);in.readInt(format);in.readInt(size);
             if(version<2.0 || version>2.2){
                 MessagePrinter::printErrorTxt("version="+to_string(version)+" is not supported for gmsh2 file importer, "
                                                "please check your mesh file");
                 return false;
             }
+            if(format!=0){
+                MessagePrinter::printErrorTxt("the binary gmsh2 file is not supported, please save your mesh in ASCII format");
+                return false;
+            }
         }
-        else if(str.find("$PhysicalNames")!=string::npos){
+        else if(line.find("$PhysicalNames")!=string_view::npos){
             MessagePrinter::printErrorTxt("The gmsh2 file exported from netgen should\'t contain $PhysicalNames, please check your input file");
             MessagePrinter::exitAsFem();
         }// end-of-physical-group-reading
-        else if(str.find("$Nodes")!=string::npos){
+        else if(line.find("$Nodes")!=string_view::npos){
             // read the nodes' coordinates
             // node-id, x, y, z
             meshdata.m_nodes=0;
-            in>>meshdata.m_nodes;
+            in.readInt(meshdata.m_nodes);
             int nodeid;
             double x,y,z;
             meshdata.m_xmin=meshdata.m_ymin=meshdata.m_zmin= 1.0e16;
@@ -107,7 +108,11 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
             meshdata.m_nodecoords0.resize(meshdata.m_nodes*3,0.0);
             meshdata.m_nodecoords.resize(meshdata.m_nodes*3,0.0);
             for(int i=0;i<meshdata.m_nodes;i++){
-                in>>nodeid>>x>>y>>z;
+                if(!in.readInt(nodeid)||!in.readDouble(x)||!in.readDouble(y)||!in.readDouble(z)||
+                   nodeid<1||nodeid>meshdata.m_nodes){
+                    MessagePrinter::printErrorTxt("Invalid node coordinates information in your gmsh2 file inside the $Nodes");
+                    return false;
+                }
                 meshdata.m_nodecoords0[(nodeid-1)*3+1-1]=x;
                 meshdata.m_nodecoords0[(nodeid-1)*3+2-1]=y;
                 meshdata.m_nodecoords0[(nodeid-1)*3+3-1]=z;
@@ -123,11 +128,11 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
                 if(z>meshdata.m_zmax) meshdata.m_zmax=z;
                 if(z<meshdata.m_zmin) meshdata.m_zmin=z;
             }
-            getline(in,str);
+            in.skipLine();
         }// end-of-node-coordinates-reading
-        else if(str.find("$Elements")!=string::npos){
+        else if(line.find("$Elements")!=string_view::npos){
             meshdata.m_elements=0;
-            in>>meshdata.m_elements;// total elements number
+            in.readInt(meshdata.m_elements);// total elements number
             vector<int> tempconn;
             int elmtid,phyid,geoid,ntags,elmttype,vtktype;
             int nodes,dim,elmtorder;
@@ -149,11 +154,15 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
 
             ElmtPhyIDVec.resize(meshdata.m_elements,0);
             ElmtDimVec.resize(meshdata.m_elements,0);
-            ElmtConn.resize(meshdata.m_elements);
+            ElmtLocalID.resize(meshdata.m_elements,0);
             PhyID2DimMap.clear();
 
             for(int e=0;e<meshdata.m_elements;e++){
-                in>>elmtid>>elmttype>>ntags>>phyid>>geoid;
+                if(!in.readInt(elmtid)||!in.readInt(elmttype)||!in.readInt(ntags)||!in.readInt(phyid)||!in.readInt(geoid)||
+                   elmtid<1||elmtid>meshdata.m_elements){
+                    MessagePrinter::printErrorTxt("Invalid element information in your gmsh2 file inside the $Elements");
+                    return false;
+                }
 
                 nodes=MshFileUtils::getElmtNodesNumFromElmtType(elmttype);
                 dim=MshFileUtils::getElmtDimFromElmtType(elmttype);
@@ -164,7 +173,7 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
 
                 // read the connectivity info
                 tempconn.resize(nodes,0);
-                for(int j=0;j<nodes;j++) in>>tempconn[j];
+                for(int j=0;j<nodes;j++) in.readInt(tempconn[j]);
 
                 MshFileUtils::reorderGmsh2NodesIndex(elmttype,tempconn);
 
@@ -172,7 +181,6 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
 
                 ElmtDimVec[elmtid-1]=dim;
                 ElmtPhyIDVec[elmtid-1]=phyid;
-                ElmtConn[elmtid-1]=tempconn;
                 PhyID2DimMap[phyid]=dim;
 
                 if(dim==0){
@@ -184,11 +192,13 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
                     meshdata.m_pointelmts+=1;
                     meshdata.m_pointelmt_volume.push_back(0.0);
                     meshdata.m_pointelmt_connectivity.push_back(tempconn);
+                    ElmtLocalID[elmtid-1]=meshdata.m_pointelmt_connectivity.size();
                 }
                 
                 if(dim==1 && dim<mshMaxDim){
                     meshdata.m_lineelmts+=1;
                     meshdata.m_lineelmt_connectivity.push_back(tempconn);
+                    ElmtLocalID[elmtid-1]=meshdata.m_lineelmt_connectivity.size();
                     meshdata.m_lineelmt_type=meshtype;
                     meshdata.m_lineelmt_volume.push_back(0.0);
                     meshdata.m_nodesperlineelmt=nodes;
@@ -196,6 +206,7 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
                 if(dim==2 && dim<mshMaxDim){
                     meshdata.m_surfaceelmts+=1;
                     meshdata.m_surfaceelmt_connectivity.push_back(tempconn);
+                    ElmtLocalID[elmtid-1]=meshdata.m_surfaceelmt_connectivity.size();
                     meshdata.m_surfaceelmt_type=meshtype;
                     meshdata.m_surfaceelmt_volume.push_back(0.0);
                     meshdata.m_nodespersurfaceelmt=nodes;
@@ -204,6 +215,7 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
                 if(dim==mshMaxDim){
                     meshdata.m_bulkelmts+=1;
                     meshdata.m_bulkelmt_connectivity.push_back(tempconn);
+                    ElmtLocalID[elmtid-1]=meshdata.m_bulkelmt_connectivity.size();
                     meshdata.m_bulkelmt_type=meshtype;
                     meshdata.m_bulkelmt_typename=meshtypename;
                     meshdata.m_bulkelmt_volume.push_back(0.0);
@@ -248,7 +260,7 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
     meshdata.m_phygroup_elmtnumvec.clear();
 
     meshdata.m_phygroup_name2bulkelmtidvec.clear();
-    meshdata.m_phygroup_name2elmtconnvec.clear();
+    meshdata.m_phygroup_name2elmtidvec.clear();
 
     meshdata.m_phygroup_nodesnumperelmtvec.clear();
 
@@ -306,7 +318,7 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
     meshdata.m_phygroup_nodesnumperelmtvec.push_back(meshdata.m_nodesperbulkelmt);// for alldomain
 
     meshdata.m_phygroup_name2bulkelmtidvec.resize(bulkelmtphygroupnums+1);
-    meshdata.m_phygroup_name2elmtconnvec.resize(meshdata.m_phygroups);
+    meshdata.m_phygroup_name2elmtidvec.resize(meshdata.m_phygroups);
     meshdata.m_phygroup_elmtnumvec.resize(meshdata.m_phygroups,0);
 
     // now we need to loop all the elements and clasify all the element sets
@@ -320,8 +332,8 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
                 dim=meshdata.m_phygroup_dimvec[i];
                 meshdata.m_phygroup_elmtnumvec[i]+=1;
 
-                meshdata.m_phygroup_name2elmtconnvec[i].first=phyname;
-                meshdata.m_phygroup_name2elmtconnvec[i].second.push_back(ElmtConn[e]);
+                meshdata.m_phygroup_name2elmtidvec[i].first=phyname;
+                meshdata.m_phygroup_name2elmtidvec[i].second.push_back(ElmtLocalID[e]);
                 if(dim==mshMaxDim){
                     // for volume mesh
                     meshdata.m_phygroup_name2bulkelmtidvec[i-lowdimphygroupnums].first=phyname;
@@ -334,8 +346,8 @@ bool Gmsh2FileImporter::importMeshFile(const string &filename,MeshData &meshdata
             meshdata.m_phygroup_name2bulkelmtidvec[bulkelmtphygroupnums].first="alldomain";
             meshdata.m_phygroup_name2bulkelmtidvec[bulkelmtphygroupnums].second.push_back(e-subelmts+1);
 
-            meshdata.m_phygroup_name2elmtconnvec[meshdata.m_phygroups-1].first="alldomain";
-            meshdata.m_phygroup_name2elmtconnvec[meshdata.m_phygroups-1].second.push_back(ElmtConn[e]);
+            meshdata.m_phygroup_name2elmtidvec[meshdata.m_phygroups-1].first="alldomain";
+            meshdata.m_phygroup_name2elmtidvec[meshdata.m_phygroups-1].second.push_back(ElmtLocalID[e]);
         }
     }// end-of-element-loop
     // add "alldomain" info
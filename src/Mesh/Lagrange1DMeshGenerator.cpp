@@ -20,8 +20,6 @@ Lagrange1DMeshGenerator::Lagrange1DMeshGenerator(){
     m_mesh_generated=false;
 }
 Lagrange1DMeshGenerator::~Lagrange1DMeshGenerator(){
-    leftconn.clear();
-    rightconn.clear();
     leftnodes.clear();
     rightnodes.clear();
 }
@@ -91,7 +89,7 @@ bool Lagrange1DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
     dy=(t_meshdata.m_ymax-t_meshdata.m_ymin)/(t_meshdata.m_nodes-1);
     dz=(t_meshdata.m_zmax-t_meshdata.m_zmin)/(t_meshdata.m_nodes-1);
 
-    t_meshdata.m_bulkelmt_connectivity.resize(t_meshdata.m_nx,vector<int>(t_meshdata.m_nodesperbulkelmt,0));
+    t_meshdata.m_bulkelmt_connectivity.reserve(t_meshdata.m_nx,t_meshdata.m_nx*t_meshdata.m_nodesperbulkelmt);
     t_meshdata.m_nodecoords.resize( t_meshdata.m_nodes*3,0.0);
     t_meshdata.m_nodecoords0.resize(t_meshdata.m_nodes*3,0.0);
 
@@ -107,36 +105,28 @@ bool Lagrange1DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
 
     // generate the element connectivity information
     t_meshdata.m_pointelmts=2;
-    t_meshdata.m_pointelmt_connectivity.resize(2);
     // for volume
     t_meshdata.m_pointelmt_volume.resize(2);
     t_meshdata.m_pointelmt_volume[0]=0.0;
     t_meshdata.m_pointelmt_volume[1]=0.0;
     // for left point
-    leftconn.resize(1);
-    leftconn[0].clear();
-    leftconn[0].push_back(1);
     leftnodes.clear();
     leftnodes.push_back(1);
-    t_meshdata.m_pointelmt_connectivity[0].clear();
-    t_meshdata.m_pointelmt_connectivity[0].push_back(1);
+    t_meshdata.m_pointelmt_connectivity.push_back(leftnodes);
     // for right point
-    rightconn.resize(1);
-    rightconn[0].clear();
-    rightconn[0].push_back(t_meshdata.m_nodes);
     rightnodes.clear();
     rightnodes.push_back(t_meshdata.m_nodes);
-    t_meshdata.m_pointelmt_connectivity[1].clear();
-    t_meshdata.m_pointelmt_connectivity[1].push_back(t_meshdata.m_nodes);
+    t_meshdata.m_pointelmt_connectivity.push_back(rightnodes);
 
-    vector<int> tempconn;
+    vector<int> tempconn,elconn;
     tempconn.clear();
     for(int e=0;e<t_meshdata.m_bulkelmts;e++){
-        t_meshdata.m_bulkelmt_connectivity[e].clear();
+        elconn.clear();
         tempconn.push_back(e+1);
         for(int j=1;j<=t_meshdata.m_nodesperbulkelmt;j++){
-            t_meshdata.m_bulkelmt_connectivity[e].push_back(e*t_meshdata.m_order+j);
+            elconn.push_back(e*t_meshdata.m_order+j);
         }
+        t_meshdata.m_bulkelmt_connectivity.push_back(elconn);
     }
     //***********************************************
     // set up the physical group information
@@ -148,7 +138,7 @@ bool Lagrange1DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
     t_meshdata.m_phygroup_elmtnumvec.resize(t_meshdata.m_phygroups);
     t_meshdata.m_phygroup_nodesnumperelmtvec.resize(t_meshdata.m_phygroups);
     t_meshdata.m_phygroup_name2dimvec.resize(t_meshdata.m_phygroups);
-    t_meshdata.m_phygroup_name2elmtconnvec.resize(t_meshdata.m_phygroups);
+    t_meshdata.m_phygroup_name2elmtidvec.resize(t_meshdata.m_phygroups);
     t_meshdata.m_phygroup_phyidvec.resize(t_meshdata.m_phygroups);
     t_meshdata.m_phygroup_phynamevec.resize(t_meshdata.m_phygroups);
     // for phy id and phy name vector
@@ -174,10 +164,10 @@ bool Lagrange1DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
     t_meshdata.m_phygroup_name2dimvec[0]=make_pair("left",     0);
     t_meshdata.m_phygroup_name2dimvec[1]=make_pair("right",    0);
     t_meshdata.m_phygroup_name2dimvec[2]=make_pair("alldomain",1);
-    //*** for phy name to element connectivity map
-    t_meshdata.m_phygroup_name2elmtconnvec[0]=make_pair("left",                               leftconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[1]=make_pair("right",                             rightconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[2]=make_pair("alldomain",t_meshdata.m_bulkelmt_connectivity);
+    //*** for phy name to element ids map, the left and right points are the 1st and 2nd point elements
+    t_meshdata.m_phygroup_name2elmtidvec[0]=make_pair("left", vector<int>(1,1));
+    t_meshdata.m_phygroup_name2elmtidvec[1]=make_pair("right",vector<int>(1,2));
+    t_meshdata.m_phygroup_name2elmtidvec[2]=make_pair("alldomain",tempconn);
     //*** for phy name to bulk element id map
     t_meshdata.m_phygroup_name2bulkelmtidvec.clear();
     t_meshdata.m_phygroup_name2bulkelmtidvec.push_back(make_pair("alldomain",tempconn));
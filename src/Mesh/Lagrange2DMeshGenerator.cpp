@@ -74,7 +74,7 @@ bool Lagrange2DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
     int i,j,k,e;
     int i1,i2,i3,i4,i5,i6,i7,i8,i9;
 
-    vector<int> tempconn;
+    vector<int> tempconn,elconn;
 
     if(t_meshtype==MeshType::QUAD4){
         t_meshdata.m_order=1;
@@ -96,91 +96,99 @@ bool Lagrange2DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
         t_meshdata.m_lineelmt_vtktype=3;
         t_meshdata.m_lineelmt_type=MeshType::EDGE2;
 
-        // for the coordinates of each node
-        t_meshdata.m_nodecoords.resize(t_meshdata.m_nodes*3,0.0);
-        t_meshdata.m_nodecoords0.resize(t_meshdata.m_nodes*3,0.0);
-        leftnodes.clear();rightnodes.clear();
-        bottomnodes.clear();rightnodes.clear();
-        for(j=1;j<=t_meshdata.m_ny+1;j++){
-            for(i=1;i<=t_meshdata.m_nx+1;i++){
-                k=(j-1)*(t_meshdata.m_nx+1)+i;
-                t_meshdata.m_nodecoords[(k-1)*3+1-1]=t_meshdata.m_xmin+(i-1)*dx;
-                t_meshdata.m_nodecoords[(k-1)*3+2-1]=t_meshdata.m_ymin+(j-1)*dy;
-                t_meshdata.m_nodecoords[(k-1)*3+3-1]=0.0;
-
-                t_meshdata.m_nodecoords0[(k-1)*3+1-1]=t_meshdata.m_xmin+(i-1)*dx;
-                t_meshdata.m_nodecoords0[(k-1)*3+2-1]=t_meshdata.m_ymin+(j-1)*dy;
-                t_meshdata.m_nodecoords0[(k-1)*3+3-1]=0.0;
-
-                if(i==1){
-                    // for left side nodes
-                    leftnodes.push_back(k);// global id, start from 1
-                }
-                if(i==t_meshdata.m_nx+1){
-                    // for right side nodes
-                    rightnodes.push_back(k);
-                }
-                if(j==1){
-                    // for bottom side nodes
-                    bottomnodes.push_back(k);
-                }
-                if(j==t_meshdata.m_ny+1){
-                    // for top side nodes
-                    topnodes.push_back(k);
-                }
-            }
+        if(t_meshdata.m_isimplicit){
+            // only the grid sizes are kept, BulkMesh computes the coordinates, connectivity and boundary sets from the (i,j) indices
+            leftnodes.clear();rightnodes.clear();
+            bottomnodes.clear();topnodes.clear();
         }
-        // for the connectivity information of bulk elements
-        t_meshdata.m_bulkelmt_connectivity.resize(t_meshdata.m_bulkelmts,vector<int>(0));
-        t_meshdata.m_bulkelmt_volume.resize(t_meshdata.m_bulkelmts,0.0);
-        leftconn.resize(t_meshdata.m_ny);rightconn.resize(t_meshdata.m_ny);
-        bottomconn.resize(t_meshdata.m_nx);topconn.resize(t_meshdata.m_nx);
-        tempconn.clear();
-        for(j=1;j<=t_meshdata.m_ny;j++){
-            for(i=1;i<=t_meshdata.m_nx;i++){
-                e=(j-1)*t_meshdata.m_nx+i;
-                i1=(j-1)*(t_meshdata.m_nx+1)+i;
-                i2=i1+1;
-                i3=i2+t_meshdata.m_nx+1;
-                i4=i3-1;
-
-                tempconn.push_back(e);
-
-                t_meshdata.m_bulkelmt_connectivity[e-1].clear();
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i1);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i2);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i3);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i4);
-
-                // for the boundary element
-                // the layout of your quad4 should be:
-                // 4-----3
-                // |     |
-                // |     |
-                // 1-----2
-                if(j==1){
-                    // for bottom bc elements
-                    bottomconn[i-1].clear();
-                    bottomconn[i-1].push_back(i1);
-                    bottomconn[i-1].push_back(i2);
+        else{
+            // for the coordinates of each node
+            t_meshdata.m_nodecoords.resize(t_meshdata.m_nodes*3,0.0);
+            t_meshdata.m_nodecoords0.resize(t_meshdata.m_nodes*3,0.0);
+            leftnodes.clear();rightnodes.clear();
+            bottomnodes.clear();rightnodes.clear();
+            for(j=1;j<=t_meshdata.m_ny+1;j++){
+                for(i=1;i<=t_meshdata.m_nx+1;i++){
+                    k=(j-1)*(t_meshdata.m_nx+1)+i;
+                    t_meshdata.m_nodecoords[(k-1)*3+1-1]=t_meshdata.m_xmin+(i-1)*dx;
+                    t_meshdata.m_nodecoords[(k-1)*3+2-1]=t_meshdata.m_ymin+(j-1)*dy;
+                    t_meshdata.m_nodecoords[(k-1)*3+3-1]=0.0;
+
+                    t_meshdata.m_nodecoords0[(k-1)*3+1-1]=t_meshdata.m_xmin+(i-1)*dx;
+                    t_meshdata.m_nodecoords0[(k-1)*3+2-1]=t_meshdata.m_ymin+(j-1)*dy;
+                    t_meshdata.m_nodecoords0[(k-1)*3+3-1]=0.0;
+
+                    if(i==1){
+                        // for left side nodes
+                        leftnodes.push_back(k);// global id, start from 1
+                    }
+                    if(i==t_meshdata.m_nx+1){
+                        // for right side nodes
+                        rightnodes.push_back(k);
+                    }
+                    if(j==1){
+                        // for bottom side nodes
+                        bottomnodes.push_back(k);
+                    }
+                    if(j==t_meshdata.m_ny+1){
+                        // for top side nodes
+                        topnodes.push_back(k);
+                    }
                 }
-                if(j==t_meshdata.m_ny){
-                    // for top bc elements
-                    topconn[i-1].clear();
-                    topconn[i-1].push_back(i3);
-                    topconn[i-1].push_back(i4);
-                }
-                if(i==1){
-                    // for left bc elements
-                    leftconn[j-1].clear();
-                    leftconn[j-1].push_back(i4);
-                    leftconn[j-1].push_back(i1);
-                }
-                if(i==t_meshdata.m_nx){
-                    // for right bc elements
-                    rightconn[j-1].clear();
-                    rightconn[j-1].push_back(i2);
-                    rightconn[j-1].push_back(i3);
+            }
+            // for the connectivity information of bulk elements
+            t_meshdata.m_bulkelmt_connectivity.reserve(t_meshdata.m_bulkelmts,t_meshdata.m_bulkelmts*t_meshdata.m_nodesperbulkelmt);
+            t_meshdata.m_bulkelmt_volume.resize(t_meshdata.m_bulkelmts,0.0);
+            leftconn.resize(t_meshdata.m_ny);rightconn.resize(t_meshdata.m_ny);
+            bottomconn.resize(t_meshdata.m_nx);topconn.resize(t_meshdata.m_nx);
+            tempconn.clear();
+            for(j=1;j<=t_meshdata.m_ny;j++){
+                for(i=1;i<=t_meshdata.m_nx;i++){
+                    e=(j-1)*t_meshdata.m_nx+i;
+                    i1=(j-1)*(t_meshdata.m_nx+1)+i;
+                    i2=i1+1;
+                    i3=i2+t_meshdata.m_nx+1;
+                    i4=i3-1;
+
+                    tempconn.push_back(e);
+
+                    elconn.clear();
+                    elconn.push_back(i1);
+                    elconn.push_back(i2);
+                    elconn.push_back(i3);
+                    elconn.push_back(i4);
+                    t_meshdata.m_bulkelmt_connectivity.push_back(elconn);
+
+                    // for the boundary element
+                    // the layout of your quad4 should be:
+                    // 4-----3
+                    // |     |
+                    // |     |
+                    // 1-----2
+                    if(j==1){
+                        // for bottom bc elements
+                        bottomconn[i-1].clear();
+                        bottomconn[i-1].push_back(i1);
+                        bottomconn[i-1].push_back(i2);
+                    }
+                    if(j==t_meshdata.m_ny){
+                        // for top bc elements
+                        topconn[i-1].clear();
+                        topconn[i-1].push_back(i3);
+                        topconn[i-1].push_back(i4);
+                    }
+                    if(i==1){
+                        // for left bc elements
+                        leftconn[j-1].clear();
+                        leftconn[j-1].push_back(i4);
+                        leftconn[j-1].push_back(i1);
+                    }
+                    if(i==t_meshdata.m_nx){
+                        // for right bc elements
+                        rightconn[j-1].clear();
+                        rightconn[j-1].push_back(i2);
+                        rightconn[j-1].push_back(i3);
+                    }
                 }
             }
         }
@@ -238,7 +246,7 @@ bool Lagrange2DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
         t_meshdata.m_nodecoords0=t_meshdata.m_nodecoords;
 
         // for the connectivity information of bulk elements
-        t_meshdata.m_bulkelmt_connectivity.resize(t_meshdata.m_bulkelmts,vector<int>(0));
+        t_meshdata.m_bulkelmt_connectivity.reserve(t_meshdata.m_bulkelmts,t_meshdata.m_bulkelmts*t_meshdata.m_nodesperbulkelmt);
         t_meshdata.m_bulkelmt_volume.resize(t_meshdata.m_bulkelmts,0.0);
         leftconn.resize(t_meshdata.m_ny);rightconn.resize(t_meshdata.m_ny);
         bottomconn.resize(t_meshdata.m_nx);topconn.resize(t_meshdata.m_nx);
@@ -260,16 +268,17 @@ bool Lagrange2DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
 
                 tempconn.push_back(e);
 
-                t_meshdata.m_bulkelmt_connectivity[e-1].clear();
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i1);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i2);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i3);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i4);
+                elconn.clear();
+                elconn.push_back(i1);
+                elconn.push_back(i2);
+                elconn.push_back(i3);
+                elconn.push_back(i4);
 
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i5);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i6);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i7);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i8);
+                elconn.push_back(i5);
+                elconn.push_back(i6);
+                elconn.push_back(i7);
+                elconn.push_back(i8);
+                t_meshdata.m_bulkelmt_connectivity.push_back(elconn);
 
                 // for the boundary element and nodes
                 // the layout of your quad8 should be:
@@ -378,7 +387,7 @@ bool Lagrange2DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
         t_meshdata.m_nodecoords0=t_meshdata.m_nodecoords;
 
         // for the connectivity information of bulk elements
-        t_meshdata.m_bulkelmt_connectivity.resize(t_meshdata.m_bulkelmts,vector<int>(0));
+        t_meshdata.m_bulkelmt_connectivity.reserve(t_meshdata.m_bulkelmts,t_meshdata.m_bulkelmts*t_meshdata.m_nodesperbulkelmt);
         t_meshdata.m_bulkelmt_volume.resize(t_meshdata.m_bulkelmts,0.0);
         leftconn.resize(t_meshdata.m_ny);rightconn.resize(t_meshdata.m_ny);
         bottomconn.resize(t_meshdata.m_nx);topconn.resize(t_meshdata.m_nx);
@@ -399,18 +408,19 @@ bool Lagrange2DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
 
                 tempconn.push_back(e);
 
-                t_meshdata.m_bulkelmt_connectivity[e-1].clear();
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i1);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i2);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i3);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i4);
+                elconn.clear();
+                elconn.push_back(i1);
+                elconn.push_back(i2);
+                elconn.push_back(i3);
+                elconn.push_back(i4);
 
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i5);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i6);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i7);
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i8);
+                elconn.push_back(i5);
+                elconn.push_back(i6);
+                elconn.push_back(i7);
+                elconn.push_back(i8);
 
-                t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i9);
+                elconn.push_back(i9);
+                t_meshdata.m_bulkelmt_connectivity.push_back(elconn);
 
                 // for the boundary element
                 // the layout of your quad8 should be:
@@ -481,7 +491,7 @@ bool Lagrange2DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
     t_meshdata.m_phygroup_elmtnumvec.resize(t_meshdata.m_phygroups);
     t_meshdata.m_phygroup_nodesnumperelmtvec.resize(t_meshdata.m_phygroups);
     t_meshdata.m_phygroup_name2dimvec.resize(t_meshdata.m_phygroups);
-    t_meshdata.m_phygroup_name2elmtconnvec.resize(t_meshdata.m_phygroups);
+    t_meshdata.m_phygroup_name2elmtidvec.resize(t_meshdata.m_phygroups);
     // now we can add physical group information
     t_meshdata.m_phygroup_dimvec[0]=1;// for left   edge
     t_meshdata.m_phygroup_dimvec[1]=1;// for right  edge
@@ -518,12 +528,12 @@ bool Lagrange2DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
     t_meshdata.m_phygroup_name2dimvec[2]=make_pair("bottom",   1);
     t_meshdata.m_phygroup_name2dimvec[3]=make_pair("top",      1);
     t_meshdata.m_phygroup_name2dimvec[4]=make_pair("alldomain",2);
-    //*** for phy name to element connectivity map
-    t_meshdata.m_phygroup_name2elmtconnvec[0]=make_pair("left",                               leftconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[1]=make_pair("right",                             rightconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[2]=make_pair("bottom",                           bottomconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[3]=make_pair("top",                                 topconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[4]=make_pair("alldomain",t_meshdata.m_bulkelmt_connectivity);
+    //*** for phy name to element ids map, the boundary elements go to the line element connectivity
+    t_meshdata.m_phygroup_name2elmtidvec[0]=make_pair("left",appendBCElmtConnectivity(leftconn,t_meshdata.m_lineelmt_connectivity));
+    t_meshdata.m_phygroup_name2elmtidvec[1]=make_pair("right",appendBCElmtConnectivity(rightconn,t_meshdata.m_lineelmt_connectivity));
+    t_meshdata.m_phygroup_name2elmtidvec[2]=make_pair("bottom",appendBCElmtConnectivity(bottomconn,t_meshdata.m_lineelmt_connectivity));
+    t_meshdata.m_phygroup_name2elmtidvec[3]=make_pair("top",appendBCElmtConnectivity(topconn,t_meshdata.m_lineelmt_connectivity));
+    t_meshdata.m_phygroup_name2elmtidvec[4]=make_pair("alldomain",tempconn);
     //*** for phy name to bulk element id map
     t_meshdata.m_phygroup_name2bulkelmtidvec.clear();
     t_meshdata.m_phygroup_name2bulkelmtidvec.push_back(make_pair("alldomain",tempconn));
@@ -86,7 +86,7 @@ bool Lagrange3DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
     int i10,i11,i12,i13,i14,i15,i16,i17,i18,i19;
     int i20,i21,i22,i23,i24,i25,i26,i27;
 
-    vector<int> tempconn;
+    vector<int> tempconn,elconn;
 
     if(t_meshtype==MeshType::HEX8){
         t_meshdata.m_order=1;
@@ -114,165 +114,174 @@ bool Lagrange3DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
         t_meshdata.m_surfaceelmt_vtktype=9;
         t_meshdata.m_surfaceelmt_type=MeshType::QUAD4;
 
-        // for the coordinates of each node
-        t_meshdata.m_nodecoords.resize(t_meshdata.m_nodes*3,0.0);
-        t_meshdata.m_nodecoords0.resize(t_meshdata.m_nodes*3,0.0);
-        leftnodes.clear();rightnodes.clear();
-        bottomnodes.clear();rightnodes.clear();
-        backnodes.clear();frontnodes.clear();
-        for(k=1;k<=t_meshdata.m_nz+1;k++){
-            for(j=1;j<=t_meshdata.m_ny+1;j++){
-                for(i=1;i<=t_meshdata.m_nx+1;i++){
-                    kk=(j-1)*(t_meshdata.m_nx+1)+i+(k-1)*(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
-                    t_meshdata.m_nodecoords0[(kk-1)*3+1-1]=t_meshdata.m_xmin+(i-1)*dx;
-                    t_meshdata.m_nodecoords0[(kk-1)*3+2-1]=t_meshdata.m_ymin+(j-1)*dy;
-                    t_meshdata.m_nodecoords0[(kk-1)*3+3-1]=t_meshdata.m_zmin+(k-1)*dz;
-
-                    if(i==1){
-                        // for left side nodes
-                        leftnodes.push_back(kk);// global id, start from 1
-                    }
-                    if(i==t_meshdata.m_nx+1){
-                        // for right side nodes
-                        rightnodes.push_back(kk);
-                    }
-                    if(j==1){
-                        // for bottom side nodes
-                        bottomnodes.push_back(kk);
-                    }
-                    if(j==t_meshdata.m_ny+1){
-                        // for top side nodes
-                        topnodes.push_back(kk);
-                    }
-                    if(k==1){
-                        // for back side nodes
-                        backnodes.push_back(kk);
-                    }
-                    if(k==t_meshdata.m_nz+1){
-                        // for front side nodes
-                        frontnodes.push_back(kk);
+        if(t_meshdata.m_isimplicit){
+            // only the grid sizes are kept, BulkMesh computes the coordinates, connectivity and boundary sets from the (i,j,k) indices
+            leftnodes.clear();rightnodes.clear();
+            bottomnodes.clear();topnodes.clear();
+            backnodes.clear();frontnodes.clear();
+        }
+        else{
+            // for the coordinates of each node
+            t_meshdata.m_nodecoords.resize(t_meshdata.m_nodes*3,0.0);
+            t_meshdata.m_nodecoords0.resize(t_meshdata.m_nodes*3,0.0);
+            leftnodes.clear();rightnodes.clear();
+            bottomnodes.clear();rightnodes.clear();
+            backnodes.clear();frontnodes.clear();
+            for(k=1;k<=t_meshdata.m_nz+1;k++){
+                for(j=1;j<=t_meshdata.m_ny+1;j++){
+                    for(i=1;i<=t_meshdata.m_nx+1;i++){
+                        kk=(j-1)*(t_meshdata.m_nx+1)+i+(k-1)*(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
+                        t_meshdata.m_nodecoords0[(kk-1)*3+1-1]=t_meshdata.m_xmin+(i-1)*dx;
+                        t_meshdata.m_nodecoords0[(kk-1)*3+2-1]=t_meshdata.m_ymin+(j-1)*dy;
+                        t_meshdata.m_nodecoords0[(kk-1)*3+3-1]=t_meshdata.m_zmin+(k-1)*dz;
+
+                        if(i==1){
+                            // for left side nodes
+                            leftnodes.push_back(kk);// global id, start from 1
+                        }
+                        if(i==t_meshdata.m_nx+1){
+                            // for right side nodes
+                            rightnodes.push_back(kk);
+                        }
+                        if(j==1){
+                            // for bottom side nodes
+                            bottomnodes.push_back(kk);
+                        }
+                        if(j==t_meshdata.m_ny+1){
+                            // for top side nodes
+                            topnodes.push_back(kk);
+                        }
+                        if(k==1){
+                            // for back side nodes
+                            backnodes.push_back(kk);
+                        }
+                        if(k==t_meshdata.m_nz+1){
+                            // for front side nodes
+                            frontnodes.push_back(kk);
+                        }
                     }
                 }
             }
-        }
-        // make a copy for nodcal coordinates
-        t_meshdata.m_nodecoords=t_meshdata.m_nodecoords0;
-        // for the connectivity information of bulk elements
-        t_meshdata.m_bulkelmt_connectivity.resize(t_meshdata.m_bulkelmts,vector<int>(0));
-        t_meshdata.m_bulkelmt_volume.resize(t_meshdata.m_bulkelmts,0.0);
-        leftconn.resize(t_meshdata.m_ny*t_meshdata.m_nz);
-        rightconn.resize(t_meshdata.m_ny*t_meshdata.m_nz);
-        //
-        bottomconn.resize(t_meshdata.m_nx*t_meshdata.m_nz);
-        topconn.resize(t_meshdata.m_nx*t_meshdata.m_nz);
-        //
-        backconn.resize(t_meshdata.m_nx*t_meshdata.m_ny);
-        frontconn.resize(t_meshdata.m_nx*t_meshdata.m_ny);
-
-        leftnodes.clear();rightnodes.clear();
-        bottomnodes.clear();rightnodes.clear();
-        backnodes.clear();frontnodes.clear();
-
-        tempconn.clear();
-
-        for(k=1;k<=t_meshdata.m_nz;k++){
-            for(j=1;j<=t_meshdata.m_ny;j++){
-                for(i=1;i<=t_meshdata.m_nx;i++){
-                    e=(j-1)*t_meshdata.m_nx+i+(k-1)*t_meshdata.m_nx*t_meshdata.m_ny;
-                    i1=(j-1)*(t_meshdata.m_nx+1)+i+(k-1)*(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
-                    i2=i1+1;
-                    i3=i2+t_meshdata.m_nx+1;
-                    i4=i3-1;
-                    i5=i1+(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
-                    i6=i2+(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
-                    i7=i3+(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
-                    i8=i4+(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
-
-                    tempconn.push_back(e);
-
-                    t_meshdata.m_bulkelmt_connectivity[e-1].clear();
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i1);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i2);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i3);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i4);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i5);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i6);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i7);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i8);
-
-                    t_meshdata.m_bulkelmt_volume[e-1]=dx*dy*dz;// for the volume of e-th bulk element
-
-                    if(i==1){
-                        // for left bc elements
-                        leftconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i1);
-                        leftconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i5);
-                        leftconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i8);
-                        leftconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i4);
-
-                        leftnodes.push_back(i1);
-                        leftnodes.push_back(i5);
-                        leftnodes.push_back(i8);
-                        leftnodes.push_back(i4);
-                    }
-                    if(i==t_meshdata.m_nx){
-                        // for right bc elements
-                        rightconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i2);
-                        rightconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i3);
-                        rightconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i7);
-                        rightconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i6);
-
-                        rightnodes.push_back(i2);
-                        rightnodes.push_back(i3);
-                        rightnodes.push_back(i7);
-                        rightnodes.push_back(i6);
-                    }
-                    if(j==1){
-                        // for bottom bc elements
-                        bottomconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i1);
-                        bottomconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i2);
-                        bottomconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i6);
-                        bottomconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i5);
-
-                        bottomnodes.push_back(i1);
-                        bottomnodes.push_back(i2);
-                        bottomnodes.push_back(i6);
-                        bottomnodes.push_back(i5);
-                    }
-                    if(j==t_meshdata.m_ny){
-                        // for bottom bc elements
-                        topconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i4);
-                        topconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i8);
-                        topconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i7);
-                        topconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i3);
-
-                        topnodes.push_back(i4);
-                        topnodes.push_back(i8);
-                        topnodes.push_back(i7);
-                        topnodes.push_back(i3);
-                    }
-                    if(k==1){
-                        // for back bc elements
-                        backconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i1);
-                        backconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i4);
-                        backconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i3);
-                        backconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i2);
-
-                        backnodes.push_back(i1);
-                        backnodes.push_back(i4);
-                        backnodes.push_back(i3);
-                        backnodes.push_back(i2);
-                    }
-                    if(k==t_meshdata.m_nz){
-                        // for front bc elements
-                        frontconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i5);
-                        frontconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i6);
-                        frontconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i7);
-                        frontconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i8);
-
-                        frontnodes.push_back(i5);
-                        frontnodes.push_back(i6);
-                        frontnodes.push_back(i7);
-                        frontnodes.push_back(i8);
+            // make a copy for nodcal coordinates
+            t_meshdata.m_nodecoords=t_meshdata.m_nodecoords0;
+            // for the connectivity information of bulk elements
+            t_meshdata.m_bulkelmt_connectivity.reserve(t_meshdata.m_bulkelmts,t_meshdata.m_bulkelmts*t_meshdata.m_nodesperbulkelmt);
+            t_meshdata.m_bulkelmt_volume.resize(t_meshdata.m_bulkelmts,0.0);
+            leftconn.resize(t_meshdata.m_ny*t_meshdata.m_nz);
+            rightconn.resize(t_meshdata.m_ny*t_meshdata.m_nz);
+            //
+            bottomconn.resize(t_meshdata.m_nx*t_meshdata.m_nz);
+            topconn.resize(t_meshdata.m_nx*t_meshdata.m_nz);
+            //
+            backconn.resize(t_meshdata.m_nx*t_meshdata.m_ny);
+            frontconn.resize(t_meshdata.m_nx*t_meshdata.m_ny);
+
+            leftnodes.clear();rightnodes.clear();
+            bottomnodes.clear();rightnodes.clear();
+            backnodes.clear();frontnodes.clear();
+
+            tempconn.clear();
+
+            for(k=1;k<=t_meshdata.m_nz;k++){
+                for(j=1;j<=t_meshdata.m_ny;j++){
+                    for(i=1;i<=t_meshdata.m_nx;i++){
+                        e=(j-1)*t_meshdata.m_nx+i+(k-1)*t_meshdata.m_nx*t_meshdata.m_ny;
+                        i1=(j-1)*(t_meshdata.m_nx+1)+i+(k-1)*(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
+                        i2=i1+1;
+                        i3=i2+t_meshdata.m_nx+1;
+                        i4=i3-1;
+                        i5=i1+(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
+                        i6=i2+(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
+                        i7=i3+(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
+                        i8=i4+(t_meshdata.m_nx+1)*(t_meshdata.m_ny+1);
+
+                        tempconn.push_back(e);
+
+                        elconn.clear();
+                        elconn.push_back(i1);
+                        elconn.push_back(i2);
+                        elconn.push_back(i3);
+                        elconn.push_back(i4);
+                        elconn.push_back(i5);
+                        elconn.push_back(i6);
+                        elconn.push_back(i7);
+                        elconn.push_back(i8);
+                        t_meshdata.m_bulkelmt_connectivity.push_back(elconn);
+
+                        t_meshdata.m_bulkelmt_volume[e-1]=dx*dy*dz;// for the volume of e-th bulk element
+
+                        if(i==1){
+                            // for left bc elements
+                            leftconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i1);
+                            leftconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i5);
+                            leftconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i8);
+                            leftconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i4);
+
+                            leftnodes.push_back(i1);
+                            leftnodes.push_back(i5);
+                            leftnodes.push_back(i8);
+                            leftnodes.push_back(i4);
+                        }
+                        if(i==t_meshdata.m_nx){
+                            // for right bc elements
+                            rightconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i2);
+                            rightconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i3);
+                            rightconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i7);
+                            rightconn[(k-1)*t_meshdata.m_ny+j-1].push_back(i6);
+
+                            rightnodes.push_back(i2);
+                            rightnodes.push_back(i3);
+                            rightnodes.push_back(i7);
+                            rightnodes.push_back(i6);
+                        }
+                        if(j==1){
+                            // for bottom bc elements
+                            bottomconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i1);
+                            bottomconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i2);
+                            bottomconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i6);
+                            bottomconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i5);
+
+                            bottomnodes.push_back(i1);
+                            bottomnodes.push_back(i2);
+                            bottomnodes.push_back(i6);
+                            bottomnodes.push_back(i5);
+                        }
+                        if(j==t_meshdata.m_ny){
+                            // for bottom bc elements
+                            topconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i4);
+                            topconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i8);
+                            topconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i7);
+                            topconn[(k-1)*t_meshdata.m_nx+i-1].push_back(i3);
+
+                            topnodes.push_back(i4);
+                            topnodes.push_back(i8);
+                            topnodes.push_back(i7);
+                            topnodes.push_back(i3);
+                        }
+                        if(k==1){
+                            // for back bc elements
+                            backconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i1);
+                            backconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i4);
+                            backconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i3);
+                            backconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i2);
+
+                            backnodes.push_back(i1);
+                            backnodes.push_back(i4);
+                            backnodes.push_back(i3);
+                            backnodes.push_back(i2);
+                        }
+                        if(k==t_meshdata.m_nz){
+                            // for front bc elements
+                            frontconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i5);
+                            frontconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i6);
+                            frontconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i7);
+                            frontconn[(j-1)*t_meshdata.m_nx+i-1].push_back(i8);
+
+                            frontnodes.push_back(i5);
+                            frontnodes.push_back(i6);
+                            frontnodes.push_back(i7);
+                            frontnodes.push_back(i8);
+                        }
                     }
                 }
             }
@@ -380,7 +389,7 @@ bool Lagrange3DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
         // make a copy for coordniate
         t_meshdata.m_nodecoords=t_meshdata.m_nodecoords0;
         // for the connectivity information of bulk elements
-        t_meshdata.m_bulkelmt_connectivity.resize(t_meshdata.m_bulkelmts,vector<int>(0));
+        t_meshdata.m_bulkelmt_connectivity.reserve(t_meshdata.m_bulkelmts,t_meshdata.m_bulkelmts*t_meshdata.m_nodesperbulkelmt);
         t_meshdata.m_bulkelmt_volume.resize(t_meshdata.m_bulkelmts,0.0);
         leftconn.resize(t_meshdata.m_ny*t_meshdata.m_nz);
         rightconn.resize(t_meshdata.m_ny*t_meshdata.m_nz);
@@ -424,29 +433,30 @@ bool Lagrange3DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
 
                     tempconn.push_back(e);
 
-                    t_meshdata.m_bulkelmt_connectivity[e-1].clear();
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i1);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i2);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i3);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i4);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i5);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i6);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i7);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i8);
-
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i9);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i10);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i11);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i12);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i13);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i14);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i15);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i16);
-
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i17);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i18);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i19);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i20);
+                    elconn.clear();
+                    elconn.push_back(i1);
+                    elconn.push_back(i2);
+                    elconn.push_back(i3);
+                    elconn.push_back(i4);
+                    elconn.push_back(i5);
+                    elconn.push_back(i6);
+                    elconn.push_back(i7);
+                    elconn.push_back(i8);
+
+                    elconn.push_back(i9);
+                    elconn.push_back(i10);
+                    elconn.push_back(i11);
+                    elconn.push_back(i12);
+                    elconn.push_back(i13);
+                    elconn.push_back(i14);
+                    elconn.push_back(i15);
+                    elconn.push_back(i16);
+
+                    elconn.push_back(i17);
+                    elconn.push_back(i18);
+                    elconn.push_back(i19);
+                    elconn.push_back(i20);
+                    t_meshdata.m_bulkelmt_connectivity.push_back(elconn);
                    
                     t_meshdata.m_bulkelmt_volume[e-1]=2.0*dx*2.0*dy*2.0*dz;
 
@@ -652,7 +662,7 @@ bool Lagrange3DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
         // make a copy for coordniate
         t_meshdata.m_nodecoords=t_meshdata.m_nodecoords0;
         // for the connectivity information of bulk elements
-        t_meshdata.m_bulkelmt_connectivity.resize(t_meshdata.m_bulkelmts,vector<int>(0));
+        t_meshdata.m_bulkelmt_connectivity.reserve(t_meshdata.m_bulkelmts,t_meshdata.m_bulkelmts*t_meshdata.m_nodesperbulkelmt);
         t_meshdata.m_bulkelmt_volume.resize(t_meshdata.m_bulkelmts,0.0);
         leftconn.resize(t_meshdata.m_ny*t_meshdata.m_nz);
         rightconn.resize(t_meshdata.m_ny*t_meshdata.m_nz);
@@ -710,36 +720,37 @@ bool Lagrange3DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
 
                     tempconn.push_back(e);
 
-                    t_meshdata.m_bulkelmt_connectivity[e-1].clear();
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i1);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i2);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i3);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i4);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i5);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i6);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i7);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i8);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i9);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i10);
-
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i11);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i12);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i13);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i14);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i15);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i16);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i17);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i18);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i19);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i20);
-
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i21);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i22);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i23);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i24);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i25);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i26);
-                    t_meshdata.m_bulkelmt_connectivity[e-1].push_back(i27);
+                    elconn.clear();
+                    elconn.push_back(i1);
+                    elconn.push_back(i2);
+                    elconn.push_back(i3);
+                    elconn.push_back(i4);
+                    elconn.push_back(i5);
+                    elconn.push_back(i6);
+                    elconn.push_back(i7);
+                    elconn.push_back(i8);
+                    elconn.push_back(i9);
+                    elconn.push_back(i10);
+
+                    elconn.push_back(i11);
+                    elconn.push_back(i12);
+                    elconn.push_back(i13);
+                    elconn.push_back(i14);
+                    elconn.push_back(i15);
+                    elconn.push_back(i16);
+                    elconn.push_back(i17);
+                    elconn.push_back(i18);
+                    elconn.push_back(i19);
+                    elconn.push_back(i20);
+
+                    elconn.push_back(i21);
+                    elconn.push_back(i22);
+                    elconn.push_back(i23);
+                    elconn.push_back(i24);
+                    elconn.push_back(i25);
+                    elconn.push_back(i26);
+                    elconn.push_back(i27);
+                    t_meshdata.m_bulkelmt_connectivity.push_back(elconn);
                    
                     t_meshdata.m_bulkelmt_volume[e-1]=2.0*dx*2.0*dy*2.0*dz;
 
@@ -927,7 +938,7 @@ bool Lagrange3DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
     t_meshdata.m_phygroup_elmtnumvec.resize(t_meshdata.m_phygroups);
     t_meshdata.m_phygroup_nodesnumperelmtvec.resize(t_meshdata.m_phygroups);
     t_meshdata.m_phygroup_name2dimvec.resize(t_meshdata.m_phygroups);
-    t_meshdata.m_phygroup_name2elmtconnvec.resize(t_meshdata.m_phygroups);
+    t_meshdata.m_phygroup_name2elmtidvec.resize(t_meshdata.m_phygroups);
     // now we can add physical group information
     t_meshdata.m_phygroup_dimvec[0]=2;// for left    surface
     t_meshdata.m_phygroup_dimvec[1]=2;// for right   surface
@@ -976,14 +987,14 @@ bool Lagrange3DMeshGenerator::generateMesh(const MeshType &t_meshtype,MeshData &
     t_meshdata.m_phygroup_name2dimvec[4]=make_pair("back",     2);
     t_meshdata.m_phygroup_name2dimvec[5]=make_pair("front",    2);
     t_meshdata.m_phygroup_name2dimvec[6]=make_pair("alldomain",3);
-    //*** for phy name to element connectivity map
-    t_meshdata.m_phygroup_name2elmtconnvec[0]=make_pair("left",                               leftconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[1]=make_pair("right",                             rightconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[2]=make_pair("bottom",                           bottomconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[3]=make_pair("top",                                 topconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[4]=make_pair("back",                               backconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[5]=make_pair("front",                             frontconn);
-    t_meshdata.m_phygroup_name2elmtconnvec[6]=make_pair("alldomain",t_meshdata.m_bulkelmt_connectivity);
+    //*** for phy name to element ids map, the boundary elements go to the surface element connectivity
+    t_meshdata.m_phygroup_name2elmtidvec[0]=make_pair("left",appendBCElmtConnectivity(leftconn,t_meshdata.m_surfaceelmt_connectivity));
+    t_meshdata.m_phygroup_name2elmtidvec[1]=make_pair("right",appendBCElmtConnectivity(rightconn,t_meshdata.m_surfaceelmt_connectivity));
+    t_meshdata.m_phygroup_name2elmtidvec[2]=make_pair("bottom",appendBCElmtConnectivity(bottomconn,t_meshdata.m_surfaceelmt_connectivity));
+    t_meshdata.m_phygroup_name2elmtidvec[3]=make_pair("top",appendBCElmtConnectivity(topconn,t_meshdata.m_surfaceelmt_connectivity));
+    t_meshdata.m_phygroup_name2elmtidvec[4]=make_pair("back",appendBCElmtConnectivity(backconn,t_meshdata.m_surfaceelmt_connectivity));
+    t_meshdata.m_phygroup_name2elmtidvec[5]=make_pair("front",appendBCElmtConnectivity(frontconn,t_meshdata.m_surfaceelmt_connectivity));
+    t_meshdata.m_phygroup_name2elmtidvec[6]=make_pair("alldomain",tempconn);
     //*** for phy name to bulk element id map
     t_meshdata.m_phygroup_name2bulkelmtidvec.clear();
     t_meshdata.m_phygroup_name2bulkelmtidvec.push_back(make_pair("alldomain",tempconn));
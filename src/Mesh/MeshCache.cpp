@@ -0,0 +1,435 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the binary cache of the imported mesh, i.e. xxx.msh
+//+++          is cached in xxx.msh.cache. The file has a versioned
+//+++          header with the size and the hash of the source file,
+//+++          then the raw arrays of the mesh data, each one starts
+//+++          from an 8-byte aligned offset, so the file can be
+//+++          mapped into memory and copied directly
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+
+#include "Mesh/BulkMesh.h"
+#include "Mesh/MshFileTokenizer.h"
+
+const char MeshCacheMagic[8]={'A','S','F','E','M','M','S','H'};
+const int MeshCacheVersion=1;
+const int MeshCacheEndianFlag=0x01020304;
+
+/**
+ * the 64-bit FNV-1a hash and the size of the source mesh file
+ */
+static bool getMeshFileHash(const string &filename,uint64_t &hash,uint64_t &filesize){
+    size_t size;
+    const unsigned char *data=MshFileTokenizer::mapFile(filename,size);
+    if(!data) return false;
+    hash=14695981039346656037ULL;
+    for(size_t i=0;i<size;i++){
+        hash^=static_cast<uint64_t>(data[i]);
+        hash*=1099511628211ULL;
+    }
+    filesize=static_cast<uint64_t>(size);
+    MshFileTokenizer::unmapFile(data,size);
+    return true;
+}
+
+//**************************************************************
+//*** for the writing
+//**************************************************************
+static void writeCachePadding(std::ofstream &out){
+    const char zeros[8]={0,0,0,0,0,0,0,0};
+    const std::streamoff pos=out.tellp();
+    if(pos%8) out.write(zeros,8-pos%8);
+}
+template<typename T>
+static void writeCacheValue(std::ofstream &out,const T &val){
+    out.write(reinterpret_cast<const char*>(&val),sizeof(T));
+    writeCachePadding(out);
+}
+template<typename T>
+static void writeCacheArray(std::ofstream &out,const T *data,const uint64_t &n){
+    out.write(reinterpret_cast<const char*>(&n),sizeof(uint64_t));
+    if(n) out.write(reinterpret_cast<const char*>(data),n*sizeof(T));
+    writeCachePadding(out);
+}
+template<typename T>
+static void writeCacheArray(std::ofstream &out,const vector<T> &vec){
+    writeCacheArray(out,vec.data(),static_cast<uint64_t>(vec.size()));
+}
+static void writeCacheString(std::ofstream &out,const string &str){
+    writeCacheArray(out,str.data(),static_cast<uint64_t>(str.size()));
+}
+static void writeCacheConnectivity(std::ofstream &out,const ElmtConnectivity &conn){
+    writeCacheArray(out,conn.getOffsetsRef());
+    writeCacheArray(out,conn.getNodeIDsRef());
+}
+static void writeCacheStrings(std::ofstream &out,const vector<string> &strs){
+    writeCacheValue(out,static_cast<uint64_t>(strs.size()));
+    for(const auto &str:strs) writeCacheString(out,str);
+}
+static void writeCacheGroups(std::ofstream &out,const vector<pair<string,vector<int>>> &groups){
+    writeCacheValue(out,static_cast<uint64_t>(groups.size()));
+    for(const auto &it:groups){
+        writeCacheString(out,it.first);
+        writeCacheArray(out,it.second);
+    }
+}
+static void writeCacheGroups(std::ofstream &out,const vector<pair<string,int>> &groups){
+    writeCacheValue(out,static_cast<uint64_t>(groups.size()));
+    for(const auto &it:groups){
+        writeCacheString(out,it.first);
+        writeCacheValue(out,it.second);
+    }
+}
+static void writeCacheGroups(std::ofstream &out,const vector<pair<int,string>> &groups){
+    writeCacheValue(out,static_cast<uint64_t>(groups.size()));
+    for(const auto &it:groups){
+        writeCacheValue(out,it.first);
+        writeCacheString(out,it.second);
+    }
+}
+
+//**************************************************************
+//*** for the reading, the cursor moves over the mapped file
+//**************************************************************
+/**
+ * the read-only cursor over the mapped cache file, it becomes invalid once any read is out of range
+ */
+struct MeshCacheCursor{
+    const unsigned char *m_data;/**< the mapped file */
+    size_t m_size;/**< the size of the mapped file */
+    size_t m_pos;/**< the current offset */
+    bool m_good;/**< false if any read is out of range */
+
+    inline void skipPadding(){
+        if(m_pos%8) m_pos+=8-m_pos%8;
+    }
+    template<typename T>
+    inline void readValue(T &val){
+        if(!m_good||m_pos+sizeof(T)>m_size){m_good=false;return;}
+        memcpy(&val,m_data+m_pos,sizeof(T));
+        m_pos+=sizeof(T);
+        skipPadding();
+    }
+    /**
+     * get the pointer to the array and its length, the pointer refers to the mapped file
+     */
+    template<typename T>
+    inline const T* readArray(uint64_t &n){
+        n=0;
+        readArrayHeader(n);
+        if(!m_good||n>(m_size-m_pos)/sizeof(T)){m_good=false;n=0;return nullptr;}
+        const T *ptr=reinterpret_cast<const T*>(m_data+m_pos);
+        m_pos+=n*sizeof(T);
+        skipPadding();
+        return ptr;
+    }
+    template<typename T>
+    inline void readArray(vector<T> &vec){
+        uint64_t n;
+        const T *ptr=readArray<T>(n);
+        if(!m_good){vec.clear();return;}
+        vec.resize(n);
+        if(n) memcpy(vec.data(),ptr,n*sizeof(T));
+    }
+    inline void readString(string &str){
+        uint64_t n;
+        const char *ptr=readArray<char>(n);
+        if(!m_good){str.clear();return;}
+        str.assign(ptr,n);
+    }
+    inline void readConnectivity(ElmtConnectivity &conn){
+        vector<int> offsets;
+        uint64_t n;
+        readArray(offsets);
+        const int *nodeids=readArray<int>(n);
+        if(!m_good||offsets.empty()||offsets[0]!=0||offsets.back()!=static_cast<int>(n)){
+            m_good=false;return;
+        }
+        conn.assign(static_cast<int>(offsets.size())-1,offsets.data(),nodeids);
+    }
+    inline void readStrings(vector<string> &strs){
+        uint64_t n=0;
+        readValue(n);
+        if(!m_good||n>m_size) {m_good=false;return;}
+        strs.resize(n);
+        for(auto &str:strs) readString(str);
+    }
+    inline void readGroups(vector<pair<string,vector<int>>> &groups){
+        uint64_t n=0;
+        readValue(n);
+        if(!m_good||n>m_size) {m_good=false;return;}
+        groups.resize(n);
+        for(auto &it:groups){
+            readString(it.first);
+            readArray(it.second);
+        }
+    }
+    inline void readGroups(vector<pair<string,int>> &groups){
+        uint64_t n=0;
+        readValue(n);
+        if(!m_good||n>m_size) {m_good=false;return;}
+        groups.resize(n);
+        for(auto &it:groups){
+            readString(it.first);
+            readValue(it.second);
+        }
+    }
+    inline void readGroups(vector<pair<int,string>> &groups){
+        uint64_t n=0;
+        readValue(n);
+        if(!m_good||n>m_size) {m_good=false;return;}
+        groups.resize(n);
+        for(auto &it:groups){
+            readValue(it.first);
+            readString(it.second);
+        }
+    }
+
+private:
+    inline void readArrayHeader(uint64_t &n){
+        if(!m_good||m_pos+sizeof(uint64_t)>m_size){m_good=false;return;}
+        memcpy(&n,m_data+m_pos,sizeof(uint64_t));
+        m_pos+=sizeof(uint64_t);
+    }
+};
+
+string BulkMesh::getMeshCacheFileName(const string &meshfile){
+    return meshfile+".cache";
+}
+
+void BulkMesh::saveBulkMesh2Cache(const string &meshfile)const{
+    PetscMPIInt rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    if(rank!=0) return;
+
+    uint64_t hash,filesize;
+    if(!getMeshFileHash(meshfile,hash,filesize)){
+        MessagePrinter::printWarningTxt("can\'t read the mesh file(="+meshfile+") for its hash, the mesh cache is not saved");
+        return;
+    }
+
+    string cachefile=getMeshCacheFileName(meshfile);
+    string tmpfile=cachefile+".tmp";
+    std::ofstream out;
+    out.open(tmpfile,std::ios::out|std::ios::binary);
+    if(!out.is_open()){
+        MessagePrinter::printWarningTxt("can\'t create the mesh cache file(="+tmpfile+"), the mesh cache is not saved");
+        return;
+    }
+
+    //****************************************
+    //*** the header
+    //****************************************
+    out.write(MeshCacheMagic,8);
+    out.write(reinterpret_cast<const char*>(&MeshCacheVersion),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&MeshCacheEndianFlag),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&filesize),sizeof(uint64_t));
+    out.write(reinterpret_cast<const char*>(&hash),sizeof(uint64_t));
+
+    //****************************************
+    //*** the scalars
+    //****************************************
+    const int ints[]={m_meshdata.m_maxdim,m_meshdata.m_mindim,
+                      m_meshdata.m_nx,m_meshdata.m_ny,m_meshdata.m_nz,
+                      m_meshdata.m_order,static_cast<int>(m_meshdata.m_isstructured),
+                      m_meshdata.m_nodes,m_meshdata.m_nodesperbulkelmt,
+                      m_meshdata.m_nodesperlineelmt,m_meshdata.m_nodespersurfaceelmt,
+                      m_meshdata.m_elements,m_meshdata.m_bulkelmts,m_meshdata.m_pointelmts,
+                      m_meshdata.m_lineelmts,m_meshdata.m_surfaceelmts,
+                      m_meshdata.m_phygroups,m_meshdata.m_nodal_phygroups,
+                      static_cast<int>(m_meshdata.m_bulkelmt_type),
+                      static_cast<int>(m_meshdata.m_lineelmt_type),
+                      static_cast<int>(m_meshdata.m_surfaceelmt_type),
+                      m_meshdata.m_bulkelmt_vtktype,m_meshdata.m_lineelmt_vtktype,
+                      m_meshdata.m_surfaceelmt_vtktype};
+    const double doubles[]={m_meshdata.m_xmin,m_meshdata.m_xmax,
+                            m_meshdata.m_ymin,m_meshdata.m_ymax,
+                            m_meshdata.m_zmin,m_meshdata.m_zmax};
+    writeCacheArray(out,ints,sizeof(ints)/sizeof(int));
+    writeCacheArray(out,doubles,sizeof(doubles)/sizeof(double));
+    writeCacheString(out,m_meshdata.m_bulkelmt_typename);
+
+    //****************************************
+    //*** the nodes and the elements
+    //****************************************
+    writeCacheArray(out,m_meshdata.m_nodecoords0);
+    writeCacheArray(out,m_meshdata.m_nodecoords);
+    writeCacheConnectivity(out,m_meshdata.m_bulkelmt_connectivity);
+    writeCacheArray(out,m_meshdata.m_bulkelmt_volume);
+    writeCacheConnectivity(out,m_meshdata.m_pointelmt_connectivity);
+    writeCacheArray(out,m_meshdata.m_pointelmt_volume);
+    writeCacheConnectivity(out,m_meshdata.m_lineelmt_connectivity);
+    writeCacheArray(out,m_meshdata.m_lineelmt_volume);
+    writeCacheConnectivity(out,m_meshdata.m_surfaceelmt_connectivity);
+    writeCacheArray(out,m_meshdata.m_surfaceelmt_volume);
+
+    //****************************************
+    //*** the physical groups
+    //****************************************
+    writeCacheArray(out,m_meshdata.m_phygroup_dimvec);
+    writeCacheStrings(out,m_meshdata.m_phygroup_phynamevec);
+    writeCacheArray(out,m_meshdata.m_phygroup_phyidvec);
+    writeCacheArray(out,m_meshdata.m_phygroup_elmtnumvec);
+    writeCacheArray(out,m_meshdata.m_phygroup_nodesnumperelmtvec);
+    writeCacheGroups(out,m_meshdata.m_phygroup_name2elmtidvec);
+    writeCacheGroups(out,m_meshdata.m_phygroup_name2bulkelmtidvec);
+    writeCacheGroups(out,m_meshdata.m_phygroup_name2dimvec);
+    writeCacheGroups(out,m_meshdata.m_phygroup_name2phyidvec);
+    writeCacheGroups(out,m_meshdata.m_phygroup_phyid2namevec);
+
+    writeCacheGroups(out,m_meshdata.m_nodephygroup_name2nodeidvec);
+    writeCacheGroups(out,m_meshdata.m_nodephygroup_name2phyidvec);
+    writeCacheGroups(out,m_meshdata.m_nodephygroup_phyid2namevec);
+    writeCacheStrings(out,m_meshdata.m_nodephygroup_phynamevec);
+    writeCacheArray(out,m_meshdata.m_nodephygroup_phyidvec);
+
+    if(!out.good()){
+        out.close();
+        std::remove(tmpfile.c_str());
+        MessagePrinter::printWarningTxt("failed to write the mesh cache file(="+tmpfile+")");
+        return;
+    }
+    out.close();
+    if(std::rename(tmpfile.c_str(),cachefile.c_str())!=0){
+        std::remove(tmpfile.c_str());
+        MessagePrinter::printWarningTxt("can\'t rename "+tmpfile+" to "+cachefile);
+        return;
+    }
+    MessagePrinter::printNormalTxt("save mesh cache to "+cachefile);
+}
+
+bool BulkMesh::loadBulkMeshFromCache(const string &meshfile){
+    PetscMPIInt rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    string cachefile=getMeshCacheFileName(meshfile);
+
+    // only the master rank checks the hash of the source file, then all the ranks know whether the cache is valid
+    int IsValid=0;
+    uint64_t hash=0,filesize=0;
+    if(rank==0){
+        IsValid=getMeshFileHash(meshfile,hash,filesize)?1:0;
+    }
+    MPI_Bcast(&IsValid,1,MPI_INT,0,PETSC_COMM_WORLD);
+    if(!IsValid) return false;
+    MPI_Bcast(&hash,1,MPI_UINT64_T,0,PETSC_COMM_WORLD);
+    MPI_Bcast(&filesize,1,MPI_UINT64_T,0,PETSC_COMM_WORLD);
+
+    size_t size;
+    const unsigned char *data=MshFileTokenizer::mapFile(cachefile,size);
+    MeshCacheCursor cursor{data,size,0,data!=nullptr};
+
+    //****************************************
+    //*** check the header
+    //****************************************
+    // magic(8 bytes), version(int), endian flag(int), source size(uint64), source hash(uint64)
+    char magic[8]={0,0,0,0,0,0,0,0};
+    int version=-1,endianflag=-1;
+    uint64_t cachedhash=0,cachedsize=0;
+    if(cursor.m_good&&size>=32){
+        memcpy(magic,data,8);
+        memcpy(&version,data+8,sizeof(int));
+        memcpy(&endianflag,data+12,sizeof(int));
+        memcpy(&cachedsize,data+16,sizeof(uint64_t));
+        memcpy(&cachedhash,data+24,sizeof(uint64_t));
+        cursor.m_pos=32;
+    }
+    else{
+        cursor.m_good=false;
+    }
+    IsValid=(cursor.m_good&&
+             string(magic,8)==string(MeshCacheMagic,8)&&
+             version==MeshCacheVersion&&
+             endianflag==MeshCacheEndianFlag&&
+             cachedsize==filesize&&cachedhash==hash)?1:0;
+
+    //****************************************
+    //*** read the mesh data
+    //****************************************
+    MeshData &meshdata=m_meshdata;
+    vector<int> ints;
+    vector<double> doubles;
+    if(IsValid){
+        cursor.readArray(ints);
+        cursor.readArray(doubles);
+        if(ints.size()!=24||doubles.size()!=6) cursor.m_good=false;
+    }
+    if(IsValid&&cursor.m_good){
+        meshdata.m_maxdim=ints[0];meshdata.m_mindim=ints[1];
+        meshdata.m_nx=ints[2];meshdata.m_ny=ints[3];meshdata.m_nz=ints[4];
+        meshdata.m_order=ints[5];meshdata.m_isstructured=(ints[6]!=0);
+        meshdata.m_nodes=ints[7];meshdata.m_nodesperbulkelmt=ints[8];
+        meshdata.m_nodesperlineelmt=ints[9];meshdata.m_nodespersurfaceelmt=ints[10];
+        meshdata.m_elements=ints[11];meshdata.m_bulkelmts=ints[12];meshdata.m_pointelmts=ints[13];
+        meshdata.m_lineelmts=ints[14];meshdata.m_surfaceelmts=ints[15];
+        meshdata.m_phygroups=ints[16];meshdata.m_nodal_phygroups=ints[17];
+        meshdata.m_bulkelmt_type=static_cast<MeshType>(ints[18]);
+        meshdata.m_lineelmt_type=static_cast<MeshType>(ints[19]);
+        meshdata.m_surfaceelmt_type=static_cast<MeshType>(ints[20]);
+        meshdata.m_bulkelmt_vtktype=ints[21];meshdata.m_lineelmt_vtktype=ints[22];
+        meshdata.m_surfaceelmt_vtktype=ints[23];
+        meshdata.m_xmin=doubles[0];meshdata.m_xmax=doubles[1];
+        meshdata.m_ymin=doubles[2];meshdata.m_ymax=doubles[3];
+        meshdata.m_zmin=doubles[4];meshdata.m_zmax=doubles[5];
+        cursor.readString(meshdata.m_bulkelmt_typename);
+
+        cursor.readArray(meshdata.m_nodecoords0);
+        cursor.readArray(meshdata.m_nodecoords);
+        cursor.readConnectivity(meshdata.m_bulkelmt_connectivity);
+        cursor.readArray(meshdata.m_bulkelmt_volume);
+        cursor.readConnectivity(meshdata.m_pointelmt_connectivity);
+        cursor.readArray(meshdata.m_pointelmt_volume);
+        cursor.readConnectivity(meshdata.m_lineelmt_connectivity);
+        cursor.readArray(meshdata.m_lineelmt_volume);
+        cursor.readConnectivity(meshdata.m_surfaceelmt_connectivity);
+        cursor.readArray(meshdata.m_surfaceelmt_volume);
+
+        cursor.readArray(meshdata.m_phygroup_dimvec);
+        cursor.readStrings(meshdata.m_phygroup_phynamevec);
+        cursor.readArray(meshdata.m_phygroup_phyidvec);
+        cursor.readArray(meshdata.m_phygroup_elmtnumvec);
+        cursor.readArray(meshdata.m_phygroup_nodesnumperelmtvec);
+        cursor.readGroups(meshdata.m_phygroup_name2elmtidvec);
+        cursor.readGroups(meshdata.m_phygroup_name2bulkelmtidvec);
+        cursor.readGroups(meshdata.m_phygroup_name2dimvec);
+        cursor.readGroups(meshdata.m_phygroup_name2phyidvec);
+        cursor.readGroups(meshdata.m_phygroup_phyid2namevec);
+
+        cursor.readGroups(meshdata.m_nodephygroup_name2nodeidvec);
+        cursor.readGroups(meshdata.m_nodephygroup_name2phyidvec);
+        cursor.readGroups(meshdata.m_nodephygroup_phyid2namevec);
+        cursor.readStrings(meshdata.m_nodephygroup_phynamevec);
+        cursor.readArray(meshdata.m_nodephygroup_phyidvec);
+
+        if(!cursor.m_good||
+           static_cast<int>(meshdata.m_nodecoords0.size())!=3*meshdata.m_nodes||
+           meshdata.m_bulkelmt_connectivity.size()!=meshdata.m_bulkelmts){
+            cursor.m_good=false;
+        }
+    }
+    MshFileTokenizer::unmapFile(data,size);
+
+    // the cache is used only if it is valid on all the ranks
+    int IsLoaded=(IsValid&&cursor.m_good)?1:0,IsLoadedGlobal;
+    MPI_Allreduce(&IsLoaded,&IsLoadedGlobal,1,MPI_INT,MPI_MIN,PETSC_COMM_WORLD);
+    if(!IsLoadedGlobal){
+        // the partially loaded mesh data is dropped, then the mesh file is imported from scratch
+        if(IsValid) releaseMemory();
+        if(data) MessagePrinter::printNormalTxt("the mesh cache(="+cachefile+") is out of date or broken, the mesh file is imported");
+        return false;
+    }
+    MessagePrinter::printNormalTxt("load mesh from the cache file(="+cachefile+")");
+    return true;
+}
@@ -19,6 +19,11 @@ MeshGenerator::MeshGenerator(){
 }
 
 bool MeshGenerator::createMesh(const int &dim,const MeshType &meshtype,MeshData &meshdata){
+    if(meshdata.m_isimplicit&&meshtype!=MeshType::QUAD4&&meshtype!=MeshType::HEX8){
+        MessagePrinter::printErrorTxt("the implicit mesh only supports quad4 and hex8, please check the meshtype of your mesh block");
+        m_isMeshGenerated=false;
+        return m_isMeshGenerated;
+    }
     if(dim==1){
         m_isMeshGenerated=Lagrange1DMeshGenerator::generateMesh(meshtype,meshdata);
     }
@@ -33,6 +38,9 @@ bool MeshGenerator::createMesh(const int &dim,const MeshType &meshtype,MeshData
         MessagePrinter::exitAsFem();
     }
 
+    // the generated mesh is always a tensor-product grid, which is required by the geometric multigrid
+    meshdata.m_isstructured=m_isMeshGenerated;
+
     return m_isMeshGenerated;
 
 }
\ No newline at end of file
@@ -0,0 +1,584 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: build the distributed mesh directly from the msh4
+//+++          records parsed by each rank. The nodes are sent to
+//+++          their home ranks (split by the node tag), the bulk
+//+++          elements are sent to the owners of the same blocks
+//+++          as BulkMesh::distributeBulkMesh, the lower dim ones
+//+++          to the owner of the 1st bulk element containing
+//+++          them. All the data is routed by MPI_Alltoallv, so
+//+++          the whole mesh is never stored on any rank
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <iterator>
+
+#include "Mesh/Msh4FileImporter.h"
+#include "Mesh/BulkMesh.h"
+
+/**
+ * send the i-th bucket to the i-th rank, the received values are stored in the rank order
+ * @param buckets the values sent to each rank, they are released after the exchange
+ * @param datatype the mpi data type of the values
+ * @param recv the received values
+ * @param recvcounts the number of the values received from each rank
+ */
+template<typename T>
+static void exchangeBuckets(vector<vector<T>> &buckets,MPI_Datatype datatype,vector<T> &recv,vector<int> &recvcounts){
+    PetscMPIInt size;
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    vector<int> sendcounts(size,0),senddispls(size,0),recvdispls(size,0);
+    recvcounts.assign(size,0);
+    for(int i=0;i<size;i++) sendcounts[i]=static_cast<int>(buckets[i].size());
+    MPI_Alltoall(sendcounts.data(),1,MPI_INT,recvcounts.data(),1,MPI_INT,PETSC_COMM_WORLD);
+    for(int i=1;i<size;i++){
+        senddispls[i]=senddispls[i-1]+sendcounts[i-1];
+        recvdispls[i]=recvdispls[i-1]+recvcounts[i-1];
+    }
+    vector<T> send;
+    send.reserve(senddispls[size-1]+sendcounts[size-1]);
+    for(auto &bucket:buckets){
+        send.insert(send.end(),bucket.begin(),bucket.end());
+        vector<T>().swap(bucket);
+    }
+    recv.resize(recvdispls[size-1]+recvcounts[size-1]);
+    MPI_Alltoallv(send.data(),sendcounts.data(),senddispls.data(),datatype,
+                  recv.data(),recvcounts.data(),recvdispls.data(),datatype,PETSC_COMM_WORLD);
+}
+
+bool Msh4FileImporter::buildDistributedMesh(const int &mshMaxDim,const int (&nodesummary)[4],
+                                            vector<int> &nodetags,vector<double> &nodecoords,
+                                            const int (&elmtsummary)[4],const vector<int> &blockinfo,vector<int> &elmts,
+                                            const vector<int> &mshPhyGroupDimVec,const vector<int> &mshPhyGroupIDVec,
+                                            const vector<string> &mshPhyGroupNameVec,const int &mshBulkPhyGroupNum,
+                                            const vector<int> &mshNodalPhyGroupIDVec,const vector<string> &mshNodalPhyGroupNameVec,
+                                            MeshData &meshdata){
+    PetscMPIInt rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+
+    int i,j,k,e,r;
+    vector<vector<int>> ibuckets(size);
+    vector<vector<double>> dbuckets(size);
+    vector<int> irecv,counts;
+    vector<double> drecv;
+
+    //*****************************************************
+    //*** the nodes are sent to their home ranks
+    //*****************************************************
+    const int numNodes=nodesummary[2-1],minNodeTag=nodesummary[3-1],maxNodeTag=nodesummary[4-1];
+    const int tagspan=std::max((maxNodeTag-minNodeTag+size)/size,1);
+    auto getNodeTagHome=[&](const int &tag)->int{
+        return std::min((tag-minNodeTag)/tagspan,static_cast<int>(size)-1);
+    };
+    for(i=0;i<static_cast<int>(nodetags.size());i++){
+        r=getNodeTagHome(nodetags[i]);
+        ibuckets[r].push_back(nodetags[i]);
+        dbuckets[r].insert(dbuckets[r].end(),nodecoords.begin()+3*i,nodecoords.begin()+3*i+3);
+    }
+    vector<int>().swap(nodetags);
+    vector<double>().swap(nodecoords);
+    exchangeBuckets(ibuckets,MPI_INT,irecv,counts);
+    exchangeBuckets(dbuckets,MPI_DOUBLE,drecv,counts);
+
+    // the active node id is the order of the node tag among all the nodes, so each home rank keeps a contiguous range of them
+    const int homecount=static_cast<int>(irecv.size());
+    vector<int> perm(homecount);
+    for(i=0;i<homecount;i++) perm[i]=i;
+    std::sort(perm.begin(),perm.end(),[&](const int &a,const int &b){return irecv[a]<irecv[b];});
+    vector<int> hometags(homecount);
+    vector<double> homecoords(3*homecount);
+    for(i=0;i<homecount;i++){
+        hometags[i]=irecv[perm[i]];
+        for(k=0;k<3;k++) homecoords[3*i+k]=drecv[3*perm[i]+k];
+        if(i>0&&hometags[i]==hometags[i-1]){
+            MessagePrinter::printErrorTxt("node Tag="+to_string(hometags[i])+" is duplicated in your msh4 file inside the $Nodes");
+            MessagePrinter::exitAsFem();
+        }
+    }
+    vector<int>().swap(perm);
+    vector<int>().swap(irecv);
+    vector<double>().swap(drecv);
+
+    int homestart=0,nNodes=0;
+    MPI_Exscan(&homecount,&homestart,1,MPI_INT,MPI_SUM,PETSC_COMM_WORLD);
+    if(rank==0) homestart=0;
+    MPI_Allreduce(&homecount,&nNodes,1,MPI_INT,MPI_SUM,PETSC_COMM_WORLD);
+    if(nNodes!=numNodes){
+        MessagePrinter::printErrorTxt("Something is wrong in your msh4 file inside the $Nodes block, nodes numer is not match with the first line");
+        MessagePrinter::exitAsFem();
+    }
+    vector<int> homestarts(size,0);
+    MPI_Allgather(&homestart,1,MPI_INT,homestarts.data(),1,MPI_INT,PETSC_COMM_WORLD);
+    auto getNodeHome=[&](const int &id)->int{
+        return static_cast<int>(std::upper_bound(homestarts.begin(),homestarts.end(),id-1)-homestarts.begin())-1;
+    };
+
+    double boxmin[3]={1.0e16,1.0e16,1.0e16},boxmax[3]={-1.0e16,-1.0e16,-1.0e16},box[3];
+    for(i=0;i<homecount;i++){
+        for(k=0;k<3;k++){
+            boxmin[k]=std::min(boxmin[k],homecoords[3*i+k]);
+            boxmax[k]=std::max(boxmax[k],homecoords[3*i+k]);
+        }
+    }
+    MPI_Allreduce(boxmin,box,3,MPI_DOUBLE,MPI_MIN,PETSC_COMM_WORLD);
+    meshdata.m_xmin=box[0];meshdata.m_ymin=box[1];meshdata.m_zmin=box[2];
+    MPI_Allreduce(boxmax,box,3,MPI_DOUBLE,MPI_MAX,PETSC_COMM_WORLD);
+    meshdata.m_xmax=box[0];meshdata.m_ymax=box[1];meshdata.m_zmax=box[2];
+
+    //*****************************************************
+    //*** the node tags of the elements to the active ids
+    //*****************************************************
+    // the records are packed as: block, element-id, nodes, node-1, node-2, ...
+    const int nrecords=static_cast<int>(elmts.size());
+    vector<int> reqtags;
+    for(k=0;k<nrecords;k+=3+elmts[k+2]){
+        for(j=0;j<elmts[k+2];j++){
+            const int tag=elmts[k+3+j];
+            if(tag<minNodeTag||tag>maxNodeTag){
+                MessagePrinter::printErrorTxt("Invalid node id(="+to_string(tag)+") in your elements, please check your msh4 file");
+                MessagePrinter::exitAsFem();
+            }
+            reqtags.push_back(tag);
+        }
+    }
+    std::sort(reqtags.begin(),reqtags.end());
+    reqtags.erase(std::unique(reqtags.begin(),reqtags.end()),reqtags.end());
+    // the tags are sorted, so the replies come back in the same order
+    for(const auto &tag:reqtags) ibuckets[getNodeTagHome(tag)].push_back(tag);
+    exchangeBuckets(ibuckets,MPI_INT,irecv,counts);
+    for(r=0,k=0;r<size;r++){
+        for(j=0;j<counts[r];j++,k++){
+            auto it=std::lower_bound(hometags.begin(),hometags.end(),irecv[k]);
+            if(it==hometags.end()||*it!=irecv[k]){
+                MessagePrinter::printErrorTxt("Invalid node id(="+to_string(irecv[k])+") in your elements, please check your msh4 file");
+                MessagePrinter::exitAsFem();
+            }
+            ibuckets[r].push_back(homestart+static_cast<int>(it-hometags.begin())+1);
+        }
+    }
+    vector<int> reqids;
+    exchangeBuckets(ibuckets,MPI_INT,reqids,counts);
+    vector<int>().swap(hometags);
+
+    int maxnodeid=-1,localmaxnodeid=-1;
+    vector<int> tempconn;
+    for(k=0;k<nrecords;k+=3+elmts[k+2]){
+        const int nodes=elmts[k+2];
+        tempconn.resize(nodes);
+        for(j=0;j<nodes;j++){
+            tempconn[j]=reqids[std::lower_bound(reqtags.begin(),reqtags.end(),elmts[k+3+j])-reqtags.begin()];
+            localmaxnodeid=std::max(localmaxnodeid,tempconn[j]);
+        }
+        MshFileUtils::reorderNodesIndex(blockinfo[4*elmts[k]+2],tempconn);
+        std::copy(tempconn.begin(),tempconn.end(),elmts.begin()+k+3);
+    }
+    vector<int>().swap(reqtags);
+    vector<int>().swap(reqids);
+    MPI_Allreduce(&localmaxnodeid,&maxnodeid,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    if(maxnodeid>numNodes){
+        MessagePrinter::printErrorTxt("The maximum node id used by your msh4 element is larger than your total nodes number,"
+                                      " please check your msh4 file");
+        MessagePrinter::exitAsFem();
+    }
+
+    //*****************************************************
+    //*** the bulk elements are sent to their owners
+    //*****************************************************
+    // the records are in the file order, then the global index of each element among the ones of the same dim is
+    // given by the prefix sums, the 4-th one is for the bulk elements
+    int localcounts[4]={0,0,0,0},offsets[4]={0,0,0,0},totals[4]={0,0,0,0};
+    auto getElmtCategory=[&](const int &block)->int{
+        const int dim=blockinfo[4*block];
+        return dim==mshMaxDim?3:dim;
+    };
+    for(k=0;k<nrecords;k+=3+elmts[k+2]) localcounts[getElmtCategory(elmts[k])]+=1;
+    MPI_Exscan(localcounts,offsets,4,MPI_INT,MPI_SUM,PETSC_COMM_WORLD);
+    if(rank==0){
+        for(i=0;i<4;i++) offsets[i]=0;
+    }
+    MPI_Allreduce(localcounts,totals,4,MPI_INT,MPI_SUM,PETSC_COMM_WORLD);
+    if(totals[0]+totals[1]+totals[2]+totals[3]!=elmtsummary[2-1]){
+        MessagePrinter::printErrorTxt("The elements number dosen\'t match with the total one, please check your msh(2) file");
+        return false;
+    }
+
+    const int nElmts=totals[3];
+    int eStart,eEnd;
+    BulkMesh::getBulkElmtsRange(nElmts,rank,size,eStart,eEnd);
+
+    // the bulk records are packed as: element-id, phy-id, nodes, node-1, ..., the lower dim ones as: dim, index, phy-id, nodes, node-1, ...
+    vector<int> lowerelmts;
+    for(k=0;k<nrecords;k+=3+elmts[k+2]){
+        const int block=elmts[k],nodes=elmts[k+2];
+        const int c=getElmtCategory(block);
+        const int phyid=getPhysicalIDViaEntityTag(blockinfo[4*block],blockinfo[4*block+1]);
+        if(c==3){
+            r=BulkMesh::getBulkElmtOwnerRank(offsets[3],nElmts,size);
+            ibuckets[r].push_back(offsets[3]+1);
+        }
+        else{
+            lowerelmts.push_back(c);
+            lowerelmts.push_back(offsets[c]+1);
+        }
+        vector<int> &dest=c==3?ibuckets[r]:lowerelmts;
+        dest.push_back(phyid);
+        dest.push_back(nodes);
+        dest.insert(dest.end(),elmts.begin()+k+3,elmts.begin()+k+3+nodes);
+        offsets[c]+=1;
+    }
+    vector<int>().swap(elmts);
+    vector<int> ownedelmts;
+    exchangeBuckets(ibuckets,MPI_INT,ownedelmts,counts);
+
+    // the owned elements come from the ranks in the file order, so they are already sorted by the element id
+    ElmtConnectivity ownedconn;
+    vector<int> ownedphyids;
+    for(k=0;k<static_cast<int>(ownedelmts.size());k+=3+ownedelmts[k+2]){
+        ownedphyids.push_back(ownedelmts[k+1]);
+        ownedconn.push_back(ElmtConnSpan(ownedelmts.data()+k+3,ownedelmts[k+2]));
+    }
+    vector<int>().swap(ownedelmts);
+    if(ownedconn.size()!=eEnd-eStart){
+        MessagePrinter::printErrorTxt("the bulk elements received by processor-"+to_string(rank)+" don\'t match with its partition, please check your msh4 file");
+        MessagePrinter::exitAsFem();
+    }
+
+    //*****************************************************
+    //*** the node to bulk element map on the home ranks
+    //*****************************************************
+    // each home rank keeps the bulk elements around its own nodes, so the map of the whole mesh is never built
+    for(e=0;e<ownedconn.size();e++){
+        for(const auto &node:ownedconn[e]){
+            r=getNodeHome(node);
+            ibuckets[r].push_back(node);
+            ibuckets[r].push_back(eStart+e+1);
+        }
+    }
+    exchangeBuckets(ibuckets,MPI_INT,irecv,counts);
+    vector<int> nodeelmt_ptr(homecount+1,0),nodeelmt_ids(irecv.size()/2);
+    for(k=0;k<static_cast<int>(irecv.size());k+=2) nodeelmt_ptr[irecv[k]-homestart]+=1;
+    for(i=0;i<homecount;i++) nodeelmt_ptr[i+1]+=nodeelmt_ptr[i];
+    vector<int> pos(nodeelmt_ptr.begin(),nodeelmt_ptr.end()-1);
+    for(k=0;k<static_cast<int>(irecv.size());k+=2) nodeelmt_ids[pos[irecv[k]-homestart-1]++]=irecv[k+1];
+    for(i=0;i<homecount;i++) std::sort(nodeelmt_ids.begin()+nodeelmt_ptr[i],nodeelmt_ids.begin()+nodeelmt_ptr[i+1]);
+    vector<int>().swap(pos);
+    vector<int>().swap(irecv);
+
+    // the bulk elements around the given sorted nodes, the result is in CSR format
+    auto getNodesBulkElmts=[&](const vector<int> &nodes,vector<int> &ptr,vector<int> &ids){
+        for(const auto &node:nodes) ibuckets[getNodeHome(node)].push_back(node);
+        exchangeBuckets(ibuckets,MPI_INT,irecv,counts);
+        int kk=0;
+        for(int rr=0;rr<size;rr++){
+            for(int jj=0;jj<counts[rr];jj++,kk++){
+                const int ii=irecv[kk]-homestart-1;
+                ibuckets[rr].push_back(nodeelmt_ptr[ii+1]-nodeelmt_ptr[ii]);
+                ibuckets[rr].insert(ibuckets[rr].end(),nodeelmt_ids.begin()+nodeelmt_ptr[ii],nodeelmt_ids.begin()+nodeelmt_ptr[ii+1]);
+            }
+        }
+        vector<int> reply;
+        exchangeBuckets(ibuckets,MPI_INT,reply,counts);
+        ptr.assign(1,0);
+        ids.clear();
+        kk=0;
+        for(int ii=0;ii<static_cast<int>(nodes.size());ii++){
+            ids.insert(ids.end(),reply.begin()+kk+1,reply.begin()+kk+1+reply[kk]);
+            kk+=1+reply[kk];
+            ptr.push_back(static_cast<int>(ids.size()));
+        }
+    };
+
+    //*****************************************************
+    //*** the halo elements
+    //*****************************************************
+    vector<int> ownednodes(ownedconn.getNodeIDsRef());
+    std::sort(ownednodes.begin(),ownednodes.end());
+    ownednodes.erase(std::unique(ownednodes.begin(),ownednodes.end()),ownednodes.end());
+    vector<int> adjptr,adjids;
+    getNodesBulkElmts(ownednodes,adjptr,adjids);
+    vector<int> halo;
+    for(const auto &id:adjids){
+        if(id-1<eStart||id-1>=eEnd) halo.push_back(id);
+    }
+    std::sort(halo.begin(),halo.end());
+    halo.erase(std::unique(halo.begin(),halo.end()),halo.end());
+
+    // the connectivity of the halo elements comes from their owners, in the same order as the requests
+    for(const auto &id:halo) ibuckets[BulkMesh::getBulkElmtOwnerRank(id-1,nElmts,size)].push_back(id);
+    exchangeBuckets(ibuckets,MPI_INT,irecv,counts);
+    for(r=0,k=0;r<size;r++){
+        for(j=0;j<counts[r];j++,k++){
+            const ElmtConnSpan conn=ownedconn[irecv[k]-1-eStart];
+            ibuckets[r].push_back(conn.size());
+            ibuckets[r].insert(ibuckets[r].end(),conn.begin(),conn.end());
+        }
+    }
+    vector<int> halorecv;
+    exchangeBuckets(ibuckets,MPI_INT,halorecv,counts);
+    ElmtConnectivity haloconn;
+    for(k=0;k<static_cast<int>(halorecv.size());k+=1+halorecv[k]){
+        haloconn.push_back(ElmtConnSpan(halorecv.data()+k+1,halorecv[k]));
+    }
+    vector<int>().swap(halorecv);
+
+    //*****************************************************
+    //*** the lower dimension elements are sent to their owners
+    //*****************************************************
+    // the owner is the one of the 1st bulk element containing all the nodes, or the 1st one around the 1st node,
+    // which is the same as BulkMesh::distributeBulkMesh. The elements containing all the nodes are the common
+    // ones of the bulk elements around each node
+    vector<int> lowernodes;
+    for(k=0;k<static_cast<int>(lowerelmts.size());k+=4+lowerelmts[k+3]){
+        lowernodes.insert(lowernodes.end(),lowerelmts.begin()+k+4,lowerelmts.begin()+k+4+lowerelmts[k+3]);
+    }
+    std::sort(lowernodes.begin(),lowernodes.end());
+    lowernodes.erase(std::unique(lowernodes.begin(),lowernodes.end()),lowernodes.end());
+    getNodesBulkElmts(lowernodes,adjptr,adjids);
+    vector<int> common,temp;
+    for(k=0;k<static_cast<int>(lowerelmts.size());k+=4+lowerelmts[k+3]){
+        const int nodes=lowerelmts[k+3];
+        for(j=0;j<nodes;j++){
+            i=static_cast<int>(std::lower_bound(lowernodes.begin(),lowernodes.end(),lowerelmts[k+4+j])-lowernodes.begin());
+            if(j==0){
+                common.assign(adjids.begin()+adjptr[i],adjids.begin()+adjptr[i+1]);
+                r=common.empty()?0:BulkMesh::getBulkElmtOwnerRank(common[0]-1,nElmts,size);
+                continue;
+            }
+            temp.clear();
+            std::set_intersection(common.begin(),common.end(),adjids.begin()+adjptr[i],adjids.begin()+adjptr[i+1],std::back_inserter(temp));
+            common.swap(temp);
+        }
+        if(!common.empty()) r=BulkMesh::getBulkElmtOwnerRank(common[0]-1,nElmts,size);
+        ibuckets[r].insert(ibuckets[r].end(),lowerelmts.begin()+k,lowerelmts.begin()+k+4+nodes);
+    }
+    vector<int>().swap(lowerelmts);
+    vector<int>().swap(lowernodes);
+    vector<int>().swap(adjptr);
+    vector<int>().swap(adjids);
+    vector<int>().swap(nodeelmt_ptr);
+    vector<int>().swap(nodeelmt_ids);
+    exchangeBuckets(ibuckets,MPI_INT,lowerelmts,counts);
+
+    // the lower dim elements are kept in the file order
+    vector<int> lowerrecs[3];
+    for(k=0;k<static_cast<int>(lowerelmts.size());k+=4+lowerelmts[k+3]) lowerrecs[lowerelmts[k]].push_back(k);
+    for(auto &recs:lowerrecs){
+        std::sort(recs.begin(),recs.end(),[&](const int &a,const int &b){return lowerelmts[a+1]<lowerelmts[b+1];});
+    }
+
+    //*****************************************************
+    //*** the local nodes and their coordinates
+    //*****************************************************
+    vector<int> node_local2global(ownednodes);
+    node_local2global.insert(node_local2global.end(),haloconn.getNodeIDsRef().begin(),haloconn.getNodeIDsRef().end());
+    for(k=0;k<static_cast<int>(lowerelmts.size());k+=4+lowerelmts[k+3]){
+        node_local2global.insert(node_local2global.end(),lowerelmts.begin()+k+4,lowerelmts.begin()+k+4+lowerelmts[k+3]);
+    }
+    vector<int>().swap(ownednodes);
+    std::sort(node_local2global.begin(),node_local2global.end());
+    node_local2global.erase(std::unique(node_local2global.begin(),node_local2global.end()),node_local2global.end());
+
+    for(const auto &node:node_local2global) ibuckets[getNodeHome(node)].push_back(node);
+    exchangeBuckets(ibuckets,MPI_INT,irecv,counts);
+    for(r=0,k=0;r<size;r++){
+        for(j=0;j<counts[r];j++,k++){
+            i=irecv[k]-homestart-1;
+            dbuckets[r].insert(dbuckets[r].end(),homecoords.begin()+3*i,homecoords.begin()+3*i+3);
+        }
+    }
+    vector<int>().swap(irecv);
+    vector<double>().swap(homecoords);
+    exchangeBuckets(dbuckets,MPI_DOUBLE,meshdata.m_nodecoords0,counts);
+    meshdata.m_nodecoords=meshdata.m_nodecoords0;
+
+    //*****************************************************
+    //*** the counters and the element types
+    //*****************************************************
+    // the counters are the global ones, the types are given by the last block of each dim, as the replicated import
+    meshdata.m_nodes=maxnodeid<numNodes?maxnodeid:numNodes;
+    meshdata.m_elements=elmtsummary[2-1];
+    meshdata.m_pointelmts=totals[0];
+    meshdata.m_lineelmts=totals[1];
+    meshdata.m_surfaceelmts=totals[2];
+    meshdata.m_bulkelmts=totals[3];
+    meshdata.m_mindim=10;
+    meshdata.m_lineelmt_type=MeshType::EDGE2;
+    meshdata.m_surfaceelmt_type=MeshType::TRI3;
+    for(int block=0;block<static_cast<int>(blockinfo.size()/4);block++){
+        if(blockinfo[4*block+3]<1) continue;
+        const int dim=blockinfo[4*block],elmttype=blockinfo[4*block+2];
+        const int nodes=MshFileUtils::getElmtNodesNumFromElmtType(elmttype);
+        if(dim<meshdata.m_mindim) meshdata.m_mindim=dim;
+        if(dim==1&&dim<mshMaxDim){
+            meshdata.m_lineelmt_type=MshFileUtils::getElmtMeshTypeFromElmtType(elmttype);
+            meshdata.m_nodesperlineelmt=nodes;
+        }
+        if(dim==2&&dim<mshMaxDim){
+            meshdata.m_surfaceelmt_type=MshFileUtils::getElmtMeshTypeFromElmtType(elmttype);
+            meshdata.m_nodespersurfaceelmt=nodes;
+        }
+        if(dim==mshMaxDim){
+            meshdata.m_bulkelmt_type=MshFileUtils::getElmtMeshTypeFromElmtType(elmttype);
+            meshdata.m_bulkelmt_typename=MshFileUtils::getElmtMeshTypeNameFromElmtType(elmttype);
+            meshdata.m_bulkelmt_vtktype=MshFileUtils::getElmtVTKCellTypeFromElmtType(elmttype);
+            meshdata.m_order=MshFileUtils::getElmtOrderFromElmtType(elmttype);
+            meshdata.m_nodesperbulkelmt=nodes;
+        }
+    }
+
+    //*****************************************************
+    //*** the local elements
+    //*****************************************************
+    // the owned elements come first, then the halo ones
+    meshdata.m_bulkelmt_connectivity.swap(ownedconn);
+    for(e=0;e<haloconn.size();e++) meshdata.m_bulkelmt_connectivity.push_back(haloconn[e]);
+    ownedconn.releaseMemory();
+    haloconn.releaseMemory();
+    vector<int> lconn;
+    meshdata.m_bulkelmt_localconnectivity.clear();
+    meshdata.m_bulkelmt_localconnectivity.reserve(meshdata.m_bulkelmt_connectivity.size(),static_cast<int>(meshdata.m_bulkelmt_connectivity.getNodeIDsRef().size()));
+    for(e=0;e<meshdata.m_bulkelmt_connectivity.size();e++){
+        lconn.clear();
+        for(const auto &node:meshdata.m_bulkelmt_connectivity[e]){
+            lconn.push_back(static_cast<int>(std::lower_bound(node_local2global.begin(),node_local2global.end(),node)-node_local2global.begin())+1);
+        }
+        meshdata.m_bulkelmt_localconnectivity.push_back(lconn);
+    }
+    meshdata.m_bulkelmt_volume.assign(meshdata.m_bulkelmt_connectivity.size(),0.0);
+
+    ElmtConnectivity *lowerconns[3]={&meshdata.m_pointelmt_connectivity,&meshdata.m_lineelmt_connectivity,&meshdata.m_surfaceelmt_connectivity};
+    for(i=0;i<3;i++){
+        lowerconns[i]->clear();
+        for(const auto &rec:lowerrecs[i]) lowerconns[i]->push_back(ElmtConnSpan(lowerelmts.data()+rec+4,lowerelmts[rec+3]));
+    }
+    // the volume of the lower dimension elements is not used by the analysis
+    vector<double>().swap(meshdata.m_pointelmt_volume);
+    vector<double>().swap(meshdata.m_lineelmt_volume);
+    vector<double>().swap(meshdata.m_surfaceelmt_volume);
+
+    //*****************************************************
+    //*** the physical groups
+    //*****************************************************
+    // the groups are the same as the replicated import, the bulk groups keep the global bulk element id,
+    // the other ones use the local id, which is the same as BulkMesh::distributeBulkMesh
+    vector<int> groupdims(mshPhyGroupDimVec),groupids(mshPhyGroupIDVec);
+    vector<string> groupnames(mshPhyGroupNameVec);
+    int maxphyid=-1;
+    if(mshBulkPhyGroupNum==0){
+        // the unique physical ids of all the bulk elements, each rank sends its own ones to all the ranks
+        vector<int> phyids(ownedphyids);
+        std::sort(phyids.begin(),phyids.end());
+        phyids.erase(std::unique(phyids.begin(),phyids.end()),phyids.end());
+        for(r=0;r<size;r++) ibuckets[r]=phyids;
+        exchangeBuckets(ibuckets,MPI_INT,phyids,counts);
+        std::sort(phyids.begin(),phyids.end());
+        phyids.erase(std::unique(phyids.begin(),phyids.end()),phyids.end());
+        if(groupdims.empty()&&phyids.empty()){
+            MessagePrinter::printErrorTxt("Invalid msh2 mesh file, no any physical id is assigned to the volume mesh, please check your mesh file");
+            return false;
+        }
+        for(i=0;i<static_cast<int>(groupdims.size());i++){
+            if(groupdims[i]==3){
+                MessagePrinter::printErrorTxt("Invalid info, your phy group dim=3(name="+groupnames[i]+"), however, it is not a volume mesh, please check your mesh file");
+                return false;
+            }
+        }
+        for(const auto &phyid:phyids){
+            groupdims.push_back(mshMaxDim);
+            groupids.push_back(phyid);
+            groupnames.push_back(to_string(phyid));
+            if(phyid>maxphyid) maxphyid=phyid;
+        }
+    }
+    else{
+        for(const auto &phyid:groupids){
+            if(phyid>maxphyid) maxphyid=phyid;
+        }
+    }
+    groupdims.push_back(mshMaxDim);
+    groupids.push_back(maxphyid+1);
+    groupnames.push_back("alldomain");
+
+    meshdata.m_phygroups=static_cast<int>(groupdims.size());
+    meshdata.m_phygroup_dimvec=groupdims;
+    meshdata.m_phygroup_phyidvec=groupids;
+    meshdata.m_phygroup_phynamevec=groupnames;
+    meshdata.m_phygroup_name2dimvec.clear();
+    meshdata.m_phygroup_name2phyidvec.clear();
+    meshdata.m_phygroup_phyid2namevec.clear();
+    meshdata.m_phygroup_nodesnumperelmtvec.clear();
+    meshdata.m_phygroup_elmtnumvec.assign(meshdata.m_phygroups,0);
+    meshdata.m_phygroup_name2elmtidvec.assign(meshdata.m_phygroups,make_pair(string(),vector<int>()));
+    meshdata.m_phygroup_name2bulkelmtidvec.clear();
+    for(i=0;i<meshdata.m_phygroups;i++){
+        const int dim=groupdims[i],phyid=groupids[i];
+        const string &phyname=groupnames[i];
+        meshdata.m_phygroup_name2dimvec.push_back(make_pair(phyname,dim));
+        meshdata.m_phygroup_name2phyidvec.push_back(make_pair(phyname,phyid));
+        meshdata.m_phygroup_phyid2namevec.push_back(make_pair(phyid,phyname));
+        meshdata.m_phygroup_name2elmtidvec[i].first=phyname;
+        vector<int> &ids=meshdata.m_phygroup_name2elmtidvec[i].second;
+        if(dim==mshMaxDim){
+            meshdata.m_phygroup_nodesnumperelmtvec.push_back(meshdata.m_nodesperbulkelmt);
+            const bool IsAllDomain=(i==meshdata.m_phygroups-1);
+            for(e=0;e<static_cast<int>(ownedphyids.size());e++){
+                if(IsAllDomain||ownedphyids[e]==phyid) ids.push_back(eStart+e+1);
+            }
+            meshdata.m_phygroup_name2bulkelmtidvec.push_back(make_pair(phyname,ids));
+        }
+        else if(dim>0&&dim<mshMaxDim){
+            meshdata.m_phygroup_nodesnumperelmtvec.push_back(dim==1?meshdata.m_nodesperlineelmt:meshdata.m_nodespersurfaceelmt);
+            for(e=0;e<static_cast<int>(lowerrecs[dim].size());e++){
+                if(lowerelmts[lowerrecs[dim][e]+2]==phyid) ids.push_back(e+1);
+            }
+        }
+        meshdata.m_phygroup_elmtnumvec[i]=static_cast<int>(ids.size());
+    }
+
+    // the nodal groups are given by the point elements
+    meshdata.m_nodal_phygroups=static_cast<int>(mshNodalPhyGroupIDVec.size());
+    meshdata.m_nodephygroup_name2nodeidvec.assign(meshdata.m_nodal_phygroups,make_pair(string(),vector<int>()));
+    meshdata.m_nodephygroup_name2phyidvec.clear();
+    meshdata.m_nodephygroup_phyid2namevec.clear();
+    meshdata.m_nodephygroup_phynamevec=mshNodalPhyGroupNameVec;
+    meshdata.m_nodephygroup_phyidvec=mshNodalPhyGroupIDVec;
+    for(i=0;i<meshdata.m_nodal_phygroups;i++){
+        meshdata.m_nodephygroup_name2phyidvec.push_back(make_pair(mshNodalPhyGroupNameVec[i],mshNodalPhyGroupIDVec[i]));
+        meshdata.m_nodephygroup_phyid2namevec.push_back(make_pair(mshNodalPhyGroupIDVec[i],mshNodalPhyGroupNameVec[i]));
+        meshdata.m_nodephygroup_name2nodeidvec[i].first=mshNodalPhyGroupNameVec[i];
+        for(const auto &rec:lowerrecs[0]){
+            if(lowerelmts[rec+2]==mshNodalPhyGroupIDVec[i]) meshdata.m_nodephygroup_name2nodeidvec[i].second.push_back(lowerelmts[rec+4]);
+        }
+    }
+
+    meshdata.m_ownedbulkelmt_start=eStart;
+    meshdata.m_ownedbulkelmt_end=eEnd;
+    meshdata.m_halobulkelmt_local2global.swap(halo);
+    meshdata.m_node_local2global.swap(node_local2global);
+    meshdata.m_isdistributed=true;
+
+    //*****************************************************
+    //*** print out the summary
+    //*****************************************************
+    int localnodes=static_cast<int>(meshdata.m_node_local2global.size());
+    int halonum=static_cast<int>(meshdata.m_halobulkelmt_local2global.size());
+    int maxnodes,maxhalo;
+    MPI_Allreduce(&localnodes,&maxnodes,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    MPI_Allreduce(&halonum,&maxhalo,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    char buff[70];
+    snprintf(buff,70,"  msh4 mesh is imported among %6d processors",static_cast<int>(size));
+    MessagePrinter::printNormalTxt(string(buff));
+    snprintf(buff,70,"  max local nodes=%10d, max halo elmts=%10d",maxnodes,maxhalo);
+    MessagePrinter::printNormalTxt(string(buff));
+
+    return true;
+}
@@ -15,49 +15,85 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "Mesh/Msh4FileImporter.h"
-#include "Utils/StringUtils.h"
 
 int Msh4FileImporter::getMaxMeshDim(const string &filename)const{
-    ifstream in;
-    string str;
+    MshFileTokenizer in;
+    string_view line;
+    vector<int> ints;
     int maxdim;
-    in.open(filename.c_str(),ios::in);
-    if(!in.is_open()){
+    if(!in.open(filename)){
         MessagePrinter::printErrorTxt("can\'t read the .msh file("+filename+"),please make sure file name is correct"
                                       " or you have the access permission");
         return false;
     }
+    double version=0.0;
+    int format=0,datasize=8,one=1;
+    long long numbers[4];
     maxdim=-1;
-    while(!in.eof()){
-        getline(in,str);
-        if(str.find("$Elements")!=string::npos){
-            int numEntityBlocks;
-            int entityDim,numElementsInBlock;
-            vector<double> numbers;
-
-            getline(in,str);
-            numbers=StringUtils::splitStrNum(str);
-
-            if(numbers.size()!=4){
-                //numEntityBlocks(size_t) numElements(size_t) minElementTag(size_t) maxElementTag(size_t)
-                MessagePrinter::printErrorTxt("Invalid element entities in your msh4 file inside the $Elements");
-                MessagePrinter::exitAsFem();
+    while(in.nextLine(line)){
+        if(line.find("$MeshFormat")!=string_view::npos){
+            in.readDouble(version);in.readInt(format);in.readInt(datasize);
+            in.skipLine();
+            if(format==1) in.readBinaryValue(one);
+        }
+        else if(line.find("$Nodes")!=string_view::npos){
+            // the node blocks are skipped as a whole, the binary ones may contain any byte
+            if(format==1){
+                for(int i=0;i<4;i++) in.readBinarySize(datasize,numbers[i]);
+            }
+            else{
+                numbers[0]=in.readLineInts(ints)==4?ints[0]:0;
+            }
+            for(long long block=0;block<numbers[0];block++){
+                long long nodes=0;
+                if(format==1){
+                    int entity[3];
+                    in.readBinary(entity,3*sizeof(int));
+                    in.readBinarySize(datasize,nodes);
+                    in.seek(in.tell()+nodes*(datasize+3*sizeof(double)));
+                }
+                else{
+                    if(in.readLineInts(ints)==4) nodes=ints[3];
+                    in.skipLines(2*nodes);
+                }
             }
-            numEntityBlocks=static_cast<int>(numbers[1-1]);
+        }
+        else if(line.find("$Elements")!=string_view::npos){
+            int entityDim;
+            long long numEntityBlocks,numElementsInBlock;
 
-            for(int nblock=0;nblock<numEntityBlocks;nblock++){
-                getline(in,str);
-                numbers=StringUtils::splitStrNum(str);
-                if(numbers.size()!=4){
-                    MessagePrinter::printErrorTxt("Invalid element entities for current element in your msh4 file inside the $Elements");
+            if(format==1){
+                for(int i=0;i<4;i++) in.readBinarySize(datasize,numbers[i]);
+            }
+            else{
+                if(in.readLineInts(ints)!=4){
+                    //numEntityBlocks(size_t) numElements(size_t) minElementTag(size_t) maxElementTag(size_t)
+                    MessagePrinter::printErrorTxt("Invalid element entities in your msh4 file inside the $Elements");
                     MessagePrinter::exitAsFem();
                 }
-                entityDim=static_cast<int>(numbers[1-1]);
-                if(entityDim>maxdim) maxdim=entityDim;
-                numElementsInBlock=static_cast<int>(numbers[4-1]);
-                for(int i=0;i<numElementsInBlock;i++){
-                    getline(in,str);
+                for(int i=0;i<4;i++) numbers[i]=ints[i];
+            }
+            numEntityBlocks=numbers[1-1];
+
+            for(long long nblock=0;nblock<numEntityBlocks;nblock++){
+                if(format==1){
+                    int entity[3];
+                    in.readBinary(entity,3*sizeof(int));
+                    in.readBinarySize(datasize,numElementsInBlock);
+                    entityDim=entity[0];
+                    const int nodes=MshFileUtils::getElmtNodesNumFromElmtType(entity[2]);
+                    in.seek(in.tell()+numElementsInBlock*(1+nodes)*datasize);
+                }
+                else{
+                    if(in.readLineInts(ints)!=4){
+                        MessagePrinter::printErrorTxt("Invalid element entities for current element in your msh4 file inside the $Elements");
+                        MessagePrinter::exitAsFem();
+                    }
+                    entityDim=ints[1-1];
+                    numElementsInBlock=ints[4-1];
+                    in.skipLines(numElementsInBlock);
                 }
+                if(entityDim>maxdim) maxdim=entityDim;
             }
             break;
         }
@@ -86,6 +122,199 @@ int Msh4FileImporter::getPhysicalIDViaEntityTag(const int &entityDim,const int &
     return -1;
 }
 
+/**
+ * gather the local vectors of all the ranks (in the rank order) to every rank
+ */
+template<typename T>
+static void allGatherVector(const vector<T> &local,vector<T> &global,MPI_Datatype datatype){
+    PetscMPIInt size;
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    int n=static_cast<int>(local.size());
+    vector<int> counts(size,0),displs(size,0);
+    MPI_Allgather(&n,1,MPI_INT,counts.data(),1,MPI_INT,PETSC_COMM_WORLD);
+    for(int i=1;i<size;i++) displs[i]=displs[i-1]+counts[i-1];
+    global.resize(displs[size-1]+counts[size-1]);
+    MPI_Allgatherv(local.data(),n,datatype,global.data(),counts.data(),displs.data(),datatype,PETSC_COMM_WORLD);
+}
+
+const int Msh4ChunkLines=4096;// the max lines of each chunk
+const long long Msh4IndexLines=256;// the step of the line index of the ASCII sections
+
+void Msh4FileImporter::scanEntityBlocks(MshFileTokenizer &in,const bool &IsNodes,int (&summary)[4],
+                                        vector<int> &blockinfo,vector<Msh4LinesChunk> &chunks,
+                                        long long &endoffset){
+    PetscMPIInt rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    const string secname=IsNodes?"$Nodes":"$Elements";
+    const string endname=IsNodes?"$EndNodes":"$EndElements";
+
+    string_view line;
+    vector<int> ints;
+    long long numbers[4];
+    long long start=0;
+    bool IsValid=true;
+    blockinfo.clear();
+    chunks.clear();
+    m_LineOffsets.clear();
+    if(rank==0){
+        if(m_IsBinary){
+            for(int i=0;i<4&&IsValid;i++) IsValid=in.readBinarySize(m_DataSize,numbers[i]);
+        }
+        else{
+            IsValid=in.readLineInts(ints)==4;
+            for(int i=0;i<4&&IsValid;i++) numbers[i]=ints[i];
+        }
+        if(!IsValid){
+            MessagePrinter::printErrorTxt("Invalid entities information in your msh4 file inside the "+secname);
+            MessagePrinter::exitAsFem();
+        }
+        for(int i=0;i<4;i++) summary[i]=static_cast<int>(numbers[i]);
+        start=static_cast<long long>(in.tell());
+    }
+    MPI_Bcast(summary,4,MPI_INT,0,PETSC_COMM_WORLD);
+    MPI_Bcast(&start,1,MPI_LONG_LONG,0,PETSC_COMM_WORLD);
+
+    const int nblocks=summary[0];
+    blockinfo.resize(4*nblocks,0);
+    // the 1st data line of each block, it is the file offset for the binary file and the line index for the ASCII one
+    vector<long long> blockstart(nblocks,0);
+    auto readBlockHeader=[&](const int &block){
+        int entity[3];
+        long long nlines=0;
+        if(m_IsBinary){
+            IsValid=in.readBinary(entity,3*sizeof(int))&&in.readBinarySize(m_DataSize,nlines);
+            if(IsValid&&IsNodes&&entity[2]!=0){
+                MessagePrinter::printErrorTxt("the parametric coordinates in the binary msh4 file are not supported inside the $Nodes");
+                MessagePrinter::exitAsFem();
+            }
+        }
+        else{
+            IsValid=in.readLineInts(ints)==4;
+            if(IsValid){
+                for(int i=0;i<3;i++) entity[i]=ints[i];
+                nlines=ints[3];
+            }
+        }
+        if(!IsValid){
+            MessagePrinter::printErrorTxt("Invalid entity block information in your msh4 file inside the "+secname);
+            MessagePrinter::exitAsFem();
+        }
+        for(int i=0;i<3;i++) blockinfo[4*block+i]=entity[i];
+        blockinfo[4*block+3]=static_cast<int>(nlines);
+    };
+
+    if(m_IsBinary){
+        // the size of each line is fixed, so the master rank walks through the block headers without reading the lines
+        if(rank==0){
+            for(int block=0;block<nblocks;block++){
+                readBlockHeader(block);
+                const long long nlines=blockinfo[4*block+3];
+                const long long stride=IsNodes?m_DataSize+3*sizeof(double):(1+MshFileUtils::getElmtNodesNumFromElmtType(blockinfo[4*block+2]))*m_DataSize;
+                blockstart[block]=static_cast<long long>(in.tell());
+                in.seek(static_cast<size_t>(blockstart[block]+nlines*stride));
+            }
+            while(in.nextLine(line)){
+                if(line.find(endname)!=string_view::npos) break;
+            }
+            endoffset=static_cast<long long>(in.tell());
+        }
+        MPI_Bcast(&endoffset,1,MPI_LONG_LONG,0,PETSC_COMM_WORLD);
+    }
+    else{
+        // each rank searches the end of the section inside its own part of the rest of the file, the parts
+        // overlap by the length of the name, then the name across two parts is still found
+        const long long filesize=static_cast<long long>(in.size());
+        long long first=start+((filesize-start)*rank)/size;
+        long long last=std::min(start+((filesize-start)*(rank+1))/size+static_cast<long long>(endname.size()),filesize);
+        long long endpos=static_cast<long long>(in.find(endname,first,last));
+        if(endpos>=last) endpos=filesize;
+        long long pos=endpos;
+        MPI_Allreduce(&pos,&endpos,1,MPI_LONG_LONG,MPI_MIN,PETSC_COMM_WORLD);
+        if(endpos>=filesize){
+            MessagePrinter::printErrorTxt("can\'t find "+endname+" in your msh4 file, please check your mesh file");
+            MessagePrinter::exitAsFem();
+        }
+        in.seek(static_cast<size_t>(endpos));
+        in.skipLine();
+        endoffset=static_cast<long long>(in.tell());
+
+        // each rank counts the lines starting inside its own part of the section, then the index of each line is known,
+        // the offset of every Msh4IndexLines-th line is kept, so any line is reached by skipping a few lines only
+        first=start+((endpos-start)*rank)/size;
+        last=start+((endpos-start)*(rank+1))/size;
+        long long nlines=in.countLineStarts(first,last),firstline=0;
+        MPI_Exscan(&nlines,&firstline,1,MPI_LONG_LONG,MPI_SUM,PETSC_COMM_WORLD);
+        if(rank==0) firstline=0;
+        vector<long long> offsets;
+        in.getLineStarts(first,last,firstline,Msh4IndexLines,offsets);
+        allGatherVector(offsets,m_LineOffsets,MPI_LONG_LONG);
+
+        // only the block headers are read by the master rank
+        if(rank==0){
+            long long headerline=0;
+            for(int block=0;block<nblocks;block++){
+                seekChunkLine(in,headerline);
+                readBlockHeader(block);
+                blockstart[block]=headerline+1;
+                headerline+=1+(IsNodes?2:1)*static_cast<long long>(blockinfo[4*block+3]);
+            }
+        }
+    }
+    MPI_Bcast(blockinfo.data(),4*nblocks,MPI_INT,0,PETSC_COMM_WORLD);
+    MPI_Bcast(blockstart.data(),nblocks,MPI_LONG_LONG,0,PETSC_COMM_WORLD);
+
+    // the chunks are built by every rank from the block headers, the lines are parsed by their ranks later
+    for(int block=0;block<nblocks;block++){
+        const long long nlines=blockinfo[4*block+3];
+        long long stride=1,stride2=1;
+        if(m_IsBinary){
+            stride=IsNodes?m_DataSize:(1+MshFileUtils::getElmtNodesNumFromElmtType(blockinfo[4*block+2]))*m_DataSize;
+            stride2=IsNodes?3*sizeof(double):0;
+        }
+        for(long long i=0;i<nlines;i+=Msh4ChunkLines){
+            Msh4LinesChunk chunk;
+            // for $Nodes, the coordinates come after all the node tags of current block
+            chunk.m_offset=blockstart[block]+i*stride;
+            chunk.m_offset2=IsNodes?blockstart[block]+nlines*stride+i*stride2:0;
+            chunk.m_block=block;
+            chunk.m_lines=static_cast<int>(std::min(static_cast<long long>(Msh4ChunkLines),nlines-i));
+            chunks.push_back(chunk);
+        }
+    }
+}
+
+void Msh4FileImporter::seekChunkLine(MshFileTokenizer &in,const long long &pos)const{
+    if(m_IsBinary){
+        in.seek(static_cast<size_t>(pos));
+        return;
+    }
+    in.seek(static_cast<size_t>(m_LineOffsets[pos/Msh4IndexLines]));
+    in.skipLines(pos%Msh4IndexLines);
+}
+
+void Msh4FileImporter::getRankChunksRange(const vector<Msh4LinesChunk> &chunks,int &cStart,int &cEnd)const{
+    PetscMPIInt rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    long long total=0;
+    for(const auto &chunk:chunks) total+=chunk.m_lines;
+    // the i-th chunk goes to the rank whose line range contains its 1st line
+    long long lines=0;
+    const int nchunks=static_cast<int>(chunks.size());
+    cStart=-1;cEnd=nchunks;
+    for(int i=0;i<nchunks;i++){
+        const int owner=static_cast<int>(std::min((lines*size)/(total>0?total:1),static_cast<long long>(size-1)));
+        if(cStart<0&&owner>=rank) cStart=i;
+        if(owner>rank){
+            cEnd=i;break;
+        }
+        lines+=chunks[i].m_lines;
+    }
+    if(cStart<0) cStart=nchunks;
+    if(cStart>cEnd) cStart=cEnd;
+}
+
 bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata){
     int mshMaxDim;
 
@@ -108,20 +337,20 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
 
     vector<int> ElmtPhyIDVec;
     vector<int> ElmtDimVec;
-    vector<vector<int>> ElmtConn;
+    vector<int> ElmtLocalID;// the element id in the connectivity of the same dim
     vector<int> ElmtIDFlag;
 
-    ifstream in;
-    in.open(filename.c_str(),ios::in);
-    if(!in.is_open()){
+    MshFileTokenizer in;
+    if(!in.open(filename)){
         MessagePrinter::printErrorTxt("can\'t read the .msh file("+filename+"),please make sure file name is correct"
                                       " or you have the access permission");
         return false;
     }
-    string str;
+    string_view line;
     double version;
     int format,size;
     vector<double> numbers;
+    vector<int> ints;
 
     int numNodes=0;
     int minNodeTag=0;
@@ -129,13 +358,21 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
     vector<double> NodeCoords;// here the node id may not be contineous case !!!
     vector<int> NodeIDFlag;
 
-    int numEntityBlocks=0;
     int numElements=0;
     int minElementTag=0;
     int maxElementTag=0;
-    int numElementsInBlock=0;
 
-    mshMaxDim=getMaxMeshDim(filename);
+    // for the distributed mesh, the parsed records are kept on current rank, then they are routed to their owners
+    const bool IsRouted=meshdata.m_distributeonimport;
+    int nodesummary[4]={0,0,0,0},elmtsummary[4]={0,0,0,0};
+    vector<int> RankNodeTags,RankElmts,ElmtBlockInfo;
+    vector<double> RankNodeCoords;
+
+    // only the master rank scans the element blocks
+    PetscMPIInt rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    if(rank==0) mshMaxDim=getMaxMeshDim(filename);
+    MPI_Bcast(&mshMaxDim,1,MPI_INT,0,PETSC_COMM_WORLD);
 
     meshdata.m_maxdim=mshMaxDim;
     meshdata.m_mindim=10;
@@ -157,26 +394,48 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
     meshdata.m_surfaceelmts=0;
     meshdata.m_bulkelmts=0;
 
-    while(!in.eof()){
-        getline(in,str);
+    m_IsBinary=false;
+    m_DataSize=8;
 
-        if(str.find("$MeshFormat")!=string::npos){
+    while(in.nextLine(line)){
+
+        if(line.find("$MeshFormat")!=string_view::npos){
             // read the version, format, size
-            in>>version>>format>>size;
+            version=0.0;format=0;size=8;
+            in.readDouble(version);in.readInt(format);in.readInt(size);
+            in.skipLine();
             if(version<4.0 || version>4.2){
                 MessagePrinter::printErrorTxt("version="+to_string(version)+" is not supported for msh4 file importer, "
                                                "please check your mesh file");
                 return false;
             }
+            if(format==1){
+                // the integer 1 is written in binary after the format line, it tells the endianness
+                int one=0;
+                if(version<4.1){
+                    MessagePrinter::printErrorTxt("the binary msh4 file is only supported for version>=4.1, please check your mesh file");
+                    return false;
+                }
+                if(size!=4&&size!=8){
+                    MessagePrinter::printErrorTxt("data-size="+to_string(size)+" is not supported for the binary msh4 file, please check your mesh file");
+                    return false;
+                }
+                if(!in.readBinaryValue(one)||one!=1){
+                    MessagePrinter::printErrorTxt("the endianness of the binary msh4 file is different from current machine, please save it in ASCII format");
+                    return false;
+                }
+                m_IsBinary=true;
+                m_DataSize=size;
+            }
         }
-        else if(str.find("$PhysicalNames")!=string::npos){
+        else if(line.find("$PhysicalNames")!=string_view::npos){
             int phydim,phyid;
             string phyname;
-            in>>mshPhyGroupNum;
-            getline(in,str);//remove \n in this line
+            in.readInt(mshPhyGroupNum);
+            in.skipLine();//remove \n in this line
             for(int i=0;i<mshPhyGroupNum;i++){
-                getline(in,str);
-                istringstream s_stream(str);
+                in.nextLine(line);
+                istringstream s_stream{string(line)};// only a few lines, the name may be quoted
                 s_stream>>phydim>>phyid>>phyname;
 
                 // remove the '"' ,keep only the text
@@ -201,21 +460,28 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
                     mshBulkPhyGroupNum+=1;
                 }
             }
-            getline(in,str);
+            in.skipLine();
         }// end-of-physical-group-reading
-        else if(str.find("$Entities")!=string::npos){
-            getline(in,str);
-            numbers=StringUtils::splitStrNum(str);
+        else if(line.find("$Entities")!=string_view::npos){
+            long long counts[4]={0,0,0,0};
             int numPoints,numCurves,numSurfaces,numVolumes;
-            if(numbers.size()!=4){
+            bool IsValid=true;
+            if(m_IsBinary){
+                for(int i=0;i<4&&IsValid;i++) IsValid=in.readBinarySize(m_DataSize,counts[i]);
+            }
+            else{
+                IsValid=in.readLineNums(numbers)==4;
+                for(int i=0;i<4&&IsValid;i++) counts[i]=static_cast<long long>(numbers[i]);
+            }
+            if(!IsValid){
                 MessagePrinter::printErrorTxt("Invalid entity block information in your msh4 file inside the $Entities");
                 MessagePrinter::exitAsFem();
             }
 
-            numPoints=static_cast<int>(numbers[1-1]);
-            numCurves=static_cast<int>(numbers[2-1]);
-            numSurfaces=static_cast<int>(numbers[3-1]);
-            numVolumes=static_cast<int>(numbers[4-1]);
+            numPoints=static_cast<int>(counts[1-1]);
+            numCurves=static_cast<int>(counts[2-1]);
+            numSurfaces=static_cast<int>(counts[3-1]);
+            numVolumes=static_cast<int>(counts[4-1]);
 
             // factor=20 to avoid the unordered entitie index(especially the nodal entities)
             m_PointsEntityPhyIDs.resize(numPoints*100,0);
@@ -225,10 +491,32 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
 
             int i,j;
             int nodeid,curveid,surfaceid,volumeid;
+            if(m_IsBinary){
+                // entityTag(int) boundingbox(double) numPhysicalTags(size_t) physicalTag(int) ...
+                // numBoundingEntities(size_t) boundingEntityTag(int) ..., the points have no bounding entities
+                auto readBinaryEntity=[&](const int &nbox,const bool &HasBounding,vector<int> &phyids){
+                    int tag=0,phyid=0;
+                    long long n=0;
+                    double box[6];
+                    in.readBinaryValue(tag);
+                    in.readBinary(box,nbox*sizeof(double));
+                    in.readBinarySize(m_DataSize,n);
+                    for(long long k=0;k<n;k++) in.readBinaryValue(phyid);
+                    if(n>0) phyids[tag-1]=phyid;
+                    if(HasBounding){
+                        in.readBinarySize(m_DataSize,n);
+                        in.seek(in.tell()+n*sizeof(int));
+                    }
+                };
+                for(i=0;i<numPoints;i++) readBinaryEntity(3,false,m_PointsEntityPhyIDs);
+                for(i=0;i<numCurves;i++) readBinaryEntity(6,true,m_CurvesEntityPhyIDS);
+                for(i=0;i<numSurfaces;i++) readBinaryEntity(6,true,m_SurfaceEntityPhyIDs);
+                for(i=0;i<numVolumes;i++) readBinaryEntity(6,true,m_VolumesEntityPhyIDs);
+                continue;
+            }
             //*** read points entities
             for(i=0;i<numPoints;i++){
-                getline(in,str);
-                numbers=StringUtils::splitStrNum(str);
+                in.readLineNums(numbers);
                 nodeid=static_cast<int>(numbers[1-1]);
                 if(static_cast<int>(numbers[5-1])>0){
                     m_PointsEntityPhyIDs[nodeid-1]=static_cast<int>(numbers[6-1]);
@@ -236,8 +524,7 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
             }
             //*** read curvess entities
             for(i=0;i<numCurves;i++){
-                getline(in,str);
-                numbers=StringUtils::splitStrNum(str);
+                in.readLineNums(numbers);
                 curveid=static_cast<int>(numbers[1-1]);
                 j=static_cast<int>(numbers[8-1]);
                 if(j>0){
@@ -246,8 +533,7 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
             }
             //*** read surfaces entities
             for(i=0;i<numSurfaces;i++){
-                getline(in,str);
-                numbers=StringUtils::splitStrNum(str);
+                in.readLineNums(numbers);
                 surfaceid=static_cast<int>(numbers[1-1]);
                 j=static_cast<int>(numbers[8-1]);
                 if(j>0){
@@ -256,8 +542,7 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
             }
             //*** read volumes entities
             for(i=0;i<numVolumes;i++){
-                getline(in,str);
-                numbers=StringUtils::splitStrNum(str);
+                in.readLineNums(numbers);
                 volumeid=static_cast<int>(numbers[1-1]);
                 j=static_cast<int>(numbers[8-1]);
                 if(j>0){
@@ -265,105 +550,125 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
                 }
             }
         }
-        else if(str.find("$Nodes")!=string::npos){
+        else if(line.find("$Nodes")!=string_view::npos){
             // read the nodes' coordinates
             // node-id, x, y, z
-            vector<int> nodeid;
+            int summary[4],cStart,cEnd;
+            vector<int> blockinfo;
+            vector<Msh4LinesChunk> chunks;
+            long long endoffset=0;
 
-            meshdata.m_nodes=0;
-            getline(in,str); // read the entities
-            numbers=StringUtils::splitStrNum(str);
+            scanEntityBlocks(in,true,summary,blockinfo,chunks,endoffset);
 
-            numEntityBlocks=static_cast<int>(numbers[1-1]);
-            numNodes=static_cast<int>(numbers[2-1]);
-            minNodeTag=static_cast<int>(numbers[3-1]);
-            maxNodeTag=static_cast<int>(numbers[4-1]);
+            numNodes=summary[2-1];
+            minNodeTag=summary[3-1];
+            maxNodeTag=summary[4-1];
 
-            NodeCoords.resize(3*maxNodeTag,0.0);// here the node id may not be contineous case !!!
-            NodeIDFlag.resize(maxNodeTag,0);
+            if(!IsRouted){
+                NodeCoords.resize(3*maxNodeTag,0.0);// here the node id may not be contineous case !!!
+                NodeIDFlag.resize(maxNodeTag,0);
+            }
 
             meshdata.m_nodes=numNodes;
 
             double x,y,z;
-            int i,j,numNodesInBlock;
-            
+            int i,j;
+
             meshdata.m_xmin=meshdata.m_ymin=meshdata.m_zmin= 1.0e16;
             meshdata.m_xmax=meshdata.m_ymax=meshdata.m_zmax=-1.0e16;
 
-            int nNodes=0;
-
-            for(int nBlock=0;nBlock<numEntityBlocks;nBlock++){
-                nodeid.clear();
-                getline(in,str);
-                numbers=StringUtils::splitStrNum(str);
-                if(numbers.size()!=4){
-                    MessagePrinter::printErrorTxt("Invalid node entities in your msh4 file inside the $Nodes block");
-                    MessagePrinter::exitAsFem();
-                }
-                numNodesInBlock=static_cast<int>(numbers[4-1]);
-                for(i=0;i<numNodesInBlock;i++){
-                    getline(in,str); // read the node id
-                    if(str.size()>1){
-                        if(str.at(str.size()-1)<'0' || str.at(str.size()-1)>'9'){
-                            // Remove the last invalid char, this may come from the msh file generated in different platform.
-                            // In some cases, the last char in this line is not '\n' or ' ', but other unrecognized character.
-                            str.pop_back();
-                        }
+            // each rank parses its own chunks of the node lines
+            vector<int> localtags,nodetags;
+            vector<double> localcoords,coords;
+            getRankChunksRange(chunks,cStart,cEnd);
+            long long tag;
+            for(int c=cStart;c<cEnd;c++){
+                seekChunkLine(in,chunks[c].m_offset);
+                for(i=0;i<chunks[c].m_lines;i++){
+                    // read the node id, the invalid chars at the end of the line (from different platforms) are ignored
+                    if(m_IsBinary){
+                        tag=0;
+                        in.readBinarySize(m_DataSize,tag);
                     }
-                    numbers=StringUtils::splitStrNum(str);
-                    if(numbers.size()<1){
-                        MessagePrinter::printErrorTxt("Can't find a valid node Tag in your msh4 file inside the $Nodes");
-                        MessagePrinter::exitAsFem();
+                    else{
+                        if(in.readLineInts(ints)<1){
+                            MessagePrinter::printErrorTxt("Can't find a valid node Tag in your msh4 file inside the $Nodes");
+                            MessagePrinter::exitAsFem();
+                        }
+                        tag=ints[0];
                     }
-                    if(static_cast<int>(numbers[0])<minNodeTag||static_cast<int>(numbers[0])>maxNodeTag){
+                    if(tag<minNodeTag||tag>maxNodeTag){
                         MessagePrinter::printErrorTxt("Invalid node Tag in your msh4 file inside the $Nodes");
                         MessagePrinter::exitAsFem();
                     }
-                    else{
-                        nodeid.push_back(static_cast<int>(numbers[0]));// store the node id
+                    localtags.push_back(static_cast<int>(tag));// store the node id
+                }
+                seekChunkLine(in,chunks[c].m_offset2);
+                if(m_IsBinary){
+                    // the coordinates of the whole chunk are contiguous
+                    localcoords.resize(localcoords.size()+3*chunks[c].m_lines);
+                    if(!in.readBinary(localcoords.data()+localcoords.size()-3*chunks[c].m_lines,3*chunks[c].m_lines*sizeof(double))){
+                        MessagePrinter::printErrorTxt("Invalid node coordinates information in your msh4 file inside the $Nodes block");
+                        MessagePrinter::exitAsFem();
                     }
+                    continue;
                 }
-                for(i=0;i<numNodesInBlock;i++){
-                    getline(in,str);
-                    numbers=StringUtils::splitStrNum(str);
-                    if(numbers.size()!=3){
+                for(i=0;i<chunks[c].m_lines;i++){
+                    if(in.readLineNums(numbers)!=3){
                         MessagePrinter::printErrorTxt("Invalid node coordinates information in your msh4 file inside the $Nodes block");
                         MessagePrinter::exitAsFem();
                     }
-                    x=numbers[0];y=numbers[1];z=numbers[2];
-                    j=nodeid[i];
-                    NodeCoords[(j-1)*3+0]=x;
-                    NodeCoords[(j-1)*3+1]=y;
-                    NodeCoords[(j-1)*3+2]=z;
-                    nNodes+=1;
-                    NodeIDFlag[j-1]=1;
-
-                    if(x>meshdata.m_xmax) meshdata.m_xmax=x;
-                    if(x<meshdata.m_xmin) meshdata.m_xmin=x;
-                    if(y>meshdata.m_ymax) meshdata.m_ymax=y;
-                    if(y<meshdata.m_ymin) meshdata.m_ymin=y;
-                    if(z>meshdata.m_zmax) meshdata.m_zmax=z;
-                    if(z<meshdata.m_zmin) meshdata.m_zmin=z;
-                } // end-of-nodes-block-reading
-            } // end-of-block-reading
+                    localcoords.push_back(numbers[0]);
+                    localcoords.push_back(numbers[1]);
+                    localcoords.push_back(numbers[2]);
+                }
+            }
+            if(IsRouted){
+                for(i=0;i<4;i++) nodesummary[i]=summary[i];
+                RankNodeTags.swap(localtags);
+                RankNodeCoords.swap(localcoords);
+                in.seek(endoffset);
+                continue;
+            }
+            allGatherVector(localtags,nodetags,MPI_INT);
+            allGatherVector(localcoords,coords,MPI_DOUBLE);
+            localtags.clear();localcoords.clear();
+
+            int nNodes=0;
+            for(i=0;i<static_cast<int>(nodetags.size());i++){
+                x=coords[3*i+0];y=coords[3*i+1];z=coords[3*i+2];
+                j=nodetags[i];
+                NodeCoords[(j-1)*3+0]=x;
+                NodeCoords[(j-1)*3+1]=y;
+                NodeCoords[(j-1)*3+2]=z;
+                nNodes+=1;
+                NodeIDFlag[j-1]=1;
+
+                if(x>meshdata.m_xmax) meshdata.m_xmax=x;
+                if(x<meshdata.m_xmin) meshdata.m_xmin=x;
+                if(y>meshdata.m_ymax) meshdata.m_ymax=y;
+                if(y<meshdata.m_ymin) meshdata.m_ymin=y;
+                if(z>meshdata.m_zmax) meshdata.m_zmax=z;
+                if(z<meshdata.m_zmin) meshdata.m_zmin=z;
+            } // end-of-nodes-reading
 
             if(nNodes!=numNodes){
                 MessagePrinter::printErrorTxt("Something is wrong in your msh4 file inside the $Nodes block, nodes numer is not match with the first line");
                 MessagePrinter::exitAsFem();
             }
+            // continue after $EndNodes
+            in.seek(endoffset);
         }// end-of-node-coordinates-reading
-        else if(str.find("$Elements")!=string::npos){
+        else if(line.find("$Elements")!=string_view::npos){
             vector<int> tempconn;
             int elmtid,phyid,entityTag,elmttype,vtktype;
             int nodes,entityDim,elmtorder;
             string meshtypename;
             MeshType meshtype;
 
-            numEntityBlocks=0;
             numElements=0;
             minElementTag=0;
             maxElementTag=0;
-            numElementsInBlock=0;
 
             meshdata.m_pointelmt_connectivity.clear();
             meshdata.m_lineelmt_connectivity.clear();
@@ -379,103 +684,141 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
             meshdata.m_lineelmt_type=MeshType::EDGE2;
             meshdata.m_surfaceelmt_type=MeshType::TRI3;
 
-            getline(in,str);// read the element total entities
-            numbers=StringUtils::splitStrNum(str);
-            if(numbers.size()!=4){
-                //numEntityBlocks(size_t) numElements(size_t) minElementTag(size_t) maxElementTag(size_t)
-                MessagePrinter::printErrorTxt("Invalid element entities in your msh4 file inside the $Elements");
-                MessagePrinter::exitAsFem();
-            }
-            numEntityBlocks=static_cast<int>(numbers[1-1]);
-            numElements=static_cast<int>(numbers[2-1]);
-            minElementTag=static_cast<int>(numbers[3-1]);
-            maxElementTag=static_cast<int>(numbers[4-1]);
+            int summary[4],cStart,cEnd;
+            vector<int> blockinfo;
+            vector<Msh4LinesChunk> chunks;
+            long long endoffset=0;
+
+            scanEntityBlocks(in,false,summary,blockinfo,chunks,endoffset);
+
+            //numEntityBlocks(size_t) numElements(size_t) minElementTag(size_t) maxElementTag(size_t)
+            numElements=summary[2-1];
+            minElementTag=summary[3-1];
+            maxElementTag=summary[4-1];
 
             meshdata.m_elements=numElements;
 
-            ElmtPhyIDVec.resize(maxElementTag,0);
-            ElmtDimVec.resize(maxElementTag,0);
-            ElmtConn.resize(maxElementTag);
-            ElmtIDFlag.resize(maxElementTag,0);
+            if(!IsRouted){
+                ElmtPhyIDVec.resize(maxElementTag,0);
+                ElmtDimVec.resize(maxElementTag,0);
+                ElmtLocalID.resize(maxElementTag,0);
+                ElmtIDFlag.resize(maxElementTag,0);
+            }
             mshBulkElmtUniquePhyIDVec.clear();
 
             meshdata.m_mindim=10;
 
-            for(int block=0;block<numEntityBlocks;block++){
-                getline(in,str);//get current element entities
-                //entityDim(int) entityTag(int) elementType(int; see below) numElementsInBlock(size_t)
-                numbers=StringUtils::splitStrNum(str);
-                if(numbers.size()!=4){
-                    MessagePrinter::printErrorTxt("Invalid element entities for current element in your msh4 file inside the $Elements");
-                    MessagePrinter::exitAsFem();
+            // each rank parses its own chunks of the element lines, which are packed as:
+            // block, element-id, nodes, node-1, node-2, ...
+            vector<int> localelmts,elmts;
+            getRankChunksRange(chunks,cStart,cEnd);
+            vector<long long> binaryline;
+            for(int c=cStart;c<cEnd;c++){
+                seekChunkLine(in,chunks[c].m_offset);
+                if(m_IsBinary){
+                    // element-tag, node-tag-1, node-tag-2, ... in size_t
+                    nodes=MshFileUtils::getElmtNodesNumFromElmtType(blockinfo[4*chunks[c].m_block+2]);
+                    binaryline.resize(1+nodes);
+                    ints.resize(1+nodes);
                 }
-
-                entityDim=static_cast<int>(numbers[1-1]);
-                entityTag=static_cast<int>(numbers[2-1]);
-                elmttype=static_cast<int>(numbers[3-1]);
-                numElementsInBlock=static_cast<int>(numbers[4-1]);
-                phyid=getPhysicalIDViaEntityTag(entityDim,entityTag);
-                vtktype=MshFileUtils::getElmtVTKCellTypeFromElmtType(elmttype);
-                meshtype=MshFileUtils::getElmtMeshTypeFromElmtType(elmttype);
-                elmtorder=MshFileUtils::getElmtOrderFromElmtType(elmttype);
-                nodes=MshFileUtils::getElmtNodesNumFromElmtType(elmttype);
-                meshtypename=MshFileUtils::getElmtMeshTypeNameFromElmtType(elmttype);
-
-                for(int i=0;i<numElementsInBlock;i++){
-                    getline(in,str);
-                    numbers=StringUtils::splitStrNum(str);
-                    nodes=static_cast<int>(numbers.size()-1);
-                    elmtid=static_cast<int>(numbers[1-1]);
+                for(int i=0;i<chunks[c].m_lines;i++){
+                    if(m_IsBinary){
+                        for(auto &val:binaryline) in.readBinarySize(m_DataSize,val);
+                        for(int j=0;j<=nodes;j++) ints[j]=static_cast<int>(binaryline[j]);
+                    }
+                    else if(in.readLineInts(ints)<2){
+                        MessagePrinter::printErrorTxt("Invalid element information in your msh4 file inside the $Elements");
+                        MessagePrinter::exitAsFem();
+                    }
+                    nodes=static_cast<int>(ints.size()-1);
+                    elmtid=ints[1-1];
                     if(elmtid<minElementTag||elmtid>maxElementTag){
                         MessagePrinter::printErrorTxt("Invalid element Tag in your msh4 file inside the $Elements");
                         MessagePrinter::exitAsFem();
                     }
+                    localelmts.push_back(chunks[c].m_block);
+                    localelmts.push_back(elmtid);
+                    localelmts.push_back(nodes);
+                    localelmts.insert(localelmts.end(),ints.begin()+1,ints.end());
+                }
+            }
+            if(IsRouted){
+                for(int i=0;i<4;i++) elmtsummary[i]=summary[i];
+                RankElmts.swap(localelmts);
+                ElmtBlockInfo.swap(blockinfo);
+                in.seek(endoffset);
+                continue;
+            }
+            allGatherVector(localelmts,elmts,MPI_INT);
+            vector<int>().swap(localelmts);
+
+            // all the ranks go through the elements in the file order
+            int block=-1;
+            entityDim=0;elmttype=0;phyid=0;vtktype=0;elmtorder=1;
+            meshtype=MeshType::EDGE2;
+            for(int k=0;k<static_cast<int>(elmts.size());k+=3+nodes){
+                if(elmts[k]!=block){
+                    //entityDim(int) entityTag(int) elementType(int; see below) numElementsInBlock(size_t)
+                    block=elmts[k];
+                    entityDim=blockinfo[4*block+0];
+                    entityTag=blockinfo[4*block+1];
+                    elmttype=blockinfo[4*block+2];
+                    phyid=getPhysicalIDViaEntityTag(entityDim,entityTag);
+                    vtktype=MshFileUtils::getElmtVTKCellTypeFromElmtType(elmttype);
+                    meshtype=MshFileUtils::getElmtMeshTypeFromElmtType(elmttype);
+                    elmtorder=MshFileUtils::getElmtOrderFromElmtType(elmttype);
+                    meshtypename=MshFileUtils::getElmtMeshTypeNameFromElmtType(elmttype);
+                }
+                elmtid=elmts[k+1];
+                nodes=elmts[k+2];
 
-                    ElmtIDFlag[elmtid-1]=1;
-                    ElmtDimVec[elmtid-1]=entityDim;
-                    ElmtPhyIDVec[elmtid-1]=phyid;
-                    tempconn.resize(nodes);
-                    for(int j=1;j<=nodes;j++){
-                        tempconn[j-1]=static_cast<int>(numbers[j]);
-                    }
-                    
-                    MshFileUtils::reorderNodesIndex(elmttype,tempconn);
+                ElmtIDFlag[elmtid-1]=1;
+                ElmtDimVec[elmtid-1]=entityDim;
+                ElmtPhyIDVec[elmtid-1]=phyid;
+                tempconn.assign(elmts.begin()+k+3,elmts.begin()+k+3+nodes);
 
-                    ElmtConn[elmtid-1]=tempconn;
-                    if(entityDim<meshdata.m_mindim) meshdata.m_mindim=entityDim;
+                MshFileUtils::reorderNodesIndex(elmttype,tempconn);
 
-                    if(entityDim==0 && entityDim<mshMaxDim){
-                        meshdata.m_pointelmts+=1;
-                        meshdata.m_pointelmt_connectivity.push_back(tempconn);
-                        meshdata.m_pointelmt_volume.push_back(0.0);
-                    }
-                    if(entityDim==1 && entityDim<mshMaxDim){
-                        meshdata.m_lineelmts+=1;
-                        meshdata.m_lineelmt_connectivity.push_back(tempconn);
-                        meshdata.m_lineelmt_type=meshtype;
-                        meshdata.m_lineelmt_volume.push_back(0.0);
-                        meshdata.m_nodesperlineelmt=nodes;
-                    }
-                    if(entityDim==2 && entityDim<mshMaxDim){
-                        meshdata.m_surfaceelmts+=1;
-                        meshdata.m_surfaceelmt_connectivity.push_back(tempconn);
-                        meshdata.m_surfaceelmt_type=meshtype;
-                        meshdata.m_surfaceelmt_volume.push_back(0.0);
-                        meshdata.m_nodespersurfaceelmt=nodes;
-                    }
-                    if(entityDim==mshMaxDim){
-                        meshdata.m_bulkelmts+=1;
-                        mshBulkElmtUniquePhyIDVec.push_back(phyid);
-                        meshdata.m_bulkelmt_connectivity.push_back(tempconn);
-                        meshdata.m_bulkelmt_type=meshtype;
-                        meshdata.m_bulkelmt_typename=meshtypename;
-                        meshdata.m_bulkelmt_volume.push_back(0.0);
-                        meshdata.m_bulkelmt_vtktype=vtktype;
-                        meshdata.m_order=elmtorder;
-                        meshdata.m_nodesperbulkelmt=nodes;
-                    }
-                } // end-of-element-in-block-reading
-            } // end-of-element-block-loop
+                if(entityDim<meshdata.m_mindim) meshdata.m_mindim=entityDim;
+
+                if(entityDim==0 && entityDim<mshMaxDim){
+                    meshdata.m_pointelmts+=1;
+                    meshdata.m_pointelmt_connectivity.push_back(tempconn);
+                    ElmtLocalID[elmtid-1]=meshdata.m_pointelmt_connectivity.size();
+                    meshdata.m_pointelmt_volume.push_back(0.0);
+                }
+                if(entityDim==1 && entityDim<mshMaxDim){
+                    meshdata.m_lineelmts+=1;
+                    meshdata.m_lineelmt_connectivity.push_back(tempconn);
+                    ElmtLocalID[elmtid-1]=meshdata.m_lineelmt_connectivity.size();
+                    meshdata.m_lineelmt_type=meshtype;
+                    meshdata.m_lineelmt_volume.push_back(0.0);
+                    meshdata.m_nodesperlineelmt=nodes;
+                }
+                if(entityDim==2 && entityDim<mshMaxDim){
+                    meshdata.m_surfaceelmts+=1;
+                    meshdata.m_surfaceelmt_connectivity.push_back(tempconn);
+                    ElmtLocalID[elmtid-1]=meshdata.m_surfaceelmt_connectivity.size();
+                    meshdata.m_surfaceelmt_type=meshtype;
+                    meshdata.m_surfaceelmt_volume.push_back(0.0);
+                    meshdata.m_nodespersurfaceelmt=nodes;
+                }
+                if(entityDim==mshMaxDim){
+                    meshdata.m_bulkelmts+=1;
+                    mshBulkElmtUniquePhyIDVec.push_back(phyid);
+                    meshdata.m_bulkelmt_connectivity.push_back(tempconn);
+                    ElmtLocalID[elmtid-1]=meshdata.m_bulkelmt_connectivity.size();
+                    meshdata.m_bulkelmt_type=meshtype;
+                    meshdata.m_bulkelmt_typename=meshtypename;
+                    meshdata.m_bulkelmt_volume.push_back(0.0);
+                    meshdata.m_bulkelmt_vtktype=vtktype;
+                    meshdata.m_order=elmtorder;
+                    meshdata.m_nodesperbulkelmt=nodes;
+                }
+            } // end-of-element-replay
+            vector<int>().swap(elmts);
+            // continue after $EndElements
+            in.seek(endoffset);
 
             // before we jump out, we check the consistency between different elements
             if(meshdata.m_pointelmts
@@ -489,6 +832,13 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
     }// end-of-msh-file-reading
     in.close();
 
+    if(IsRouted){
+        return buildDistributedMesh(mshMaxDim,nodesummary,RankNodeTags,RankNodeCoords,
+                                    elmtsummary,ElmtBlockInfo,RankElmts,
+                                    mshPhyGroupDimVec,mshPhyGroupIDVec,mshPhyGroupNameVec,mshBulkPhyGroupNum,
+                                    mshNodalPhyGroupIDVec,mshNodalPhyGroupNameVec,meshdata);
+    }
+
     //**********************************************************************************
     //*** now we re-arrange the node id and element id, to make them to be continue
     //**********************************************************************************
@@ -515,25 +865,25 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
     }
     NodeCoords.clear();
 
-    int nodeid=0,j,maxnodeid;
+    int nodeid=0,maxnodeid;
     count=0;maxnodeid=-1;
     for(int e=0;e<maxElementTag;e++){
         if(ElmtIDFlag[e]>0){
             count+=1;
             ElmtIDFlag[e]=count;// the active element id
-            for(int i=1;i<=static_cast<int>(ElmtConn[e].size());i++){
-                j=ElmtConn[e][i-1];
-                if(NodeIDFlag[j-1]){
-                    nodeid=NodeIDFlag[j-1];
-                    ElmtConn[e][i-1]=nodeid;
-                    if(nodeid>maxnodeid) maxnodeid=nodeid;
-                }
-                else{
-                    MessagePrinter::printErrorTxt("Invalid node id in "+to_string(e+1)+"-th element "+to_string(i)+"-th node, please check your msh4 file");
-                    MessagePrinter::exitAsFem();
-                }
-
+        }
+    }
+    // the node tags in the connectivity are replaced by the active node id
+    for(auto *elmtconn:{&meshdata.m_pointelmt_connectivity,&meshdata.m_lineelmt_connectivity,
+                        &meshdata.m_surfaceelmt_connectivity,&meshdata.m_bulkelmt_connectivity}){
+        for(auto &id:elmtconn->getNodeIDsRef()){
+            if(id<1||id>maxNodeTag||NodeIDFlag[id-1]<1){
+                MessagePrinter::printErrorTxt("Invalid node id(="+to_string(id)+") in your elements, please check your msh4 file");
+                MessagePrinter::exitAsFem();
             }
+            nodeid=NodeIDFlag[id-1];
+            id=nodeid;
+            if(nodeid>maxnodeid) maxnodeid=nodeid;
         }
     }
     if(maxnodeid<numNodes){
@@ -545,11 +895,10 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
         MessagePrinter::exitAsFem();
     }
     
-    vector<int> ElmtDimVecCopy,ElmtPhyIDVecCopy;
-    vector<vector<int>> ElmtConnCopy;
+    vector<int> ElmtDimVecCopy,ElmtPhyIDVecCopy,ElmtLocalIDCopy;
     ElmtDimVecCopy.resize(numElements,0);
     ElmtPhyIDVecCopy.resize(numElements,0);
-    ElmtConnCopy.resize(numElements);
+    ElmtLocalIDCopy.resize(numElements,0);
     int elmtid;
     for(int e=0;e<maxElementTag;e++){
         if(ElmtIDFlag[e]){
@@ -557,16 +906,16 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
             elmtid=ElmtIDFlag[e];
             ElmtDimVecCopy[elmtid-1]=ElmtDimVec[e];
             ElmtPhyIDVecCopy[elmtid-1]=ElmtPhyIDVec[e];
-            ElmtConnCopy[elmtid-1]=ElmtConn[e];
+            ElmtLocalIDCopy[elmtid-1]=ElmtLocalID[e];
         }
     }
     ElmtDimVec=ElmtDimVecCopy;
     ElmtPhyIDVec=ElmtPhyIDVecCopy;
-    ElmtConn=ElmtConnCopy;
+    ElmtLocalID=ElmtLocalIDCopy;
 
     ElmtDimVecCopy.clear();
     ElmtPhyIDVecCopy.clear();
-    ElmtConnCopy.clear();
+    ElmtLocalIDCopy.clear();
 
     mshPhyGroupNum=static_cast<int>(mshPhyGroupDimVec.size());// remove the nodal phy info
     if(mshBulkPhyGroupNum==0){
@@ -592,7 +941,7 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
             meshdata.m_phygroup_elmtnumvec.clear();
 
             meshdata.m_phygroup_name2bulkelmtidvec.clear();
-            meshdata.m_phygroup_name2elmtconnvec.clear();
+            meshdata.m_phygroup_name2elmtidvec.clear();
 
             meshdata.m_phygroup_nodesnumperelmtvec.clear();
 
@@ -625,13 +974,13 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
             meshdata.m_phygroup_nodesnumperelmtvec.push_back(meshdata.m_nodesperbulkelmt);// for alldomain
 
             meshdata.m_phygroup_name2bulkelmtidvec.resize(meshdata.m_phygroups);
-            meshdata.m_phygroup_name2elmtconnvec.resize(meshdata.m_phygroups);
+            meshdata.m_phygroup_name2elmtidvec.resize(meshdata.m_phygroups);
             meshdata.m_phygroup_elmtnumvec.resize(meshdata.m_phygroups);
 
             // now we need to loop all the elements and clasify all the element sets
             // meshdata.m_phygroup_elmtnumvec.clear();
             // meshdata.m_phygroup_name2bulkelmtidvec.clear();
-            // meshdata.m_phygroup_name2elmtconnvec.clear();
+            // meshdata.m_phygroup_name2elmtidvec.clear();
             int subelmts;
             subelmts=meshdata.m_pointelmts+meshdata.m_lineelmts+meshdata.m_surfaceelmts;
             for(int e=subelmts;e<meshdata.m_elements;e++){
@@ -647,8 +996,8 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
                             meshdata.m_phygroup_name2bulkelmtidvec[i].first=phyname;
                             meshdata.m_phygroup_name2bulkelmtidvec[i].second.push_back(e+1-subelmts);
 
-                            meshdata.m_phygroup_name2elmtconnvec[i].first=phyname;
-                            meshdata.m_phygroup_name2elmtconnvec[i].second.push_back(meshdata.m_bulkelmt_connectivity[e]);
+                            meshdata.m_phygroup_name2elmtidvec[i].first=phyname;
+                            meshdata.m_phygroup_name2elmtidvec[i].second.push_back(ElmtLocalID[e]);
                         }
                     }
                     meshdata.m_phygroup_name2bulkelmtidvec[meshdata.m_phygroups-1].first="alldomain";
@@ -656,8 +1005,8 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
                 }
             }
             meshdata.m_phygroup_elmtnumvec[meshdata.m_phygroups-1]=meshdata.m_bulkelmts;
-            meshdata.m_phygroup_name2elmtconnvec[meshdata.m_phygroups-1].first="alldomain";
-            meshdata.m_phygroup_name2elmtconnvec[meshdata.m_phygroups-1].second=meshdata.m_bulkelmt_connectivity;
+            meshdata.m_phygroup_name2elmtidvec[meshdata.m_phygroups-1].first="alldomain";
+            meshdata.m_phygroup_name2elmtidvec[meshdata.m_phygroups-1].second=getBulkElmtIDs(meshdata.m_bulkelmts);
         }
         else{
             // if we have the lower dimension physical group but zero volume mesh physical info, we should 
@@ -676,7 +1025,7 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
             meshdata.m_phygroup_elmtnumvec.clear();
 
             meshdata.m_phygroup_name2bulkelmtidvec.clear();
-            meshdata.m_phygroup_name2elmtconnvec.clear();
+            meshdata.m_phygroup_name2elmtidvec.clear();
 
             meshdata.m_phygroup_nodesnumperelmtvec.clear();
 
@@ -733,7 +1082,7 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
 
             meshdata.m_phygroup_elmtnumvec.resize(meshdata.m_phygroups,0);
             meshdata.m_phygroup_name2bulkelmtidvec.resize(mshBulkPhyGroupNum+1);
-            meshdata.m_phygroup_name2elmtconnvec.resize(meshdata.m_phygroups);
+            meshdata.m_phygroup_name2elmtidvec.resize(meshdata.m_phygroups);
 
             subelmts=meshdata.m_pointelmts+meshdata.m_lineelmts+meshdata.m_surfaceelmts;
             for(int e=0;e<meshdata.m_elements;e++){
@@ -744,8 +1093,8 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
                         phyname=meshdata.m_phygroup_phynamevec[i];
                         meshdata.m_phygroup_elmtnumvec[i]+=1;
 
-                        meshdata.m_phygroup_name2elmtconnvec[i].first=phyname;
-                        meshdata.m_phygroup_name2elmtconnvec[i].second.push_back(ElmtConn[e]);
+                        meshdata.m_phygroup_name2elmtidvec[i].first=phyname;
+                        meshdata.m_phygroup_name2elmtidvec[i].second.push_back(ElmtLocalID[e]);
                         if(dim==mshMaxDim){
                             // for volume mesh
                             meshdata.m_phygroup_name2bulkelmtidvec[i-mshPhyGroupNum].first=phyname;
@@ -758,8 +1107,8 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
                     meshdata.m_phygroup_name2bulkelmtidvec[mshBulkPhyGroupNum].first=phyname;
                     meshdata.m_phygroup_name2bulkelmtidvec[mshBulkPhyGroupNum].second.push_back(e-subelmts+1);
 
-                    meshdata.m_phygroup_name2elmtconnvec[meshdata.m_phygroups-1].first="alldomain";
-                    meshdata.m_phygroup_name2elmtconnvec[meshdata.m_phygroups-1].second.push_back(ElmtConn[e]);
+                    meshdata.m_phygroup_name2elmtidvec[meshdata.m_phygroups-1].first="alldomain";
+                    meshdata.m_phygroup_name2elmtidvec[meshdata.m_phygroups-1].second.push_back(ElmtLocalID[e]);
                 }
             }// end-of-element-loop
             // add "alldomain" info
@@ -782,7 +1131,7 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
         meshdata.m_phygroup_elmtnumvec.clear();
 
         meshdata.m_phygroup_name2bulkelmtidvec.clear();
-        meshdata.m_phygroup_name2elmtconnvec.clear();
+        meshdata.m_phygroup_name2elmtidvec.clear();
 
         meshdata.m_phygroup_nodesnumperelmtvec.clear();
 
@@ -816,7 +1165,7 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
         }
         meshdata.m_phygroup_elmtnumvec.resize(meshdata.m_phygroups,0);
         meshdata.m_phygroup_name2bulkelmtidvec.resize(mshBulkPhyGroupNum+1);
-        meshdata.m_phygroup_name2elmtconnvec.resize(meshdata.m_phygroups);
+        meshdata.m_phygroup_name2elmtidvec.resize(meshdata.m_phygroups);
         for(int e=0;e<meshdata.m_elements;e++){
             phyid=ElmtPhyIDVec[e];
             dim=ElmtDimVec[e];
@@ -825,8 +1174,8 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
                     phyname=meshdata.m_phygroup_phynamevec[i];
                     meshdata.m_phygroup_elmtnumvec[i]+=1;
 
-                    meshdata.m_phygroup_name2elmtconnvec[i].first=phyname;
-                    meshdata.m_phygroup_name2elmtconnvec[i].second.push_back(ElmtConn[e]);
+                    meshdata.m_phygroup_name2elmtidvec[i].first=phyname;
+                    meshdata.m_phygroup_name2elmtidvec[i].second.push_back(ElmtLocalID[e]);
 
                     if(dim==mshMaxDim){
                         meshdata.m_phygroup_name2bulkelmtidvec[i-(mshPhyGroupNum-mshBulkPhyGroupNum)].first=phyname;
@@ -856,8 +1205,8 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
 
         meshdata.m_phygroup_elmtnumvec[meshdata.m_phygroups-1]=meshdata.m_bulkelmts;
 
-        meshdata.m_phygroup_name2elmtconnvec[meshdata.m_phygroups-1].first=phyname;
-        meshdata.m_phygroup_name2elmtconnvec[meshdata.m_phygroups-1].second=meshdata.m_bulkelmt_connectivity;
+        meshdata.m_phygroup_name2elmtidvec[meshdata.m_phygroups-1].first=phyname;
+        meshdata.m_phygroup_name2elmtidvec[meshdata.m_phygroups-1].second=getBulkElmtIDs(meshdata.m_bulkelmts);
 
     }
 
@@ -885,7 +1234,7 @@ bool Msh4FileImporter::importMeshFile(const string &filename,MeshData &meshdata)
                     if(phyid==mshNodalPhyGroupIDVec[i]){
                         phyname=mshNodalPhyGroupNameVec[i];
                         meshdata.m_nodephygroup_name2nodeidvec[i].first=phyname;
-                        meshdata.m_nodephygroup_name2nodeidvec[i].second.push_back(ElmtConn[e][0]);
+                        meshdata.m_nodephygroup_name2nodeidvec[i].second.push_back(meshdata.m_pointelmt_connectivity[ElmtLocalID[e]-1][0]);
                     }
                 }
             }
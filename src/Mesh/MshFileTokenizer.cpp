@@ -0,0 +1,178 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the tokenizer shared by the msh/gmsh importers
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Mesh/MshFileTokenizer.h"
+
+MshFileTokenizer::MshFileTokenizer(){
+    m_data=nullptr;
+    m_size=0;
+    m_pos=0;
+}
+MshFileTokenizer::~MshFileTokenizer(){
+    close();
+}
+
+const unsigned char* MshFileTokenizer::mapFile(const string &filename,size_t &size){
+    size=0;
+    int fd=::open(filename.c_str(),O_RDONLY);
+    if(fd<0) return nullptr;
+    struct stat st;
+    if(fstat(fd,&st)!=0||st.st_size<1){
+        ::close(fd);
+        return nullptr;
+    }
+    size=static_cast<size_t>(st.st_size);
+    void *data=mmap(nullptr,size,PROT_READ,MAP_PRIVATE,fd,0);
+    ::close(fd);// the mapping is still valid after the file is closed
+    if(data==MAP_FAILED){
+        size=0;
+        return nullptr;
+    }
+    // the file is read from the beginning to the end
+    madvise(data,size,MADV_SEQUENTIAL);
+    return static_cast<const unsigned char*>(data);
+}
+void MshFileTokenizer::unmapFile(const unsigned char *data,const size_t &size){
+    if(data) munmap(const_cast<unsigned char*>(data),size);
+}
+
+bool MshFileTokenizer::open(const string &filename){
+    close();
+    const unsigned char *data=mapFile(filename,m_size);
+    if(!data) return false;
+    m_data=reinterpret_cast<const char*>(data);
+    m_pos=0;
+    return true;
+}
+void MshFileTokenizer::close(){
+    if(m_data) unmapFile(reinterpret_cast<const unsigned char*>(m_data),m_size);
+    m_data=nullptr;
+    m_size=0;
+    m_pos=0;
+}
+
+bool MshFileTokenizer::nextLine(string_view &line){
+    if(m_pos>=m_size){
+        line=string_view();
+        return false;
+    }
+    const char *first=m_data+m_pos;
+    const char *last=static_cast<const char*>(memchr(first,'\n',m_size-m_pos));
+    size_t len=last?static_cast<size_t>(last-first):m_size-m_pos;
+    m_pos+=len+(last?1:0);
+    if(len>0&&first[len-1]=='\r') len-=1;
+    line=string_view(first,len);
+    return true;
+}
+void MshFileTokenizer::skipLine(){
+    if(m_pos>=m_size) return;
+    const char *last=static_cast<const char*>(memchr(m_data+m_pos,'\n',m_size-m_pos));
+    m_pos=last?static_cast<size_t>(last-m_data)+1:m_size;
+}
+void MshFileTokenizer::skipLines(const long long &n){
+    for(long long i=0;i<n&&m_pos<m_size;i++) skipLine();
+}
+
+size_t MshFileTokenizer::find(const string_view &str,const size_t &first,const size_t &last)const{
+    const size_t end=last<m_size?last:m_size;
+    if(first>=end) return last;
+    const size_t pos=string_view(m_data+first,end-first).find(str);
+    return pos==string_view::npos?last:first+pos;
+}
+long long MshFileTokenizer::countLineStarts(const size_t &first,const size_t &last)const{
+    // the line starting at p is counted by the '\n' at p-1
+    const size_t end=last<m_size?last:m_size;
+    long long n=0;
+    const char *p=m_data+first-1,*pend=m_data+end-1;
+    while(p<pend){
+        p=static_cast<const char*>(memchr(p,'\n',pend-p));
+        if(!p) break;
+        n+=1;p+=1;
+    }
+    return n;
+}
+void MshFileTokenizer::getLineStarts(const size_t &first,const size_t &last,const long long &firstline,const long long &step,
+                                     vector<long long> &offsets)const{
+    const size_t end=last<m_size?last:m_size;
+    long long line=firstline;
+    const char *p=m_data+first-1,*pend=m_data+end-1;
+    while(p<pend){
+        p=static_cast<const char*>(memchr(p,'\n',pend-p));
+        if(!p) break;
+        p+=1;
+        if(line%step==0) offsets.push_back(static_cast<long long>(p-m_data));
+        line+=1;
+    }
+}
+
+bool MshFileTokenizer::readInt(int &val){
+    skipSpaces();
+    return parseNumber(val);
+}
+bool MshFileTokenizer::readDouble(double &val){
+    skipSpaces();
+    return parseNumber(val);
+}
+
+int MshFileTokenizer::readLineInts(vector<int> &vals){
+    int val;
+    vals.clear();
+    while(true){
+        skipBlanks();
+        if(m_pos>=m_size||m_data[m_pos]=='\n') break;
+        if(!parseNumber(val)) break;
+        vals.push_back(val);
+    }
+    skipLine();
+    return static_cast<int>(vals.size());
+}
+int MshFileTokenizer::readLineNums(vector<double> &vals){
+    double val;
+    vals.clear();
+    while(true){
+        skipBlanks();
+        if(m_pos>=m_size||m_data[m_pos]=='\n') break;
+        if(!parseNumber(val)) break;
+        vals.push_back(val);
+    }
+    skipLine();
+    return static_cast<int>(vals.size());
+}
+
+bool MshFileTokenizer::readBinary(void *vals,const size_t &bytes){
+    if(bytes>m_size-m_pos) return false;
+    memcpy(vals,m_data+m_pos,bytes);
+    m_pos+=bytes;
+    return true;
+}
+bool MshFileTokenizer::readBinarySize(const int &datasize,long long &val){
+    if(datasize==8){
+        uint64_t v;
+        if(!readBinaryValue(v)) return false;
+        val=static_cast<long long>(v);
+        return true;
+    }
+    else if(datasize==4){
+        uint32_t v;
+        if(!readBinaryValue(v)) return false;
+        val=static_cast<long long>(v);
+        return true;
+    }
+    return false;
+}
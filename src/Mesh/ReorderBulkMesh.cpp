@@ -0,0 +1,212 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: reorder the imported mesh for the cache locality, the
+//+++          bulk elements are sorted along the Hilbert (or Morton)
+//+++          curve of their centroids, then the nodes are numbered
+//+++          by the first touch in the new element order. So the
+//+++          neighbouring elements share the nearby nodes, and the
+//+++          gathers of the coordinates and the solution are close
+//+++          in memory
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <cstdint>
+
+#include "Mesh/BulkMesh.h"
+
+/**
+ * get the key of the point on the space-filling curve, the Hilbert key is computed by the transpose algorithm of
+ * J. Skilling (AIP Conf. Proc. 707, 2004), the Morton key just interleaves the bits
+ * @param type the curve type
+ * @param x the integer coordinates, they are modified for the Hilbert curve
+ * @param dim the number of coordinates
+ * @param bits the number of bits of each coordinate
+ */
+static uint64_t getCurveKey(const MeshReorderType &type,uint32_t x[3],const int &dim,const int &bits){
+    int i,b;
+    if(type==MeshReorderType::HILBERT&&dim>1){
+        const uint32_t M=1u<<(bits-1);
+        uint32_t P,Q,t;
+        // inverse undo
+        for(Q=M;Q>1;Q>>=1){
+            P=Q-1;
+            for(i=0;i<dim;i++){
+                if(x[i]&Q){
+                    x[0]^=P;
+                }
+                else{
+                    t=(x[0]^x[i])&P;x[0]^=t;x[i]^=t;
+                }
+            }
+        }
+        // gray encode
+        for(i=1;i<dim;i++) x[i]^=x[i-1];
+        t=0;
+        for(Q=M;Q>1;Q>>=1){
+            if(x[dim-1]&Q) t^=Q-1;
+        }
+        for(i=0;i<dim;i++) x[i]^=t;
+    }
+    uint64_t key=0;
+    for(b=bits-1;b>=0;b--){
+        for(i=0;i<dim;i++) key=(key<<1)|((x[i]>>b)&1u);
+    }
+    return key;
+}
+
+/**
+ * get the average node-index spread (max id-min id) of the bulk elements
+ */
+static double getAverageNodeSpread(const ElmtConnectivity &conn){
+    if(conn.empty()) return 0.0;
+    double sum=0.0;
+    for(int e=0;e<conn.size();e++){
+        ElmtConnSpan elconn=conn[e];
+        auto mm=std::minmax_element(elconn.begin(),elconn.end());
+        sum+=static_cast<double>(*mm.second-*mm.first);
+    }
+    return sum/conn.size();
+}
+
+void BulkMesh::reorderBulkMesh(const MeshReorderType &type){
+    if(type==MeshReorderType::NONE) return;
+    if(m_meshdata.m_isstructured||m_meshdata.m_isimplicit||m_meshdata.m_isdistributed){
+        // the generated grid is already ordered, and its numbering is required by the geometric multigrid
+        MessagePrinter::printWarningTxt("only the imported (not distributed) mesh can be reordered, the reorder option is ignored");
+        return;
+    }
+
+    const int nElmts=m_meshdata.m_bulkelmts;
+    const int nNodes=m_meshdata.m_nodes;
+    int e,i,k;
+
+    //*****************************************************
+    //*** the keys of the element centroids
+    //*****************************************************
+    double xmin[3],xmax[3];
+    for(k=0;k<3;k++){
+        xmin[k]=1.0e30;xmax[k]=-1.0e30;
+    }
+    for(i=0;i<nNodes;i++){
+        for(k=0;k<3;k++){
+            xmin[k]=std::min(xmin[k],m_meshdata.m_nodecoords0[3*i+k]);
+            xmax[k]=std::max(xmax[k],m_meshdata.m_nodecoords0[3*i+k]);
+        }
+    }
+    // only the axes with the non-zero extent are used, i.e. a 2d mesh in the x-z plane
+    int axes[3],dim=0;
+    for(k=0;k<3;k++){
+        if(xmax[k]-xmin[k]>1.0e-13*(1.0+std::fabs(xmax[k])+std::fabs(xmin[k]))) axes[dim++]=k;
+    }
+    if(dim==0||nElmts<2) return;
+    const int bits=(dim==1)?32:((dim==2)?31:21);
+    const double scale=static_cast<double>((1ull<<bits)-1);
+
+    vector<uint64_t> keys(nElmts);
+    uint32_t x[3];
+    double c[3];
+    for(e=0;e<nElmts;e++){
+        ElmtConnSpan elconn=m_meshdata.m_bulkelmt_connectivity[e];
+        c[0]=c[1]=c[2]=0.0;
+        for(const auto &node:elconn){
+            for(k=0;k<dim;k++) c[k]+=m_meshdata.m_nodecoords0[3*(node-1)+axes[k]];
+        }
+        for(k=0;k<dim;k++){
+            c[k]=(c[k]/elconn.size()-xmin[axes[k]])/(xmax[axes[k]]-xmin[axes[k]]);
+            x[k]=static_cast<uint32_t>(std::min(std::max(c[k],0.0),1.0)*scale);
+        }
+        keys[e]=getCurveKey(type,x,dim,bits);
+    }
+    // new2old for the bulk elements, the ties are kept in the original order, then all the ranks get the same order
+    vector<int> elmtperm(nElmts);
+    for(e=0;e<nElmts;e++) elmtperm[e]=e;
+    std::stable_sort(elmtperm.begin(),elmtperm.end(),[&](const int &a,const int &b){return keys[a]<keys[b];});
+    vector<uint64_t>().swap(keys);
+
+    //*****************************************************
+    //*** the nodes are numbered by the first touch
+    //*****************************************************
+    const double spreadold=getAverageNodeSpread(m_meshdata.m_bulkelmt_connectivity);
+    vector<int> nodeold2new(nNodes,0);
+    int nodeid=0;
+    for(e=0;e<nElmts;e++){
+        for(const auto &node:m_meshdata.m_bulkelmt_connectivity[elmtperm[e]]){
+            if(nodeold2new[node-1]==0) nodeold2new[node-1]=++nodeid;
+        }
+    }
+    // the nodes which are not used by any bulk element are kept at the end
+    for(i=0;i<nNodes;i++){
+        if(nodeold2new[i]==0) nodeold2new[i]=++nodeid;
+    }
+
+    //*****************************************************
+    //*** apply the new order
+    //*****************************************************
+    vector<double> coords(3*nNodes);
+    for(i=0;i<nNodes;i++){
+        for(k=0;k<3;k++) coords[3*(nodeold2new[i]-1)+k]=m_meshdata.m_nodecoords0[3*i+k];
+    }
+    m_meshdata.m_nodecoords0.swap(coords);
+    if(static_cast<int>(m_meshdata.m_nodecoords.size())==3*nNodes){
+        for(i=0;i<nNodes;i++){
+            for(k=0;k<3;k++) coords[3*(nodeold2new[i]-1)+k]=m_meshdata.m_nodecoords[3*i+k];
+        }
+        m_meshdata.m_nodecoords.swap(coords);
+    }
+    vector<double>().swap(coords);
+
+    ElmtConnectivity elconn;
+    elconn.reserve(nElmts,static_cast<int>(m_meshdata.m_bulkelmt_connectivity.getNodeIDsRef().size()));
+    for(e=0;e<nElmts;e++) elconn.push_back(m_meshdata.m_bulkelmt_connectivity[elmtperm[e]]);
+    m_meshdata.m_bulkelmt_connectivity.swap(elconn);
+    elconn.releaseMemory();
+    // the node ids of all the elements are renumbered, the lower dim elements keep their order since the groups refer to them by ids
+    for(auto *conn:{&m_meshdata.m_bulkelmt_connectivity,&m_meshdata.m_pointelmt_connectivity,
+                    &m_meshdata.m_lineelmt_connectivity,&m_meshdata.m_surfaceelmt_connectivity}){
+        for(auto &node:conn->getNodeIDsRef()) node=nodeold2new[node-1];
+    }
+    if(static_cast<int>(m_meshdata.m_bulkelmt_volume.size())==nElmts){
+        vector<double> volume(nElmts);
+        for(e=0;e<nElmts;e++) volume[e]=m_meshdata.m_bulkelmt_volume[elmtperm[e]];
+        m_meshdata.m_bulkelmt_volume.swap(volume);
+    }
+
+    // the bulk groups are sorted by the new ids, then their element loops follow the curve as well
+    vector<int> elmtold2new(nElmts);
+    for(e=0;e<nElmts;e++) elmtold2new[elmtperm[e]]=e+1;
+    vector<int>().swap(elmtperm);
+    auto renumberIDs=[](vector<int> &ids,const vector<int> &old2new){
+        for(auto &id:ids) id=old2new[id-1];
+        std::sort(ids.begin(),ids.end());
+    };
+    for(auto &group:m_meshdata.m_phygroup_name2elmtidvec){
+        bool IsBulkGroup=false;
+        for(const auto &it:m_meshdata.m_phygroup_name2dimvec){
+            if(it.first==group.first){
+                IsBulkGroup=(it.second==m_meshdata.m_maxdim);
+                break;
+            }
+        }
+        if(IsBulkGroup) renumberIDs(group.second,elmtold2new);
+    }
+    for(auto &group:m_meshdata.m_phygroup_name2bulkelmtidvec) renumberIDs(group.second,elmtold2new);
+    for(auto &group:m_meshdata.m_nodephygroup_name2nodeidvec) renumberIDs(group.second,nodeold2new);
+
+    //*****************************************************
+    //*** print out the locality report
+    //*****************************************************
+    const double spreadnew=getAverageNodeSpread(m_meshdata.m_bulkelmt_connectivity);
+    char buff[70];
+    snprintf(buff,70,"  mesh is reordered along the %s curve",type==MeshReorderType::HILBERT?"Hilbert":"Morton");
+    MessagePrinter::printNormalTxt(string(buff));
+    snprintf(buff,70,"  avg node spread per elmt: %12.2f -> %12.2f",spreadold,spreadnew);
+    MessagePrinter::printNormalTxt(string(buff));
+}
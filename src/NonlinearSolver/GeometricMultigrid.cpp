@@ -0,0 +1,256 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the geometric multigrid preconditioner for the mesh
+//+++          generated by AsFem
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "NonlinearSolver/GeometricMultigrid.h"
+
+GeometricMultigrid::GeometricMultigrid(){
+    m_created=false;
+    m_levels=0;
+    m_dim=0;
+    m_dofspernode=0;
+    for(int d=0;d<3;d++) m_n[d].clear();
+    m_node2lattice.clear();
+    m_activeids.clear();
+    m_prolongation.clear();
+}
+
+void GeometricMultigrid::createHierarchy(const Mesh &t_mesh,const DofHandler &t_dofhandler,const int &t_levels){
+    if(t_mesh.isDistributedMesh()){
+        MessagePrinter::printErrorTxt("the geometric multigrid (gmg) needs the whole mesh, it can\'t be used with the distributed mesh, please use another preconditioner");
+        MessagePrinter::exitAsFem();
+    }
+    if(!t_mesh.isStructuredMesh()){
+        MessagePrinter::printErrorTxt("the geometric multigrid (gmg) only works for the mesh generated by AsFem, please use another preconditioner");
+        MessagePrinter::exitAsFem();
+    }
+    m_dim=t_mesh.getBulkMeshMaxDim();
+    m_dofspernode=t_dofhandler.getMaxDofsPerNode();
+
+    // the intervals of the finest lattice, the mid-side nodes of the quadratic mesh are lattice points as well
+    int nfine[3];
+    nfine[0]=t_mesh.getBulkMeshBulkElmtOrder()*t_mesh.getBulkMeshNx();
+    nfine[1]=m_dim>=2?t_mesh.getBulkMeshBulkElmtOrder()*t_mesh.getBulkMeshNy():0;
+    nfine[2]=m_dim>=3?t_mesh.getBulkMeshBulkElmtOrder()*t_mesh.getBulkMeshNz():0;
+
+    // each coarse level halves the lattice, so the intervals must be divisible by 2^(levels-1)
+    m_levels=t_levels;
+    bool IsValid=false;
+    while(!IsValid){
+        IsValid=true;
+        for(int d=0;d<m_dim;d++){
+            if(nfine[d]%(1<<(m_levels-1))!=0) IsValid=false;
+        }
+        if(!IsValid) m_levels-=1;
+    }
+    if(m_levels<t_levels){
+        MessagePrinter::printWarningTxt("the mesh can\'t be coarsened "+to_string(t_levels-1)+" times, the multigrid levels is reduced to "+to_string(m_levels));
+    }
+
+    for(int d=0;d<3;d++){
+        m_n[d].resize(m_levels,0);
+        m_n[d][m_levels-1]=nfine[d];
+        for(int l=m_levels-2;l>=0;l--) m_n[d][l]=m_n[d][l+1]/2;
+    }
+
+    createLatticeMap(t_mesh);
+
+    // from the finest level to the coarsest one, each level gives the active dofs of the next coarse one
+    m_prolongation.resize(m_levels-1);
+    m_activeids.resize(m_levels);
+    for(int l=m_levels-1;l>=1;l--){
+        createProlongation(l,t_dofhandler);
+    }
+
+    m_created=true;
+}
+
+void GeometricMultigrid::createLatticeMap(const Mesh &t_mesh){
+    const int nNodes=t_mesh.getBulkMeshNodesNum();
+    double xmin[3],xmax[3],h[3],x;
+    int d,i,ijk;
+
+    for(d=0;d<3;d++){
+        xmin[d]=1.0e16;xmax[d]=-1.0e16;
+    }
+    for(i=1;i<=nNodes;i++){
+        for(d=0;d<m_dim;d++){
+            x=t_mesh.getBulkMeshIthNodeJthCoord0(i,d+1);
+            if(x<xmin[d]) xmin[d]=x;
+            if(x>xmax[d]) xmax[d]=x;
+        }
+    }
+    for(d=0;d<m_dim;d++) h[d]=(xmax[d]-xmin[d])/m_n[d][m_levels-1];
+
+    m_node2lattice.resize(nNodes*3,0);
+    for(i=1;i<=nNodes;i++){
+        for(d=0;d<m_dim;d++){
+            x=(t_mesh.getBulkMeshIthNodeJthCoord0(i,d+1)-xmin[d])/h[d];
+            ijk=static_cast<int>(x+0.5);
+            if(abs(x-ijk)>1.0e-6){
+                MessagePrinter::printErrorTxt("node-"+to_string(i)+" is not on the structured grid, the geometric multigrid can\'t be used for your mesh");
+                MessagePrinter::exitAsFem();
+            }
+            m_node2lattice[(i-1)*3+d]=ijk;
+        }
+    }
+}
+
+int GeometricMultigrid::getRowStencil(const int &l,const int (&ijk)[3],const int &dof,int (&cols)[8],double (&vals)[8])const{
+    const int nxc=m_n[0][l-1],nyc=m_n[1][l-1];
+    int ids[3][2],n[3];
+    double w[3][2];
+    // the tensor product of the 1d linear interpolation
+    for(int d=0;d<3;d++){
+        if(d<m_dim){
+            n[d]=get1DStencil(ijk[d],ids[d],w[d]);
+        }
+        else{
+            n[d]=1;ids[d][0]=0;w[d][0]=1.0;
+        }
+    }
+    int k=0;
+    for(int c=0;c<n[2];c++){
+        for(int b=0;b<n[1];b++){
+            for(int a=0;a<n[0];a++){
+                cols[k]=((ids[2][c]*(nyc+1)+ids[1][b])*(nxc+1)+ids[0][a])*m_dofspernode+dof;
+                vals[k]=w[0][a]*w[1][b]*w[2][c];
+                k+=1;
+            }
+        }
+    }
+    return k;
+}
+
+void GeometricMultigrid::createProlongation(const int &l,const DofHandler &t_dofhandler){
+    const int nxf=m_n[0][l],nyf=m_n[1][l];
+    const int nxc=m_n[0][l-1],nyc=m_n[1][l-1],nzc=m_n[2][l-1];
+    const int nnz=1<<m_dim;
+    int nrows,ncols,nlocal,rStart,rEnd;
+    int cols[8];
+    double vals[8];
+
+    if(l==m_levels-1){
+        // the rows of the finest level follow the dofs map of the system
+        nrows=t_dofhandler.getActiveDofs();
+    }
+    else{
+        // the rows of the other levels are the active dofs of this level, found by the finer one
+        nrows=static_cast<int>(m_activeids[l].size());
+    }
+    // the same row distribution as PETSC_DECIDE
+    nlocal=PETSC_DECIDE;
+    PetscSplitOwnership(PETSC_COMM_WORLD,&nlocal,&nrows);
+    MPI_Scan(&nlocal,&rEnd,1,MPI_INT,MPI_SUM,PETSC_COMM_WORLD);
+    rStart=rEnd-nlocal;
+
+    // the (lattice point, dof) of each local row
+    vector<int> rows,rowdofs,rowijk;
+    int row,full;
+    if(l==m_levels-1){
+        for(int i=1;i<=t_dofhandler.getNodesNum();i++){
+            for(int j=1;j<=m_dofspernode;j++){
+                row=t_dofhandler.getIthNodeJthDofID(i,j);
+                if(row<1) continue;// inactive dof
+                row-=1;
+                if(row<rStart||row>=rEnd) continue;
+                rows.push_back(row);
+                rowdofs.push_back(j-1);
+                for(int d=0;d<3;d++) rowijk.push_back(m_node2lattice[(i-1)*3+d]);
+            }
+        }
+    }
+    else{
+        for(row=rStart;row<rEnd;row++){
+            full=m_activeids[l][row];
+            rows.push_back(row);
+            rowdofs.push_back(full%m_dofspernode);
+            rowijk.push_back((full/m_dofspernode)%(nxf+1));
+            rowijk.push_back(((full/m_dofspernode)/(nxf+1))%(nyf+1));
+            rowijk.push_back((full/m_dofspernode)/((nxf+1)*(nyf+1)));
+        }
+    }
+
+    // only the coarse dofs reached by an active fine dof are kept, otherwise the galerkin
+    // coarse operator has empty rows when a dof is only active on part of the mesh
+    int ijk[3],k;
+    vector<int> coarseid((nxc+1)*(nyc+1)*(nzc+1)*m_dofspernode,0);
+    for(int r=0;r<static_cast<int>(rows.size());r++){
+        ijk[0]=rowijk[r*3+0];ijk[1]=rowijk[r*3+1];ijk[2]=rowijk[r*3+2];
+        k=getRowStencil(l,ijk,rowdofs[r],cols,vals);
+        for(int c=0;c<k;c++) coarseid[cols[c]]=1;
+    }
+    MPI_Allreduce(MPI_IN_PLACE,coarseid.data(),static_cast<int>(coarseid.size()),MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    m_activeids[l-1].clear();
+    for(int i=0;i<static_cast<int>(coarseid.size());i++){
+        if(coarseid[i]){
+            coarseid[i]=static_cast<int>(m_activeids[l-1].size());
+            m_activeids[l-1].push_back(i);
+        }
+        else{
+            coarseid[i]=-1;
+        }
+    }
+    ncols=static_cast<int>(m_activeids[l-1].size());
+
+    Mat &P=m_prolongation[l-1];
+    MatCreateAIJ(PETSC_COMM_WORLD,nlocal,PETSC_DECIDE,nrows,ncols,nnz,NULL,nnz,NULL,&P);
+    for(int r=0;r<static_cast<int>(rows.size());r++){
+        ijk[0]=rowijk[r*3+0];ijk[1]=rowijk[r*3+1];ijk[2]=rowijk[r*3+2];
+        k=getRowStencil(l,ijk,rowdofs[r],cols,vals);
+        for(int c=0;c<k;c++) cols[c]=coarseid[cols[c]];
+        MatSetValues(P,1,&rows[r],k,cols,vals,INSERT_VALUES);
+    }
+    MatAssemblyBegin(P,MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(P,MAT_FINAL_ASSEMBLY);
+}
+
+void GeometricMultigrid::setupPC(PC &t_pc){
+    KSP ksp;
+    PC pc;
+
+    PCSetType(t_pc,PCMG);
+    PCMGSetLevels(t_pc,m_levels,NULL);
+    PCMGSetType(t_pc,PC_MG_MULTIPLICATIVE);
+    // the coarse operators are P^T*K*P, then no coarse mesh assembly is needed
+    PCMGSetGalerkin(t_pc,PC_MG_GALERKIN_BOTH);
+
+    for(int l=1;l<m_levels;l++){
+        PCMGSetInterpolation(t_pc,l,m_prolongation[l-1]);
+        // the penalty of dirichlet bc makes the spectrum very wide, so SOR is more robust than chebyshev here
+        PCMGGetSmoother(t_pc,l,&ksp);
+        KSPSetType(ksp,KSPRICHARDSON);
+        KSPSetTolerances(ksp,PETSC_DEFAULT,PETSC_DEFAULT,PETSC_DEFAULT,2);
+        KSPGetPC(ksp,&pc);
+        PCSetType(pc,PCSOR);
+    }
+    PCMGGetCoarseSolve(t_pc,&ksp);
+    KSPSetType(ksp,KSPPREONLY);
+    KSPGetPC(ksp,&pc);
+    PCSetType(pc,PCREDUNDANT);
+
+    // allow user setting the smoothers from command line, i.e. -mg_levels_ksp_type
+    PCSetFromOptions(t_pc);
+}
+
+void GeometricMultigrid::releaseMemory(){
+    if(m_created){
+        for(auto &it:m_prolongation) MatDestroy(&it);
+        m_prolongation.clear();
+        m_created=false;
+    }
+    for(int d=0;d<3;d++) m_n[d].clear();
+    m_node2lattice.clear();
+    m_activeids.clear();
+}
@@ -22,6 +22,41 @@ NonlinearSolver::NonlinearSolver(){
 }
 
 void NonlinearSolver::init(){
-    setFromNonlinearSolverBlock(m_nlsolverblock);
-    initSolver();
-}
\ No newline at end of file
+    if(m_nlsolverblock.m_nlsolvertype==NonlinearSolverType::STAGGERED){
+        m_staggeredsolver.setFromNonlinearSolverBlock(m_nlsolverblock);
+        m_staggeredsolver.initSolver();
+    }
+    else{
+        SNESSolver::setFromNonlinearSolverBlock(m_nlsolverblock);
+        SNESSolver::initSolver();
+    }
+}
+
+void NonlinearSolver::releaseMemory(){
+    SNESSolver::releaseMemory();
+    m_staggeredsolver.releaseMemory();
+}
+
+bool NonlinearSolver::solve(Mesh &t_mesh,DofHandler &t_dofhandler,FE &t_fe,
+                            ElmtSystem &t_elmtsystem,MateSystem &t_matesystem,
+                            FESystem &t_fesystem,
+                            BCSystem &t_bcsystem,
+                            SolutionSystem &t_solutionsystem,
+                            EquationSystem &t_equationsystem,
+                            FEControlInfo &t_fectrlinfo){
+    if(m_nlsolverblock.m_nlsolvertype==NonlinearSolverType::STAGGERED){
+        return m_staggeredsolver.solve(t_mesh,t_dofhandler,t_fe,t_elmtsystem,t_matesystem,t_fesystem,
+                                       t_bcsystem,t_solutionsystem,t_equationsystem,t_fectrlinfo);
+    }
+    return SNESSolver::solve(t_mesh,t_dofhandler,t_fe,t_elmtsystem,t_matesystem,t_fesystem,
+                             t_bcsystem,t_solutionsystem,t_equationsystem,t_fectrlinfo);
+}
+
+void NonlinearSolver::printSolverInfo()const{
+    if(m_nlsolverblock.m_nlsolvertype==NonlinearSolverType::STAGGERED){
+        m_staggeredsolver.printSolverInfo();
+    }
+    else{
+        SNESSolver::printSolverInfo();
+    }
+}
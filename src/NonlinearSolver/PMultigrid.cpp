@@ -0,0 +1,213 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the p-multigrid preconditioner for the quadratic
+//+++          mesh
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "NonlinearSolver/PMultigrid.h"
+
+PMultigrid::PMultigrid(){
+    m_created=false;
+    m_vertices=0;
+    m_nodesperelmt=0;
+    m_weights.clear();
+}
+
+bool PMultigrid::getLinearMeshType(const MeshType &t_meshtype,MeshType &t_lineartype)const{
+    switch(t_meshtype){
+    case MeshType::EDGE3:
+        t_lineartype=MeshType::EDGE2;
+        return true;
+    case MeshType::TRI6:
+        t_lineartype=MeshType::TRI3;
+        return true;
+    case MeshType::QUAD8:
+    case MeshType::QUAD9:
+        t_lineartype=MeshType::QUAD4;
+        return true;
+    case MeshType::TET10:
+        t_lineartype=MeshType::TET4;
+        return true;
+    case MeshType::HEX20:
+    case MeshType::HEX27:
+        t_lineartype=MeshType::HEX8;
+        return true;
+    default:
+        return false;
+    }
+}
+
+void PMultigrid::calcReferenceWeights(const MeshType &t_meshtype){
+    MeshType lineartype;
+    ShapeFun fineshp,linearshp;
+
+    getLinearMeshType(t_meshtype,lineartype);
+    fineshp.setMeshType(t_meshtype);fineshp.init();
+    linearshp.setMeshType(lineartype);linearshp.init();
+
+    // the reference nodes of the quadratic lagrange element are either the vertices or the mid-points of the
+    // edges/faces/cell, so they are found from the candidate points where one of the quadratic shape functions is 1
+    const bool IsSimplex=(t_meshtype==MeshType::TRI6||t_meshtype==MeshType::TET10);
+    const double c[3]={IsSimplex?0.0:-1.0,IsSimplex?0.5:0.0,1.0};
+    const int dim=(t_meshtype==MeshType::EDGE3)?1:((t_meshtype==MeshType::TRI6||t_meshtype==MeshType::QUAD8||t_meshtype==MeshType::QUAD9)?2:3);
+    Nodes nodes(m_nodesperelmt);// the nodal coordinates are not used for the local shape functions
+    double xi,eta,zeta;
+    int k,found=0;
+
+    m_weights.resize(m_nodesperelmt,vector<double>(m_vertices,0.0));
+    for(int a=0;a<3;a++){
+        for(int b=0;b<(dim>=2?3:1);b++){
+            for(int d=0;d<(dim>=3?3:1);d++){
+                xi=c[a];
+                eta=dim>=2?c[b]:0.0;
+                zeta=dim>=3?c[d]:0.0;
+                if(IsSimplex&&xi+eta+zeta>1.0+1.0e-12) continue;
+
+                fineshp.calc(xi,eta,zeta,nodes,false);
+                for(k=1;k<=m_nodesperelmt;k++){
+                    if(abs(fineshp.shape_value(k)-1.0)<1.0e-10) break;
+                }
+                if(k>m_nodesperelmt) continue;// i.e. the face center of quad8/hex20
+
+                linearshp.calc(xi,eta,zeta,nodes,false);
+                for(int v=1;v<=m_vertices;v++){
+                    m_weights[k-1][v-1]=linearshp.shape_value(v);
+                }
+                found+=1;
+            }
+        }
+    }
+    if(found!=m_nodesperelmt){
+        MessagePrinter::printErrorTxt("can\'t locate all the nodes of the reference element for the p-multigrid, please use another preconditioner");
+        MessagePrinter::exitAsFem();
+    }
+}
+
+void PMultigrid::createHierarchy(const Mesh &t_mesh,const DofHandler &t_dofhandler){
+    MeshType lineartype;
+    if(t_mesh.isDistributedMesh()){
+        MessagePrinter::printErrorTxt("the p-multigrid (pmg) needs the whole mesh, it can\'t be used with the distributed mesh, please use another preconditioner");
+        MessagePrinter::exitAsFem();
+    }
+    if(!getLinearMeshType(t_mesh.getBulkMeshBulkElmtMeshType(),lineartype)){
+        MessagePrinter::printErrorTxt("the p-multigrid (pmg) only works for the quadratic mesh, i.e. quad8, quad9, tri6, tet10, hex20 and hex27, please use another preconditioner");
+        MessagePrinter::exitAsFem();
+    }
+    ShapeFun linearshp;
+    linearshp.setMeshType(lineartype);linearshp.init();
+    m_vertices=linearshp.getShapeFunsNum();
+    m_nodesperelmt=t_mesh.getBulkMeshNodesNumPerBulkElmt();
+    calcReferenceWeights(t_mesh.getBulkMeshBulkElmtMeshType());
+
+    const int nNodes=t_mesh.getBulkMeshNodesNum();
+    const int nDofs=t_dofhandler.getMaxDofsPerNode();
+    int e,i,j,k,v,dofid;
+
+    // the local vertex nodes come first in the connectivity of the quadratic element, the 1st element
+    // (and the local index) which contains the non-vertex node gives its interpolation from the vertex ones
+    vector<int> nodeelmt(nNodes,0),nodelocal(nNodes,0);
+    vector<bool> IsVertex(nNodes,false);
+    for(e=1;e<=t_mesh.getBulkMeshBulkElmtsNum();e++){
+        for(k=1;k<=m_nodesperelmt;k++){
+            i=t_mesh.getBulkMeshIthBulkElmtJthNodeID(e,k);
+            if(k<=m_vertices) IsVertex[i-1]=true;
+            if(nodeelmt[i-1]==0){
+                nodeelmt[i-1]=e;
+                nodelocal[i-1]=k;
+            }
+        }
+    }
+
+    // the coarse dofs are the active dofs of the vertex nodes
+    vector<int> coarseid(nNodes*nDofs,-1);
+    int ncoarse=0;
+    for(i=1;i<=nNodes;i++){
+        if(!IsVertex[i-1]) continue;
+        for(j=1;j<=nDofs;j++){
+            if(t_dofhandler.getIthNodeJthDofID(i,j)<1) continue;
+            coarseid[(i-1)*nDofs+j-1]=ncoarse;
+            ncoarse+=1;
+        }
+    }
+
+    int rStart,rEnd,row,ncols,iv;
+    int cols[8];
+    double vals[8];
+    MatCreateAIJ(PETSC_COMM_WORLD,PETSC_DECIDE,PETSC_DECIDE,t_dofhandler.getActiveDofs(),ncoarse,m_vertices,NULL,m_vertices,NULL,&m_prolongation);
+    MatGetOwnershipRange(m_prolongation,&rStart,&rEnd);
+    for(i=1;i<=nNodes;i++){
+        for(j=1;j<=nDofs;j++){
+            dofid=t_dofhandler.getIthNodeJthDofID(i,j);
+            if(dofid<1) continue;// inactive dof
+            row=dofid-1;
+            if(row<rStart||row>=rEnd) continue;
+            ncols=0;
+            if(IsVertex[i-1]){
+                cols[0]=coarseid[(i-1)*nDofs+j-1];
+                vals[0]=1.0;
+                ncols=1;
+            }
+            else{
+                e=nodeelmt[i-1];
+                for(v=1;v<=m_vertices;v++){
+                    if(abs(m_weights[nodelocal[i-1]-1][v-1])<1.0e-12) continue;
+                    iv=t_mesh.getBulkMeshIthBulkElmtJthNodeID(e,v);
+                    if(coarseid[(iv-1)*nDofs+j-1]<0) continue;
+                    cols[ncols]=coarseid[(iv-1)*nDofs+j-1];
+                    vals[ncols]=m_weights[nodelocal[i-1]-1][v-1];
+                    ncols+=1;
+                }
+            }
+            MatSetValues(m_prolongation,1,&row,ncols,cols,vals,INSERT_VALUES);
+        }
+    }
+    MatAssemblyBegin(m_prolongation,MAT_FINAL_ASSEMBLY);
+    MatAssemblyEnd(m_prolongation,MAT_FINAL_ASSEMBLY);
+
+    m_created=true;
+}
+
+void PMultigrid::setupPC(PC &t_pc){
+    KSP ksp;
+    PC pc;
+
+    PCSetType(t_pc,PCMG);
+    PCMGSetLevels(t_pc,2,NULL);
+    PCMGSetType(t_pc,PC_MG_MULTIPLICATIVE);
+    // P^T*K*P is the operator of the linear element on the same mesh (the linear space is a subspace of the
+    // quadratic one), so the coarse level is never assembled by the element system
+    PCMGSetGalerkin(t_pc,PC_MG_GALERKIN_BOTH);
+    PCMGSetInterpolation(t_pc,1,m_prolongation);
+
+    PCMGGetSmoother(t_pc,1,&ksp);
+    KSPSetType(ksp,KSPRICHARDSON);
+    KSPSetTolerances(ksp,PETSC_DEFAULT,PETSC_DEFAULT,PETSC_DEFAULT,2);
+    KSPGetPC(ksp,&pc);
+    PCSetType(pc,PCSOR);
+
+    // the linear operator is the one AMG works well for
+    PCMGGetCoarseSolve(t_pc,&ksp);
+    KSPSetType(ksp,KSPPREONLY);
+    KSPGetPC(ksp,&pc);
+    PCSetType(pc,PCGAMG);
+
+    // allow user setting the smoother and the coarse solver from command line, i.e. -mg_coarse_pc_type
+    PCSetFromOptions(t_pc);
+}
+
+void PMultigrid::releaseMemory(){
+    if(m_created){
+        MatDestroy(&m_prolongation);
+        m_created=false;
+    }
+    m_weights.clear();
+}
@@ -38,7 +38,10 @@ PetscErrorCode myMonitor(SNES snes,PetscInt iters,PetscReal rnorm,void* ctx){
         user->enorm0=user->enorm;
     }
     if(user->IsDepDebug){
-        snprintf(buff,68,"  SNES solver: iters=%4d, |R|=%12.5e, |dU|=%12.5e",iters,rnorm,user->dunorm);
+        PetscInt lits;
+        SNESGetLinearSolveIterations(snes,&lits);// accumulated linear iterations
+        snprintf(buff,68,"  SNES: iters=%3d, lits=%4d, |R|=%12.5e, |dU|=%12.5e",iters,static_cast<int>(lits-user->lits),rnorm,user->dunorm);
+        user->lits=lits;
         str=buff;
         MessagePrinter::printNormalTxt(str);
     }
@@ -47,11 +50,7 @@ PetscErrorCode myMonitor(SNES snes,PetscInt iters,PetscReal rnorm,void* ctx){
 //***************************************************************
 //*** here we setup the subroutine for residual 
 //***************************************************************
-PetscErrorCode computeResidual(SNES snes,Vec U,Vec RHS,void *ctx){
-    AppCtx *user=(AppCtx*)ctx;
-    int i;
-    SNESGetMaxNonlinearStepFailures(snes,&i);// just to get rid of unused snes warning
-
+void formSystemResidual(AppCtx *user,Vec U,Vec RHS){
     computeTimeDerivatives(*user->_fectrlinfo,U,*user->_solutionSystem);
 
     user->_feSystem->formBulkFE(FECalcType::COMPUTERESIDUAL,
@@ -85,6 +84,14 @@ PetscErrorCode computeResidual(SNES snes,Vec U,Vec RHS,void *ctx){
                                              user->_equationSystem->m_rhs);
 
     user->_equationSystem->m_rhs.copy2Vec(RHS);// please overwrite RHS to make sure it is the correct one !
+}
+
+PetscErrorCode computeResidual(SNES snes,Vec U,Vec RHS,void *ctx){
+    AppCtx *user=(AppCtx*)ctx;
+    int i;
+    SNESGetMaxNonlinearStepFailures(snes,&i);// just to get rid of unused snes warning
+
+    formSystemResidual(user,U,RHS);
 
     return 0;
 }
@@ -92,9 +99,7 @@ PetscErrorCode computeResidual(SNES snes,Vec U,Vec RHS,void *ctx){
 //***************************************************************
 //*** here we setup the subroutine for jacobian 
 //***************************************************************
-PetscErrorCode computeJacobian(SNES snes,Vec U,Mat Jac,Mat B,void *ctx){
-    AppCtx *user=(AppCtx*)ctx;
-    
+void formSystemJacobian(AppCtx *user,Vec U){
     user->_feSystem->resetMaxKMatrixCoeff();
     
     computeTimeDerivatives(*user->_fectrlinfo,U,*user->_solutionSystem);
@@ -128,9 +133,38 @@ PetscErrorCode computeJacobian(SNES snes,Vec U,Mat Jac,Mat B,void *ctx){
                                              user->_solutionSystem->m_v,
                                              user->_equationSystem->m_amatrix,
                                              user->_equationSystem->m_rhs);
+}
 
-    int i;
-    SNESGetMaxNonlinearStepFailures(snes,&i);
+PetscErrorCode computeJacobian(SNES snes,Vec U,Mat Jac,Mat B,void *ctx){
+    AppCtx *user=(AppCtx*)ctx;
+    JacobianCtx *jac=user->_jacctx;
+    KSP ksp;
+    SNESGetKSP(snes,&ksp);
+
+    // for linear problem, the jacobian only depends on dt and ctan, if they are unchanged and
+    // no other path (staggered, imex, explicit mass ...) has assembled into K since then,
+    // both the assembly and the factorization of the stored jacobian can be skipped
+    if(jac->IsLinear&&jac->HasJacobian&&
+       jac->assemblycount==user->_equationSystem->m_amatrix.getAssemblyCount()&&
+       jac->dt==user->_fectrlinfo->dt&&
+       jac->ctan[0]==user->_fectrlinfo->ctan[0]&&
+       jac->ctan[1]==user->_fectrlinfo->ctan[1]&&
+       jac->ctan[2]==user->_fectrlinfo->ctan[2]){
+        KSPSetReusePreconditioner(ksp,PETSC_TRUE);
+        return 0;
+    }
+    
+    formSystemJacobian(user,U);
+
+    KSPSetReusePreconditioner(ksp,PETSC_FALSE);
+    jac->factorized+=1;
+    jac->assemblycount=user->_equationSystem->m_amatrix.getAssemblyCount();
+    jac->HasJacobian=true;
+    jac->dt=user->_fectrlinfo->dt;
+    jac->ctan[0]=user->_fectrlinfo->ctan[0];
+    jac->ctan[1]=user->_fectrlinfo->ctan[1];
+    jac->ctan[2]=user->_fectrlinfo->ctan[2];
+    jac->assembled+=1;
 
     if(Jac!=B){
         MatAssemblyBegin(Jac,MAT_FINAL_ASSEMBLY);
@@ -157,12 +191,16 @@ bool SNESSolver::solve(Mesh &mesh,DofHandler &dofhandler,FE &fe,
                    &elmtsystem,&matesystem,
                    &solutionsystem,&equationsystem,
                    &fe,&fesystem,
-                   &fectrlinfo
+                   &fectrlinfo,
+                   &m_jacctx
                    };
+    m_jacctx.IsLinear=elmtsystem.isLinearSystem();
+    m_jacctx.assembled=0;
+    m_jacctx.factorized=0;
     m_monctx=MonitorCtx{0.0,1.0,
                 0.0,1.0,
                 0.0,1.0,
-                0,
+                0,0,
                 fectrlinfo.IsDepDebug};
     
     m_appctx._bcSystem->applyPresetBoundaryConditions(FECalcType::UPDATEU,
@@ -177,17 +215,46 @@ bool SNESSolver::solve(Mesh &mesh,DofHandler &dofhandler,FE &fe,
                                              m_appctx._equationSystem->m_amatrix,
                                              m_appctx._equationSystem->m_rhs);
                                
+    if(m_pcname=="gmg"&&!m_gmg.isCreated()){
+        // the prolongation operators depend on the dofs map, so they are created in the first solve
+        m_gmg.createHierarchy(mesh,dofhandler,m_mg_levels);
+        m_gmg.setupPC(m_pc);
+    }
+    else if(m_pcname=="pmg"&&!m_pmg.isCreated()){
+        m_pmg.createHierarchy(mesh,dofhandler);
+        m_pmg.setupPC(m_pc);
+    }
+
+    if(m_nlsolvertype==NonlinearSolverType::VINEWTONRSLS){
+        setVariableBounds(dofhandler,solutionsystem);
+    }
+
     SNESSetFunction(m_snes,m_appctx._equationSystem->m_rhs.getVectorCopy(),computeResidual,&m_appctx);
     SNESSetJacobian(m_snes,m_appctx._equationSystem->m_amatrix.getCopy(),m_appctx._equationSystem->m_amatrix.getCopy(),computeJacobian,&m_appctx);
         
     SNESMonitorSet(m_snes,myMonitor,&m_monctx,0);
     SNESSetForceIteration(m_snes,PETSC_TRUE);
     SNESSetFromOptions(m_snes);
+    if(m_hasguessresidual&&
+       (m_nlsolvertype==NonlinearSolverType::NEWTON||
+        m_nlsolvertype==NonlinearSolverType::NEWTONLS||
+        m_nlsolvertype==NonlinearSolverType::NEWTONTR)){
+        // the residual of the initial guess is already assembled, the newton solvers take it as their first residual
+        SNESSetInitialFunction(m_snes,m_rguess);
+    }
+    m_hasguessresidual=false;
     SNESSolve(m_snes,NULL,m_appctx._solutionSystem->m_u_current.getVectorRef());
     SNESGetConvergedReason(m_snes,&m_snesconvergereason);
+    if(m_nlsolvertype==NonlinearSolverType::VINEWTONRSLS){
+        m_vi_minincrement=computeMinBoundedIncrement(solutionsystem);
+    }
     
     
     m_iterations=m_monctx.iters;
+    PetscInt lits;
+    SNESGetLinearSolveIterations(m_snes,&lits);
+    m_linear_iterations=static_cast<int>(lits);
+    m_rnorm0=m_monctx.rnorm0;
     m_rnorm=m_monctx.rnorm;
     m_abstol_du=m_monctx.dunorm;
     m_abstol_e=m_monctx.enorm;
@@ -206,6 +273,7 @@ bool SNESSolver::solve(Mesh &mesh,DofHandler &dofhandler,FE &fe,
             str=buff;
             MessagePrinter::printNormalTxt(str);
         }
+        printLinearIterationsInfo();
         return true;
     }
     else if(m_snesconvergereason==SNES_CONVERGED_FNORM_RELATIVE){
@@ -219,6 +287,7 @@ bool SNESSolver::solve(Mesh &mesh,DofHandler &dofhandler,FE &fe,
             str=buff;
             MessagePrinter::printNormalTxt(str);
         }
+        printLinearIterationsInfo();
         return true;
     }
     else if(m_snesconvergereason==SNES_CONVERGED_SNORM_RELATIVE){
@@ -232,13 +301,122 @@ bool SNESSolver::solve(Mesh &mesh,DofHandler &dofhandler,FE &fe,
             str=buff;
             MessagePrinter::printNormalTxt(str);
         }
+        printLinearIterationsInfo();
         return true;
     }
     else{
         snprintf(buff,68,"  Divergent, SNES nonlinear solver failed, iters=%3d",m_monctx.iters);
         str=buff;
         MessagePrinter::printNormalTxt(str);
+        printLinearIterationsInfo();
         return false;
     }
     return false;
 }
+
+double SNESSolver::computeGuessResidualNorm(Mesh &mesh,DofHandler &dofhandler,FE &fe,
+                                            ElmtSystem &elmtsystem,MateSystem &matesystem,
+                                            FESystem &fesystem,
+                                            BCSystem &bcsystem,
+                                            SolutionSystem &solutionsystem,
+                                            EquationSystem &equationsystem,
+                                            FEControlInfo &fectrlinfo){
+    AppCtx appctx={&mesh,&dofhandler,
+                   &bcsystem,
+                   &elmtsystem,&matesystem,
+                   &solutionsystem,&equationsystem,
+                   &fe,&fesystem,
+                   &fectrlinfo,
+                   nullptr
+                   };
+    if(!m_hasguessvecs){
+        VecDuplicate(solutionsystem.m_u_current.getVectorRef(),&m_rguess);
+        VecDuplicate(solutionsystem.m_u_current.getVectorRef(),&m_rguess_prev);
+        m_hasguessvecs=true;
+    }
+
+    solutionsystem.m_u_copy.copyFrom(solutionsystem.m_u_current);
+    bcsystem.applyPresetBoundaryConditions(FECalcType::UPDATEU,
+                                           fectrlinfo.t+fectrlinfo.dt,
+                                           mesh,dofhandler,
+                                           solutionsystem.m_u_current,
+                                           solutionsystem.m_u_copy,
+                                           solutionsystem.m_u_old,
+                                           solutionsystem.m_u_older,
+                                           solutionsystem.m_v,
+                                           equationsystem.m_amatrix,
+                                           equationsystem.m_rhs);
+
+    // the residual of the previous guess is kept as well, so the caller can still go back to it
+    usePreviousGuessResidual();
+    formSystemResidual(&appctx,solutionsystem.m_u_current.getVectorRef(),m_rguess);
+    m_hasguessresidual=true;
+
+    double rnorm;
+    VecNorm(m_rguess,NORM_2,&rnorm);
+    return rnorm;
+}
+
+void SNESSolver::setVariableBounds(const DofHandler &t_dofhandler,SolutionSystem &t_solutionsystem){
+    int iStart,iEnd,dofid;
+    if(!m_hasbounds){
+        for(const auto &name:m_vi_dofnames){
+            if(!t_dofhandler.isValidDofName(name)){
+                MessagePrinter::printErrorTxt("dof name="+name+" in your vi-dofs is invalid, please check your input file");
+                MessagePrinter::exitAsFem();
+            }
+        }
+        VecDuplicate(t_solutionsystem.m_u_current.getVectorRef(),&m_xl);
+        VecDuplicate(t_solutionsystem.m_u_current.getVectorRef(),&m_xu);
+        VecGetOwnershipRange(m_xl,&iStart,&iEnd);
+        // only the locally owned vi dofs are stored
+        m_vi_dofids.clear();
+        for(int i=1;i<=t_dofhandler.getLocalNodesNum();i++){
+            for(const auto &name:m_vi_dofnames){
+                dofid=t_dofhandler.getIthLocalNodeJthDofID(i,t_dofhandler.getDofIDViaName(name));
+                if(dofid<1) continue;// inactive dof
+                dofid-=1;
+                if(dofid<iStart||dofid>=iEnd) continue;
+                m_vi_dofids.push_back(dofid);
+            }
+        }
+        m_hasbounds=true;
+    }
+
+    // d_old<=d<=upper bound for the vi dofs, the others are unbounded
+    VecSet(m_xl,PETSC_NINFINITY);
+    VecSet(m_xu,PETSC_INFINITY);
+    VecGetOwnershipRange(m_xl,&iStart,&iEnd);
+
+    const PetscScalar *uold;
+    PetscScalar *xl,*xu;
+    VecGetArrayRead(t_solutionsystem.m_u_old.getVectorRef(),&uold);
+    VecGetArray(m_xl,&xl);
+    VecGetArray(m_xu,&xu);
+    for(const auto &it:m_vi_dofids){
+        xl[it-iStart]=uold[it-iStart];
+        if(m_vi_upperbound<1.0e19) xu[it-iStart]=m_vi_upperbound;
+    }
+    VecRestoreArray(m_xu,&xu);
+    VecRestoreArray(m_xl,&xl);
+    VecRestoreArrayRead(t_solutionsystem.m_u_old.getVectorRef(),&uold);
+
+    SNESVISetVariableBounds(m_snes,m_xl,m_xu);
+}
+
+double SNESSolver::computeMinBoundedIncrement(SolutionSystem &t_solutionsystem)const{
+    // the increment is taken from U_old rather than the lower bound vector, so a wrong bound is detected as well
+    int iStart,iEnd;
+    double dumin=PETSC_MAX_REAL,dumin_global;
+    const PetscScalar *u,*uold;
+    VecGetOwnershipRange(t_solutionsystem.m_u_current.getVectorRef(),&iStart,&iEnd);
+    VecGetArrayRead(t_solutionsystem.m_u_current.getVectorRef(),&u);
+    VecGetArrayRead(t_solutionsystem.m_u_old.getVectorRef(),&uold);
+    for(const auto &it:m_vi_dofids){
+        if(u[it-iStart]-uold[it-iStart]<dumin) dumin=u[it-iStart]-uold[it-iStart];
+    }
+    VecRestoreArrayRead(t_solutionsystem.m_u_old.getVectorRef(),&uold);
+    VecRestoreArrayRead(t_solutionsystem.m_u_current.getVectorRef(),&u);
+    MPI_Allreduce(&dumin,&dumin_global,1,MPI_DOUBLE,MPI_MIN,PETSC_COMM_WORLD);
+    return dumin_global;
+}
@@ -18,6 +18,17 @@ SNESSolver::SNESSolver(){
     m_initialized=false;/**< boolean flag for the status of initializing */
     m_maxiters=50;/**< the maximum iterations */
     m_iterations=0;/**< the iteration number */
+    m_linear_iterations=0;/**< the total linear iterations */
+
+    m_useinexactnewton=false;
+    m_ksp_restart=30;
+    m_ksp_maxiters=10000;
+    m_mg_levels=3;
+    m_vi_dofnames.clear();
+    m_vi_upperbound=1.0e20;
+    m_vi_dofids.clear();
+    m_hasbounds=false;
+    m_vi_minincrement=0.0;
     m_abstol_r=1.0e-7;/**< the absolute tolerance for residual */
     m_reltol_r=1.0e-9;/**< the relative tolerance for residual */
 
@@ -30,6 +41,9 @@ SNESSolver::SNESSolver(){
     m_rnorm0=1.0;/**< the initial norm of residual */
     m_rnorm =1.0;/**< the intermediate or final norm of reisudal */
 
+    m_hasguessvecs=false;
+    m_hasguessresidual=false;
+
     m_s_tol=0.0;
 
     m_linearsolvername="gmres";/**< the string name of the linear solver in SNES*/
@@ -50,102 +64,124 @@ void SNESSolver::setFromNonlinearSolverBlock(const NonlinearSolverBlock &nlblock
     m_s_tol=nlblock.m_s_tol;
 
     m_pcname=nlblock.m_pctypename;
-}
-
-void SNESSolver::initSolver(){
-    SNESCreate(PETSC_COMM_WORLD,&m_snes);
 
-    //**************************************************
-    //*** init KSP
-    //**************************************************
-    SNESGetKSP(m_snes,&m_ksp);
-    KSPGMRESSetRestart(m_ksp,2500);
-    KSPGetPC(m_ksp,&m_pc);
+    m_useinexactnewton=nlblock.m_useinexactnewton;
+    m_ksp_restart=nlblock.m_ksp_restart;
+    m_ksp_maxiters=nlblock.m_ksp_maxiters;
+    m_mg_levels=nlblock.m_mg_levels;
+    m_vi_dofnames=nlblock.m_vi_dofnames;
+    m_vi_upperbound=nlblock.m_vi_upperbound;
+}
 
+void setupLinearSolver(KSP &t_ksp,const string &t_linearsolvername,const string &t_pcname,
+                       const int &t_restart,const int &t_maxiters){
+    PC pc;
+    KSPGMRESSetRestart(t_ksp,t_restart);// the restart number limits the stored Krylov vectors
+    KSPSetTolerances(t_ksp,PETSC_DEFAULT,PETSC_DEFAULT,PETSC_DEFAULT,t_maxiters);
+    KSPGetPC(t_ksp,&pc);
 
     //**************************************************
     //*** setup the preconditioner
     //**************************************************
-    if(m_pcname=="lu"){
-        PCSetType(m_pc,PCLU);
+    if(t_pcname=="lu"){
+        PCSetType(pc,PCLU);
     }
-    else if(m_pcname=="ilu"){
-        PCSetType(m_pc,PCILU);
+    else if(t_pcname=="ilu"){
+        PCSetType(pc,PCILU);
     }
-    else if(m_pcname=="jacobi"){
-        PCSetType(m_pc,PCJACOBI);
+    else if(t_pcname=="jacobi"){
+        PCSetType(pc,PCJACOBI);
     }
-    else if(m_pcname=="bjacobi"){
-        PCSetType(m_pc,PCBJACOBI);
+    else if(t_pcname=="bjacobi"){
+        PCSetType(pc,PCBJACOBI);
     }
-    else if(m_pcname=="sor"){
-        PCSetType(m_pc,PCSOR);
+    else if(t_pcname=="sor"){
+        PCSetType(pc,PCSOR);
     }
-    else if(m_pcname=="icc"){
-        PCSetType(m_pc,PCICC);
+    else if(t_pcname=="icc"){
+        PCSetType(pc,PCICC);
     }
-    else if(m_pcname=="asm"){
-        PCSetType(m_pc,PCASM);
+    else if(t_pcname=="asm"){
+        PCSetType(pc,PCASM);
     }
-    else if(m_pcname=="gasm"){
-        PCSetType(m_pc,PCGASM);
+    else if(t_pcname=="gasm"){
+        PCSetType(pc,PCGASM);
     }
-    else if(m_pcname=="gamg"){
-        PCSetType(m_pc,PCGAMG);
+    else if(t_pcname=="gamg"){
+        PCSetType(pc,PCGAMG);
     }
-    else if(m_pcname=="ksp"){
-        PCSetType(m_pc,PCKSP);
+    else if(t_pcname=="gmg"||t_pcname=="pmg"){
+        PCSetType(pc,PCMG);// the levels and the prolongations are set once the mesh and dofs are ready
     }
-    else if(m_pcname=="cholesky"){
-        PCSetType(m_pc,PCCHOLESKY);
+    else if(t_pcname=="ksp"){
+        PCSetType(pc,PCKSP);
     }
-    else if(m_pcname=="none"){
-        PCSetType(m_pc,PCNONE);// no preconditioner
+    else if(t_pcname=="cholesky"){
+        PCSetType(pc,PCCHOLESKY);
+    }
+    else if(t_pcname=="none"){
+        PCSetType(pc,PCNONE);// no preconditioner
     }
     else{
-        MessagePrinter::printErrorTxt("unsupported preconditioner("+m_pcname+") in SNESSolver");
+        MessagePrinter::printErrorTxt("unsupported preconditioner("+t_pcname+") in your linear solver");
         MessagePrinter::exitAsFem();
     }
 
     //**************************************************
     //*** setup the linear solver
     //**************************************************
-    if(m_linearsolvername=="default"){
-        PCSetType(m_pc,PCLU);
+    if(t_linearsolvername=="default"){
+        PCSetType(pc,PCLU);
     }
-    else if(m_linearsolvername=="gmres"){
-        KSPSetType(m_ksp,KSPGMRES);
+    else if(t_linearsolvername=="gmres"){
+        KSPSetType(t_ksp,KSPGMRES);
     }
-    else if(m_linearsolvername=="fgmres"){
-        KSPSetType(m_ksp,KSPFGMRES);
+    else if(t_linearsolvername=="fgmres"){
+        KSPSetType(t_ksp,KSPFGMRES);
     }
-    else if(m_linearsolvername=="cg"){
-        KSPSetType(m_ksp,KSPCG);
+    else if(t_linearsolvername=="cg"){
+        KSPSetType(t_ksp,KSPCG);
     }
-    else if(m_linearsolvername=="bicg"){
-        KSPSetType(m_ksp,KSPBICG);
+    else if(t_linearsolvername=="bicg"){
+        KSPSetType(t_ksp,KSPBICG);
     }
-    else if(m_linearsolvername=="richardson"){
-        KSPSetType(m_ksp,KSPRICHARDSON);
+    else if(t_linearsolvername=="richardson"){
+        KSPSetType(t_ksp,KSPRICHARDSON);
     }
-    else if(m_linearsolvername=="mumps"){
-        KSPSetType(m_ksp,KSPPREONLY);
-        PCSetType(m_pc,PCLU);
-        PCFactorSetMatSolverType(m_pc,MATSOLVERMUMPS);
+    else if(t_linearsolvername=="mumps"){
+        KSPSetType(t_ksp,KSPPREONLY);
+        PCSetType(pc,PCLU);
+        PCFactorSetMatSolverType(pc,MATSOLVERMUMPS);
     }
-    else if(m_linearsolvername=="superlu"){
-        KSPSetType(m_ksp,KSPPREONLY);
-        PCSetType(m_pc,PCLU);
-        PCFactorSetMatSolverType(m_pc,MATSOLVERSUPERLU_DIST);
+    else if(t_linearsolvername=="superlu"){
+        KSPSetType(t_ksp,KSPPREONLY);
+        PCSetType(pc,PCLU);
+        PCFactorSetMatSolverType(pc,MATSOLVERSUPERLU_DIST);
     }
 
 
-    PCFactorSetReuseOrdering(m_pc,PETSC_TRUE);
+    // the sparsity pattern of K is fixed after createSparsityPattern, so PETSc only redoes the
+    // numeric factorization for a new K and keeps the symbolic one, the ordering and the fill
+    // estimate are reused as well in case the symbolic factorization is ever redone
+    PCFactorSetReuseOrdering(pc,PETSC_TRUE);
+    PCFactorSetReuseFill(pc,PETSC_TRUE);
 
+    //**************************************************
     //*** allow user setting ksp from command line
     //**************************************************
-    KSPSetFromOptions(m_ksp);
-    PCSetFromOptions(m_pc);
+    KSPSetFromOptions(t_ksp);
+    PCSetFromOptions(pc);
+}
+
+void SNESSolver::initSolver(){
+    SNESCreate(PETSC_COMM_WORLD,&m_snes);
+
+    //**************************************************
+    //*** init KSP and the preconditioner
+    //**************************************************
+    SNESGetKSP(m_snes,&m_ksp);
+    setupLinearSolver(m_ksp,m_linearsolvername,m_pcname,m_ksp_restart,m_ksp_maxiters);
+    KSPGetPC(m_ksp,&m_pc);
 
     //**************************************************
     //*** basic settings for SNES
@@ -153,6 +189,19 @@ void SNESSolver::initSolver(){
     SNESSetTolerances(m_snes,m_abstol_r,m_reltol_r,m_s_tol,m_maxiters,-1);
     SNESSetDivergenceTolerance(m_snes,-1);
 
+    //**************************************************
+    //*** inexact newton, the linear tolerance follows |R|
+    //**************************************************
+    if(m_useinexactnewton){
+        if(m_linearsolvername=="mumps"||m_linearsolvername=="superlu"){
+            MessagePrinter::printWarningTxt("inexact newton has no effect for the direct solver("+m_linearsolvername+"), it will be ignored");
+            m_useinexactnewton=false;
+        }
+        else{
+            SNESKSPSetUseEW(m_snes,PETSC_TRUE);
+        }
+    }
+
     //**************************************************
     //*** for different types of SNES solver
     //**************************************************
@@ -199,9 +248,21 @@ void SNESSolver::initSolver(){
     else if(m_nlsolvertype==NonlinearSolverType::FAS){
         SNESSetType(m_snes,SNESFAS);
     }
+    else if(m_nlsolvertype==NonlinearSolverType::VINEWTONRSLS){
+        // the bounds are set in each solve, since the lower bound comes from the previous solution
+        SNESSetType(m_snes,SNESVINEWTONRSLS);
+    }
 
     SNESSetFromOptions(m_snes);
 
+    m_jacctx.IsLinear=false;
+    m_jacctx.HasJacobian=false;
+    m_jacctx.dt=0.0;
+    m_jacctx.ctan[0]=0.0;m_jacctx.ctan[1]=0.0;m_jacctx.ctan[2]=0.0;
+    m_jacctx.assemblycount=-1;
+    m_jacctx.assembled=0;
+    m_jacctx.factorized=0;
+
     m_initialized=true;
 }
 
@@ -210,6 +271,20 @@ void SNESSolver::releaseMemory(){
         SNESDestroy(&m_snes);
         m_initialized=false;
     }
+    if(m_hasbounds){
+        VecDestroy(&m_xl);
+        VecDestroy(&m_xu);
+        m_hasbounds=false;
+    }
+    if(m_hasguessvecs){
+        VecDestroy(&m_rguess);
+        VecDestroy(&m_rguess_prev);
+        m_hasguessvecs=false;
+    }
+    m_hasguessresidual=false;
+    m_vi_dofids.clear();
+    m_gmg.releaseMemory();
+    m_pmg.releaseMemory();
 }
 
 void SNESSolver::printSolverInfo()const{
@@ -239,6 +314,10 @@ void SNESSolver::printSolverInfo()const{
     else if(m_nlsolvertype==NonlinearSolverType::NEWTONGMRES){
         str="  solver type= newton GMRES";
     }
+    else if(m_nlsolvertype==NonlinearSolverType::VINEWTONRSLS){
+        str="  solver type= vi newton (reduced space), bounded dofs= ";
+        for(const auto &name:m_vi_dofnames) str+=name+" ";
+    }
     MessagePrinter::printNormalTxt(str);
 
     snprintf(buff,70,"  max iters=%3d, abs R tol=%13.5e, rel R tol=%13.5e",m_maxiters,m_abstol_r,m_reltol_r);
@@ -247,7 +326,33 @@ void SNESSolver::printSolverInfo()const{
 
     str="  linear solver is: "+m_linearsolvername;
     str+=", preconditioner= "+m_pcname;
+    if(m_pcname=="gmg") str+=", levels= "+to_string(m_mg_levels);
+    MessagePrinter::printNormalTxt(str);
+
+    snprintf(buff,70,"  ksp restart=%5d, ksp max iters=%6d, inexact newton=%s",m_ksp_restart,m_ksp_maxiters,m_useinexactnewton?"true":"false");
+    str=buff;
     MessagePrinter::printNormalTxt(str);
     MessagePrinter::printStars();
     
-}
\ No newline at end of file
+}
+
+void SNESSolver::printLinearIterationsInfo()const{
+    char buff[68];
+    string str;
+    snprintf(buff,68,"  KSP solver: linear iters=%6d, per newton iter=%8.2f",
+             m_linear_iterations,
+             m_linear_iterations/(1.0*(m_iterations>0?m_iterations:1)));
+    str=buff;
+    MessagePrinter::printNormalTxt(str);
+    if(m_monctx.IsDepDebug){
+        snprintf(buff,68,"  Jacobian: assembled=%4d, factorized=%4d, linear=%s",
+                 m_jacctx.assembled,m_jacctx.factorized,m_jacctx.IsLinear?"true":"false");
+        str=buff;
+        MessagePrinter::printNormalTxt(str);
+        if(m_hasbounds){
+            snprintf(buff,68,"  VI bounds: min(U-U_old) of the vi dofs=%12.5e",m_vi_minincrement);
+            str=buff;
+            MessagePrinter::printNormalTxt(str);
+        }
+    }
+}
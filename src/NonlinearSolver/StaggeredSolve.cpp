@@ -0,0 +1,171 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: solve R(x)->0 by the staggered scheme, in each
+//+++          staggering iteration, the 1st subproblem is solved
+//+++          with the 2nd one fixed, then the 2nd subproblem is
+//+++          solved with the updated 1st one
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "NonlinearSolver/StaggeredSolver.h"
+
+void StaggeredSolver::assembleSubJacobian(const int &i,Vec &U){
+    m_appctx._feSystem->setAssembledDofsFlag(m_issubdof[i]);
+    formSystemJacobian(&m_appctx,U);
+    m_appctx._feSystem->resetAssembledDofsFlag();
+    if(!m_hassubmatrix[i]){
+        MatCreateSubMatrix(m_appctx._equationSystem->m_amatrix.getReference(),m_is[i],m_is[i],MAT_INITIAL_MATRIX,&m_subK[i]);
+        MatCreateVecs(m_subK[i],&m_dU[i],NULL);
+        // the operator is set only once, PETSc then keeps the symbolic factorization of the fixed sparsity pattern
+        KSPSetOperators(m_ksp[i],m_subK[i],m_subK[i]);
+        m_hassubmatrix[i]=true;
+    }
+    else{
+        MatCreateSubMatrix(m_appctx._equationSystem->m_amatrix.getReference(),m_is[i],m_is[i],MAT_REUSE_MATRIX,&m_subK[i]);
+    }
+}
+
+bool StaggeredSolver::solveSubProblem(const int &i,Vec &U){
+    Vec subR,subU;
+    double rnorm,rnorm0;
+    int iters;
+
+    rnorm0=1.0;
+    for(iters=0;iters<=m_maxiters;iters++){
+        formSystemResidual(&m_appctx,U,m_R);
+        VecGetSubVector(m_R,m_is[i],&subR);
+        VecNorm(subR,NORM_2,&rnorm);
+        if(iters==0) rnorm0=rnorm;
+        if(rnorm<m_abstol_r||(iters>0&&rnorm<m_reltol_r*rnorm0)){
+            VecRestoreSubVector(m_R,m_is[i],&subR);
+            m_subiterations[i]+=iters;
+            return true;
+        }
+        if(iters==m_maxiters){
+            VecRestoreSubVector(m_R,m_is[i],&subR);
+            break;
+        }
+
+        if(iters==0||!m_islinear[i]){
+            // only the diagonal block of the i-th subproblem is assembled, the sparsity pattern of K
+            // never changes, then the sub-matrix is reused and only its values are updated
+            assembleSubJacobian(i,U);
+            KSPSetReusePreconditioner(m_ksp[i],PETSC_FALSE);
+        }
+        else{
+            // for a linear subproblem, K_ii is constant while the other one is fixed, so its factorization is reused
+            KSPSetReusePreconditioner(m_ksp[i],PETSC_TRUE);
+        }
+        KSPSolve(m_ksp[i],subR,m_dU[i]);
+        VecRestoreSubVector(m_R,m_is[i],&subR);
+
+        // U_i=U_i-dU_i, the other subproblem is fixed
+        VecGetSubVector(U,m_is[i],&subU);
+        VecAXPY(subU,-1.0,m_dU[i]);
+        VecRestoreSubVector(U,m_is[i],&subU);
+    }
+    m_subiterations[i]+=m_maxiters;
+    return false;
+}
+
+bool StaggeredSolver::solve(Mesh &mesh,DofHandler &dofhandler,FE &fe,
+                            ElmtSystem &elmtsystem,MateSystem &matesystem,
+                            FESystem &fesystem,
+                            BCSystem &bcsystem,
+                            SolutionSystem &solutionsystem,
+                            EquationSystem &equationsystem,
+                            FEControlInfo &fectrlinfo){
+    if(!m_subproblemcreated) createSubProblems(dofhandler);
+
+    solutionsystem.m_u_copy.copyFrom(solutionsystem.m_u_current);
+
+    m_appctx=AppCtx{&mesh,&dofhandler,
+                   &bcsystem,
+                   &elmtsystem,&matesystem,
+                   &solutionsystem,&equationsystem,
+                   &fe,&fesystem,
+                   &fectrlinfo,
+                   nullptr
+                   };
+    m_isdepdebug=fectrlinfo.IsDepDebug;
+
+    bcsystem.applyPresetBoundaryConditions(FECalcType::UPDATEU,
+                                           fectrlinfo.t+fectrlinfo.dt,
+                                           mesh,dofhandler,
+                                           solutionsystem.m_u_current,
+                                           solutionsystem.m_u_copy,
+                                           solutionsystem.m_u_old,
+                                           solutionsystem.m_u_older,
+                                           solutionsystem.m_v,
+                                           equationsystem.m_amatrix,
+                                           equationsystem.m_rhs);
+
+    Vec &U=solutionsystem.m_u_current.getVectorRef();
+    char buff[68];
+    string str;
+    bool IsConverged=false;
+
+    // the max K coefficient (for the penalty of dirichlet bc) comes from the jacobian,
+    // so the jacobian should be assembled before the first residual evaluation, the
+    // max coefficient covers the whole K even if only one block is assembled
+    m_appctx._feSystem->setAssembledDofsFlag(m_issubdof[0]);
+    formSystemJacobian(&m_appctx,U);
+    m_appctx._feSystem->resetAssembledDofsFlag();
+    formSystemResidual(&m_appctx,U,m_R);
+    VecNorm(m_R,NORM_2,&m_rnorm0);
+    m_rnorm=m_rnorm0;
+
+    m_subiterations[0]=0;m_subiterations[1]=0;
+    for(m_iterations=1;m_iterations<=m_stagger_maxiters;m_iterations++){
+        if(!solveSubProblem(0,U)){
+            if(m_isdepdebug){
+                snprintf(buff,68,"  Subproblem-1 failed in stagger iters=%3d",m_iterations);
+                str=buff;
+                MessagePrinter::printNormalTxt(str);
+            }
+            break;
+        }
+        if(!solveSubProblem(1,U)){
+            if(m_isdepdebug){
+                snprintf(buff,68,"  Subproblem-2 failed in stagger iters=%3d",m_iterations);
+                str=buff;
+                MessagePrinter::printNormalTxt(str);
+            }
+            break;
+        }
+
+        // the coupled residual measures the staggering error
+        formSystemResidual(&m_appctx,U,m_R);
+        VecNorm(m_R,NORM_2,&m_rnorm);
+        if(m_isdepdebug){
+            snprintf(buff,68,"  Stagger: iters=%3d, sub iters=%3d,%3d, |R|=%12.5e",m_iterations,
+                     m_subiterations[0],m_subiterations[1],m_rnorm);
+            str=buff;
+            MessagePrinter::printNormalTxt(str);
+        }
+        if(m_rnorm<m_stagger_abstol||m_rnorm<m_stagger_reltol*m_rnorm0){
+            IsConverged=true;
+            break;
+        }
+    }
+
+    if(IsConverged){
+        snprintf(buff,68,"  Stagger solver: iters=%3d,|R0|=%12.5e,|R|=%12.5e",m_iterations,m_rnorm0,m_rnorm);
+        str=buff;
+        MessagePrinter::printNormalTxt(str);
+        return true;
+    }
+    if(m_iterations>m_stagger_maxiters) m_iterations=m_stagger_maxiters;
+    snprintf(buff,68,"  Divergent, staggered solver failed, iters=%3d",m_iterations);
+    str=buff;
+    MessagePrinter::printNormalTxt(str);
+    return false;
+}
@@ -0,0 +1,188 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the settings of the staggered solver
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "NonlinearSolver/StaggeredSolver.h"
+
+StaggeredSolver::StaggeredSolver(){
+    m_initialized=false;
+    m_subproblemcreated=false;
+    m_hassubmatrix[0]=false;m_hassubmatrix[1]=false;
+    m_islinear[0]=false;m_islinear[1]=false;
+
+    m_maxiters=25;
+    m_stagger_maxiters=100;
+    m_iterations=0;
+    m_subiterations[0]=0;m_subiterations[1]=0;
+
+    m_abstol_r=7.5e-7;
+    m_reltol_r=5.0e-10;
+    m_stagger_abstol=1.0e-6;
+    m_stagger_reltol=1.0e-5;
+
+    m_rnorm0=1.0;
+    m_rnorm=1.0;
+
+    m_linearsolvername="gmres";
+    m_pcname="lu";
+    m_ksp_restart=30;
+    m_ksp_maxiters=10000;
+    m_stagger_dofnames.clear();
+
+    m_isdepdebug=false;
+}
+
+void StaggeredSolver::setFromNonlinearSolverBlock(const NonlinearSolverBlock &t_nlblock){
+    m_maxiters=t_nlblock.m_maxiters;
+    m_abstol_r=t_nlblock.m_abstol_r;
+    m_reltol_r=t_nlblock.m_reltol_r;
+
+    m_stagger_maxiters=t_nlblock.m_stagger_maxiters;
+    m_stagger_abstol=t_nlblock.m_stagger_abstol;
+    m_stagger_reltol=t_nlblock.m_stagger_reltol;
+    m_stagger_dofnames=t_nlblock.m_stagger_dofnames;
+    m_islinear[0]=t_nlblock.m_stagger_linear[0];
+    m_islinear[1]=t_nlblock.m_stagger_linear[1];
+
+    m_linearsolvername=t_nlblock.m_linearsolvername;
+    m_pcname=t_nlblock.m_pctypename;
+    if(m_pcname=="gmg"||m_pcname=="pmg"){
+        MessagePrinter::printErrorTxt("the multigrid ("+m_pcname+") can\'t be used for the subproblems of the staggered solver, please use another preconditioner");
+        MessagePrinter::exitAsFem();
+    }
+    m_ksp_restart=t_nlblock.m_ksp_restart;
+    m_ksp_maxiters=t_nlblock.m_ksp_maxiters;
+}
+
+void StaggeredSolver::initSolver(){
+    // each subproblem has its own linear solver, then the factorization of one
+    // subproblem is not destroyed by the other one
+    KSPCreate(PETSC_COMM_WORLD,&m_ksp[0]);
+    KSPSetOptionsPrefix(m_ksp[0],"stagger1_");
+    setupLinearSolver(m_ksp[0],m_linearsolvername,m_pcname,m_ksp_restart,m_ksp_maxiters);
+
+    KSPCreate(PETSC_COMM_WORLD,&m_ksp[1]);
+    KSPSetOptionsPrefix(m_ksp[1],"stagger2_");
+    setupLinearSolver(m_ksp[1],m_linearsolvername,m_pcname,m_ksp_restart,m_ksp_maxiters);
+
+    m_subproblemcreated=false;
+    m_hassubmatrix[0]=false;m_hassubmatrix[1]=false;
+
+    m_initialized=true;
+}
+
+void StaggeredSolver::createSubProblems(const DofHandler &t_dofhandler){
+    for(const auto &name:m_stagger_dofnames){
+        if(!t_dofhandler.isValidDofName(name)){
+            MessagePrinter::printErrorTxt("dof name="+name+" in your stagger-dofs is invalid, please check your input file");
+            MessagePrinter::exitAsFem();
+        }
+    }
+    vector<bool> IsStaggerDof(t_dofhandler.getMaxDofsPerNode(),false);
+    for(const auto &name:m_stagger_dofnames){
+        IsStaggerDof[t_dofhandler.getDofIDViaName(name)-1]=true;
+    }
+    m_issubdof[1]=IsStaggerDof;
+    m_issubdof[0]=IsStaggerDof;
+    m_issubdof[0].flip();
+
+    VecCreate(PETSC_COMM_WORLD,&m_R);
+    VecSetSizes(m_R,t_dofhandler.getLocalDofsNum(),t_dofhandler.getActiveDofs());
+    VecSetFromOptions(m_R);
+
+    // only the locally owned rows go to the index set
+    int iStart,iEnd,dofid;
+    VecGetOwnershipRange(m_R,&iStart,&iEnd);
+
+    vector<int> ids[2];
+    for(int i=1;i<=t_dofhandler.getLocalNodesNum();i++){
+        for(int j=1;j<=t_dofhandler.getMaxDofsPerNode();j++){
+            dofid=t_dofhandler.getIthLocalNodeJthDofID(i,j);
+            if(dofid<1) continue;// inactive dof
+            dofid-=1;
+            if(dofid<iStart||dofid>=iEnd) continue;
+            if(IsStaggerDof[j-1]){
+                ids[1].push_back(dofid);
+            }
+            else{
+                ids[0].push_back(dofid);
+            }
+        }
+    }
+
+    int nsize[2],globalsize;
+    for(int k=0;k<2;k++){
+        sort(ids[k].begin(),ids[k].end());
+        ISCreateGeneral(PETSC_COMM_WORLD,static_cast<int>(ids[k].size()),ids[k].data(),PETSC_COPY_VALUES,&m_is[k]);
+        nsize[k]=static_cast<int>(ids[k].size());
+        MPI_Allreduce(&nsize[k],&globalsize,1,MPI_INT,MPI_SUM,PETSC_COMM_WORLD);
+        if(globalsize<1){
+            MessagePrinter::printErrorTxt("subproblem-"+to_string(k+1)+" of the staggered solver has no dofs, please check your stagger-dofs");
+            MessagePrinter::exitAsFem();
+        }
+    }
+
+    m_subproblemcreated=true;
+}
+
+void StaggeredSolver::releaseMemory(){
+    if(m_initialized){
+        KSPDestroy(&m_ksp[0]);
+        KSPDestroy(&m_ksp[1]);
+        m_initialized=false;
+    }
+    if(m_subproblemcreated){
+        ISDestroy(&m_is[0]);
+        ISDestroy(&m_is[1]);
+        VecDestroy(&m_R);
+        m_subproblemcreated=false;
+    }
+    for(int k=0;k<2;k++){
+        if(m_hassubmatrix[k]){
+            MatDestroy(&m_subK[k]);
+            VecDestroy(&m_dU[k]);
+            m_hassubmatrix[k]=false;
+        }
+    }
+}
+
+void StaggeredSolver::printSolverInfo()const{
+    MessagePrinter::printNormalTxt("Nonlinear (staggered) solver information summary:");
+    char buff[70];
+    string str;
+
+    str="  solver type= staggered, 2nd subproblem dofs= ";
+    for(const auto &name:m_stagger_dofnames) str+=name+" ";
+    MessagePrinter::printNormalTxt(str);
+
+    snprintf(buff,70,"  max stagger iters=%3d, abs tol=%12.5e, rel tol=%12.5e",m_stagger_maxiters,m_stagger_abstol,m_stagger_reltol);
+    str=buff;
+    MessagePrinter::printNormalTxt(str);
+
+    snprintf(buff,70,"  newton iters=%3d, abs R tol=%12.5e, rel R tol=%12.5e",m_maxiters,m_abstol_r,m_reltol_r);
+    str=buff;
+    MessagePrinter::printNormalTxt(str);
+
+    for(int k=0;k<2;k++){
+        if(m_islinear[k]){
+            snprintf(buff,70,"  subproblem-%d linear: one KSPSetOperators, symbolic factor reused",k+1);
+            str=buff;
+            MessagePrinter::printNormalTxt(str);
+        }
+    }
+
+    str="  linear solver is: "+m_linearsolvername;
+    str+=", preconditioner= "+m_pcname;
+    MessagePrinter::printNormalTxt(str);
+    MessagePrinter::printStars();
+}
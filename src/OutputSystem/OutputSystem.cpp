@@ -22,6 +22,8 @@ OutputSystem::OutputSystem(){
     m_pvdfile_name.clear();
     m_fileformat=ResultFileFormat::VTU;
     m_intervals=1;
+    m_checkpoint_intervals=0;
+    m_pvd_datasets=0;
 }
 
 void OutputSystem::printInfo()const{
@@ -36,5 +38,8 @@ void OutputSystem::printInfo()const{
         MessagePrinter::printNormalTxt("  output file format = csv");
     }
     MessagePrinter::printNormalTxt("  output interval = "+to_string(m_intervals));
+    if(m_checkpoint_intervals>0){
+        MessagePrinter::printNormalTxt("  checkpoint interval = "+to_string(m_checkpoint_intervals)+", file = "+getCheckpointFileName());
+    }
     MessagePrinter::printStars();
 }
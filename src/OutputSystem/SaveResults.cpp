@@ -32,6 +32,11 @@ void OutputSystem::saveResults2File(const int &t_step,
         m_outputfile_name = m_outputfile_name+"-"+ss.str()+ ".vtu";
     }
     
+    if(t_mesh.isDistributedMesh()){
+        // the pieces of the distributed mesh are collected by the pvtu file
+        m_outputfile_name=m_outputfile_name.substr(0,m_outputfile_name.size()-4)+".pvtu";
+    }
+    
     if(m_fileformat==ResultFileFormat::VTU){
         VTUWriter::saveResults(m_outputfile_name,t_mesh,t_dofHandler,t_solution,t_projection);
     }
@@ -40,6 +45,7 @@ void OutputSystem::saveResults2File(const int &t_step,
 //*** for pvd file
 //***********************************************
 void OutputSystem::savePVDHead(){
+    m_pvd_datasets=0;
     MPI_Comm_rank(PETSC_COMM_WORLD, &m_rank);
     if(m_rank == 0){
         m_pvdfile_name=m_inputfile_name.substr(0,m_inputfile_name.size()-5)+".pvd";// remove ".json" extension name
@@ -72,6 +78,7 @@ void OutputSystem::savePVDEnd(){
     }
 }
 void OutputSystem::savePVDResults(const double &current_time){
+    m_pvd_datasets+=1;
     MPI_Comm_rank(PETSC_COMM_WORLD, &m_rank);
     if(m_rank==0){
         std::ifstream in;
@@ -109,4 +116,47 @@ void OutputSystem::savePVDResults(const double &current_time){
         out<<"</VTKFile>\n";
         out.close();
     }
-}
\ No newline at end of file
+}
+void OutputSystem::restorePVDFile(const int &n){
+    m_pvdfile_name=m_inputfile_name.substr(0,m_inputfile_name.size()-5)+".pvd";// remove ".json" extension name
+    m_pvd_datasets=n;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &m_rank);
+    if(m_rank==0){
+        std::ifstream in;
+        string line;
+        vector<string> lines;
+        in.open(m_pvdfile_name,std::ios::in);
+        if(!in.is_open()){
+            MessagePrinter::printErrorTxt("can\'t open pvd file(="+m_pvdfile_name+") for the restart, please make sure it is in the same folder as your input file");
+            MessagePrinter::exitAsFem();
+        }
+        // the datasets written after the checkpoint are removed
+        int datasets=0;
+        while(getline(in,line)){
+            if(line.find("<DataSet")!=string::npos){
+                datasets+=1;
+                if(datasets>n) continue;
+            }
+            if(line.find("</Collection>")!=string::npos) break;
+            lines.push_back(line);
+        }
+        in.close();
+        if(datasets<n){
+            MessagePrinter::printErrorTxt("the pvd file(="+m_pvdfile_name+") has less datasets than the checkpoint file, it can\'t be restored");
+            MessagePrinter::exitAsFem();
+        }
+
+        std::ofstream out;
+        out.open(m_pvdfile_name,std::ios::out);
+        if (!out.is_open()){
+            MessagePrinter::printErrorTxt("can\'t open pvd file(="+m_pvdfile_name+")! please make sure you have the write permission");
+            MessagePrinter::exitAsFem();
+        }
+        for(const auto &line:lines){
+            out<<line<<endl;
+        }
+        out<<"</Collection>\n";
+        out<<"</VTKFile>\n";
+        out.close();
+    }
+}
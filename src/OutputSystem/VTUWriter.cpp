@@ -27,216 +27,294 @@ void VTUWriter::saveResults(const string &t_filename,
     t_projection.getProjectionDataRef().m_proj_rank2mate_vec.makeGhostCopy();
     t_projection.getProjectionDataRef().m_proj_rank4mate_vec.makeGhostCopy();
 
-    if(m_rank==0){
-        std::ofstream out;
-        out.open(t_filename,std::ios::out);
-        if(!out.is_open()){
-            MessagePrinter::printErrorTxt("can\'t create/open "+t_filename+", please make sure you have the write permission");
-            MessagePrinter::exitAsFem();
+    if(t_mesh.isDistributedMesh()){
+        // each rank writes its own piece, the master rank writes the pvtu file
+        savePieceFile(getPieceFileName(t_filename,m_rank),t_mesh,t_dofHandler,t_solution,t_projection);
+        if(m_rank==0){
+            savePVTUFile(t_filename,t_dofHandler,t_projection);
         }
+    }
+    else if(m_rank==0){
+        savePieceFile(t_filename,t_mesh,t_dofHandler,t_solution,t_projection);
+    }// end-of-master-rank-process
 
-        int i,j,k,iInd,e;
-
-        out << "<?xml version=\"1.0\"?>\n";
-        out << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\">\n";
-        out << "<UnstructuredGrid>\n";
-        out << "<Piece NumberOfPoints=\"" << t_mesh.getBulkMeshNodesNum() << "\" NumberOfCells=\"" << t_mesh.getBulkMeshBulkElmtsNum() << "\">\n";
-        out << "<Points>\n";
-        out << "<DataArray type=\"Float64\" Name=\"nodes\"  NumberOfComponents=\"3\"  format=\"ascii\">\n";
-
-        //*****************************
-        // print out node coordinates
-        out <<std::scientific << std::setprecision(6);
-        for (i = 1; i <= t_mesh.getBulkMeshNodesNum(); i++){
-            out << t_mesh.getBulkMeshIthNodeJthCoord0(i, 1) << " ";
-            out << t_mesh.getBulkMeshIthNodeJthCoord0(i, 2) << " ";
-            out << t_mesh.getBulkMeshIthNodeJthCoord0(i, 3) << "\n";
-        }
-        out << "</DataArray>\n";
-        out << "</Points>\n";
-
-        //***************************************
-        //*** For cell information
-        //***************************************
-        out << "<Cells>\n";
-        out << "<DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-        for (e = 1; e <= t_mesh.getBulkMeshBulkElmtsNum(); e++){
-            for (j = 1; j <= t_mesh.getBulkMeshIthBulkElmtNodesNum(e); j++){
-                out << t_mesh.getBulkMeshIthBulkElmtJthNodeID(e,j) - 1 << " ";
-            }
-            out << "\n";
-        }
-        out << "</DataArray>\n";
-
-        //***************************************
-        //*** For offset
-        //***************************************
-        out << "<DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-        int offset = 0;
-        for (e = 1; e <= t_mesh.getBulkMeshBulkElmtsNum(); e++){
-            offset += t_mesh.getBulkMeshIthBulkElmtNodesNum(e);
-            out << offset << "\n";
-        }
-        out << "</DataArray>\n";
-
-        //***************************************
-        //*** For connectivity
-        //***************************************
-        out << "<DataArray type=\"Int32\" Name=\"types\"  NumberOfComponents=\"1\"  format=\"ascii\">\n";
-        for (e = 1; e <= t_mesh.getBulkMeshBulkElmtsNum(); e++){
-            out << t_mesh.getBulkMeshBulkElmtVTKCellType() << "\n";
-        }
-        out << "</DataArray>\n";
-        out << "</Cells>\n";
+    t_solution.m_u_current.destroyGhostCopy();
+    t_projection.getProjectionDataRef().m_proj_scalarmate_vec.destroyGhostCopy();
+    t_projection.getProjectionDataRef().m_proj_vectormate_vec.destroyGhostCopy();
+    t_projection.getProjectionDataRef().m_proj_rank2mate_vec.destroyGhostCopy();
+    t_projection.getProjectionDataRef().m_proj_rank4mate_vec.destroyGhostCopy();
 
+}
 
-        //***************************************
-        //*** For solutions
-        //***************************************
-        string dofname;
-        double value;
-        string ScalarName,VectorName,Rank2Name,Rank4Name,TensorName;
+string VTUWriter::getPieceFileName(const string &t_filename,const int &t_rank)const{
+    // xxx.pvtu -> xxx-p{rank}.vtu
+    return t_filename.substr(0,t_filename.find_last_of("."))+"-p"+to_string(t_rank)+".vtu";
+}
 
-        ScalarName="<PointData Scalar=\"";
-        for (j = 1;j<=t_dofHandler.getMaxDofsPerNode();j++){
-            ScalarName+=t_dofHandler.getIthDofName(j)+" ";
-        }
-        for(j=1;j<=t_projection.getScalarMaterialNum();j++){
-            ScalarName+=t_projection.getIthScalarMateName(j)+" ";
+void VTUWriter::savePieceFile(const string &t_filename,
+                              const Mesh &t_mesh,
+                              const DofHandler &t_dofHandler,
+                              SolutionSystem &t_solution,
+                              ProjectionSystem &t_projection){
+    std::ofstream out;
+    out.open(t_filename,std::ios::out);
+    if(!out.is_open()){
+        MessagePrinter::printErrorTxt("can\'t create/open "+t_filename+", please make sure you have the write permission");
+        MessagePrinter::exitAsFem();
+    }
+
+    out << "<?xml version=\"1.0\"?>\n";
+    out << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\">\n";
+    out << "<UnstructuredGrid>\n";
+
+    int i,j,k,iInd,e,eStart,eEnd,nodeid;
+
+    // the distributed mesh only writes its local nodes and the owned elements
+    const int nNodes=t_mesh.getBulkMeshLocalNodesNum();
+    t_mesh.getBulkMeshOwnedBulkElmtsRange(eStart,eEnd);
+
+    out << "<Piece NumberOfPoints=\"" << nNodes << "\" NumberOfCells=\"" << eEnd-eStart << "\">\n";
+    out << "<Points>\n";
+    out << "<DataArray type=\"Float64\" Name=\"nodes\"  NumberOfComponents=\"3\"  format=\"ascii\">\n";
+
+    //*****************************
+    // print out node coordinates
+    out <<std::scientific << std::setprecision(6);
+    for (i = 1; i <= nNodes; i++){
+        nodeid=t_mesh.getBulkMeshIthLocalNodeGlobalID(i);
+        out << t_mesh.getBulkMeshIthNodeJthCoord0(nodeid, 1) << " ";
+        out << t_mesh.getBulkMeshIthNodeJthCoord0(nodeid, 2) << " ";
+        out << t_mesh.getBulkMeshIthNodeJthCoord0(nodeid, 3) << "\n";
+    }
+    out << "</DataArray>\n";
+    out << "</Points>\n";
+
+    //***************************************
+    //*** For cell information
+    //***************************************
+    out << "<Cells>\n";
+    out << "<DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">\n";
+    for (e = eStart+1; e <= eEnd; e++){
+        for (j = 1; j <= t_mesh.getBulkMeshIthBulkElmtNodesNum(e); j++){
+            out << t_mesh.getBulkMeshNodeLocalID(t_mesh.getBulkMeshIthBulkElmtJthNodeID(e,j)) - 1 << " ";
         }
-        ScalarName+="\" ";
+        out << "\n";
+    }
+    out << "</DataArray>\n";
 
-        VectorName.clear();
-        if(t_projection.getVectorMaterialNum()){
-            VectorName="Vector=\"";
-            for(j=1;j<=t_projection.getVectorMaterialNum();j++){
-                VectorName+=t_projection.getIthVectorMateName(j)+" ";
-            }
-            VectorName+="\" ";
+    //***************************************
+    //*** For offset
+    //***************************************
+    out << "<DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">\n";
+    int offset = 0;
+    for (e = eStart+1; e <= eEnd; e++){
+        offset += t_mesh.getBulkMeshIthBulkElmtNodesNum(e);
+        out << offset << "\n";
+    }
+    out << "</DataArray>\n";
+
+    //***************************************
+    //*** For connectivity
+    //***************************************
+    out << "<DataArray type=\"Int32\" Name=\"types\"  NumberOfComponents=\"1\"  format=\"ascii\">\n";
+    for (e = eStart+1; e <= eEnd; e++){
+        out << t_mesh.getBulkMeshBulkElmtVTKCellType() << "\n";
+    }
+    out << "</DataArray>\n";
+    out << "</Cells>\n";
+
+
+    //***************************************
+    //*** For solutions
+    //***************************************
+    string dofname;
+    double value;
+    string ScalarName,VectorName,Rank2Name,Rank4Name,TensorName;
+
+    ScalarName="<PointData Scalar=\"";
+    for (j = 1;j<=t_dofHandler.getMaxDofsPerNode();j++){
+        ScalarName+=t_dofHandler.getIthDofName(j)+" ";
+    }
+    for(j=1;j<=t_projection.getScalarMaterialNum();j++){
+        ScalarName+=t_projection.getIthScalarMateName(j)+" ";
+    }
+    ScalarName+="\" ";
+
+    VectorName.clear();
+    if(t_projection.getVectorMaterialNum()){
+        VectorName="Vector=\"";
+        for(j=1;j<=t_projection.getVectorMaterialNum();j++){
+            VectorName+=t_projection.getIthVectorMateName(j)+" ";
         }
+        VectorName+="\" ";
+    }
 
-        TensorName.clear();
-        if(t_projection.getRank2MaterialNum()||t_projection.getRank4MaterialNum()){
-            TensorName="Tensor=\"";
-            for(j=1;j<=t_projection.getRank2MaterialNum();j++){
-                TensorName+=t_projection.getIthRank2MateName(j)+" ";
-            }
-            for(j=1;j<=t_projection.getRank4MaterialNum();j++){
-                TensorName+=t_projection.getIthRank4MateName(j)+" ";
-            }
-            TensorName+="\" ";
+    TensorName.clear();
+    if(t_projection.getRank2MaterialNum()||t_projection.getRank4MaterialNum()){
+        TensorName="Tensor=\"";
+        for(j=1;j<=t_projection.getRank2MaterialNum();j++){
+            TensorName+=t_projection.getIthRank2MateName(j)+" ";
+        }
+        for(j=1;j<=t_projection.getRank4MaterialNum();j++){
+            TensorName+=t_projection.getIthRank4MateName(j)+" ";
         }
+        TensorName+="\" ";
+    }
 
-        out << ScalarName<< VectorName<< TensorName<<">\n";
-
-        //**************************************
-        //*** for solution output
-        //**************************************
-        for (j = 1;j<=t_dofHandler.getMaxDofsPerNode();j++){
-            dofname =t_dofHandler.getIthDofName(j);
-            out<<"<DataArray type=\"Float64\" Name=\"" << dofname << "\"  NumberOfComponents=\"1\" format=\"ascii\">\n";
-            out<<std::scientific<<std::setprecision(6);
-            for (i = 1; i <= t_mesh.getBulkMeshNodesNum(); i++){
-                iInd = t_dofHandler.getIthNodeJthDofID(i,j);
-                value=t_solution.m_u_current.getIthValueFromGhost(iInd);
-                out << value << "\n";
-            }
-            out << "</DataArray>\n\n";
+    out << ScalarName<< VectorName<< TensorName<<">\n";
+
+    //**************************************
+    //*** for solution output
+    //**************************************
+    for (j = 1;j<=t_dofHandler.getMaxDofsPerNode();j++){
+        dofname =t_dofHandler.getIthDofName(j);
+        out<<"<DataArray type=\"Float64\" Name=\"" << dofname << "\"  NumberOfComponents=\"1\" format=\"ascii\">\n";
+        out<<std::scientific<<std::setprecision(6);
+        for (i = 1; i <= nNodes; i++){
+            iInd = t_dofHandler.getIthLocalNodeJthDofID(i,j);// the same local nodes as the mesh
+            value=t_solution.m_u_current.getIthValueFromGhost(iInd);
+            out << value << "\n";
         }
+        out << "</DataArray>\n\n";
+    }
 
 
-        int nproj;
-        //**************************************
-        //*** for projected scalar output
-        //**************************************
-        nproj=t_projection.getScalarMaterialNum();
-        for (j = 1;j<=nproj;j++){
-            dofname = t_projection.getIthScalarMateName(j);
-            out<<"<DataArray type=\"Float64\" Name=\"" << dofname << "\"  NumberOfComponents=\"1\" format=\"ascii\">\n";
-            out<<std::scientific<<std::setprecision(6);
-            for (i = 1; i <= t_mesh.getBulkMeshNodesNum(); i++){
-                iInd = (i-1)*(1+nproj)+j+1;
-                value=t_projection.getProjectionDataRef().m_proj_scalarmate_vec.getIthValueFromGhost(iInd);
-                out << value << "\n";
-            }
-            out << "</DataArray>\n\n";
+    int nproj;
+    //**************************************
+    //*** for projected scalar output
+    //**************************************
+    nproj=t_projection.getScalarMaterialNum();
+    for (j = 1;j<=nproj;j++){
+        dofname = t_projection.getIthScalarMateName(j);
+        out<<"<DataArray type=\"Float64\" Name=\"" << dofname << "\"  NumberOfComponents=\"1\" format=\"ascii\">\n";
+        out<<std::scientific<<std::setprecision(6);
+        for (i = 1; i <= nNodes; i++){
+            nodeid=t_mesh.getBulkMeshIthLocalNodeGlobalID(i);
+            iInd = (nodeid-1)*(1+nproj)+j+1;
+            value=t_projection.getProjectionDataRef().m_proj_scalarmate_vec.getIthValueFromGhost(iInd);
+            out << value << "\n";
         }
+        out << "</DataArray>\n\n";
+    }
 
-        //**************************************
-        //*** for projected vector output
-        //**************************************
-        nproj=t_projection.getVectorMaterialNum();
-        for (j = 1;j<=nproj;j++){
-            dofname = t_projection.getIthVectorMateName(j);
-            out<<"<DataArray type=\"Float64\" Name=\"" << dofname << "\"  NumberOfComponents=\"3\" format=\"ascii\">\n";
-            out<<std::scientific<<std::setprecision(6);
-            for (i = 1; i <= t_mesh.getBulkMeshNodesNum(); i++){
-                for(k=1;k<=3;k++){
-                    iInd = (i-1)*(1+nproj*3)+3*(j-1)+k+1;
-                    value=t_projection.getProjectionDataRef().m_proj_vectormate_vec.getIthValueFromGhost(iInd);
-                    out << value << " ";
-                }
-                out <<"\n";
+    //**************************************
+    //*** for projected vector output
+    //**************************************
+    nproj=t_projection.getVectorMaterialNum();
+    for (j = 1;j<=nproj;j++){
+        dofname = t_projection.getIthVectorMateName(j);
+        out<<"<DataArray type=\"Float64\" Name=\"" << dofname << "\"  NumberOfComponents=\"3\" format=\"ascii\">\n";
+        out<<std::scientific<<std::setprecision(6);
+        for (i = 1; i <= nNodes; i++){
+            nodeid=t_mesh.getBulkMeshIthLocalNodeGlobalID(i);
+            for(k=1;k<=3;k++){
+                iInd = (nodeid-1)*(1+nproj*3)+3*(j-1)+k+1;
+                value=t_projection.getProjectionDataRef().m_proj_vectormate_vec.getIthValueFromGhost(iInd);
+                out << value << " ";
             }
-            out << "</DataArray>\n\n";
+            out <<"\n";
         }
+        out << "</DataArray>\n\n";
+    }
 
-        //**************************************
-        //*** for projected rank-2 output
-        //**************************************
-        nproj=t_projection.getRank2MaterialNum();
-        for (j = 1;j<=nproj;j++){
-            dofname = t_projection.getIthRank2MateName(j);
-            out<<"<DataArray type=\"Float64\" Name=\"" << dofname << "\"  NumberOfComponents=\"9\" format=\"ascii\">\n";
-            out<<std::scientific<<std::setprecision(6);
-            for (i = 1; i <= t_mesh.getBulkMeshNodesNum(); i++){
-                for(k=1;k<=9;k++){
-                    iInd = (i-1)*(1+nproj*9)+9*(j-1)+k+1;
-                    value=t_projection.getProjectionDataRef().m_proj_rank2mate_vec.getIthValueFromGhost(iInd);
-                    out << value << " ";
-                }
-                out <<"\n";
+    //**************************************
+    //*** for projected rank-2 output
+    //**************************************
+    nproj=t_projection.getRank2MaterialNum();
+    for (j = 1;j<=nproj;j++){
+        dofname = t_projection.getIthRank2MateName(j);
+        out<<"<DataArray type=\"Float64\" Name=\"" << dofname << "\"  NumberOfComponents=\"9\" format=\"ascii\">\n";
+        out<<std::scientific<<std::setprecision(6);
+        for (i = 1; i <= nNodes; i++){
+            nodeid=t_mesh.getBulkMeshIthLocalNodeGlobalID(i);
+            for(k=1;k<=9;k++){
+                iInd = (nodeid-1)*(1+nproj*9)+9*(j-1)+k+1;
+                value=t_projection.getProjectionDataRef().m_proj_rank2mate_vec.getIthValueFromGhost(iInd);
+                out << value << " ";
             }
-            out << "</DataArray>\n\n";
+            out <<"\n";
         }
+        out << "</DataArray>\n\n";
+    }
 
-        //**************************************
-        //*** for projected rank-4 output
-        //**************************************
-        nproj=t_projection.getRank4MaterialNum();
-        for (j = 1;j<=nproj;j++){
-            dofname = t_projection.getIthRank4MateName(j);
-            out<<"<DataArray type=\"Float64\" Name=\"" << dofname << "\"  NumberOfComponents=\"36\" format=\"ascii\">\n";
-            out<<std::scientific<<std::setprecision(6);
-            for (i = 1; i <= t_mesh.getBulkMeshNodesNum(); i++){
-                for(k=1;k<=36;k++){
-                    iInd = (i-1)*(1+nproj*36)+36*(j-1)+k+1;
-                    value=t_projection.getProjectionDataRef().m_proj_rank4mate_vec.getIthValueFromGhost(iInd);
-                    out << value << " ";
-                }
-                out <<"\n";
+    //**************************************
+    //*** for projected rank-4 output
+    //**************************************
+    nproj=t_projection.getRank4MaterialNum();
+    for (j = 1;j<=nproj;j++){
+        dofname = t_projection.getIthRank4MateName(j);
+        out<<"<DataArray type=\"Float64\" Name=\"" << dofname << "\"  NumberOfComponents=\"36\" format=\"ascii\">\n";
+        out<<std::scientific<<std::setprecision(6);
+        for (i = 1; i <= nNodes; i++){
+            nodeid=t_mesh.getBulkMeshIthLocalNodeGlobalID(i);
+            for(k=1;k<=36;k++){
+                iInd = (nodeid-1)*(1+nproj*36)+36*(j-1)+k+1;
+                value=t_projection.getProjectionDataRef().m_proj_rank4mate_vec.getIthValueFromGhost(iInd);
+                out << value << " ";
             }
-            out << "</DataArray>\n\n";
+            out <<"\n";
         }
+        out << "</DataArray>\n\n";
+    }
 
-        
+    
 
-        //***************************************
-        //*** End of output
-        //***************************************
-        out << "</PointData>\n";
-        out << "</Piece>\n";
-        out << "</UnstructuredGrid>\n";
-        out << "</VTKFile>" << endl;
+    //***************************************
+    //*** End of output
+    //***************************************
+    out << "</PointData>\n";
+    out << "</Piece>\n";
+    out << "</UnstructuredGrid>\n";
+    out << "</VTKFile>" << endl;
 
-        out.close();
+    out.close();
+}
 
-    }// end-of-master-rank-process
+void VTUWriter::savePVTUFile(const string &t_filename,
+                             const DofHandler &t_dofHandler,
+                             ProjectionSystem &t_projection){
+    PetscMPIInt size;
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
 
-    t_solution.m_u_current.destroyGhostCopy();
-    t_projection.getProjectionDataRef().m_proj_scalarmate_vec.destroyGhostCopy();
-    t_projection.getProjectionDataRef().m_proj_vectormate_vec.destroyGhostCopy();
-    t_projection.getProjectionDataRef().m_proj_rank2mate_vec.destroyGhostCopy();
-    t_projection.getProjectionDataRef().m_proj_rank4mate_vec.destroyGhostCopy();
+    std::ofstream out;
+    out.open(t_filename,std::ios::out);
+    if(!out.is_open()){
+        MessagePrinter::printErrorTxt("can\'t create/open "+t_filename+", please make sure you have the write permission");
+        MessagePrinter::exitAsFem();
+    }
+    int j;
+    out << "<?xml version=\"1.0\"?>\n";
+    out << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\">\n";
+    out << "<PUnstructuredGrid GhostLevel=\"0\">\n";
+    out << "<PPoints>\n";
+    out << "<PDataArray type=\"Float64\" Name=\"nodes\" NumberOfComponents=\"3\"/>\n";
+    out << "</PPoints>\n";
+    out << "<PPointData>\n";
+    for(j=1;j<=t_dofHandler.getMaxDofsPerNode();j++){
+        out << "<PDataArray type=\"Float64\" Name=\"" << t_dofHandler.getIthDofName(j) << "\" NumberOfComponents=\"1\"/>\n";
+    }
+    for(j=1;j<=t_projection.getScalarMaterialNum();j++){
+        out << "<PDataArray type=\"Float64\" Name=\"" << t_projection.getIthScalarMateName(j) << "\" NumberOfComponents=\"1\"/>\n";
+    }
+    for(j=1;j<=t_projection.getVectorMaterialNum();j++){
+        out << "<PDataArray type=\"Float64\" Name=\"" << t_projection.getIthVectorMateName(j) << "\" NumberOfComponents=\"3\"/>\n";
+    }
+    for(j=1;j<=t_projection.getRank2MaterialNum();j++){
+        out << "<PDataArray type=\"Float64\" Name=\"" << t_projection.getIthRank2MateName(j) << "\" NumberOfComponents=\"9\"/>\n";
+    }
+    for(j=1;j<=t_projection.getRank4MaterialNum();j++){
+        out << "<PDataArray type=\"Float64\" Name=\"" << t_projection.getIthRank4MateName(j) << "\" NumberOfComponents=\"36\"/>\n";
+    }
+    out << "</PPointData>\n";
 
-}
\ No newline at end of file
+    // the piece files are in the same folder as the pvtu file
+    string piecename;
+    for(int rank=0;rank<size;rank++){
+        piecename=getPieceFileName(t_filename,rank);
+        if(piecename.find_last_of("/")!=string::npos) piecename=piecename.substr(piecename.find_last_of("/")+1);
+        out << "<Piece Source=\"" << piecename << "\"/>\n";
+    }
+    out << "</PUnstructuredGrid>\n";
+    out << "</VTKFile>" << endl;
+    out.close();
+}
@@ -42,6 +42,11 @@ void Postprocessor::executePostprocess(const Mesh &t_mesh,
             m_pps_values[i-1]=executeNodalPostprocess(pps_type,dofid,getIthPPSBlock(i).m_parameters,t_dofhandler,t_solution,t_projsystem);
             break;
         }
+        case PostprocessorType::POINTVALUE:
+        {
+            m_pps_values[i-1]=PointValuePostprocessor::computePointValue(dofid,getIthPPSBlock(i).m_parameters,t_mesh,t_dofhandler,t_fe,t_solution);
+            break;
+        }
         case PostprocessorType::AREA:
         case PostprocessorType::SIDEAVERAGEVALUE:
         case PostprocessorType::SIDEAVERAGESCALARMATERIALVALUE:
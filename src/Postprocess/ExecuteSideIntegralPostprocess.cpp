@@ -26,7 +26,7 @@ double Postprocessor::executeSideIntegralPostprocess(const PostprocessorType &pp
     double pps_value,side_area;
     double pps_value_global,side_area_global;
     string sidename;
-    int i,j,iInd,e,rankne,eStart,eEnd,nElmts,nNodesPerBCElmt;
+    int i,j,iInd,e,eStart,eEnd,nElmts,nNodesPerBCElmt,phyhandle;
     int nqpoints;
     double dist;
     double xi,eta,w,JxW;
@@ -44,17 +44,18 @@ double Postprocessor::executeSideIntegralPostprocess(const PostprocessorType &pp
     for(i=0;i<static_cast<int>(sidenames.size());i++){
         sidename=sidenames[i];
         nElmts=t_mesh.getBulkMeshElmtsNumViaPhyName(sidename);
+        phyhandle=t_mesh.getBulkMeshPhyGroupHandle(sidename);
 
-        rankne=nElmts/m_size;
-        eStart=m_rank*rankne;
-        eEnd=(m_rank+1)*rankne;
-        if(m_rank==m_size-1) eEnd=nElmts;
+        t_mesh.getBulkMeshPhyGroupElmtsRange(nElmts,m_rank,m_size,eStart,eEnd);
 
         m_local_elmtinfo.m_dim=t_mesh.getBulkMeshElmtDimViaPhyName(sidename);
         nNodesPerBCElmt=0;
 
         for(e=eStart;e<eEnd;e++){
-            nNodesPerBCElmt=t_mesh.getBulkMeshIthElmtNodesNumViaPhyName(sidename,e+1);
+            ElmtConnArray conn=t_mesh.getBulkMeshIthElmtConnViaHandle(phyhandle,e+1);
+            nNodesPerBCElmt=conn.size();
+            // the dofs map is indexed by the local node id, it is only looked up once per element
+            for(int k=0;k<nNodesPerBCElmt;k++) m_localnodeids[k]=t_mesh.getBulkMeshNodeLocalID(conn[k]);
             m_local_elmtinfo.m_nodesnum=nNodesPerBCElmt;
             JxW=0.0;
             if(m_local_elmtinfo.m_dim==0){
@@ -62,8 +63,8 @@ double Postprocessor::executeSideIntegralPostprocess(const PostprocessorType &pp
                 JxW=1.0;
                 side_area=1.0;
                 for(i=1;i<=nNodesPerBCElmt;i++){
-                    j=t_mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(sidename,e+1,i);// global node id
-                    iInd=t_dofhandler.getIthNodeJthDofID(j,dofid);
+                    j=conn[i-1];// global node id
+                    iInd=t_dofhandler.getIthLocalNodeJthDofID(m_localnodeids[i-1],dofid);
                     m_local_elmtinfo.m_gpCoords0(1)=t_mesh.getBulkMeshIthNodeJthCoord0(j,1);
                     m_local_elmtinfo.m_gpCoords0(2)=t_mesh.getBulkMeshIthNodeJthCoord0(j,2);
                     m_local_elmtinfo.m_gpCoords0(3)=t_mesh.getBulkMeshIthNodeJthCoord0(j,3);
@@ -75,7 +76,7 @@ double Postprocessor::executeSideIntegralPostprocess(const PostprocessorType &pp
                 }
             }// end-of-dim=0-case
             else{
-                t_mesh.getBulkMeshIthElmtNodeCoords0ViaPhyName(sidename,e+1,m_nodes0);
+                t_mesh.getBulkMeshIthElmtNodeCoords0ViaHandle(phyhandle,e+1,m_nodes0);
 
                 nqpoints=0;
                 if(m_local_elmtinfo.m_dim==1){
@@ -151,7 +152,7 @@ double Postprocessor::executeSideIntegralPostprocess(const PostprocessorType &pp
                     
                     m_local_elmtinfo.m_gpCoords0=0.0;
                     for(i=1;i<=nNodesPerBCElmt;i++){
-                        j=t_mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(sidename,e+1,i);//global id
+                        j=conn[i-1];//global id
 
                         if(m_local_elmtinfo.m_dim==1){
                             m_local_elmtinfo.m_gpCoords0(1)+=t_fe.m_line_shp.shape_value(i)*t_mesh.getBulkMeshIthNodeJthCoord(j,1);
@@ -178,13 +179,13 @@ double Postprocessor::executeSideIntegralPostprocess(const PostprocessorType &pp
                             m_local_shp.m_trial=0.0;
                             m_local_shp.m_grad_trial=0.0;
                         }
-                        j=t_mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(sidename,e+1,i);//global id
+                        j=conn[i-1];//global id
                         if(dofid<1){
                             // this means no dof is given in the postprocess block, it is processing the material properties
-                            iInd=t_dofhandler.getIthNodeJthDofID(j,1);
+                            iInd=t_dofhandler.getIthLocalNodeJthDofID(m_localnodeids[i-1],1);
                         }
                         else{
-                            iInd=t_dofhandler.getIthNodeJthDofID(j,dofid);
+                            iInd=t_dofhandler.getIthLocalNodeJthDofID(m_localnodeids[i-1],dofid);
                         }
 
                         pps_value+=JxW*runSideIntegralPostprocessLibs(pps_type,iInd,j,t_parameters,m_local_elmtinfo,m_local_shp,t_soln,t_projsystem);
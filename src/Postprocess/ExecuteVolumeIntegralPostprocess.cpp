@@ -26,7 +26,7 @@ double Postprocessor::executeVolumeIntegralPostprocess(const PostprocessorType &
     double pps_value,domain_volume;
     double pps_value_global,domain_volume_global;
     string domainname;
-    int i,j,iInd,e,rankne,eStart,eEnd,nElmts,nNodesPerElmt;
+    int i,j,iInd,e,eStart,eEnd,nElmts,nNodesPerElmt,phyhandle;
     int nqpoints;
     double xi,eta,zeta,w,JxW;
 
@@ -43,17 +43,18 @@ double Postprocessor::executeVolumeIntegralPostprocess(const PostprocessorType &
     for(i=0;i<static_cast<int>(domainnames.size());i++){
         domainname=domainnames[i];
         nElmts=t_mesh.getBulkMeshElmtsNumViaPhyName(domainname);
+        phyhandle=t_mesh.getBulkMeshPhyGroupHandle(domainname);
         
-        rankne=nElmts/m_size;
-        eStart=m_rank*rankne;
-        eEnd=(m_rank+1)*rankne;
-        if(m_rank==m_size-1) eEnd=nElmts;
+        t_mesh.getBulkMeshPhyGroupElmtsRange(nElmts,m_rank,m_size,eStart,eEnd);
 
         m_local_elmtinfo.m_dim=t_mesh.getBulkMeshElmtDimViaPhyName(domainname);
         nNodesPerElmt=0;
 
         for(e=eStart;e<eEnd;e++){
-            nNodesPerElmt=t_mesh.getBulkMeshIthElmtNodesNumViaPhyName(domainname,e+1);
+            ElmtConnArray conn=t_mesh.getBulkMeshIthElmtConnViaHandle(phyhandle,e+1);
+            nNodesPerElmt=conn.size();
+            // the dofs map is indexed by the local node id, it is only looked up once per element
+            for(int k=0;k<nNodesPerElmt;k++) m_localnodeids[k]=t_mesh.getBulkMeshNodeLocalID(conn[k]);
             m_local_elmtinfo.m_nodesnum=nNodesPerElmt;
             JxW=0.0;
             if(m_local_elmtinfo.m_dim<=0){
@@ -61,7 +62,7 @@ double Postprocessor::executeVolumeIntegralPostprocess(const PostprocessorType &
                 MessagePrinter::exitAsFem();
             }// end-of-dim=0-case
             else{
-                t_mesh.getBulkMeshIthElmtNodeCoords0ViaPhyName(domainname,e+1,m_nodes0);
+                t_mesh.getBulkMeshIthElmtNodeCoords0ViaHandle(phyhandle,e+1,m_nodes0);
 
                 nqpoints=t_fe.m_bulk_qpoints.getQPointsNum();
 
@@ -86,7 +87,7 @@ double Postprocessor::executeVolumeIntegralPostprocess(const PostprocessorType &
                     
                     m_local_elmtinfo.m_gpCoords0=0.0;
                     for(i=1;i<=nNodesPerElmt;i++){
-                        j=t_mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(domainname,e+1,i);//global id
+                        j=conn[i-1];//global id
                 
                         m_local_elmtinfo.m_gpCoords0(1)+=t_fe.m_bulk_shp.shape_value(i)*t_mesh.getBulkMeshIthNodeJthCoord(j,1);
                         m_local_elmtinfo.m_gpCoords0(2)+=t_fe.m_bulk_shp.shape_value(i)*t_mesh.getBulkMeshIthNodeJthCoord(j,2);
@@ -99,13 +100,13 @@ double Postprocessor::executeVolumeIntegralPostprocess(const PostprocessorType &
                         m_local_shp.m_grad_test=t_fe.m_bulk_shp.shape_grad(i);
                         m_local_shp.m_trial=0.0;
                         m_local_shp.m_grad_trial=0.0;
-                        j=t_mesh.getBulkMeshIthElmtJthNodeIDViaPhyName(domainname,e+1,i);//global id
+                        j=conn[i-1];//global id
                         if(dofid<1){
                             // if no dofid is given, then we use the first one
-                            iInd=t_dofhandler.getIthNodeJthDofID(j,1);
+                            iInd=t_dofhandler.getIthLocalNodeJthDofID(m_localnodeids[i-1],1);
                         }
                         else{
-                            iInd=t_dofhandler.getIthNodeJthDofID(j,dofid);
+                            iInd=t_dofhandler.getIthLocalNodeJthDofID(m_localnodeids[i-1],dofid);
                         }
 
                         pps_value+=JxW*runVolumeIntegralPostprocessLibs(pps_type,iInd,j,t_parameters,m_local_elmtinfo,m_local_shp,t_soln,t_projsystem);
@@ -33,10 +33,34 @@ double NodalValuePostprocessor::computeNodalValue(const int &dofid,
     }
 
     m_nodeid=JsonUtils::getInteger(parameters,"nodeid");
-    int iInd=dofhandler.getIthNodeJthDofID(m_nodeid,dofid);
+    if(m_nodeid<1||m_nodeid>dofhandler.getNodesNum()){
+        MessagePrinter::printErrorTxt("node id="+to_string(m_nodeid)+" is invalid for NodalValuePostprocessor");
+        MessagePrinter::exitAsFem();
+    }
+
+    int rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+
+    // the distributed mesh only stores the node on the ranks around it, so only the rank who owns its dof computes the value
+    int iInd=0,iStart,iEnd;
+    bool IsFound=false;
+    if(dofhandler.isNodeStored(m_nodeid)){
+        iInd=dofhandler.getIthNodeJthDofID(m_nodeid,dofid);
+        dofhandler.getOwnedDofsRange(iStart,iEnd);
+        IsFound=iInd<1||(iInd>=iStart&&iInd<=iEnd);// the inactive dof is zero on every rank
+    }
+    m_pps_value=0.0;
     soln.m_u_current.makeGhostCopy();
-    m_pps_value=soln.m_u_current.getIthValueFromGhost(iInd);
+    if(IsFound&&iInd>=1){
+        m_pps_value=soln.m_u_current.getIthValueFromGhost(iInd);
+    }
     soln.m_u_current.destroyGhostCopy();
+
+    // the lowest rank who finds the dof sends its value, as the PointValuePostprocessor does
+    int root=IsFound?rank:size,rootmin;
+    MPI_Allreduce(&root,&rootmin,1,MPI_INT,MPI_MIN,PETSC_COMM_WORLD);
+    MPI_Bcast(&m_pps_value,1,MPI_DOUBLE,rootmin,PETSC_COMM_WORLD);
     return m_pps_value;
 
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: Get the dof value at an arbitrary physical point for
+//+++          pps, the point is located by the element locator of
+//+++          the FE space
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "Postprocess/PointValuePostprocessor.h"
+
+double PointValuePostprocessor::computePointValue(const int &dofid,
+                                                  const nlohmann::json &parameters,
+                                                  const Mesh &mesh,
+                                                  const DofHandler &dofhandler,
+                                                  FE &fe,
+                                                  SolutionSystem &soln){
+    if(dofid<1||dofid>dofhandler.getMaxDofsPerNode()){
+        MessagePrinter::printErrorTxt("dof id="+to_string(dofid)+" is invalid for PointValuePostprocessor");
+        MessagePrinter::exitAsFem();
+    }
+
+    if(!JsonUtils::hasOnlyGivenValues(parameters,vector<string>{"point"})){
+        MessagePrinter::printErrorTxt("Unsupported options in parameters of the PointValuePostprocessor, "
+                                      "the 'point' is the only parameter you need,"
+                                      "please check your input file");
+        MessagePrinter::exitAsFem();
+    }
+    m_point=JsonUtils::getVector(parameters,"point");
+
+    if(!fe.m_elmtlocator.isInit()){
+        fe.m_elmtlocator.init(mesh);
+        fe.m_elmtlocator.printElmtLocatorInfo();
+    }
+
+    int rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+
+    int elmtid,iInd;
+    Vector3d xi;
+    bool IsFound=fe.m_elmtlocator.findElmt(mesh,m_point,elmtid,xi);
+    m_pps_value=0.0;
+    soln.m_u_current.makeGhostCopy();
+    if(IsFound){
+        ElmtConnArray elconn=mesh.getBulkMeshIthBulkElmtConn(elmtid);
+        for(int i=1;i<=elconn.size();i++){
+            iInd=dofhandler.getIthNodeJthDofID(elconn[i-1],dofid);
+            if(iInd<1) continue;// the inactive dof
+            m_pps_value+=fe.m_elmtlocator.getIthShapeValue(i)*soln.m_u_current.getIthValueFromGhost(iInd);
+        }
+    }
+    soln.m_u_current.destroyGhostCopy();
+
+    // for the distributed mesh only one rank holds the element, the lowest rank who finds the point sends its value
+    int root=IsFound?rank:size,rootmin;
+    MPI_Allreduce(&root,&rootmin,1,MPI_INT,MPI_MIN,PETSC_COMM_WORLD);
+    if(rootmin>=size){
+        MessagePrinter::printErrorTxt("the point ("+to_string(m_point(1))+","+to_string(m_point(2))+","+to_string(m_point(3))
+                                      +") is outside the mesh, it can\'t be used in PointValuePostprocessor, please check your input file");
+        MessagePrinter::exitAsFem();
+    }
+    MPI_Bcast(&m_pps_value,1,MPI_DOUBLE,rootmin,PETSC_COMM_WORLD);
+    return m_pps_value;
+}
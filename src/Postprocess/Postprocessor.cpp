@@ -22,6 +22,7 @@ Postprocessor::Postprocessor(){
     m_inputfilename.clear();
 
     m_csv_filename.clear();
+    m_csv_rows=0;
 
     m_pps_blocklist.clear();
     m_pps_blocksnum=0;
@@ -30,10 +31,12 @@ Postprocessor::Postprocessor(){
 void Postprocessor::init(){
     m_nodes0.resize(27+1);
     m_nodes.resize(27+1);
+    m_localnodeids.resize(27,0);
 }
 void Postprocessor::releaseMemory(){
     m_nodes0.clear();
     m_nodes.clear();
+    m_localnodeids.clear();
 }
 //**********************************************
 void Postprocessor::addPPSBlock2List(const PostprocessorBlock &t_block){
@@ -16,6 +16,7 @@
 
 void Postprocessor::prepareCSVFileHeader(){
     m_csv_filename=m_inputfilename.substr(0,m_inputfilename.size()-5)+".csv";
+    m_csv_rows=0;
     MPI_Comm_rank(PETSC_COMM_WORLD,&m_rank);
     if(m_rank==0){
         std::ofstream out;
@@ -33,6 +34,7 @@ void Postprocessor::prepareCSVFileHeader(){
     }
 }
 void Postprocessor::savePPSResults2CSVFile(const double &time){
+    m_csv_rows+=1;
     MPI_Comm_rank(PETSC_COMM_WORLD,&m_rank);
     if(m_rank==0){
         std::ofstream out;
@@ -49,4 +51,39 @@ void Postprocessor::savePPSResults2CSVFile(const double &time){
         out<<endl;
         out.close();
     }
-}
\ No newline at end of file
+}
+void Postprocessor::restoreCSVFile(const int &n){
+    m_csv_filename=m_inputfilename.substr(0,m_inputfilename.size()-5)+".csv";
+    m_csv_rows=n;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&m_rank);
+    if(m_rank==0){
+        std::ifstream in;
+        string line;
+        vector<string> lines;
+        in.open(m_csv_filename.c_str(),std::ios::in);
+        if(!in.is_open()){
+            MessagePrinter::printErrorTxt("can\'t open "+m_csv_filename+" for the restart, please make sure it is in the same folder as your input file");
+            MessagePrinter::exitAsFem();
+        }
+        // the header and the first n rows are kept
+        while(static_cast<int>(lines.size())<n+1&&getline(in,line)){
+            lines.push_back(line);
+        }
+        in.close();
+        if(static_cast<int>(lines.size())<n+1){
+            MessagePrinter::printErrorTxt(m_csv_filename+" has less rows than the checkpoint file, it can\'t be restored");
+            MessagePrinter::exitAsFem();
+        }
+
+        std::ofstream out;
+        out.open(m_csv_filename.c_str(),std::ios::out);
+        if(!out.is_open()){
+            MessagePrinter::printErrorTxt("can\'t open "+m_csv_filename+", please make sure you have the write permission");
+            MessagePrinter::exitAsFem();
+        }
+        for(const auto &it:lines){
+            out<<it<<endl;
+        }
+        out.close();
+    }
+}
@@ -47,17 +47,15 @@ void ProjectionSystem::executeProjection(const Mesh &t_mesh,const DofHandler &t_
     MPI_Comm_rank(PETSC_COMM_WORLD,&m_rank);
     MPI_Comm_size(PETSC_COMM_WORLD,&m_size);
 
-    int rankne=t_mesh.getBulkMeshBulkElmtsNum()/m_size;
-    int eStart=m_rank*rankne;
-    int eEnd=(m_rank+1)*rankne;
-    if(m_rank==m_size-1) eEnd=t_mesh.getBulkMeshBulkElmtsNum();
+    int eStart,eEnd;
+    BulkMesh::getBulkElmtsRange(t_mesh.getBulkMeshBulkElmtsNum(),m_rank,m_size,eStart,eEnd);
 
-    int nDim,e,qpoints_num;
+    int nDim,e,qpoints_num,qpid;
     double xi,eta,zeta,w,J,JxW;
     nDim=t_mesh.getBulkMeshMaxDim();
 
     int subelmtid;
-    int globaldofid,globalnodeid;
+    int globaldofid,localnodeid;
 
     m_local_elmtinfo.m_dim=nDim;
     m_local_elmtinfo.m_nodesnum=t_mesh.getBulkMeshNodesNumPerBulkElmt();
@@ -76,6 +74,7 @@ void ProjectionSystem::executeProjection(const Mesh &t_mesh,const DofHandler &t_
 
         qpoints_num=t_fe.m_bulk_qpoints.getQPointsNum();
         for(int qpInd=1;qpInd<=qpoints_num;qpInd++){
+            qpid=t_solution.getIthElmtJthQPointLocalID(e,qpInd);// the position in the local materials arrays
             w =t_fe.m_bulk_qpoints.getIthPointJthCoord(qpInd,0);
             xi=t_fe.m_bulk_qpoints.getIthPointJthCoord(qpInd,1);
             if(nDim==1){
@@ -100,10 +99,10 @@ void ProjectionSystem::executeProjection(const Mesh &t_mesh,const DofHandler &t_
                 m_local_elmtinfo.m_gpCoords0(3)+=t_fe.m_bulk_shp.shape_value(i)*m_nodes0(i,3);
             }
 
-            t_matesystem.m_materialcontainer_old.getScalarMaterialsRef()=t_solution.m_qpoints_scalarmaterials[(e-1)*qpoints_num+qpInd-1];
-            t_matesystem.m_materialcontainer_old.getVectorMaterialsRef()=t_solution.m_qpoints_vectormaterials[(e-1)*qpoints_num+qpInd-1];
-            t_matesystem.m_materialcontainer_old.getRank2MaterialsRef()=t_solution.m_qpoints_rank2materials[(e-1)*qpoints_num+qpInd-1];
-            t_matesystem.m_materialcontainer_old.getRank4MaterialsRef()=t_solution.m_qpoints_rank4materials[(e-1)*qpoints_num+qpInd-1];
+            t_matesystem.m_materialcontainer_old.getScalarMaterialsRef()=t_solution.m_qpoints_scalarmaterials[qpid];
+            t_matesystem.m_materialcontainer_old.getVectorMaterialsRef()=t_solution.m_qpoints_vectormaterials[qpid];
+            t_matesystem.m_materialcontainer_old.getRank2MaterialsRef()=t_solution.m_qpoints_rank2materials[qpid];
+            t_matesystem.m_materialcontainer_old.getRank4MaterialsRef()=t_solution.m_qpoints_rank4materials[qpid];
 
             for(int subelmt=1;subelmt<=t_elmtsystem.getIthBulkElmtSubElmtsNum(e);subelmt++){
 
@@ -132,8 +131,8 @@ void ProjectionSystem::executeProjection(const Mesh &t_mesh,const DofHandler &t_
 
                     m_local_elmtsoln.m_gpGradV[i+1]=0.0;
                     for(int j=1;j<=m_bulkelmt_nodesnum;j++){
-                        globalnodeid=t_mesh.getBulkMeshIthBulkElmtJthNodeID(e,j);
-                        globaldofid=t_dofhandler.getIthNodeJthDofID(globalnodeid,m_subelmtdofsid[i]);
+                        localnodeid=t_mesh.getBulkMeshIthBulkElmtJthLocalNodeID(e,j);// no global id search for the distributed mesh
+                        globaldofid=t_dofhandler.getIthLocalNodeJthDofID(localnodeid,m_subelmtdofsid[i]);
                         m_local_elmtsoln.m_gpUolder[i+1]+=t_fe.m_bulk_shp.shape_value(j)*t_solution.m_u_older.getIthValueFromGhost(globaldofid);
                         m_local_elmtsoln.m_gpUold[i+1]+=t_fe.m_bulk_shp.shape_value(j)*t_solution.m_u_old.getIthValueFromGhost(globaldofid);
                         m_local_elmtsoln.m_gpU[i+1]+=t_fe.m_bulk_shp.shape_value(j)*t_solution.m_u_current.getIthValueFromGhost(globaldofid);
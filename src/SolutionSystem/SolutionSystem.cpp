@@ -19,7 +19,11 @@ SolutionSystem::SolutionSystem(){
     m_dofs=0;
     m_allocated=false;
     m_bulkelmts_num=0;
+    m_elmt_offset=0;
     m_qpoints_num=0;
+    m_history_size=0;
+    m_history_num=0;
+    m_history_head=-1;
 }
 
 void SolutionSystem::releaseMemory(){
@@ -34,6 +38,13 @@ void SolutionSystem::releaseMemory(){
 
         m_a.releaseMemory();
 
+        for(auto &it:m_u_history) it.releaseMemory();
+        m_u_history.clear();
+        m_t_history.clear();
+        m_history_size=0;
+        m_history_num=0;
+        m_history_head=-1;
+
         for(auto &it:m_qpoints_scalarmaterials) it.clear();
         m_qpoints_scalarmaterials.clear();
 
@@ -0,0 +1,252 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: write/read the solution vectors and the materials of
+//+++          each qpoint to/from the raw binary checkpoint file,
+//+++          the values are stored as they are in memory, then
+//+++          the restart is bit-for-bit
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "SolutionSystem/SolutionSystem.h"
+
+template<typename T>
+static void writeBinaryValue(std::ofstream &out,const T &val){
+    out.write(reinterpret_cast<const char*>(&val),sizeof(T));
+}
+template<typename T>
+static void readBinaryValue(std::ifstream &in,T &val){
+    in.read(reinterpret_cast<char*>(&val),sizeof(T));
+}
+static void writeBinaryString(std::ofstream &out,const string &str){
+    writeBinaryValue(out,static_cast<int>(str.size()));
+    out.write(str.data(),str.size());
+}
+static void readBinaryString(std::ifstream &in,string &str){
+    int n=0;
+    readBinaryValue(in,n);
+    str.resize(n>0?n:0);
+    if(n>0) in.read(&str[0],n);
+}
+
+/**
+ * write the local part of the petsc vector
+ */
+static void writeBinaryVector(std::ofstream &out,Vector &u){
+    PetscInt n;
+    const PetscScalar *vals;
+    VecGetLocalSize(u.getVectorRef(),&n);
+    writeBinaryValue(out,static_cast<int>(n));
+    VecGetArrayRead(u.getVectorRef(),&vals);
+    out.write(reinterpret_cast<const char*>(vals),n*sizeof(PetscScalar));
+    VecRestoreArrayRead(u.getVectorRef(),&vals);
+}
+/**
+ * read the local part of the petsc vector, return false if the local size is different
+ */
+static bool readBinaryVector(std::ifstream &in,Vector &u){
+    PetscInt n;
+    int nstored=-1;
+    PetscScalar *vals;
+    VecGetLocalSize(u.getVectorRef(),&n);
+    readBinaryValue(in,nstored);
+    if(nstored!=static_cast<int>(n)) return false;
+    VecGetArray(u.getVectorRef(),&vals);
+    in.read(reinterpret_cast<char*>(vals),n*sizeof(PetscScalar));
+    VecRestoreArray(u.getVectorRef(),&vals);
+    return true;
+}
+
+static void writeBinaryMaterials(std::ofstream &out,const vector<ScalarMateType> &mates){
+    for(const auto &mate:mates){
+        writeBinaryValue(out,static_cast<int>(mate.size()));
+        for(const auto &it:mate){
+            writeBinaryString(out,it.first);
+            writeBinaryValue(out,it.second);
+        }
+    }
+}
+static void writeBinaryMaterials(std::ofstream &out,const vector<VectorMateType> &mates){
+    for(const auto &mate:mates){
+        writeBinaryValue(out,static_cast<int>(mate.size()));
+        for(const auto &it:mate){
+            writeBinaryString(out,it.first);
+            for(int i=1;i<=3;i++) writeBinaryValue(out,it.second(i));
+        }
+    }
+}
+static void writeBinaryMaterials(std::ofstream &out,const vector<Rank2MateType> &mates){
+    for(const auto &mate:mates){
+        writeBinaryValue(out,static_cast<int>(mate.size()));
+        for(const auto &it:mate){
+            writeBinaryString(out,it.first);
+            for(int i=1;i<=3;i++){
+                for(int j=1;j<=3;j++) writeBinaryValue(out,it.second(i,j));
+            }
+        }
+    }
+}
+static void writeBinaryMaterials(std::ofstream &out,const vector<Rank4MateType> &mates){
+    for(const auto &mate:mates){
+        writeBinaryValue(out,static_cast<int>(mate.size()));
+        for(const auto &it:mate){
+            writeBinaryString(out,it.first);
+            for(int i=1;i<=3;i++){
+                for(int j=1;j<=3;j++){
+                    for(int k=1;k<=3;k++){
+                        for(int l=1;l<=3;l++) writeBinaryValue(out,it.second(i,j,k,l));
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void readBinaryMaterials(std::ifstream &in,vector<ScalarMateType> &mates){
+    int n;
+    string name;
+    for(auto &mate:mates){
+        mate.clear();
+        readBinaryValue(in,n);
+        for(int m=0;m<n;m++){
+            readBinaryString(in,name);
+            readBinaryValue(in,mate[name]);
+        }
+    }
+}
+static void readBinaryMaterials(std::ifstream &in,vector<VectorMateType> &mates){
+    int n;
+    string name;
+    for(auto &mate:mates){
+        mate.clear();
+        readBinaryValue(in,n);
+        for(int m=0;m<n;m++){
+            readBinaryString(in,name);
+            Vector3d &val=mate[name];
+            for(int i=1;i<=3;i++) readBinaryValue(in,val(i));
+        }
+    }
+}
+static void readBinaryMaterials(std::ifstream &in,vector<Rank2MateType> &mates){
+    int n;
+    string name;
+    for(auto &mate:mates){
+        mate.clear();
+        readBinaryValue(in,n);
+        for(int m=0;m<n;m++){
+            readBinaryString(in,name);
+            Rank2Tensor &val=mate[name];
+            for(int i=1;i<=3;i++){
+                for(int j=1;j<=3;j++) readBinaryValue(in,val(i,j));
+            }
+        }
+    }
+}
+static void readBinaryMaterials(std::ifstream &in,vector<Rank4MateType> &mates){
+    int n;
+    string name;
+    for(auto &mate:mates){
+        mate.clear();
+        readBinaryValue(in,n);
+        for(int m=0;m<n;m++){
+            readBinaryString(in,name);
+            Rank4Tensor &val=mate[name];
+            for(int i=1;i<=3;i++){
+                for(int j=1;j<=3;j++){
+                    for(int k=1;k<=3;k++){
+                        for(int l=1;l<=3;l++) readBinaryValue(in,val(i,j,k,l));
+                    }
+                }
+            }
+        }
+    }
+}
+
+void SolutionSystem::writeCheckpoint(std::ofstream &out){
+    writeBinaryValue(out,m_dofs);
+    writeBinaryValue(out,m_bulkelmts_num);
+    writeBinaryValue(out,m_qpoints_num);
+
+    writeBinaryVector(out,m_u_current);
+    writeBinaryVector(out,m_u_old);
+    writeBinaryVector(out,m_u_older);
+    writeBinaryVector(out,m_v);
+    writeBinaryVector(out,m_a);
+
+    // the history buffer of the multi-step method
+    writeBinaryValue(out,m_history_size);
+    writeBinaryValue(out,m_history_num);
+    writeBinaryValue(out,m_history_head);
+    for(int i=0;i<m_history_size;i++){
+        writeBinaryValue(out,m_t_history[i]);
+        writeBinaryVector(out,m_u_history[i]);
+    }
+
+    // the materials of the local qpoints, the current and the old ones
+    writeBinaryMaterials(out,m_qpoints_scalarmaterials);
+    writeBinaryMaterials(out,m_qpoints_vectormaterials);
+    writeBinaryMaterials(out,m_qpoints_rank2materials);
+    writeBinaryMaterials(out,m_qpoints_rank4materials);
+    writeBinaryMaterials(out,m_qpoints_scalarmaterials_old);
+    writeBinaryMaterials(out,m_qpoints_vectormaterials_old);
+    writeBinaryMaterials(out,m_qpoints_rank2materials_old);
+    writeBinaryMaterials(out,m_qpoints_rank4materials_old);
+}
+
+bool SolutionSystem::readCheckpoint(std::ifstream &in){
+    int dofs=-1,elmts=-1,qpoints=-1;
+    readBinaryValue(in,dofs);
+    readBinaryValue(in,elmts);
+    readBinaryValue(in,qpoints);
+    if(dofs!=m_dofs||elmts!=m_bulkelmts_num||qpoints!=m_qpoints_num){
+        MessagePrinter::printErrorTxt("the dofs or the qpoints of the checkpoint file don\'t match your current input file");
+        return false;
+    }
+
+    if(!readBinaryVector(in,m_u_current)||
+       !readBinaryVector(in,m_u_old)||
+       !readBinaryVector(in,m_u_older)||
+       !readBinaryVector(in,m_v)||
+       !readBinaryVector(in,m_a)){
+        MessagePrinter::printErrorTxt("the local size of the solution vectors in the checkpoint file doesn\'t match, please use the same number of processors");
+        return false;
+    }
+
+    int size=-1;
+    readBinaryValue(in,size);
+    if(size!=m_history_size){
+        MessagePrinter::printErrorTxt("the history buffer of the checkpoint file doesn\'t match, please use the same time stepping method");
+        return false;
+    }
+    readBinaryValue(in,m_history_num);
+    readBinaryValue(in,m_history_head);
+    for(int i=0;i<m_history_size;i++){
+        readBinaryValue(in,m_t_history[i]);
+        if(!readBinaryVector(in,m_u_history[i])){
+            MessagePrinter::printErrorTxt("the local size of the history vectors in the checkpoint file doesn\'t match");
+            return false;
+        }
+    }
+
+    readBinaryMaterials(in,m_qpoints_scalarmaterials);
+    readBinaryMaterials(in,m_qpoints_vectormaterials);
+    readBinaryMaterials(in,m_qpoints_rank2materials);
+    readBinaryMaterials(in,m_qpoints_rank4materials);
+    readBinaryMaterials(in,m_qpoints_scalarmaterials_old);
+    readBinaryMaterials(in,m_qpoints_vectormaterials_old);
+    readBinaryMaterials(in,m_qpoints_rank2materials_old);
+    readBinaryMaterials(in,m_qpoints_rank4materials_old);
+
+    if(!in.good()){
+        MessagePrinter::printErrorTxt("the checkpoint file is incomplete");
+        return false;
+    }
+    return true;
+}
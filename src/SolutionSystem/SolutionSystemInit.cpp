@@ -16,21 +16,48 @@
 
 void SolutionSystem::init(const DofHandler &t_dofhandler,const FE &t_fe){
     m_dofs=t_dofhandler.getActiveDofs();
-    m_bulkelmts_num=t_dofhandler.getBulkElmtsNum();
     m_qpoints_num=t_fe.m_bulk_qpoints.getQPointsNum();
 
+    // only the elements assembled by the current rank keep their qpoint materials, the partition is
+    // the same one used by the FE system's element loop
+    int rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    int eEnd;
+    BulkMesh::getBulkElmtsRange(t_dofhandler.getBulkElmtsNum(),rank,size,m_elmt_offset,eEnd);
+    m_bulkelmts_num=eEnd-m_elmt_offset;
+
     //******************************************************
     //*** initialize each vector
     //******************************************************
-    m_u_current.resize(m_dofs,0.0);
-    m_u_old.resize(m_dofs,0.0);
-    m_u_older.resize(m_dofs,0.0);
-    m_u_temp.resize(m_dofs,0.0);
-    m_u_copy.resize(m_dofs,0.0);
+    // the same layout as the equation system, the owned dofs of the distributed mesh are the local part
+    const int nlocal=t_dofhandler.getLocalDofsNum();
+    m_u_current.resize(m_dofs,0.0,nlocal);
+    m_u_old.resize(m_dofs,0.0,nlocal);
+    m_u_older.resize(m_dofs,0.0,nlocal);
+    m_u_temp.resize(m_dofs,0.0,nlocal);
+    m_u_copy.resize(m_dofs,0.0,nlocal);
 
     // for velocity and acceleration
-    m_v.resize(m_dofs,0.0);
-    m_a.resize(m_dofs,0.0);
+    m_v.resize(m_dofs,0.0,nlocal);
+    m_a.resize(m_dofs,0.0,nlocal);
+
+    // for the distributed mesh, the ghost copies only need the dofs of the local nodes
+    if(nlocal!=PETSC_DECIDE){
+        int iStart,iEnd,dofid;
+        t_dofhandler.getOwnedDofsRange(iStart,iEnd);
+        vector<int> ghostids;
+        for(int i=1;i<=t_dofhandler.getLocalNodesNum();i++){
+            for(int j=1;j<=t_dofhandler.getMaxDofsPerNode();j++){
+                dofid=t_dofhandler.getIthLocalNodeJthDofID(i,j);
+                if(dofid<1||(dofid>=iStart&&dofid<=iEnd)) continue;
+                ghostids.push_back(dofid);
+            }
+        }
+        std::sort(ghostids.begin(),ghostids.end());
+        ghostids.erase(std::unique(ghostids.begin(),ghostids.end()),ghostids.end());
+        for(auto *u:{&m_u_current,&m_u_old,&m_u_older,&m_u_temp,&m_u_copy,&m_v,&m_a}) u->setGhostIDs(ghostids);
+    }
 
     // for the material properties on each gauss point
     m_qpoints_scalarmaterials.resize(m_bulkelmts_num*m_qpoints_num);
@@ -15,19 +15,51 @@
 #include "SolutionSystem/SolutionSystem.h"
 
 void SolutionSystem::updateSolution(){
-    m_u_older=m_u_old;
-    m_u_old=m_u_current;
+    // older<-old<-current, the storage of the older one is reused by the current one
+    m_u_older.swap(m_u_old);
+    m_u_old.swap(m_u_current);
+    m_u_current.copyFrom(m_u_old);
+}
+
+void SolutionSystem::rollbackSolution(){
+    m_u_current.copyFrom(m_u_old);
+    // m_v and m_a are not the state of any integrator, there is nothing to restore: the implicit ones rebuild them
+    // from U and the history in every residual evaluation (and the accepted step zeroes m_v as well), and the
+    // central difference keeps its half-step velocity and acceleration inside the explicit integrator, it only
+    // writes m_v and m_a for the output once a step is accepted. So only the values of the rejected step are cleared.
+    m_v.setToZero();
+    m_a.setToZero();
+}
+
+void SolutionSystem::initHistory(const int &n){
+    // the vector class can't be copied before its allocation, so the buffer is always rebuilt from the empty one
+    for(auto &it:m_u_history) it.releaseMemory();
+    m_u_history.clear();
+    m_u_history.resize(n);
+    m_t_history.assign(n,0.0);
+    // the history vectors have the same layout as the solution
+    PetscInt nlocal;
+    VecGetLocalSize(m_u_current.getVectorRef(),&nlocal);
+    for(auto &it:m_u_history) it.resize(m_dofs,0.0,static_cast<int>(nlocal));
+    m_history_size=n;
+    m_history_num=0;
+    m_history_head=-1;
+}
+
+void SolutionSystem::pushHistory(const Vector &u,const double &t){
+    if(m_history_size<1) return;
+    m_history_head=(m_history_head+1)%m_history_size;
+    m_u_history[m_history_head].copyFrom(u);
+    m_t_history[m_history_head]=t;
+    if(m_history_num<m_history_size) m_history_num+=1;
 }
 
 void SolutionSystem::updateMaterialsSolution(){
-    // TODO: in the future, this vector should be designed as the distributed one (mpi vector) 
-    //       to reduce the memory consumption !!!
-    for(int e=1;e<=m_bulkelmts_num;e++){
-        for(int j=1;j<=m_qpoints_num;j++){
-            m_qpoints_scalarmaterials_old[(e-1)*m_qpoints_num+j-1]=m_qpoints_scalarmaterials[(e-1)*m_qpoints_num+j-1];
-            m_qpoints_vectormaterials_old[(e-1)*m_qpoints_num+j-1]=m_qpoints_vectormaterials[(e-1)*m_qpoints_num+j-1];
-            m_qpoints_rank2materials_old[(e-1)*m_qpoints_num+j-1]=m_qpoints_rank2materials[(e-1)*m_qpoints_num+j-1];
-            m_qpoints_rank4materials_old[(e-1)*m_qpoints_num+j-1]=m_qpoints_rank4materials[(e-1)*m_qpoints_num+j-1];
-        }
+    // only the local elements' qpoints are stored
+    for(int i=0;i<m_bulkelmts_num*m_qpoints_num;i++){
+        m_qpoints_scalarmaterials_old[i]=m_qpoints_scalarmaterials[i];
+        m_qpoints_vectormaterials_old[i]=m_qpoints_vectormaterials[i];
+        m_qpoints_rank2materials_old[i]=m_qpoints_rank2materials[i];
+        m_qpoints_rank4materials_old[i]=m_qpoints_rank4materials[i];
     }
 }
\ No newline at end of file
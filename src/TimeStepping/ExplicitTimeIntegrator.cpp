@@ -0,0 +1,286 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the assembly, the checkpoint and the memory management
+//+++          of the explicit/IMEX time integrator
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "TimeStepping/ExplicitTimeIntegrator.h"
+
+ExplicitTimeIntegrator::ExplicitTimeIntegrator(){
+    m_allocated=false;
+    m_hasmass=false;
+    m_hasimexmatrix=false;
+    m_hasgold=false;
+    m_hasacc=false;
+    m_hrzlumping=false;
+    m_M=NULL;// the HRZ lumping doesn't need the consistent mass
+    m_imex_dt=0.0;
+    m_imex_order=0;
+    m_cd_dtold=0.0;
+    m_linearsolvername="mumps";
+    m_pcname="lu";
+    m_ksp_restart=30;
+    m_ksp_maxiters=10000;
+}
+
+void ExplicitTimeIntegrator::setLinearSolverOptions(const string &t_linearsolvername,const string &t_pcname,
+                                                    const int &t_restart,const int &t_maxiters){
+    m_linearsolvername=t_linearsolvername;
+    m_pcname=t_pcname;
+    // the multigrid hierarchy belongs to the SNES solver, then the IMEX system uses lu instead
+    if(m_pcname=="gmg"||m_pcname=="pmg") m_pcname="lu";
+    m_ksp_restart=t_restart;
+    m_ksp_maxiters=t_maxiters;
+}
+
+void ExplicitTimeIntegrator::allocateVectors(SolutionSystem &t_solutionsystem){
+    if(m_allocated) return;
+    VecDuplicate(t_solutionsystem.m_u_current.getVectorRef(),&m_MLinv);
+    VecDuplicate(t_solutionsystem.m_u_current.getVectorRef(),&m_G);
+    VecDuplicate(t_solutionsystem.m_u_current.getVectorRef(),&m_Gold);
+    VecDuplicate(t_solutionsystem.m_u_current.getVectorRef(),&m_dU);
+    VecDuplicate(t_solutionsystem.m_u_current.getVectorRef(),&m_work);
+    VecDuplicate(t_solutionsystem.m_u_current.getVectorRef(),&m_vhalf);
+    VecDuplicate(t_solutionsystem.m_u_current.getVectorRef(),&m_acc);
+    m_allocated=true;
+}
+
+/**
+ * write the local part of the petsc vector
+ */
+static void writeBinaryVec(std::ofstream &out,Vec &u){
+    PetscInt n;
+    const PetscScalar *vals;
+    VecGetLocalSize(u,&n);
+    const int nlocal=static_cast<int>(n);
+    out.write(reinterpret_cast<const char*>(&nlocal),sizeof(int));
+    VecGetArrayRead(u,&vals);
+    out.write(reinterpret_cast<const char*>(vals),n*sizeof(PetscScalar));
+    VecRestoreArrayRead(u,&vals);
+}
+/**
+ * read the local part of the petsc vector, return false if the local size is different
+ */
+static bool readBinaryVec(std::ifstream &in,Vec &u){
+    PetscInt n;
+    int nstored=-1;
+    PetscScalar *vals;
+    VecGetLocalSize(u,&n);
+    in.read(reinterpret_cast<char*>(&nstored),sizeof(int));
+    if(nstored!=static_cast<int>(n)) return false;
+    VecGetArray(u,&vals);
+    in.read(reinterpret_cast<char*>(vals),n*sizeof(PetscScalar));
+    VecRestoreArray(u,&vals);
+    return true;
+}
+
+void ExplicitTimeIntegrator::writeCheckpoint(std::ofstream &out){
+    const int hasgold=m_hasgold?1:0;
+    const int hasacc=m_hasacc?1:0;
+    out.write(reinterpret_cast<const char*>(&hasgold),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&hasacc),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&m_cd_dtold),sizeof(double));
+    if(m_hasgold) writeBinaryVec(out,m_Gold);
+    if(m_hasacc){
+        writeBinaryVec(out,m_vhalf);
+        writeBinaryVec(out,m_acc);
+    }
+}
+
+bool ExplicitTimeIntegrator::readCheckpoint(std::ifstream &in,SolutionSystem &t_solutionsystem){
+    int hasgold=0,hasacc=0;
+    in.read(reinterpret_cast<char*>(&hasgold),sizeof(int));
+    in.read(reinterpret_cast<char*>(&hasacc),sizeof(int));
+    in.read(reinterpret_cast<char*>(&m_cd_dtold),sizeof(double));
+    allocateVectors(t_solutionsystem);
+    // the mass and the IMEX matrix only depend on the mesh and dt, they are rebuilt by the next step
+    m_hasgold=(hasgold==1);
+    m_hasacc=(hasacc==1);
+    if(m_hasgold&&!readBinaryVec(in,m_Gold)) return false;
+    if(m_hasacc){
+        if(!readBinaryVec(in,m_vhalf)||!readBinaryVec(in,m_acc)) return false;
+    }
+    return in.good();
+}
+
+void ExplicitTimeIntegrator::evaluateResidual(const double &t,Vector &U,Vec &G){
+    SolutionSystem &soln=*m_appctx._solutionSystem;
+    FEControlInfo &fectrlinfo=*m_appctx._fectrlinfo;
+
+    // V=0, then the residual only contains G(U)
+    soln.m_u_temp.copyFrom(U);
+    soln.m_v.setToZero();
+    soln.m_a.setToZero();
+    m_appctx._feSystem->formBulkFE(FECalcType::COMPUTERESIDUAL,t,fectrlinfo.dt,fectrlinfo.ctan,
+                                   *m_appctx._mesh,*m_appctx._dofHandler,*m_appctx._fe,
+                                   *m_appctx._elmtSystem,*m_appctx._mateSystem,
+                                   soln,
+                                   m_appctx._equationSystem->m_amatrix,
+                                   m_appctx._equationSystem->m_rhs);
+
+    // the integrated bcs are added, while the dirichlet rows are zero
+    soln.m_u_copy.copyFrom(U);
+    m_appctx._bcSystem->applyBoundaryConditions(FECalcType::COMPUTERESIDUAL,t,fectrlinfo.ctan,
+                                                *m_appctx._mesh,*m_appctx._dofHandler,*m_appctx._fe,
+                                                soln.m_u_temp,soln.m_u_copy,soln.m_u_old,soln.m_u_older,
+                                                soln.m_v,
+                                                m_appctx._equationSystem->m_amatrix,
+                                                m_appctx._equationSystem->m_rhs);
+    VecCopy(m_appctx._equationSystem->m_rhs.getVectorRef(),G);
+}
+
+void ExplicitTimeIntegrator::assembleMatrix(Vector &U,const double (&ctan)[3],const bool &applybc,Mat &A){
+    SolutionSystem &soln=*m_appctx._solutionSystem;
+    FEControlInfo &fectrlinfo=*m_appctx._fectrlinfo;
+    const double t=fectrlinfo.t+fectrlinfo.dt;
+
+    m_appctx._feSystem->resetMaxKMatrixCoeff();
+    soln.m_u_temp.copyFrom(U);
+    soln.m_v.setToZero();
+    soln.m_a.setToZero();
+    m_appctx._feSystem->formBulkFE(FECalcType::COMPUTEJACOBIAN,t,fectrlinfo.dt,ctan,
+                                   *m_appctx._mesh,*m_appctx._dofHandler,*m_appctx._fe,
+                                   *m_appctx._elmtSystem,*m_appctx._mateSystem,
+                                   soln,
+                                   m_appctx._equationSystem->m_amatrix,
+                                   m_appctx._equationSystem->m_rhs);
+    if(applybc){
+        m_appctx._bcSystem->setDirichletPenalty(m_appctx._feSystem->getMaxCoefOfKMatrix()*1.0e10);
+        soln.m_u_copy.copyFrom(U);
+        m_appctx._bcSystem->applyBoundaryConditions(FECalcType::COMPUTEJACOBIAN,t,ctan,
+                                                    *m_appctx._mesh,*m_appctx._dofHandler,*m_appctx._fe,
+                                                    soln.m_u_temp,soln.m_u_copy,soln.m_u_old,soln.m_u_older,
+                                                    soln.m_v,
+                                                    m_appctx._equationSystem->m_amatrix,
+                                                    m_appctx._equationSystem->m_rhs);
+    }
+    // the equation system matrix is overwritten by SNES, so a copy is kept here
+    MatDuplicate(m_appctx._equationSystem->m_amatrix.getReference(),MAT_COPY_VALUES,&A);
+}
+
+void ExplicitTimeIntegrator::applyDirichletBC(const double &t){
+    SolutionSystem &soln=*m_appctx._solutionSystem;
+    soln.m_u_copy.copyFrom(soln.m_u_current);
+    m_appctx._bcSystem->applyPresetBoundaryConditions(FECalcType::UPDATEU,t,
+                                                      *m_appctx._mesh,*m_appctx._dofHandler,
+                                                      soln.m_u_current,soln.m_u_copy,
+                                                      soln.m_u_old,soln.m_u_older,
+                                                      soln.m_v,
+                                                      m_appctx._equationSystem->m_amatrix,
+                                                      m_appctx._equationSystem->m_rhs);
+}
+
+void ExplicitTimeIntegrator::assembleLumpedMass(const double (&ctan)[3]){
+    SolutionSystem &soln=*m_appctx._solutionSystem;
+    FEControlInfo &fectrlinfo=*m_appctx._fectrlinfo;
+    if(m_hrzlumping){
+        // the diagonal of each element mass is scaled per field component, then it is assembled
+        soln.m_u_temp.copyFrom(soln.m_u_old);
+        soln.m_v.setToZero();
+        soln.m_a.setToZero();
+        m_appctx._feSystem->formBulkFE(FECalcType::COMPUTELUMPEDMASS,fectrlinfo.t+fectrlinfo.dt,fectrlinfo.dt,ctan,
+                                       *m_appctx._mesh,*m_appctx._dofHandler,*m_appctx._fe,
+                                       *m_appctx._elmtSystem,*m_appctx._mateSystem,
+                                       soln,
+                                       m_appctx._equationSystem->m_amatrix,
+                                       m_appctx._equationSystem->m_rhs);
+        VecCopy(m_appctx._equationSystem->m_rhs.getVectorRef(),m_MLinv);
+    }
+    else{
+        assembleMatrix(soln.m_u_old,ctan,false,m_M);
+        MatGetRowSum(m_M,m_MLinv);
+    }
+    double mmin;
+    VecMin(m_MLinv,NULL,&mmin);
+    if(mmin<=0.0){
+        MessagePrinter::printErrorTxt("the lumped mass is not positive, the explicit method requires the time derivative of all the dofs, please use the implicit method");
+        MessagePrinter::exitAsFem();
+    }
+    VecReciprocal(m_MLinv);
+    m_hasmass=true;
+}
+
+double ExplicitTimeIntegrator::estimateStableDt(const Mesh &mesh,const SolutionSystem &solutionsystem)const{
+    double dtcrit=1.0e30;
+    double dist,dx,c,ce;
+    int nodes,iInd,jInd;
+    bool HasWaveSpeed=false;
+    // the materials are only updated for the elements of current rank, the same partition as FormBulkFE
+    PetscMPIInt rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    int eStart,eEnd;
+    BulkMesh::getBulkElmtsRange(mesh.getBulkMeshBulkElmtsNum(),rank,size,eStart,eEnd);
+    for(int e=eStart+1;e<=eEnd;e++){
+        ce=0.0;
+        for(int qp=1;qp<=solutionsystem.getQPointsNum();qp++){
+            const ScalarMateType mate=solutionsystem.getIthElmtJthScalarMaterial(e,qp);
+            if(mate.find("wave-speed")==mate.end()) continue;
+            c=mate.at("wave-speed");
+            if(c>ce) ce=c;
+        }
+        if(ce<=0.0) continue;
+        HasWaveSpeed=true;
+
+        // the min distance between the nodes of the element
+        nodes=mesh.getBulkMeshIthBulkElmtNodesNum(e);
+        dist=1.0e30;
+        for(int i=1;i<=nodes;i++){
+            iInd=mesh.getBulkMeshIthBulkElmtJthNodeID(e,i);
+            for(int j=i+1;j<=nodes;j++){
+                jInd=mesh.getBulkMeshIthBulkElmtJthNodeID(e,j);
+                dx=0.0;
+                for(int k=1;k<=3;k++){
+                    dx+=(mesh.getBulkMeshIthNodeJthCoord0(iInd,k)-mesh.getBulkMeshIthNodeJthCoord0(jInd,k))
+                       *(mesh.getBulkMeshIthNodeJthCoord0(iInd,k)-mesh.getBulkMeshIthNodeJthCoord0(jInd,k));
+                }
+                if(sqrt(dx)<dist) dist=sqrt(dx);
+            }
+        }
+        if(dist/ce<dtcrit) dtcrit=dist/ce;
+    }
+    double dtlocal=dtcrit;
+    int haslocal=HasWaveSpeed?1:0,hasglobal=0;
+    MPI_Allreduce(&dtlocal,&dtcrit,1,MPI_DOUBLE,MPI_MIN,PETSC_COMM_WORLD);
+    MPI_Allreduce(&haslocal,&hasglobal,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    HasWaveSpeed=(hasglobal>0);
+    if(!HasWaveSpeed){
+        MessagePrinter::printErrorTxt("can\'t find the 'wave-speed' material, the central difference method requires the density 'rho' of your mechanics material");
+        MessagePrinter::exitAsFem();
+    }
+    return dtcrit;
+}
+
+void ExplicitTimeIntegrator::releaseMemory(){
+    if(m_allocated){
+        VecDestroy(&m_MLinv);
+        VecDestroy(&m_G);
+        VecDestroy(&m_Gold);
+        VecDestroy(&m_dU);
+        VecDestroy(&m_work);
+        VecDestroy(&m_vhalf);
+        VecDestroy(&m_acc);
+        m_allocated=false;
+    }
+    if(m_hasmass){
+        MatDestroy(&m_M);
+        m_hasmass=false;
+    }
+    if(m_hasimexmatrix){
+        MatDestroy(&m_A);
+        KSPDestroy(&m_ksp);
+        m_hasimexmatrix=false;
+    }
+    m_hasgold=false;
+    m_hasacc=false;
+    m_cd_dtold=0.0;
+}
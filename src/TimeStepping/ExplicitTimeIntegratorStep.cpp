@@ -0,0 +1,215 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: advance one step by SSP-RK3, IMEX-SBDF or the central
+//+++          difference, the mass
+//+++          matrix is assembled once, so it should not depend
+//+++          on the solution
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "TimeStepping/ExplicitTimeIntegrator.h"
+
+bool ExplicitTimeIntegrator::step(Mesh &mesh,DofHandler &dofhandler,FE &fe,
+                                  ElmtSystem &elmtsystem,MateSystem &matesystem,
+                                  FESystem &fesystem,
+                                  BCSystem &bcsystem,
+                                  SolutionSystem &solutionsystem,
+                                  EquationSystem &equationsystem,
+                                  FEControlInfo &fectrlinfo){
+    m_appctx=AppCtx{&mesh,&dofhandler,
+                   &bcsystem,
+                   &elmtsystem,&matesystem,
+                   &solutionsystem,&equationsystem,
+                   &fe,&fesystem,
+                   &fectrlinfo,
+                   nullptr
+                   };
+    allocateVectors(solutionsystem);
+    // the residual is always evaluated with V=0, the same as the static case
+    fectrlinfo.ctan[0]=1.0;fectrlinfo.ctan[1]=0.0;fectrlinfo.ctan[2]=0.0;
+
+    bool IsSuccess;
+    if(fectrlinfo.m_timesteppingtype==TimeSteppingType::SSPRK3){
+        IsSuccess=stepSSPRK3();
+    }
+    else if(fectrlinfo.m_timesteppingtype==TimeSteppingType::IMEXSBDF1){
+        IsSuccess=stepIMEX(1);
+    }
+    else if(fectrlinfo.m_timesteppingtype==TimeSteppingType::IMEXSBDF2){
+        // SBDF2 needs the previous G and the constant dt, otherwise it starts again from SBDF1
+        if(m_hasgold&&fectrlinfo.CurrentStep>=1&&fabs(fectrlinfo.dt-fectrlinfo.dtold)<1.0e-12*fectrlinfo.dt){
+            IsSuccess=stepIMEX(2);
+        }
+        else{
+            IsSuccess=stepIMEX(1);
+        }
+    }
+    else if(fectrlinfo.m_timesteppingtype==TimeSteppingType::CENTRALDIFFERENCE){
+        IsSuccess=stepCentralDifference();
+    }
+    else{
+        MessagePrinter::printErrorTxt("unsupported time stepping method for the explicit time integrator");
+        MessagePrinter::exitAsFem();
+        return false;
+    }
+
+    double unorm;
+    VecNorm(solutionsystem.m_u_current.getVectorRef(),NORM_2,&unorm);
+    if(PetscIsInfOrNanReal(unorm)) IsSuccess=false;
+
+    char buff[68];
+    string str;
+    if(IsSuccess){
+        snprintf(buff,68,"  Explicit solver: |U|=%12.5e",unorm);
+    }
+    else{
+        snprintf(buff,68,"  Divergent, explicit solver failed");
+    }
+    str=buff;
+    MessagePrinter::printNormalTxt(str);
+    return IsSuccess;
+}
+
+bool ExplicitTimeIntegrator::stepSSPRK3(){
+    SolutionSystem &soln=*m_appctx._solutionSystem;
+    const double t=m_appctx._fectrlinfo->t;
+    const double h=m_appctx._fectrlinfo->dt;
+
+    if(!m_hasmass){
+        const double ctan[3]={0.0,1.0,0.0};
+        assembleLumpedMass(ctan);
+    }
+    Vec &U=soln.m_u_current.getVectorRef();
+    Vec &Un=soln.m_u_old.getVectorRef();
+
+    // U1=Un+h*L(Un), L(U)=-ML^{-1}*G(U)
+    evaluateResidual(t,soln.m_u_old,m_G);
+    VecPointwiseMult(m_work,m_MLinv,m_G);
+    VecWAXPY(U,-h,m_work,Un);
+    applyDirichletBC(t+h);
+
+    // U2=(3/4)Un+(1/4)(U1+h*L(U1))
+    evaluateResidual(t+h,soln.m_u_current,m_G);
+    VecPointwiseMult(m_work,m_MLinv,m_G);
+    VecAXPBYPCZ(U,0.75,-0.25*h,0.25,Un,m_work);
+    applyDirichletBC(t+0.5*h);
+
+    // Un+1=(1/3)Un+(2/3)(U2+h*L(U2))
+    evaluateResidual(t+0.5*h,soln.m_u_current,m_G);
+    VecPointwiseMult(m_work,m_MLinv,m_G);
+    VecAXPBYPCZ(U,1.0/3.0,-2.0*h/3.0,2.0/3.0,Un,m_work);
+    applyDirichletBC(t+h);
+
+    return true;
+}
+
+bool ExplicitTimeIntegrator::stepIMEX(const int &order){
+    SolutionSystem &soln=*m_appctx._solutionSystem;
+    const double t=m_appctx._fectrlinfo->t;
+    const double h=m_appctx._fectrlinfo->dt;
+
+    // A=c*M/h+L, L=dG/dU of the current state, c=1 for SBDF1, 3/2 for SBDF2
+    // the matrix is only rebuilt if dt or the order is changed
+    if(!m_hasimexmatrix||fabs(h-m_imex_dt)>1.0e-12*h||order!=m_imex_order){
+        const double ctan[3]={1.0,(order==1?1.0:1.5)/h,0.0};
+        if(m_hasimexmatrix){
+            MatDestroy(&m_A);
+        }
+        else{
+            // the same linear solver as the nonlinear solver block, the direct solver only factors A once
+            KSPCreate(PETSC_COMM_WORLD,&m_ksp);
+            KSPSetOptionsPrefix(m_ksp,"imex_");
+            setupLinearSolver(m_ksp,m_linearsolvername,m_pcname,m_ksp_restart,m_ksp_maxiters);
+        }
+        assembleMatrix(soln.m_u_old,ctan,true,m_A);
+        KSPSetOperators(m_ksp,m_A,m_A);
+        m_imex_dt=h;
+        m_imex_order=order;
+        m_hasimexmatrix=true;
+    }
+    if(order==2&&!m_hasmass){
+        const double ctan[3]={0.0,1.0,0.0};
+        assembleMatrix(soln.m_u_old,ctan,false,m_M);
+        m_hasmass=true;
+    }
+
+    // the explicit part: G(Un)-L*Un
+    evaluateResidual(t+h,soln.m_u_old,m_G);
+    if(order==1){
+        // A*dU=-G(Un)
+        VecCopy(m_G,m_dU);
+        VecScale(m_dU,-1.0);
+    }
+    else{
+        // A*dU=(A-M/h)*(Un-Un-1)-2G(Un)+G(Un-1)
+        VecWAXPY(m_work,-1.0,soln.m_u_older.getVectorRef(),soln.m_u_old.getVectorRef());
+        MatMult(m_M,m_work,m_dU);
+        VecScale(m_dU,-1.0/h);
+        MatMultAdd(m_A,m_work,m_dU,m_dU);
+        VecAXPBYPCZ(m_dU,-2.0,1.0,1.0,m_G,m_Gold);
+    }
+    KSPSolve(m_ksp,m_dU,m_work);
+    KSPConvergedReason reason;
+    KSPGetConvergedReason(m_ksp,&reason);
+    if(reason<0) return false;
+
+    VecWAXPY(soln.m_u_current.getVectorRef(),1.0,m_work,soln.m_u_old.getVectorRef());
+    applyDirichletBC(t+h);
+
+    // G(Un) is the G(Un-1) of the next step
+    VecCopy(m_G,m_Gold);
+    m_hasgold=true;
+    return true;
+}
+
+bool ExplicitTimeIntegrator::stepCentralDifference(){
+    SolutionSystem &soln=*m_appctx._solutionSystem;
+    const double t=m_appctx._fectrlinfo->t;
+    const double h=m_appctx._fectrlinfo->dt;
+
+    if(!m_hasmass){
+        const double ctan[3]={0.0,0.0,1.0};
+        assembleLumpedMass(ctan);
+    }
+    if(!m_hasacc){
+        // the initial velocity is zero, then A0=-ML^{-1}*G(U0)
+        evaluateResidual(t,soln.m_u_old,m_G);
+        VecPointwiseMult(m_acc,m_MLinv,m_G);
+        VecScale(m_acc,-1.0);
+        VecSet(m_vhalf,0.0);
+        m_cd_dtold=0.0;
+        m_hasacc=true;
+    }
+
+    // V(n+1/2)=V(n-1/2)+0.5*(h(n-1)+h)*A(n), for the first step, it is V(1/2)=V0+0.5*h*A0
+    VecWAXPY(m_dU,0.5*(m_cd_dtold+h),m_acc,m_vhalf);
+    // U(n+1)=U(n)+h*V(n+1/2)
+    VecWAXPY(soln.m_u_current.getVectorRef(),h,m_dU,soln.m_u_old.getVectorRef());
+    applyDirichletBC(t+h);
+
+    // A(n+1)=-ML^{-1}*G(U(n+1)), only the internal force is evaluated
+    evaluateResidual(t+h,soln.m_u_current,m_G);
+    VecPointwiseMult(m_work,m_MLinv,m_G);
+    double anorm;
+    VecNorm(m_work,NORM_2,&anorm);
+    if(PetscIsInfOrNanReal(anorm)) return false;
+
+    // the step is accepted, then the half-step velocity and the acceleration are updated
+    VecCopy(m_dU,m_vhalf);
+    VecCopy(m_work,m_acc);
+    VecScale(m_acc,-1.0);
+    m_cd_dtold=h;
+
+    // V(n+1)=V(n+1/2)+0.5*h*A(n+1), they are only used for the output
+    VecWAXPY(soln.m_v.getVectorRef(),0.5*h,m_acc,m_vhalf);
+    VecCopy(m_acc,soln.m_a.getVectorRef());
+    return true;
+}
@@ -25,8 +25,23 @@ TimeStepping::TimeStepping(){
     m_data.m_growthfactor=1.1;/**< the growth factor for time adaptive */
     m_data.m_isadaptive=false;/**< boolean flag for adaptive */
     m_data.m_optimize_iters=4;/**< optimize nonlinear iterations for time adaptive */
+    m_data.m_errorcontrol=false;/**< adaptive by nonlinear iterations by default */
+    m_data.m_err_abstol=1.0e-4;/**< the absolute tolerance of the local truncation error */
+    m_data.m_err_reltol=1.0e-3;/**< the relative tolerance of the local truncation error */
+    m_data.m_safety=0.9;/**< the safety factor of the step size controller */
+    m_data.m_bdf_maxorder=5;/**< the maximum order of the variable order BDF */
+    m_data.m_predictor_order=0;/**< no extrapolation predictor by default */
 
     m_data.m_stepping_type=TimeSteppingType::BACKWARDEULER;/**< the time stepping type */
+
+    m_err_old=1.0;
+    m_restartfile_name.clear();
+    m_failed_steps=0;
+    m_errorrejected_steps=0;
+    m_rejected_iters=0;
+    m_rejected_time=0.0;
+    m_bdf_order=1;
+    m_bdf_steps=0;
 }
 
 void TimeStepping::applyDefaultSettings(){
@@ -39,6 +54,12 @@ void TimeStepping::applyDefaultSettings(){
     m_data.m_growthfactor=1.1;/**< the growth factor for time adaptive */
     m_data.m_isadaptive=false;/**< boolean flag for adaptive */
     m_data.m_optimize_iters=4;/**< optimize nonlinear iterations for time adaptive */
+    m_data.m_errorcontrol=false;/**< adaptive by nonlinear iterations by default */
+    m_data.m_err_abstol=1.0e-4;/**< the absolute tolerance of the local truncation error */
+    m_data.m_err_reltol=1.0e-3;/**< the relative tolerance of the local truncation error */
+    m_data.m_safety=0.9;/**< the safety factor of the step size controller */
+    m_data.m_bdf_maxorder=5;/**< the maximum order of the variable order BDF */
+    m_data.m_predictor_order=0;/**< no extrapolation predictor by default */
 
     m_data.m_stepping_type=TimeSteppingType::BACKWARDEULER;/**< the time stepping type */
 }
@@ -66,11 +87,24 @@ void TimeStepping::printInfo()const{
     
     if(isAdaptive()){
         MessagePrinter::printNormalTxt("  adaptive = true");
+        if(isErrorControl()){
+            snprintf(buff,69,"  error control: abs tol=%12.5e, rel tol=%12.5e",
+                             getErrorAbsTolerance(),getErrorRelTolerance());
+            str=buff;
+            MessagePrinter::printNormalTxt(str);
+        }
     }
     else{
         MessagePrinter::printNormalTxt("  adaptive = false");
     }
 
+    if(getPredictorOrder()==1){
+        MessagePrinter::printNormalTxt("  predictor = linear extrapolation");
+    }
+    else if(getPredictorOrder()==2){
+        MessagePrinter::printNormalTxt("  predictor = quadratic extrapolation");
+    }
+
     if(getTimeSteppingType()==TimeSteppingType::BACKWARDEULER){
         MessagePrinter::printNormalTxt("  stepping method = backward euler(BE)");
     }
@@ -83,6 +117,52 @@ void TimeStepping::printInfo()const{
     else if(getTimeSteppingType()==TimeSteppingType::BDF2){
         MessagePrinter::printNormalTxt("  stepping method = BDF2");
     }
+    else if(getTimeSteppingType()==TimeSteppingType::SSPRK3){
+        MessagePrinter::printNormalTxt("  stepping method = explicit SSP-RK3 with lumped mass");
+    }
+    else if(getTimeSteppingType()==TimeSteppingType::IMEXSBDF1){
+        MessagePrinter::printNormalTxt("  stepping method = IMEX-SBDF1");
+    }
+    else if(getTimeSteppingType()==TimeSteppingType::IMEXSBDF2){
+        MessagePrinter::printNormalTxt("  stepping method = IMEX-SBDF2");
+    }
+    else if(getTimeSteppingType()==TimeSteppingType::CENTRALDIFFERENCE){
+        snprintf(buff,69,"  stepping method = central difference, cfl=%5.3f, %s lumping",getCFLFactor(),isHRZLumping()?"HRZ":"row-sum");
+        str=buff;
+        MessagePrinter::printNormalTxt(str);
+    }
+    else if(getTimeSteppingType()==TimeSteppingType::BDF){
+        snprintf(buff,69,"  stepping method = variable order BDF, max order=%1d",getBDFMaxOrder());
+        str=buff;
+        MessagePrinter::printNormalTxt(str);
+    }
 
     MessagePrinter::printStars();
-}
\ No newline at end of file
+}
+//**************************************************************
+void TimeStepping::recordRejectedStep(const bool &failed,const double &starttime,const int &iters){
+    if(failed){
+        m_failed_steps+=1;
+    }
+    else{
+        m_errorrejected_steps+=1;
+    }
+    m_rejected_iters+=iters;
+    m_rejected_time+=MPI_Wtime()-starttime;
+}
+
+void TimeStepping::printRejectedStepsInfo(const double &totaltime)const{
+    if(m_failed_steps+m_errorrejected_steps<1) return;
+    char buff[69];
+    string str;
+    MessagePrinter::printNormalTxt("Rejected steps summary:");
+    snprintf(buff,69,"  solver failed=%6d, error rejected=%6d, newton iters=%8d",
+             m_failed_steps,m_errorrejected_steps,m_rejected_iters);
+    str=buff;
+    MessagePrinter::printNormalTxt(str);
+    snprintf(buff,69,"  wasted time=%12.5e s (%6.2f%% of the transient analysis)",
+             m_rejected_time,totaltime>0.0?100.0*m_rejected_time/totaltime:0.0);
+    str=buff;
+    MessagePrinter::printNormalTxt(str);
+    MessagePrinter::printStars();
+}
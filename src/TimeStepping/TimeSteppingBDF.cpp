@@ -0,0 +1,125 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the variable order variable step BDF (order 1~5),
+//+++          the coefficients are the derivatives of the lagrange
+//+++          polynomial through the current solution and the
+//+++          previous ones, then the unequal dt is taken into
+//+++          account automatically. The order of the next step
+//+++          is selected by the divided difference error estimation
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "TimeStepping/TimeStepping.h"
+
+void TimeStepping::computeBDFCoefficients(SolutionSystem &solutionsystem,FEControlInfo &fectrlinfo)const{
+    // the order is reduced if there are not enough previous solutions
+    int k=m_bdf_order;
+    if(k>solutionsystem.getHistoryNum()) k=solutionsystem.getHistoryNum();
+    if(k<1) k=1;
+
+    // tau[0] is the time of the current step, tau[j] is the time of the j-th previous solution
+    double tau[6];
+    tau[0]=fectrlinfo.t+fectrlinfo.dt;
+    for(int j=1;j<=k;j++) tau[j]=solutionsystem.getIthHistoryTime(j);
+
+    // l_0'(tau_0)=sum(1/(tau_0-tau_m))
+    fectrlinfo.bdfcoefs[0]=0.0;
+    for(int m=1;m<=k;m++) fectrlinfo.bdfcoefs[0]+=1.0/(tau[0]-tau[m]);
+    // l_j'(tau_0)=prod(tau_0-tau_m)/prod(tau_j-tau_m)
+    for(int j=1;j<=k;j++){
+        double num=1.0,den=1.0;
+        for(int m=0;m<=k;m++){
+            if(m==j) continue;
+            if(m!=0) num*=tau[0]-tau[m];
+            den*=tau[j]-tau[m];
+        }
+        fectrlinfo.bdfcoefs[j]=num/den;
+    }
+    for(int j=k+1;j<6;j++) fectrlinfo.bdfcoefs[j]=0.0;
+    fectrlinfo.bdforder=k;
+}
+
+double TimeStepping::estimateBDFError(SolutionSystem &solutionsystem,const double &t,const int &q)const{
+    // the (q+1)-th divided difference needs q+2 points, including the current one
+    if(q<1||q+1>solutionsystem.getHistoryNum()) return -1.0;
+
+    double tau[7];
+    tau[0]=t;
+    for(int j=1;j<=q+1;j++) tau[j]=solutionsystem.getIthHistoryTime(j);
+
+    // the divided difference: u[tau_0,...,tau_q+1]=sum(u_i/prod(tau_i-tau_m))
+    // the LTE of the variable step BDF-q is: prod(tau_0-tau_m)*u[tau_0,...,tau_q+1]/l_0'(tau_0), m=1...q
+    // which reduces to h^(q+1)*u^(q+1)/((q+1)*sum(1/m)) for the constant dt, i.e. 1/2 for BE, 2/9 for BDF2
+    double scale=1.0,alpha0=0.0;
+    for(int m=1;m<=q;m++){
+        scale*=tau[0]-tau[m];
+        alpha0+=1.0/(tau[0]-tau[m]);
+    }
+    scale/=alpha0;
+
+    Vec E;
+    VecDuplicate(solutionsystem.m_u_current.getVectorRef(),&E);
+    VecSet(E,0.0);
+    for(int i=0;i<=q+1;i++){
+        double w=1.0;
+        for(int m=0;m<=q+1;m++){
+            if(m==i) continue;
+            w*=tau[i]-tau[m];
+        }
+        w=scale/w;
+        if(i==0){
+            VecAXPY(E,w,solutionsystem.m_u_current.getVectorRef());
+        }
+        else{
+            VecAXPY(E,w,solutionsystem.getIthHistory(i).getVectorRef());
+        }
+    }
+    double err=computeWeightedRMSNorm(E,solutionsystem.m_u_current.getVectorRef());
+    VecDestroy(&E);
+
+    return err;
+}
+
+void TimeStepping::selectBDFOrder(SolutionSystem &solutionsystem,const double &t){
+    m_bdf_steps+=1;
+
+    const int k=m_bdf_order;
+    double err,ratio,bestratio;
+    int bestorder;
+
+    // the achievable step ratio of order q is (1/err_q)^(1/(q+1))
+    err=estimateBDFError(solutionsystem,t,k);
+    if(err<0.0) return;// not enough previous solutions yet
+    bestorder=k;
+    bestratio=pow(err>1.0e-10?err:1.0e-10,-1.0/(k+1));
+
+    if(k>1){
+        err=estimateBDFError(solutionsystem,t,k-1);
+        ratio=pow(err>1.0e-10?err:1.0e-10,-1.0/k);
+        if(ratio>bestratio){
+            bestratio=ratio;bestorder=k-1;
+        }
+    }
+    // the order can only be increased after k+1 steps with constant order, otherwise the zero stability can't be guaranteed
+    if(k<getBDFMaxOrder()&&m_bdf_steps>=k+1){
+        err=estimateBDFError(solutionsystem,t,k+1);
+        if(err>=0.0){
+            ratio=pow(err>1.0e-10?err:1.0e-10,-1.0/(k+2));
+            if(ratio>bestratio){
+                bestratio=ratio;bestorder=k+1;
+            }
+        }
+    }
+    if(bestorder!=k){
+        m_bdf_order=bestorder;
+        m_bdf_steps=0;
+    }
+}
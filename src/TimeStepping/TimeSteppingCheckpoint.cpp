@@ -0,0 +1,168 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: the checkpoint/restart of the transient analysis,
+//+++          each rank writes its local part to a raw binary
+//+++          file, i.e. xxx.chk for the serial run, xxx.chk.i
+//+++          for the i-th rank of the parallel run
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "TimeStepping/TimeStepping.h"
+
+const char CheckpointMagic[8]={'A','S','F','E','M','C','H','K'};
+const int CheckpointVersion=3;
+
+string TimeStepping::getRankCheckpointFileName(const string &filename)const{
+    PetscMPIInt rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    if(size==1) return filename;
+    return filename+"."+to_string(rank);
+}
+
+void TimeStepping::saveCheckpoint(const string &filename,const int &lastiters,
+                                  SolutionSystem &solutionsystem,
+                                  const FEControlInfo &fectrlinfo,
+                                  const OutputSystem &output,
+                                  const Postprocessor &postprocess){
+    PetscMPIInt size;
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    const int nranks=size;
+    const int steppingtype=static_cast<int>(getTimeSteppingType());
+    const int pvddatasets=output.getPVDDataSetsNum();
+    const int csvrows=postprocess.getCSVRowsNum();
+
+    // the old checkpoint is only replaced after the new one is complete
+    string rankfilename=getRankCheckpointFileName(filename);
+    string tmpfilename=rankfilename+".tmp";
+    std::ofstream out;
+    out.open(tmpfilename,std::ios::out|std::ios::binary);
+    if(!out.is_open()){
+        MessagePrinter::printErrorTxt("can\'t create the checkpoint file(="+tmpfilename+"), please make sure you have the write permission");
+        MessagePrinter::exitAsFem();
+    }
+    out.write(CheckpointMagic,8);
+    out.write(reinterpret_cast<const char*>(&CheckpointVersion),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&nranks),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&steppingtype),sizeof(int));
+
+    out.write(reinterpret_cast<const char*>(&fectrlinfo.t),sizeof(double));
+    out.write(reinterpret_cast<const char*>(&fectrlinfo.dt),sizeof(double));
+    out.write(reinterpret_cast<const char*>(&fectrlinfo.dtold),sizeof(double));
+    out.write(reinterpret_cast<const char*>(&fectrlinfo.CurrentStep),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&m_err_old),sizeof(double));
+    out.write(reinterpret_cast<const char*>(&m_bdf_order),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&m_bdf_steps),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&lastiters),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&pvddatasets),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&csvrows),sizeof(int));
+
+    solutionsystem.writeCheckpoint(out);
+    if(isExplicitMethod()){
+        // the velocity of the central difference and G of IMEX-SBDF2 are not in the solution system
+        m_explicit.writeCheckpoint(out);
+    }
+    if(!out.good()){
+        MessagePrinter::printErrorTxt("failed to write the checkpoint file(="+tmpfilename+")");
+        MessagePrinter::exitAsFem();
+    }
+    out.close();
+    if(std::rename(tmpfilename.c_str(),rankfilename.c_str())!=0){
+        MessagePrinter::printErrorTxt("can\'t rename "+tmpfilename+" to "+rankfilename);
+        MessagePrinter::exitAsFem();
+    }
+
+    MessagePrinter::printDashLine(MessageColor::BLUE);
+    MessagePrinter::printNormalTxt("Save checkpoint to "+filename,MessageColor::BLUE);
+    MessagePrinter::printDashLine(MessageColor::BLUE);
+}
+
+bool TimeStepping::readRankCheckpoint(const string &filename,int &lastiters,int &pvddatasets,int &csvrows,
+                                      SolutionSystem &solutionsystem,
+                                      FEControlInfo &fectrlinfo){
+    PetscMPIInt size;
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    string rankfilename=getRankCheckpointFileName(filename);
+    std::ifstream in;
+    in.open(rankfilename,std::ios::in|std::ios::binary);
+    if(!in.is_open()){
+        MessagePrinter::printErrorTxt("can\'t open the checkpoint file(="+rankfilename+"), please make sure it exists");
+        return false;
+    }
+
+    char magic[8];
+    int version=-1,nranks=-1,steppingtype=-1;
+    in.read(magic,8);
+    in.read(reinterpret_cast<char*>(&version),sizeof(int));
+    if(!in.good()||string(magic,8)!=string(CheckpointMagic,8)||version!=CheckpointVersion){
+        MessagePrinter::printErrorTxt(rankfilename+" is not a valid checkpoint file of AsFem");
+        return false;
+    }
+    in.read(reinterpret_cast<char*>(&nranks),sizeof(int));
+    if(nranks!=size){
+        MessagePrinter::printErrorTxt("the checkpoint file is written by "+to_string(nranks)+" processors, please restart with the same number of processors");
+        return false;
+    }
+    in.read(reinterpret_cast<char*>(&steppingtype),sizeof(int));
+    if(steppingtype!=static_cast<int>(getTimeSteppingType())){
+        MessagePrinter::printErrorTxt("the time stepping method of the checkpoint file is different from your input file");
+        return false;
+    }
+
+    in.read(reinterpret_cast<char*>(&fectrlinfo.t),sizeof(double));
+    in.read(reinterpret_cast<char*>(&fectrlinfo.dt),sizeof(double));
+    in.read(reinterpret_cast<char*>(&fectrlinfo.dtold),sizeof(double));
+    in.read(reinterpret_cast<char*>(&fectrlinfo.CurrentStep),sizeof(int));
+    in.read(reinterpret_cast<char*>(&m_err_old),sizeof(double));
+    in.read(reinterpret_cast<char*>(&m_bdf_order),sizeof(int));
+    in.read(reinterpret_cast<char*>(&m_bdf_steps),sizeof(int));
+    in.read(reinterpret_cast<char*>(&lastiters),sizeof(int));
+    in.read(reinterpret_cast<char*>(&pvddatasets),sizeof(int));
+    in.read(reinterpret_cast<char*>(&csvrows),sizeof(int));
+
+    if(!solutionsystem.readCheckpoint(in)){
+        in.close();
+        return false;
+    }
+    if(isExplicitMethod()&&!m_explicit.readCheckpoint(in,solutionsystem)){
+        MessagePrinter::printErrorTxt("the explicit time integrator state of the checkpoint file is incomplete");
+        in.close();
+        return false;
+    }
+    in.close();
+    return true;
+}
+
+bool TimeStepping::loadCheckpoint(const string &filename,int &lastiters,
+                                  SolutionSystem &solutionsystem,
+                                  FEControlInfo &fectrlinfo,
+                                  OutputSystem &output,
+                                  Postprocessor &postprocess){
+    int pvddatasets=0,csvrows=0;
+    int IsSuccess=readRankCheckpoint(filename,lastiters,pvddatasets,csvrows,solutionsystem,fectrlinfo)?1:0;
+    // all the ranks must restart, otherwise the failed one returns while the others wait in the solver
+    MPI_Allreduce(MPI_IN_PLACE,&IsSuccess,1,MPI_INT,MPI_LAND,PETSC_COMM_WORLD);
+    if(!IsSuccess) return false;
+
+    // the results written after the checkpoint are removed from the pvd and csv files
+    output.restorePVDFile(pvddatasets);
+    if(postprocess.hasPostprocess()){
+        postprocess.restoreCSVFile(csvrows);
+    }
+
+    char buff[68];
+    snprintf(buff,68,"Restart from time=%13.5e, step=%8d",fectrlinfo.t,fectrlinfo.CurrentStep);
+    MessagePrinter::printDashLine(MessageColor::BLUE);
+    MessagePrinter::printNormalTxt("Load checkpoint from "+filename,MessageColor::BLUE);
+    MessagePrinter::printNormalTxt(string(buff),MessageColor::BLUE);
+    MessagePrinter::printDashLine(MessageColor::BLUE);
+    return true;
+}
@@ -0,0 +1,143 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: estimate the local truncation error of the implicit
+//+++          time integration by the difference between the
+//+++          converged solution and the polynomial extrapolation
+//+++          (milne's device), then the next dt is given by the
+//+++          PI step size controller
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "TimeStepping/TimeStepping.h"
+
+double TimeStepping::estimateLocalError(SolutionSystem &solutionsystem,const FEControlInfo &fectrlinfo)const{
+    // the order of the extrapolation equals the order of the time integration method
+    int order;
+    if(getTimeSteppingType()==TimeSteppingType::BDF){
+        // the variable order BDF uses the divided difference of its own history
+        double err=estimateBDFError(solutionsystem,fectrlinfo.t+fectrlinfo.dt,fectrlinfo.bdforder);
+        return err<0.0?0.0:err;
+    }
+    else if(getTimeSteppingType()==TimeSteppingType::BACKWARDEULER){
+        order=1;
+    }
+    else if(getTimeSteppingType()==TimeSteppingType::CRANCKNICOLSON||
+            getTimeSteppingType()==TimeSteppingType::BDF2){
+        order=2;
+    }
+    else{
+        return 0.0;
+    }
+    // not enough converged steps in the history for the extrapolation, then the step is accepted without any estimation
+    if(solutionsystem.getHistoryNum()<order+1) return 0.0;
+
+    // milne's device: LTE=C*(U-U_p), where C follows from the error constants of the integrator
+    // (the corrector) and of the extrapolation U_p (the predictor). U_p extrapolates the converged
+    // solutions, so its error has the extrapolation error of the exact solution plus the error
+    // increments d of the previous steps, these increments cancel only for the constant dt
+    const double h=fectrlinfo.dt;
+    const double h1=solutionsystem.getIthHistoryTime(1)-solutionsystem.getIthHistoryTime(2);
+    double C;
+    Vec E;
+    VecDuplicate(solutionsystem.m_u_current.getVectorRef(),&E);
+    if(order==1){
+        // U_p=Un+(h/h1)*(Un-Un-1), for backward euler (Un-Un-1)/h1 is exactly the velocity at t_n, so U_p is
+        // the forward euler step for any h1: U_p-u=-0.5*h^2*u'', U-u=0.5*h^2*u'', then C=0.5
+        VecCopy(solutionsystem.getIthHistory(2).getVectorRef(),E);
+        VecAXPBY(E,1.0+h/h1,-h/h1,solutionsystem.getIthHistory(1).getVectorRef());
+        C=0.5;
+    }
+    else{
+        // U_p is the lagrange polynomial through t_n, t_n-1 and t_n-2, it misses the exact solution by X*u''' and
+        // the error increments by d+(L1+L2)*d1+L2*d2 (d1 and d2 for the previous two steps), so C=LTE/(X+d+...)
+        const double h2=solutionsystem.getIthHistoryTime(2)-solutionsystem.getIthHistoryTime(3);
+        const double L0= (h+h1)*(h+h1+h2)/(h1*(h1+h2));
+        const double L1=-h*(h+h1+h2)/(h1*h2);
+        const double L2= h*(h+h1)/(h2*(h1+h2));
+        const double X=h*(h+h1)*(h+h1+h2)/6.0;
+        VecCopy(solutionsystem.getIthHistory(3).getVectorRef(),E);
+        VecAXPBYPCZ(E,L0,L1,L2,solutionsystem.getIthHistory(1).getVectorRef(),solutionsystem.getIthHistory(2).getVectorRef());
+        double lte,d,d1,d2;
+        if(getTimeSteppingType()==TimeSteppingType::CRANCKNICOLSON){
+            // LTE=h^3/12*u''' (the mid-point form has the same constant for the linear problems),
+            // CN is a one step method, so each increment is the LTE of its own step
+            lte=h*h*h/12.0;
+            d=lte;
+            d1=h1*h1*h1/12.0;
+            d2=h2*h2*h2/12.0;
+        }
+        else{
+            // the variable step BDF2 (w=h/h1) has LTE=h^2*(h+h1)^2/(6*(2h+h1))*u''', i.e. 2/9*h^3*u''' for the constant dt,
+            // and its increments follow d=LTE+w^2/(1+2w)*d1, the oldest one is taken as the constant dt value h2^3/3
+            auto bdf2LTE=[](const double &dt,const double &dtold){
+                return dt*dt*(dt+dtold)*(dt+dtold)/(6.0*(2.0*dt+dtold));
+            };
+            auto bdf2Ratio=[](const double &dt,const double &dtold){
+                return (dt/dtold)*(dt/dtold)/(1.0+2.0*dt/dtold);
+            };
+            lte=bdf2LTE(h,h1);
+            d2=h2*h2*h2/3.0;
+            d1=bdf2LTE(h1,h2)+bdf2Ratio(h1,h2)*d2;
+            d=lte+bdf2Ratio(h,h1)*d1;
+        }
+        // for the constant dt, X=h^3 and the increments cancel, then C=1/12 for CN and C=2/9 for BDF2
+        C=lte/(X+d+(L1+L2)*d1+L2*d2);
+    }
+    // E=C*(U-U_p)
+    VecAXPBY(E,C,-C,solutionsystem.m_u_current.getVectorRef());
+
+    double err=computeWeightedRMSNorm(E,solutionsystem.m_u_current.getVectorRef());
+    VecDestroy(&E);
+
+    return err;
+}
+
+double TimeStepping::computeWeightedRMSNorm(Vec &E,const Vec &U)const{
+    // the weighted rms norm, the weight is atol+rtol*|U|
+    Vec W;
+    VecDuplicate(U,&W);
+    VecCopy(U,W);
+    VecAbs(W);
+    VecScale(W,getErrorRelTolerance());
+    VecShift(W,getErrorAbsTolerance());
+    VecPointwiseDivide(E,E,W);
+    VecDestroy(&W);
+
+    int n;
+    double err;
+    VecGetSize(E,&n);
+    VecNorm(E,NORM_2,&err);
+    return err/sqrt(1.0*n);
+}
+
+double TimeStepping::computePIStepSize(const double &dt,const double &err)const{
+    int k;
+    if(getTimeSteppingType()==TimeSteppingType::BDF){
+        k=m_bdf_order+1;
+    }
+    else if(getTimeSteppingType()==TimeSteppingType::BACKWARDEULER){
+        k=2;
+    }
+    else{
+        k=3;
+    }
+    const double e=err>1.0e-10?err:1.0e-10;
+    const double eold=m_err_old>1.0e-10?m_err_old:1.0e-10;
+    // dt_new=dt*safety*(1/err)^(0.7/k)*(err_old)^(0.4/k)
+    double factor=getSafetyFactor()*pow(e,-0.7/k)*pow(eold,0.4/k);
+    if(factor<0.1) factor=0.1;
+    if(factor>getGrowthFactor()) factor=getGrowthFactor();
+
+    double dtnew=dt*factor;
+    if(dtnew>getMaxDt()) dtnew=getMaxDt();
+    if(dtnew<getMinDt()) dtnew=getMinDt();
+    return dtnew;
+}
@@ -0,0 +1,97 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group@CopyRight 2020-present
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2026.10.18
+//+++ Purpose: extrapolate the previous converged solutions to t+dt
+//+++          as the initial guess of the nonlinear solver, the
+//+++          variable dt is taken into account by the lagrange
+//+++          polynomial of the last 2 or 3 steps in the history
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "TimeStepping/TimeStepping.h"
+
+void TimeStepping::applyPredictor(Mesh &mesh,DofHandler &dofhandler,FE &fe,
+                                  ElmtSystem &elmtsystem,MateSystem &matesystem,
+                                  FESystem &fesystem,
+                                  BCSystem &bcsystem,
+                                  SolutionSystem &solutionsystem,
+                                  EquationSystem &equationsystem,
+                                  FEControlInfo &fectrlinfo,
+                                  NonlinearSolver &nlsolver){
+    // the order is reduced if there are not enough converged steps in the history
+    int order=getPredictorOrder();
+    if(order>solutionsystem.getHistoryNum()-1) order=solutionsystem.getHistoryNum()-1;
+    if(order<1) return;
+
+    char buff[68];
+    string str;
+    double rnorm_old,rnorm_pred;
+
+    // the previous solution is the reference guess, the residual of the accepted guess is reused by
+    // the newton solver, so the check costs one residual assembly instead of a failed nonlinear solve
+    solutionsystem.m_u_current.copyFrom(solutionsystem.m_u_old);
+    rnorm_old=nlsolver.computeGuessResidualNorm(mesh,dofhandler,fe,elmtsystem,matesystem,fesystem,
+                                                bcsystem,solutionsystem,equationsystem,fectrlinfo);
+
+    // the history is shared with the multi-step method, i=1 is the latest converged solution
+    const double h=fectrlinfo.dt;
+    const double h1=solutionsystem.getIthHistoryTime(1)-solutionsystem.getIthHistoryTime(2);
+    Vec &U=solutionsystem.m_u_current.getVectorRef();
+    if(order==1){
+        // U=Un+(h/h1)*(Un-Un-1)
+        solutionsystem.m_u_current.copyFrom(solutionsystem.getIthHistory(2));
+        VecAXPBY(U,1.0+h/h1,-h/h1,solutionsystem.getIthHistory(1).getVectorRef());
+    }
+    else{
+        // the lagrange polynomial through t_n, t_n-1 and t_n-2, evaluated at t_n+h
+        const double h2=solutionsystem.getIthHistoryTime(2)-solutionsystem.getIthHistoryTime(3);
+        const double L0= (h+h1)*(h+h1+h2)/(h1*(h1+h2));
+        const double L1=-h*(h+h1+h2)/(h1*h2);
+        const double L2= h*(h+h1)/(h2*(h1+h2));
+        solutionsystem.m_u_current.copyFrom(solutionsystem.getIthHistory(3));
+        VecAXPBYPCZ(U,L0,L1,L2,solutionsystem.getIthHistory(1).getVectorRef(),solutionsystem.getIthHistory(2).getVectorRef());
+    }
+    solutionsystem.m_u_current.assemble();
+    rnorm_pred=nlsolver.computeGuessResidualNorm(mesh,dofhandler,fe,elmtsystem,matesystem,fesystem,
+                                                 bcsystem,solutionsystem,equationsystem,fectrlinfo);
+
+    if(rnorm_pred>rnorm_old){
+        // the extrapolation makes things worse, then go back to the previous solution and its residual
+        solutionsystem.m_u_current.copyFrom(solutionsystem.m_u_old);
+        nlsolver.usePreviousGuessResidual();
+    }
+
+    if(fectrlinfo.IsDepDebug){
+        snprintf(buff,68,"  Predictor: order=%1d,|R0|=%12.5e,|Rp|=%12.5e,%s",order,rnorm_old,rnorm_pred,
+                 rnorm_pred>rnorm_old?"rejected":"accepted");
+        str=buff;
+        MessagePrinter::printNormalTxt(str);
+    }
+}
+
+int TimeStepping::getRequiredHistoryNum()const{
+    int n=0;
+    if(getTimeSteppingType()==TimeSteppingType::BDF){
+        // one more solution than the max order for the error estimation of order k+1
+        n=getBDFMaxOrder()+1;
+    }
+    else if(isAdaptive()&&isErrorControl()){
+        // the extrapolation of the error estimation has the same order as the time integration method
+        if(getTimeSteppingType()==TimeSteppingType::BACKWARDEULER){
+            n=2;
+        }
+        else if(getTimeSteppingType()==TimeSteppingType::CRANCKNICOLSON||
+                getTimeSteppingType()==TimeSteppingType::BDF2){
+            n=3;
+        }
+    }
+    if(getPredictorOrder()>0&&getPredictorOrder()+1>n) n=getPredictorOrder()+1;
+    return n;
+}
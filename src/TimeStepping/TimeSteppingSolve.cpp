@@ -30,13 +30,43 @@ bool TimeStepping::solve(Mesh &mesh,DofHandler &dofhandler,FE &fe,
     char buff[68];//77-12=65
     string str;
     int lastiters=1000;
+    double steptimer=0.0;
+    const double totaltimer=MPI_Wtime();
+    m_failed_steps=0;
+    m_errorrejected_steps=0;
+    m_rejected_iters=0;
+    m_rejected_time=0.0;
+    double err=0.0;
     fectrlinfo.dt=m_data.m_dt0;
+    fectrlinfo.dtold=m_data.m_dt0;
     fectrlinfo.CurrentStep=0;
+    fectrlinfo.m_timesteppingtype=getTimeSteppingType();
+    bool IsSuccess;
+    if(isExplicitMethod()){
+        // the stability limit of the explicit part is unknown, so dt is kept fixed
+        if(isAdaptive()){
+            MessagePrinter::printWarningTxt("adaptive time stepping is not supported by the explicit/IMEX method, the fixed dt will be used");
+            setAdaptiveFlag(false);
+        }
+        if(getPredictorOrder()>0){
+            MessagePrinter::printWarningTxt("the predictor is not used by the explicit/IMEX method");
+            setPredictorOrder(0);
+        }
+    }
 
     solutionsystem.m_u_current.setToZero();
     icsystem.applyInitialConditions(mesh,dofhandler,solutionsystem.m_u_current);
     solutionsystem.m_u_old.copyFrom(solutionsystem.m_u_current);
     solutionsystem.m_u_older.copyFrom(solutionsystem.m_u_current);
+    m_err_old=1.0;
+    // the converged solutions and their time are stored in the history buffer, which is
+    // shared by the variable order BDF, the predictor and the error estimation
+    solutionsystem.initHistory(getRequiredHistoryNum());
+    solutionsystem.pushHistory(solutionsystem.m_u_current,0.0);
+    if(getTimeSteppingType()==TimeSteppingType::BDF){
+        m_bdf_order=1;
+        m_bdf_steps=0;
+    }
 
     // initialize the material
     fesystem.formBulkFE(FECalcType::INITMATERIAL,fectrlinfo.t,fectrlinfo.dt,fectrlinfo.ctan,
@@ -48,35 +78,99 @@ bool TimeStepping::solve(Mesh &mesh,DofHandler &dofhandler,FE &fe,
     MessagePrinter::printDashLine();
     MessagePrinter::printNormalTxt("Material properties have been initialized");
     MessagePrinter::printDashLine();
+
+    if(getTimeSteppingType()==TimeSteppingType::CENTRALDIFFERENCE){
+        // the central difference is only conditionally stable, so dt is limited by the critical one
+        double dtcrit=m_explicit.estimateStableDt(mesh,solutionsystem);
+        if(fectrlinfo.dt>getCFLFactor()*dtcrit){
+            fectrlinfo.dt=getCFLFactor()*dtcrit;
+            fectrlinfo.dtold=fectrlinfo.dt;
+            snprintf(buff,68," dt is reduced to %13.5e by the critical dt",fectrlinfo.dt);
+            str=buff;
+            MessagePrinter::printWarningTxt(str);
+        }
+        m_explicit.setHRZLumpingFlag(isHRZLumping());
+        m_explicit.setLinearSolverOptions(nlsolver.getLinearSolverName(),nlsolver.getPCName(),
+                                          nlsolver.getKSPRestart(),nlsolver.getKSPMaxIters());
+    }
     
-    output.savePVDHead();
-    output.savePVDEnd();
-    output.saveResults2File(0,mesh,dofhandler,solutionsystem,projection);
-    output.savePVDResults(0.0);
-    MessagePrinter::printDashLine(MessageColor::BLUE);
-    MessagePrinter::printNormalTxt("Save results to "+output.getOutputFileName(),MessageColor::BLUE);
-    MessagePrinter::printDashLine(MessageColor::BLUE);
-    if(postprocess.hasPostprocess()){
-        postprocess.prepareCSVFileHeader();
-        postprocess.executePostprocess(mesh,dofhandler,fe,matesystem,projection,solutionsystem);
-        postprocess.savePPSResults2CSVFile(0.0);
+    fectrlinfo.t=0.0;
+    if(hasRestartFile()){
+        // the solution, the materials and the time info are overwritten by the checkpoint
+        if(!loadCheckpoint(m_restartfile_name,lastiters,solutionsystem,fectrlinfo,output,postprocess)){
+            m_explicit.releaseMemory();
+            return false;
+        }
+    }
+    else{
+        output.savePVDHead();
+        output.savePVDEnd();
+        output.saveResults2File(0,mesh,dofhandler,solutionsystem,projection);
+        output.savePVDResults(0.0);
         MessagePrinter::printDashLine(MessageColor::BLUE);
-        MessagePrinter::printNormalTxt("Save postprocess result to "+postprocess.getCSVFileName(),MessageColor::BLUE);
+        MessagePrinter::printNormalTxt("Save results to "+output.getOutputFileName(),MessageColor::BLUE);
         MessagePrinter::printDashLine(MessageColor::BLUE);
+        if(postprocess.hasPostprocess()){
+            postprocess.prepareCSVFileHeader();
+            postprocess.executePostprocess(mesh,dofhandler,fe,matesystem,projection,solutionsystem);
+            postprocess.savePPSResults2CSVFile(0.0);
+            MessagePrinter::printDashLine(MessageColor::BLUE);
+            MessagePrinter::printNormalTxt("Save postprocess result to "+postprocess.getCSVFileName(),MessageColor::BLUE);
+            MessagePrinter::printDashLine(MessageColor::BLUE);
+        }
     }
     MessagePrinter::printStars();
 
-    for(fectrlinfo.t=0.0;fectrlinfo.t<=m_data.m_finaltime;){
+    for(;fectrlinfo.t<=m_data.m_finaltime;){
         snprintf(buff,68,"Time=%13.5e, step=%8d, dt=%13.5e",fectrlinfo.t+fectrlinfo.dt,fectrlinfo.CurrentStep+1,fectrlinfo.dt);
         str=buff;
         MessagePrinter::printNormalTxt(str);
-        if(nlsolver.solve(mesh,dofhandler,fe,
-                          elmtsystem,matesystem,fesystem,
-                          bcsystem,solutionsystem,equationsystem,
-                          fectrlinfo)){
+        steptimer=MPI_Wtime();
+        if(getTimeSteppingType()==TimeSteppingType::BDF){
+            computeBDFCoefficients(solutionsystem,fectrlinfo);
+        }
+        if(getPredictorOrder()>0){
+            applyPredictor(mesh,dofhandler,fe,
+                           elmtsystem,matesystem,fesystem,
+                           bcsystem,solutionsystem,equationsystem,
+                           fectrlinfo,nlsolver);
+        }
+        if(isExplicitMethod()){
+            IsSuccess=m_explicit.step(mesh,dofhandler,fe,
+                                      elmtsystem,matesystem,fesystem,
+                                      bcsystem,solutionsystem,equationsystem,
+                                      fectrlinfo);
+        }
+        else{
+            IsSuccess=nlsolver.solve(mesh,dofhandler,fe,
+                                     elmtsystem,matesystem,fesystem,
+                                     bcsystem,solutionsystem,equationsystem,
+                                     fectrlinfo);
+        }
+        if(IsSuccess){
             // if the current nonlinear process success
+            if(isAdaptive()&&isErrorControl()){
+                err=estimateLocalError(solutionsystem,fectrlinfo);
+                if(err>1.0){
+                    // the local truncation error is too large, then the step is rejected and redone with smaller dt
+                    solutionsystem.rollbackSolution();
+                    recordRejectedStep(false,steptimer,isExplicitMethod()?0:nlsolver.getIterationNum());
+                    // the new dt is clamped to dtmin, so only the step already done with dtmin can't be refined
+                    if(fectrlinfo.dt<=getMinDt()){
+                        MessagePrinter::printErrorTxt("The minimum detal t is reached, however, the local truncation error is still too large. Please check your error tolerances");
+                        m_explicit.releaseMemory();
+                        return false;
+                    }
+                    fectrlinfo.dt=computePIStepSize(fectrlinfo.dt,err);
+                    snprintf(buff,68," Step rejected, err=%12.5e, reduce dt to %13.5e",err,fectrlinfo.dt);
+                    str=buff;
+                    MessagePrinter::printWarningTxt(str);
+                    continue;
+                }
+            }
             fectrlinfo.t+=fectrlinfo.dt;
             fectrlinfo.CurrentStep+=1;
+            fectrlinfo.dtold=fectrlinfo.dt;
 
             // update the material properties
             // update the solution
@@ -109,7 +203,11 @@ bool TimeStepping::solve(Mesh &mesh,DofHandler &dofhandler,FE &fe,
                 }
             }
             MessagePrinter::printStars();
-            if(isAdaptive()){
+            if(isAdaptive()&&isErrorControl()){
+                fectrlinfo.dt=computePIStepSize(fectrlinfo.dt,err);
+                m_err_old=err;
+            }
+            else if(isAdaptive()){
                 if(nlsolver.getIterationNum()<=getOptimizeIters() && lastiters<=getOptimizeIters()){
                     fectrlinfo.dt*=getGrowthFactor();
                     if(fectrlinfo.dt>getMaxDt()) fectrlinfo.dt=getMaxDt();
@@ -123,21 +221,32 @@ bool TimeStepping::solve(Mesh &mesh,DofHandler &dofhandler,FE &fe,
                     if(fectrlinfo.dt<getMinDt()) fectrlinfo.dt=getMinDt();
                 }
             }
+            if(getTimeSteppingType()==TimeSteppingType::BDF){
+                selectBDFOrder(solutionsystem,fectrlinfo.t);
+            }
+            solutionsystem.pushHistory(solutionsystem.m_u_current,fectrlinfo.t);
             // update the solution
-            solutionsystem.m_u_older.copyFrom(solutionsystem.m_u_old);
-            solutionsystem.m_u_old.copyFrom(solutionsystem.m_u_current);
+            solutionsystem.updateSolution();
             solutionsystem.m_v.setToZero();
             // store the previous step's iteration numbers
             lastiters=nlsolver.getIterationNum();
+
+            if(output.getCheckpointIntervalNum()>0&&fectrlinfo.CurrentStep%output.getCheckpointIntervalNum()==0){
+                saveCheckpoint(output.getCheckpointFileName(),lastiters,solutionsystem,fectrlinfo,output,postprocess);
+            }
         }
         else{
-            //  if the nonlinear solver failed we will try to reduce the dt
+            //  if the nonlinear solver failed we will try to reduce the dt, the diverged solution is thrown away
+            solutionsystem.rollbackSolution();
+            recordRejectedStep(true,steptimer,isExplicitMethod()?0:nlsolver.getIterationNum());
             fectrlinfo.dt*=getCutbackFactor();
             snprintf(buff,68," Transient solver failed, reduce dt to %13.5e",fectrlinfo.dt);
             str=buff;
             MessagePrinter::printWarningTxt(str);
             if(fectrlinfo.dt<getMinDt()){
                 MessagePrinter::printErrorTxt("The minimum detal t is reached, however, your solver still fails. Please check either your code or your boundary conditions");
+                printRejectedStepsInfo(MPI_Wtime()-totaltimer);
+                m_explicit.releaseMemory();
                 return false;
             }
         }
@@ -151,6 +260,8 @@ bool TimeStepping::solve(Mesh &mesh,DofHandler &dofhandler,FE &fe,
         MessagePrinter::printDashLine(MessageColor::BLUE);
         MessagePrinter::printStars();
     }
+    printRejectedStepsInfo(MPI_Wtime()-totaltimer);
+    m_explicit.releaseMemory();
     
     return true;
 }
\ No newline at end of file